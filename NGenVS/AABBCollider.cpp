@@ -121,134 +121,63 @@ void AABBCollider_GetScaledDimensions(struct ColliderData_AABB* dest, const stru
 //	srcCollider: A pointer to an AABB collider data set to be represented as a convex hull collider
 void AABBCollider_ToConvexHullCollider(struct ColliderData_ConvexHull* dest, const struct ColliderData_AABB* srcCollider)
 {
+	//The points and axes are copied into the convex hull
+	Vec3 point;
+
 	//Get points of AABB in modelSpace
 	//1) Right Bottom Front
-	Vector* point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-	
-	point->components[0] = srcCollider->width / 2.0f;
-	point->components[1] = srcCollider->height / -2.0f;
-	point->components[2] = srcCollider->depth / 2.0f;
-
-	Vector_Increment(point, srcCollider->centroid);
-
-	//Add to convex hull
-	ConvexHullCollider_AddPoint(dest, point);
+	Vec3_Set(&point, srcCollider->width / 2.0f, srcCollider->height / -2.0f, srcCollider->depth / 2.0f);
+	Vec3_Increment(&point, Vec3_FROM_VECTOR(srcCollider->centroid));
+	ConvexHullCollider_AddPoint(dest, &point);
 
-	//2) Righ bottom back
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-	
-	point->components[0] = srcCollider->width / 2.0f;
-	point->components[1] = srcCollider->height / -2.0f;
-	point->components[2] = srcCollider->depth / -2.0f;
-
-	Vector_Increment(point, srcCollider->centroid);
-
-	//Add to convex hull
-	ConvexHullCollider_AddPoint(dest, point);
+	//2) Right bottom back
+	Vec3_Set(&point, srcCollider->width / 2.0f, srcCollider->height / -2.0f, srcCollider->depth / -2.0f);
+	Vec3_Increment(&point, Vec3_FROM_VECTOR(srcCollider->centroid));
+	ConvexHullCollider_AddPoint(dest, &point);
 
 	//3) Left bottom back
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-	
-	point->components[0] = srcCollider->width / -2.0f;
-	point->components[1] = srcCollider->height / -2.0f;
-	point->components[2] = srcCollider->depth / -2.0f;
-
-	Vector_Increment(point, srcCollider->centroid);
-
-	//Add to convex hull
-	ConvexHullCollider_AddPoint(dest, point);
+	Vec3_Set(&point, srcCollider->width / -2.0f, srcCollider->height / -2.0f, srcCollider->depth / -2.0f);
+	Vec3_Increment(&point, Vec3_FROM_VECTOR(srcCollider->centroid));
+	ConvexHullCollider_AddPoint(dest, &point);
 
 	//4) Left bottom front
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-	
-	point->components[0] = srcCollider->width / -2.0f;
-	point->components[1] = srcCollider->height / -2.0f;
-	point->components[2] = srcCollider->depth / 2.0f;
-
-	Vector_Increment(point, srcCollider->centroid);
-
-	//Add to convex hull
-	ConvexHullCollider_AddPoint(dest, point);
+	Vec3_Set(&point, srcCollider->width / -2.0f, srcCollider->height / -2.0f, srcCollider->depth / 2.0f);
+	Vec3_Increment(&point, Vec3_FROM_VECTOR(srcCollider->centroid));
+	ConvexHullCollider_AddPoint(dest, &point);
 
 	//5) Right Top front
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-	
-	point->components[0] = srcCollider->width / 2.0f;
-	point->components[1] = srcCollider->height / 2.0f;
-	point->components[2] = srcCollider->depth / 2.0f;
-
-	Vector_Increment(point, srcCollider->centroid);
-
-	//Add to convex hull
-	ConvexHullCollider_AddPoint(dest, point);
+	Vec3_Set(&point, srcCollider->width / 2.0f, srcCollider->height / 2.0f, srcCollider->depth / 2.0f);
+	Vec3_Increment(&point, Vec3_FROM_VECTOR(srcCollider->centroid));
+	ConvexHullCollider_AddPoint(dest, &point);
 
 	//6) Right Top Back
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-	
-	point->components[0] = srcCollider->width / 2.0f;
-	point->components[1] = srcCollider->height / 2.0f;
-	point->components[2] = srcCollider->depth / -2.0f;
-
-	Vector_Increment(point, srcCollider->centroid);
-
-	//Add to convex hull
-	ConvexHullCollider_AddPoint(dest, point);
+	Vec3_Set(&point, srcCollider->width / 2.0f, srcCollider->height / 2.0f, srcCollider->depth / -2.0f);
+	Vec3_Increment(&point, Vec3_FROM_VECTOR(srcCollider->centroid));
+	ConvexHullCollider_AddPoint(dest, &point);
 
 	//7) Left Top Back
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-	
-	point->components[0] = srcCollider->width / -2.0f;
-	point->components[1] = srcCollider->height / 2.0f;
-	point->components[2] = srcCollider->depth / -2.0f;
-
-	Vector_Increment(point, srcCollider->centroid);
-
-	//Add to convex hull
-	ConvexHullCollider_AddPoint(dest, point);
+	Vec3_Set(&point, srcCollider->width / -2.0f, srcCollider->height / 2.0f, srcCollider->depth / -2.0f);
+	Vec3_Increment(&point, Vec3_FROM_VECTOR(srcCollider->centroid));
+	ConvexHullCollider_AddPoint(dest, &point);
 
 	//8) Left Top Front
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-	
-	point->components[0] = srcCollider->width / -2.0f;
-	point->components[1] = srcCollider->height / 2.0f;
-	point->components[2] = srcCollider->depth / 2.0f;
-
-	Vector_Increment(point, srcCollider->centroid);
-
-	//Add to convex hull
-	ConvexHullCollider_AddPoint(dest, point);
+	Vec3_Set(&point, srcCollider->width / -2.0f, srcCollider->height / 2.0f, srcCollider->depth / 2.0f);
+	Vec3_Increment(&point, Vec3_FROM_VECTOR(srcCollider->centroid));
+	ConvexHullCollider_AddPoint(dest, &point);
 
 
 	//Get axes of AABB
-	//Right/Left side
-	Vector* axis = Vector_Allocate();
-	Vector_Initialize(axis, 3);
+	Vec3 axis;
 
-	Vector_Copy(axis, &Vector_E1);
-
-	ConvexHullCollider_AddAxis(dest, axis);
+	//Right/Left side
+	Vec3_Set(&axis, 1.0f, 0.0f, 0.0f);
+	ConvexHullCollider_AddAxis(dest, &axis);
 
 	//Top/Bottom side
-	axis = Vector_Allocate();
-	Vector_Initialize(axis, 3);
-
-	Vector_Copy(axis, &Vector_E2);
-
-	ConvexHullCollider_AddAxis(dest, axis);
+	Vec3_Set(&axis, 0.0f, 1.0f, 0.0f);
+	ConvexHullCollider_AddAxis(dest, &axis);
 
 	//Front/Back side
-	axis = Vector_Allocate();
-	Vector_Initialize(axis, 3);
-
-	Vector_Copy(axis, &Vector_E3);
-	
-	ConvexHullCollider_AddAxis(dest, axis);
+	Vec3_Set(&axis, 0.0f, 0.0f, 1.0f);
+	ConvexHullCollider_AddAxis(dest, &axis);
 }
\ No newline at end of file
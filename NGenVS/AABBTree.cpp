@@ -0,0 +1,673 @@
+#include "AABBTree.h"
+
+#include <stdlib.h>
+
+#include "Hash.h"
+
+///
+//Allocates memory for a dynamic AABB tree
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized dynamic AABB tree
+AABBTree* AABBTree_Allocate(void)
+{
+	AABBTree* tree = (AABBTree*)malloc(sizeof(AABBTree));
+	return tree;
+}
+
+///
+//Initializes a dynamic AABB tree with no objects
+//
+//Parameters:
+//	tree: A pointer to the tree to initialize
+//	margin: Distance to enlarge the bounds of each object by on each side
+void AABBTree_Initialize(AABBTree* tree, float margin)
+{
+	tree->nodes = DynamicArray_Allocate();
+	DynamicArray_Initialize(tree->nodes, sizeof(AABBTree_Node));
+
+	tree->root = AABBTree_nullNode;
+	tree->freeList = AABBTree_nullNode;
+	tree->margin = margin;
+
+	tree->map = HashMap_Allocate();
+	HashMap_Initialize(tree->map, 16);
+	tree->map->Hash = Hash_Pointer;
+
+	tree->pairs = DynamicArray_Allocate();
+	DynamicArray_Initialize(tree->pairs, sizeof(AABBTree_Pair));
+
+	tree->stack = DynamicArray_Allocate();
+	DynamicArray_Initialize(tree->stack, sizeof(int));
+
+	tree->numReinserts = 0;
+}
+
+///
+//Frees the data allocated by a dynamic AABB tree.
+//Does not free any of the objects contained within the tree!
+//
+//Parameters:
+//	tree: A pointer to the tree to free
+void AABBTree_Free(AABBTree* tree)
+{
+	DynamicArray_Free(tree->nodes);
+	HashMap_Free(tree->map);
+	DynamicArray_Free(tree->pairs);
+	DynamicArray_Free(tree->stack);
+
+	free(tree);
+}
+
+///
+//Adds a game object to a dynamic AABB tree
+//
+//Parameters:
+//	tree: A pointer to the tree to add a game object to
+//	obj: A pointer to the game object to add (Must have collider attached)
+void AABBTree_Add(AABBTree* tree, GObject* obj)
+{
+	int leaf = AABBTree_AllocateNode(tree);
+	AABBTree_Node* node = (AABBTree_Node*)tree->nodes->data + leaf;
+	node->obj = obj;
+
+	float min[3], max[3];
+	AABBTree_GetObjectBounds(min, max, obj);
+	AABBTree_SetLeafBounds(tree, node, min, max);
+
+	AABBTree_InsertLeaf(tree, leaf);
+	HashMap_Add(tree->map, &obj, (void*)(size_t)leaf, sizeof(GObject*));
+}
+
+///
+//Removes a game object from a dynamic AABB tree
+//
+//Parameters:
+//	tree: A pointer to the tree to remove the game object from
+//	obj: A pointer to the game object to remove
+void AABBTree_Remove(AABBTree* tree, GObject* obj)
+{
+	int leaf = AABBTree_FindLeaf(tree, obj);
+	if(leaf == AABBTree_nullNode) return;
+
+	HashMap_Remove(tree->map, &obj, sizeof(GObject*));
+	AABBTree_RemoveLeaf(tree, leaf);
+	AABBTree_FreeNode(tree, leaf);
+}
+
+///
+//Refits the bounds of all game objects within a dynamic AABB tree and finds every pair of game objects whose bounds overlap.
+//Only objects which have moved outside of their enlarged bounds are reinserted.
+//
+//Parameters:
+//	tree: A pointer to the tree to update
+void AABBTree_Update(AABBTree* tree)
+{
+	tree->numReinserts = 0;
+
+	//Reinserting a leaf frees and takes back one branch, so the pool does not grow during this loop
+	for(int i = 0; i < (int)tree->nodes->size; i++)
+	{
+		AABBTree_Node* leaf = (AABBTree_Node*)tree->nodes->data + i;
+		if(leaf->height != 0) continue;
+
+		//Sleeping objects have not moved, so their bounds are still contained
+		if(leaf->obj->body != NULL && !leaf->obj->body->isAwake) continue;
+
+		float min[3], max[3];
+		AABBTree_GetObjectBounds(min, max, leaf->obj);
+
+		if(min[0] >= leaf->min[0] && min[1] >= leaf->min[1] && min[2] >= leaf->min[2] &&
+			max[0] <= leaf->max[0] && max[1] <= leaf->max[1] && max[2] <= leaf->max[2])
+		{
+			continue;
+		}
+
+		AABBTree_RemoveLeaf(tree, i);
+		AABBTree_SetLeafBounds(tree, leaf, min, max);
+		AABBTree_InsertLeaf(tree, i);
+		tree->numReinserts++;
+	}
+
+	DynamicArray_Clear(tree->pairs);
+	for(int i = 0; i < (int)tree->nodes->size; i++)
+	{
+		if(((AABBTree_Node*)tree->nodes->data)[i].height == 0)
+		{
+			AABBTree_FindPairs(tree, i);
+		}
+	}
+}
+
+///
+//Finds every game object in a dynamic AABB tree whose enlarged bounds overlap a box
+//
+//Parameters:
+//	tree: A pointer to the tree to query
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the overlapping game objects to
+void AABBTree_QueryBox(AABBTree* tree, const float* min, const float* max, DynamicArray* results)
+{
+	if(tree->root == AABBTree_nullNode) return;
+
+	AABBTree_Node* nodes = (AABBTree_Node*)tree->nodes->data;
+	DynamicArray* stack = tree->stack;
+	DynamicArray_Clear(stack);
+	DynamicArray_Append(stack, &tree->root);
+
+	while(stack->size > 0)
+	{
+		AABBTree_Node* node = nodes + ((int*)stack->data)[--stack->size];
+		if(!AABBTree_Overlaps(node, min, max)) continue;
+
+		if(node->height == 0)
+		{
+			DynamicArray_Append(results, &node->obj);
+		}
+		else
+		{
+			DynamicArray_Append(stack, node->children);
+			DynamicArray_Append(stack, node->children + 1);
+		}
+	}
+}
+
+///
+//Finds every game object in a dynamic AABB tree whose enlarged bounds are crossed by a ray
+//
+//Parameters:
+//	tree: A pointer to the tree to query
+//	origin: A pointer to a vector of dimension 3, the start of the ray
+//	direction: A pointer to a vector of dimension 3, the direction of the ray
+//	maxDistance: How far the ray extends, in multiples of the length of direction
+//	results: Dynamic array of GObject* to append the game objects crossed by the ray to
+void AABBTree_QueryRay(AABBTree* tree, const Vector* origin, const Vector* direction, float maxDistance, DynamicArray* results)
+{
+	if(tree->root == AABBTree_nullNode) return;
+
+	AABBTree_Node* nodes = (AABBTree_Node*)tree->nodes->data;
+	DynamicArray* stack = tree->stack;
+	DynamicArray_Clear(stack);
+	DynamicArray_Append(stack, &tree->root);
+
+	while(stack->size > 0)
+	{
+		AABBTree_Node* node = nodes + ((int*)stack->data)[--stack->size];
+		if(!AABBTree_RayCrosses(node, origin->components, direction->components, maxDistance)) continue;
+
+		if(node->height == 0)
+		{
+			DynamicArray_Append(results, &node->obj);
+		}
+		else
+		{
+			DynamicArray_Append(stack, node->children);
+			DynamicArray_Append(stack, node->children + 1);
+		}
+	}
+}
+
+///
+//Gets the height of a dynamic AABB tree
+//
+//Parameters:
+//	tree: A pointer to the tree
+//
+//Returns:
+//	The number of branches between the root and the deepest leaf, 0 if the tree is empty or the root is a leaf
+int AABBTree_GetHeight(AABBTree* tree)
+{
+	if(tree->root == AABBTree_nullNode) return 0;
+	return ((AABBTree_Node*)tree->nodes->data)[tree->root].height;
+}
+
+///
+//Takes an unused node from the pool of a tree, growing the pool if there are none
+//The node is initialized as a leaf with no object or parent.
+//
+//Parameters:
+//	tree: A pointer to the tree to take a node from
+//
+//Returns:
+//	The index of the node. Pointers into the node pool are invalid after this call.
+static int AABBTree_AllocateNode(AABBTree* tree)
+{
+	int index;
+	if(tree->freeList == AABBTree_nullNode)
+	{
+		AABBTree_Node unused;
+		index = tree->nodes->size;
+		DynamicArray_Append(tree->nodes, &unused);
+	}
+	else
+	{
+		index = tree->freeList;
+		tree->freeList = ((AABBTree_Node*)tree->nodes->data)[index].parent;
+	}
+
+	AABBTree_Node* node = (AABBTree_Node*)tree->nodes->data + index;
+	node->obj = NULL;
+	node->parent = AABBTree_nullNode;
+	node->children[0] = node->children[1] = AABBTree_nullNode;
+	node->height = 0;
+
+	return index;
+}
+
+///
+//Returns a node to the pool of a tree
+//
+//Parameters:
+//	tree: A pointer to the tree the node belongs to
+//	index: The index of the node to free
+static void AABBTree_FreeNode(AABBTree* tree, int index)
+{
+	AABBTree_Node* node = (AABBTree_Node*)tree->nodes->data + index;
+	node->obj = NULL;
+	node->parent = tree->freeList;
+	node->height = -1;
+	tree->freeList = index;
+}
+
+///
+//Gets the world space bounds of an object's collider
+//
+//Parameters:
+//	minDest: Array of 3 floats to store the minimum bound on each axis in
+//	maxDest: Array of 3 floats to store the maximum bound on each axis in
+//	obj: A pointer to the object to get the bounds of (Must have collider attached)
+static void AABBTree_GetObjectBounds(float* minDest, float* maxDest, GObject* obj)
+{
+	//If there is a rigidbody use that frame of reference, else use the objects
+	FrameOfReference* frame = obj->body != NULL ? obj->body->frame : obj->frameOfReference;
+
+	Collider_GetWorldBounds(minDest, maxDest, obj->collider, frame);
+}
+
+///
+//Sets the bounds of a leaf to the given bounds enlarged by the tree's margin on each side
+//
+//Parameters:
+//	tree: A pointer to the tree the leaf belongs to
+//	leaf: A pointer to the leaf to set the bounds of
+//	min: The minimum bound of the leaf's object on each axis
+//	max: The maximum bound of the leaf's object on each axis
+static void AABBTree_SetLeafBounds(AABBTree* tree, AABBTree_Node* leaf, const float* min, const float* max)
+{
+	for(int i = 0; i < 3; i++)
+	{
+		leaf->min[i] = min[i] - tree->margin;
+		leaf->max[i] = max[i] + tree->margin;
+	}
+}
+
+///
+//Inserts a leaf into a tree next to the node which grows the surface area of the tree the least,
+//Then refits and rebalances each of it's ancestors.
+//
+//Parameters:
+//	tree: A pointer to the tree to insert the leaf into
+//	leaf: The index of the leaf to insert
+static void AABBTree_InsertLeaf(AABBTree* tree, int leaf)
+{
+	if(tree->root == AABBTree_nullNode)
+	{
+		tree->root = leaf;
+		((AABBTree_Node*)tree->nodes->data)[leaf].parent = AABBTree_nullNode;
+		return;
+	}
+
+	//Descend towards the sibling which costs the least, stopping when making the current node the sibling is cheapest.
+	//Every ancestor of the new branch grows to contain the leaf, so the growth of each is inherited by the choices below it.
+	AABBTree_Node* nodes = (AABBTree_Node*)tree->nodes->data;
+	AABBTree_Node* leafNode = nodes + leaf;
+	int index = tree->root;
+	while(nodes[index].height > 0)
+	{
+		AABBTree_Node* node = nodes + index;
+
+		float area = AABBTree_GetArea(node);
+		float combinedArea = AABBTree_GetCombinedArea(node, leafNode);
+
+		//Cost of making a new parent for this node and the leaf
+		float cost = 2.0f * combinedArea;
+		//Minimum cost of pushing the leaf further down the tree
+		float inheritanceCost = 2.0f * (combinedArea - area);
+
+		float childCosts[2];
+		for(int i = 0; i < 2; i++)
+		{
+			AABBTree_Node* child = nodes + node->children[i];
+			childCosts[i] = AABBTree_GetCombinedArea(child, leafNode) + inheritanceCost;
+			if(child->height > 0)
+			{
+				childCosts[i] -= AABBTree_GetArea(child);
+			}
+		}
+
+		if(cost < childCosts[0] && cost < childCosts[1]) break;
+
+		index = childCosts[0] < childCosts[1] ? node->children[0] : node->children[1];
+	}
+	int sibling = index;
+
+	//Make a new parent for the sibling and the leaf
+	int newParent = AABBTree_AllocateNode(tree);
+	nodes = (AABBTree_Node*)tree->nodes->data;
+	int oldParent = nodes[sibling].parent;
+
+	nodes[newParent].parent = oldParent;
+	nodes[newParent].children[0] = sibling;
+	nodes[newParent].children[1] = leaf;
+	nodes[sibling].parent = newParent;
+	nodes[leaf].parent = newParent;
+
+	if(oldParent == AABBTree_nullNode)
+	{
+		tree->root = newParent;
+	}
+	else if(nodes[oldParent].children[0] == sibling)
+	{
+		nodes[oldParent].children[0] = newParent;
+	}
+	else
+	{
+		nodes[oldParent].children[1] = newParent;
+	}
+
+	//Walk back up the tree refitting and balancing each ancestor
+	index = newParent;
+	while(index != AABBTree_nullNode)
+	{
+		index = AABBTree_Balance(tree, index);
+		AABBTree_Refit(nodes, index);
+		index = nodes[index].parent;
+	}
+}
+
+///
+//Removes a leaf from a tree, replacing it's parent with it's sibling.
+//The leaf node itself is not freed.
+//
+//Parameters:
+//	tree: A pointer to the tree to remove the leaf from
+//	leaf: The index of the leaf to remove
+static void AABBTree_RemoveLeaf(AABBTree* tree, int leaf)
+{
+	if(tree->root == leaf)
+	{
+		tree->root = AABBTree_nullNode;
+		return;
+	}
+
+	AABBTree_Node* nodes = (AABBTree_Node*)tree->nodes->data;
+	int parent = nodes[leaf].parent;
+	int grandParent = nodes[parent].parent;
+	int sibling = nodes[parent].children[0] == leaf ? nodes[parent].children[1] : nodes[parent].children[0];
+
+	AABBTree_FreeNode(tree, parent);
+	nodes[sibling].parent = grandParent;
+
+	if(grandParent == AABBTree_nullNode)
+	{
+		tree->root = sibling;
+		return;
+	}
+
+	if(nodes[grandParent].children[0] == parent)
+	{
+		nodes[grandParent].children[0] = sibling;
+	}
+	else
+	{
+		nodes[grandParent].children[1] = sibling;
+	}
+
+	//Walk back up the tree refitting and balancing each ancestor
+	int index = grandParent;
+	while(index != AABBTree_nullNode)
+	{
+		index = AABBTree_Balance(tree, index);
+		AABBTree_Refit(nodes, index);
+		index = nodes[index].parent;
+	}
+}
+
+///
+//Performs a left or right rotation if the heights of a branch's children differ by more than one
+//
+//Parameters:
+//	tree: A pointer to the tree containing the branch
+//	index: The index of the branch to balance
+//
+//Returns:
+//	The index of the node which is now in the branch's place
+static int AABBTree_Balance(AABBTree* tree, int index)
+{
+	AABBTree_Node* nodes = (AABBTree_Node*)tree->nodes->data;
+	AABBTree_Node* A = nodes + index;
+	if(A->height < 2) return index;
+
+	//The child which is too tall is rotated up into A's place.
+	//A keeps the shorter child and takes the shorter grandchild, the taller grandchild stays with the rotated child.
+	int balance = nodes[A->children[1]].height - nodes[A->children[0]].height;
+	if(balance >= -1 && balance <= 1) return index;
+
+	int tall = balance > 1 ? 1 : 0;
+	int iB = A->children[tall];
+	AABBTree_Node* B = nodes + iB;
+
+	int iTallGrandChild = B->children[0];
+	int iShortGrandChild = B->children[1];
+	if(nodes[iTallGrandChild].height < nodes[iShortGrandChild].height)
+	{
+		iTallGrandChild = B->children[1];
+		iShortGrandChild = B->children[0];
+	}
+
+	//B takes A's place under A's parent
+	B->parent = A->parent;
+	if(B->parent == AABBTree_nullNode)
+	{
+		tree->root = iB;
+	}
+	else if(nodes[B->parent].children[0] == index)
+	{
+		nodes[B->parent].children[0] = iB;
+	}
+	else
+	{
+		nodes[B->parent].children[1] = iB;
+	}
+
+	//A becomes a child of B
+	B->children[0] = index;
+	B->children[1] = iTallGrandChild;
+	A->parent = iB;
+
+	//And the shorter grandchild replaces B under A
+	A->children[tall] = iShortGrandChild;
+	nodes[iShortGrandChild].parent = index;
+
+	AABBTree_Refit(nodes, index);
+	AABBTree_Refit(nodes, iB);
+
+	return iB;
+}
+
+///
+//Sets the bounds and height of a branch from it's two children
+//
+//Parameters:
+//	nodes: The node pool of the tree containing the branch
+//	index: The index of the branch to refit
+static void AABBTree_Refit(AABBTree_Node* nodes, int index)
+{
+	AABBTree_Node* node = nodes + index;
+	AABBTree_Node* child1 = nodes + node->children[0];
+	AABBTree_Node* child2 = nodes + node->children[1];
+
+	for(int i = 0; i < 3; i++)
+	{
+		node->min[i] = child1->min[i] < child2->min[i] ? child1->min[i] : child2->min[i];
+		node->max[i] = child1->max[i] > child2->max[i] ? child1->max[i] : child2->max[i];
+	}
+	node->height = 1 + (child1->height > child2->height ? child1->height : child2->height);
+}
+
+///
+//Finds the leaf bounding an object in a tree through the tree's map
+//
+//Parameters:
+//	tree: A pointer to the tree to search
+//	obj: A pointer to the object to find the leaf of
+//
+//Returns:
+//	The index of the object's leaf, or AABBTree_nullNode if the object is not in the tree
+static int AABBTree_FindLeaf(AABBTree* tree, GObject* obj)
+{
+	//Reinserting a leaf and rotating branches relink nodes without moving them in the pool, so the index stays valid
+	struct HashMap_KeyValuePair* pair = HashMap_LookUp(tree->map, &obj, sizeof(GObject*));
+	if(pair == NULL)
+	{
+		return AABBTree_nullNode;
+	}
+	return (int)(size_t)pair->data;
+}
+
+///
+//Appends to a tree's pairs every leaf whose bounds overlap the bounds of the given leaf.
+//Only leaves with a greater index are paired so each pair is found once.
+//
+//Parameters:
+//	tree: A pointer to the tree containing the leaf
+//	leaf: The index of the leaf to find the pairs of
+static void AABBTree_FindPairs(AABBTree* tree, int leaf)
+{
+	AABBTree_Node* nodes = (AABBTree_Node*)tree->nodes->data;
+	AABBTree_Node* leafNode = nodes + leaf;
+	DynamicArray* stack = tree->stack;
+	DynamicArray_Clear(stack);
+	DynamicArray_Append(stack, &tree->root);
+
+	AABBTree_Pair pair;
+	pair.obj1 = leafNode->obj;
+	while(stack->size > 0)
+	{
+		int index = ((int*)stack->data)[--stack->size];
+		AABBTree_Node* node = nodes + index;
+		if(!AABBTree_Overlaps(node, leafNode->min, leafNode->max)) continue;
+
+		if(node->height == 0)
+		{
+			if(index > leaf)
+			{
+				pair.obj2 = node->obj;
+				DynamicArray_Append(tree->pairs, &pair);
+			}
+		}
+		else
+		{
+			DynamicArray_Append(stack, node->children);
+			DynamicArray_Append(stack, node->children + 1);
+		}
+	}
+}
+
+///
+//Determines if a node's bounds overlap a box
+//
+//Parameters:
+//	node: A pointer to the node to test
+//	min: The minimum bound of the box on each axis
+//	max: The maximum bound of the box on each axis
+//
+//Returns:
+//	1 if the bounds overlap, else 0
+static unsigned char AABBTree_Overlaps(const AABBTree_Node* node, const float* min, const float* max)
+{
+	return node->min[0] <= max[0] && node->max[0] >= min[0] &&
+		node->min[1] <= max[1] && node->max[1] >= min[1] &&
+		node->min[2] <= max[2] && node->max[2] >= min[2];
+}
+
+///
+//Determines if a ray crosses a node's bounds using the slab test
+//
+//Parameters:
+//	node: A pointer to the node to test
+//	origin: The start of the ray
+//	direction: The direction of the ray
+//	maxDistance: How far the ray extends, in multiples of the length of direction
+//
+//Returns:
+//	1 if the ray crosses the bounds, else 0
+static unsigned char AABBTree_RayCrosses(const AABBTree_Node* node, const float* origin, const float* direction, float maxDistance)
+{
+	//The range of distances along the ray which lie within the slabs tested so far
+	float enter = 0.0f;
+	float exit = maxDistance;
+
+	for(int i = 0; i < 3; i++)
+	{
+		if(direction[i] == 0.0f)
+		{
+			//Parallel to the slab, so the ray is either always or never within it
+			if(origin[i] < node->min[i] || origin[i] > node->max[i]) return 0;
+			continue;
+		}
+
+		float inverse = 1.0f / direction[i];
+		float slabEnter = (node->min[i] - origin[i]) * inverse;
+		float slabExit = (node->max[i] - origin[i]) * inverse;
+		if(slabEnter > slabExit)
+		{
+			float temp = slabEnter;
+			slabEnter = slabExit;
+			slabExit = temp;
+		}
+
+		if(slabEnter > enter) enter = slabEnter;
+		if(slabExit < exit) exit = slabExit;
+		if(enter > exit) return 0;
+	}
+	return 1;
+}
+
+///
+//Computes the surface area of the bounds which enclose two nodes
+//
+//Parameters:
+//	node1: A pointer to the first node
+//	node2: A pointer to the second node
+//
+//Returns:
+//	The surface area of the combined bounds
+static float AABBTree_GetCombinedArea(const AABBTree_Node* node1, const AABBTree_Node* node2)
+{
+	float dimensions[3];
+	for(int i = 0; i < 3; i++)
+	{
+		float min = node1->min[i] < node2->min[i] ? node1->min[i] : node2->min[i];
+		float max = node1->max[i] > node2->max[i] ? node1->max[i] : node2->max[i];
+		dimensions[i] = max - min;
+	}
+	return 2.0f * (dimensions[0] * dimensions[1] + dimensions[1] * dimensions[2] + dimensions[2] * dimensions[0]);
+}
+
+///
+//Computes the surface area of a node's bounds
+//
+//Parameters:
+//	node: A pointer to the node
+//
+//Returns:
+//	The surface area of the node's bounds
+static float AABBTree_GetArea(const AABBTree_Node* node)
+{
+	float width = node->max[0] - node->min[0];
+	float height = node->max[1] - node->min[1];
+	float depth = node->max[2] - node->min[2];
+	return 2.0f * (width * height + height * depth + depth * width);
+}
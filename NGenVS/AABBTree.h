@@ -0,0 +1,271 @@
+#ifndef AABBTREE_H
+#define AABBTREE_H
+
+#include "GObject.h"		//The data the tree will contain
+#include "DynamicArray.h"
+#include "HashMap.h"
+
+//A node of a dynamic AABB tree, either a leaf bounding one object or a branch bounding two children.
+//Nodes refer to each other by index into the tree's node pool, so the pool can grow without invalidating links.
+typedef struct AABBTree_Node
+{
+	float min[3];			//Minimum bound on each axis, a leaf's bounds are enlarged by the tree's margin
+	float max[3];			//Maximum bound on each axis
+
+	GObject* obj;			//The object bounded by a leaf, NULL for branches
+	int parent;				//Index of the parent node, or of the next free node while this node is unused
+	int children[2];		//Indices of the children of a branch, AABBTree_nullNode for leaves
+	int height;				//Leaves have a height of 0, a branch is one higher than it's highest child, and unused nodes are -1
+} AABBTree_Node;
+
+//Two objects whose enlarged bounds overlap
+typedef struct AABBTree_Pair
+{
+	GObject* obj1;
+	GObject* obj2;
+} AABBTree_Pair;
+
+typedef struct AABBTree
+{
+	DynamicArray* nodes;		//Pool of every node, used or free
+	int root;					//Index of the root node, AABBTree_nullNode when the tree is empty
+	int freeList;				//Index of the first unused node in the pool, AABBTree_nullNode if there are none
+	HashMap* map;				//Maps each object to the index of it's leaf, which keeps it's index until the object is removed
+
+	float margin;				//Distance a leaf's bounds are enlarged by on each side.
+								//Objects moving less than this between frames do not need to be reinserted.
+
+	DynamicArray* pairs;		//The pairs of objects with overlapping bounds found by the last update
+	DynamicArray* stack;		//Indices of the nodes left to visit during a traversal
+
+	unsigned int numReinserts;	//The number of leaves which moved out of their enlarged bounds during the last update
+} AABBTree;
+
+//Internal members
+static const int AABBTree_nullNode = -1;			//Index used for the absence of a node
+static const float AABBTree_defaultMargin = 0.1f;	//Margin a tree is initialized with
+
+//Internal functions
+
+///
+//Takes an unused node from the pool of a tree, growing the pool if there are none
+//The node is initialized as a leaf with no object or parent.
+//
+//Parameters:
+//	tree: A pointer to the tree to take a node from
+//
+//Returns:
+//	The index of the node. Pointers into the node pool are invalid after this call.
+static int AABBTree_AllocateNode(AABBTree* tree);
+
+///
+//Returns a node to the pool of a tree
+//
+//Parameters:
+//	tree: A pointer to the tree the node belongs to
+//	index: The index of the node to free
+static void AABBTree_FreeNode(AABBTree* tree, int index);
+
+///
+//Gets the world space bounds of an object's collider
+//
+//Parameters:
+//	minDest: Array of 3 floats to store the minimum bound on each axis in
+//	maxDest: Array of 3 floats to store the maximum bound on each axis in
+//	obj: A pointer to the object to get the bounds of (Must have collider attached)
+static void AABBTree_GetObjectBounds(float* minDest, float* maxDest, GObject* obj);
+
+///
+//Sets the bounds of a leaf to the given bounds enlarged by the tree's margin on each side
+//
+//Parameters:
+//	tree: A pointer to the tree the leaf belongs to
+//	leaf: A pointer to the leaf to set the bounds of
+//	min: The minimum bound of the leaf's object on each axis
+//	max: The maximum bound of the leaf's object on each axis
+static void AABBTree_SetLeafBounds(AABBTree* tree, AABBTree_Node* leaf, const float* min, const float* max);
+
+///
+//Inserts a leaf into a tree next to the node which grows the surface area of the tree the least,
+//Then refits and rebalances each of it's ancestors.
+//
+//Parameters:
+//	tree: A pointer to the tree to insert the leaf into
+//	leaf: The index of the leaf to insert
+static void AABBTree_InsertLeaf(AABBTree* tree, int leaf);
+
+///
+//Removes a leaf from a tree, replacing it's parent with it's sibling.
+//The leaf node itself is not freed.
+//
+//Parameters:
+//	tree: A pointer to the tree to remove the leaf from
+//	leaf: The index of the leaf to remove
+static void AABBTree_RemoveLeaf(AABBTree* tree, int leaf);
+
+///
+//Performs a left or right rotation if the heights of a branch's children differ by more than one
+//
+//Parameters:
+//	tree: A pointer to the tree containing the branch
+//	index: The index of the branch to balance
+//
+//Returns:
+//	The index of the node which is now in the branch's place
+static int AABBTree_Balance(AABBTree* tree, int index);
+
+///
+//Sets the bounds and height of a branch from it's two children
+//
+//Parameters:
+//	nodes: The node pool of the tree containing the branch
+//	index: The index of the branch to refit
+static void AABBTree_Refit(AABBTree_Node* nodes, int index);
+
+///
+//Finds the leaf bounding an object in a tree through the tree's map
+//
+//Parameters:
+//	tree: A pointer to the tree to search
+//	obj: A pointer to the object to find the leaf of
+//
+//Returns:
+//	The index of the object's leaf, or AABBTree_nullNode if the object is not in the tree
+static int AABBTree_FindLeaf(AABBTree* tree, GObject* obj);
+
+///
+//Appends to a tree's pairs every leaf whose bounds overlap the bounds of the given leaf.
+//Only leaves with a greater index are paired so each pair is found once.
+//
+//Parameters:
+//	tree: A pointer to the tree containing the leaf
+//	leaf: The index of the leaf to find the pairs of
+static void AABBTree_FindPairs(AABBTree* tree, int leaf);
+
+///
+//Determines if a node's bounds overlap a box
+//
+//Parameters:
+//	node: A pointer to the node to test
+//	min: The minimum bound of the box on each axis
+//	max: The maximum bound of the box on each axis
+//
+//Returns:
+//	1 if the bounds overlap, else 0
+static unsigned char AABBTree_Overlaps(const AABBTree_Node* node, const float* min, const float* max);
+
+///
+//Determines if a ray crosses a node's bounds using the slab test
+//
+//Parameters:
+//	node: A pointer to the node to test
+//	origin: The start of the ray
+//	direction: The direction of the ray
+//	maxDistance: How far the ray extends, in multiples of the length of direction
+//
+//Returns:
+//	1 if the ray crosses the bounds, else 0
+static unsigned char AABBTree_RayCrosses(const AABBTree_Node* node, const float* origin, const float* direction, float maxDistance);
+
+///
+//Computes the surface area of the bounds which enclose two nodes
+//
+//Parameters:
+//	node1: A pointer to the first node
+//	node2: A pointer to the second node
+//
+//Returns:
+//	The surface area of the combined bounds
+static float AABBTree_GetCombinedArea(const AABBTree_Node* node1, const AABBTree_Node* node2);
+
+///
+//Computes the surface area of a node's bounds
+//
+//Parameters:
+//	node: A pointer to the node
+//
+//Returns:
+//	The surface area of the node's bounds
+static float AABBTree_GetArea(const AABBTree_Node* node);
+
+//Functions
+
+///
+//Allocates memory for a dynamic AABB tree
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized dynamic AABB tree
+AABBTree* AABBTree_Allocate(void);
+
+///
+//Initializes a dynamic AABB tree with no objects
+//
+//Parameters:
+//	tree: A pointer to the tree to initialize
+//	margin: Distance to enlarge the bounds of each object by on each side
+void AABBTree_Initialize(AABBTree* tree, float margin);
+
+///
+//Frees the data allocated by a dynamic AABB tree.
+//Does not free any of the objects contained within the tree!
+//
+//Parameters:
+//	tree: A pointer to the tree to free
+void AABBTree_Free(AABBTree* tree);
+
+///
+//Adds a game object to a dynamic AABB tree
+//
+//Parameters:
+//	tree: A pointer to the tree to add a game object to
+//	obj: A pointer to the game object to add (Must have collider attached)
+void AABBTree_Add(AABBTree* tree, GObject* obj);
+
+///
+//Removes a game object from a dynamic AABB tree
+//
+//Parameters:
+//	tree: A pointer to the tree to remove the game object from
+//	obj: A pointer to the game object to remove
+void AABBTree_Remove(AABBTree* tree, GObject* obj);
+
+///
+//Refits the bounds of all game objects within a dynamic AABB tree and finds every pair of game objects whose bounds overlap.
+//Only objects which have moved outside of their enlarged bounds are reinserted.
+//
+//Parameters:
+//	tree: A pointer to the tree to update
+void AABBTree_Update(AABBTree* tree);
+
+///
+//Finds every game object in a dynamic AABB tree whose enlarged bounds overlap a box
+//
+//Parameters:
+//	tree: A pointer to the tree to query
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the overlapping game objects to
+void AABBTree_QueryBox(AABBTree* tree, const float* min, const float* max, DynamicArray* results);
+
+///
+//Finds every game object in a dynamic AABB tree whose enlarged bounds are crossed by a ray
+//
+//Parameters:
+//	tree: A pointer to the tree to query
+//	origin: A pointer to a vector of dimension 3, the start of the ray
+//	direction: A pointer to a vector of dimension 3, the direction of the ray
+//	maxDistance: How far the ray extends, in multiples of the length of direction
+//	results: Dynamic array of GObject* to append the game objects crossed by the ray to
+void AABBTree_QueryRay(AABBTree* tree, const Vector* origin, const Vector* direction, float maxDistance, DynamicArray* results);
+
+///
+//Gets the height of a dynamic AABB tree
+//
+//Parameters:
+//	tree: A pointer to the tree
+//
+//Returns:
+//	The number of branches between the root and the deepest leaf, 0 if the tree is empty or the root is a leaf
+int AABBTree_GetHeight(AABBTree* tree);
+
+#endif
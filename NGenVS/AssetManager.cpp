@@ -179,10 +179,10 @@ static void AssetManager_FreeBuffer(AssetBuffer* buffer)
 	for (int i = 0; i < buffer->meshMap->data->capacity; i++)
 	{
 		//Mesh_Free((Mesh*)buffer->meshMap->data[i]->data);
-		Mesh* m = *(Mesh**)DynamicArray_Index(buffer->meshMap->data, i);
-		if(m != NULL)
+		struct HashMap_KeyValuePair* pair = (struct HashMap_KeyValuePair*)DynamicArray_Index(buffer->meshMap->data, i);
+		if(pair->probeLength != 0)
 		{
-			Mesh_Free(m);
+			Mesh_Free((Mesh*)pair->data);
 		}
 	}
 	HashMap_Free(buffer->meshMap);
@@ -191,10 +191,10 @@ static void AssetManager_FreeBuffer(AssetBuffer* buffer)
 	for (int i = 0; i < buffer->textureMap->data->capacity; i++)
 	{
 		//Texture_Free((Texture*)buffer->meshMap->data[i]->data);
-		Texture* t = *(Texture**)DynamicArray_Index(buffer->textureMap->data, i);
-		if(t != NULL)
+		struct HashMap_KeyValuePair* pair = (struct HashMap_KeyValuePair*)DynamicArray_Index(buffer->textureMap->data, i);
+		if(pair->probeLength != 0)
 		{
-			Texture_Free(t);
+			Texture_Free((Texture*)pair->data);
 		}
 	}
 
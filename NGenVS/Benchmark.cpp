@@ -0,0 +1,1676 @@
+#include "Benchmark.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef _DEBUG
+#include <crtdbg.h>
+#endif
+
+#include "ObjectManager.h"
+#include "Hash.h"
+#include "PhysicsManager.h"
+#include "SIMDMath.h"
+
+#ifdef _DEBUG
+///
+//Debug CRT allocation hook which counts every allocation and reallocation
+//
+//Parameters:
+//	allocType: The type of heap operation (_HOOK_ALLOC, _HOOK_REALLOC, _HOOK_FREE)
+//	All other parameters are ignored
+//
+//Returns:
+//	1 so the heap operation always proceeds
+static int Benchmark_AllocationHook(int allocType, void* userData, size_t size, int blockType, long requestNumber, const unsigned char* filename, int lineNumber)
+{
+	if(benchmarkCountingAllocations && (allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC))
+	{
+		benchmarkAllocationCount++;
+	}
+	return 1;
+}
+#endif
+
+///
+//The general scalar dot product loop which Vector_DotProductArray used for every dimension
+//
+//Parameters:
+//	vec1: The first vector being dotted
+//	vec2: The other vector being dotted
+//	dim: The dimension of the vectors
+//
+//Returns:
+//	Float representing value of the dot product
+__declspec(noinline) static float Benchmark_DotProductLoop(const float* vec1, const float* vec2, const int dim)
+{
+	float dotProd = 0.0f;
+
+	for (int i = 0; i < dim; i++)
+		dotProd += (vec1[i] * vec2[i]);
+
+	return dotProd;
+}
+
+///
+//The general scalar addition loop which Vector_AddArray used for every dimension
+//
+//Parameters:
+//	dest: The destination of the sum
+//	vec1: The first addend
+//	vec2: The second addend
+//	dim: The dimension of the vectors
+__declspec(noinline) static void Benchmark_AddLoop(float* dest, const float* vec1, const float* vec2, const int dim)
+{
+	for (int row = 0; row < dim; row++)
+	{
+		dest[row] = vec1[row] + vec2[row];
+	}
+}
+
+///
+//The general scalar product loop which Matrix_GetProductMatrixArray used for every size
+//
+//Parameters:
+//	dest: The destination of the product
+//	LHSMatrix: The left hand side matrix
+//	RHSMatrix: The right hand side matrix
+//	dim: The number of rows and columns in each matrix
+__declspec(noinline) static void Benchmark_GetProductMatrixLoop(float* dest, const float* LHSMatrix, const float* RHSMatrix, const int dim)
+{
+	for (int rows = 0; rows < dim; rows++)
+	{
+		for (int cols = 0; cols < dim; cols++)
+		{
+			dest[rows * dim + cols] = 0.0f;
+			for (int dot = 0; dot < dim; dot++)
+			{
+				float increment = LHSMatrix[rows * dim + dot] * RHSMatrix[dot * dim + cols];
+				dest[rows * dim + cols] += increment;
+			}
+		}
+	}
+}
+
+///
+//The general scalar transformation which Matrix_TransformVectorArray used for every size,
+//Including it's heap allocated copy of the vector
+//
+//Parameters:
+//	LHSMatrix: The matrix
+//	RHSVector: The vector being transformed
+//	dim: The number of rows and columns in the matrix
+__declspec(noinline) static void Benchmark_TransformVectorLoop(const float* LHSMatrix, float* RHSVector, const int dim)
+{
+	float* RHSCopy = (float*)malloc(sizeof(float)* dim);
+	memcpy(RHSCopy, RHSVector, sizeof(float) * dim);
+
+	for (int row = 0; row < dim; row++)
+	{
+		RHSVector[row] = 0;
+		for (int col = 0; col < dim; col++)
+		{
+			RHSVector[row] += LHSMatrix[row * dim + col] * RHSCopy[col];
+		}
+	}
+
+	free(RHSCopy);
+}
+
+///
+//The per body loop which PhysicsManager_UpdateLinearPhysicsOfBodies used before SIMDMath_IntegrateLinear,
+//Branching over each inactive body and integrating the others one component at a time
+//
+//Parameters:
+//	positions: The position of each body
+//	velocities: The velocity of each body
+//	accelerations: The destination of the acceleration of each body
+//	netImpulses: The net impulse of each body, scaled by the body's inverse mass
+//	netForces: The net force of each body
+//	inverseMasses: The inverse mass of each body
+//	active: 1 if the body is integrated, 0 if it is left as it is
+//	numBodies: The number of bodies to integrate
+//	dt: The time step
+__declspec(noinline) static void Benchmark_IntegrateLinearLoop(Vec3* positions, Vec3* velocities, Vec3* accelerations, Vec3* netImpulses, const Vec3* netForces, const float* inverseMasses, const unsigned char* active, unsigned int numBodies, float dt)
+{
+	for(unsigned int i = 0; i < numBodies; i++)
+	{
+		if(!active[i])
+		{
+			continue;
+		}
+
+		float inverseMass = inverseMasses[i];
+		for(int j = 0; j < 3; j++)
+		{
+			accelerations[i].components[j] = netForces[i].components[j] * inverseMass;
+			netImpulses[i].components[j] *= inverseMass;
+
+			float VT = velocities[i].components[j] * dt;
+			float AT = accelerations[i].components[j] * dt;
+
+			positions[i].components[j] += AT * dt * 0.5f + VT;
+			velocities[i].components[j] += AT;
+			velocities[i].components[j] += netImpulses[i].components[j];
+		}
+	}
+}
+
+///
+//The per body loop which PhysicsManager_UpdateRotationalPhysicsOfBodies used before SIMDMath_IntegrateAngular,
+//Branching over each inactive body and integrating the others through the Mat3, Vec3 and Quat functions
+//
+//Parameters:
+//	orientations: The orientation of each body
+//	rotationsOutOfDate: Set to 1 for each body which is integrated
+//	angularVelocities: The angular velocity of each body
+//	angularAccelerations: The destination of the angular acceleration of each body
+//	netInstantaneousTorques: The net instantaneous torque of each body, transformed by the body's inverse inertia
+//	netTorques: The net torque of each body
+//	inverseInertias: The inverse inertia of each body
+//	active: 1 if the body is integrated, 0 if it is left as it is
+//	numBodies: The number of bodies to integrate
+//	dt: The time step
+__declspec(noinline) static void Benchmark_IntegrateAngularLoop(Quat* orientations, unsigned char* rotationsOutOfDate, Vec3* angularVelocities, Vec3* angularAccelerations, Vec3* netInstantaneousTorques, const Vec3* netTorques, const Mat3* inverseInertias, const unsigned char* active, unsigned int numBodies, float dt)
+{
+	for(unsigned int i = 0; i < numBodies; i++)
+	{
+		if(!active[i])
+		{
+			continue;
+		}
+
+		Mat3_GetProductVec3(angularAccelerations + i, inverseInertias + i, netTorques + i);
+		Mat3_TransformVec3(inverseInertias + i, netInstantaneousTorques + i);
+
+		Vec3 AT;
+		Vec3_GetScalarProduct(&AT, angularAccelerations + i, dt);
+		Vec3_Increment(angularVelocities + i, &AT);
+		Vec3_Increment(angularVelocities + i, netInstantaneousTorques + i);
+
+		Quat_Integrate(orientations + i, angularVelocities + i, dt);
+		rotationsOutOfDate[i] = 1;
+	}
+}
+
+///
+//Prints the timings of a math kernel against the loop it replaces
+//And the number of floats in which their results differ
+//
+//Parameters:
+//	name: The name of the kernel
+//	loopSeconds: The seconds spent in the general loop
+//	kernelSeconds: The seconds spent in the kernel
+//	numCalls: The number of times each was called
+//	results: The results of the general loop
+//	kernelResults: The results of the kernel
+//	numResults: The number of floats in each set of results
+static void Benchmark_PrintKernelResult(const char* name, double loopSeconds, double kernelSeconds, unsigned long numCalls, const float* results, const float* kernelResults, unsigned int numResults)
+{
+	//Compare bit patterns, so even a differently signed zero counts as a mismatch
+	unsigned int mismatches = 0;
+	for(unsigned int i = 0; i < numResults; i++)
+	{
+		if(memcmp(results + i, kernelResults + i, sizeof(float)) != 0)
+		{
+			mismatches++;
+		}
+	}
+
+	printf("\t%s: loop %f ns, kernel %f ns, %fx faster, %u mismatched floats\n",
+		name,
+		(loopSeconds * 1000000000.0) / numCalls,
+		(kernelSeconds * 1000000000.0) / numCalls,
+		loopSeconds / kernelSeconds,
+		mismatches);
+}
+
+///
+//Runs the narrow phase test on every pair of objects which share a leaf of an oct tree node
+//
+//Parameters:
+//	node: The oct tree node to test the leaves of
+//	collision: The collision to store the results of each test in
+//
+//Returns:
+//	The number of pairs which were tested
+static unsigned long Benchmark_TestOctTreeNode(OctTree_Node* node, Collision* collision)
+{
+	unsigned long numTests = 0;
+	if(node->children != NULL)
+	{
+		for(int i = 0; i < 8; i++)
+		{
+			numTests += Benchmark_TestOctTreeNode(node->children + i, collision);
+		}
+	}
+	else
+	{
+		GObject** gameObjects = (GObject**)node->data->data;
+		for(unsigned int i = 0; i < node->data->size; i++)
+		{
+			if(gameObjects[i]->collider == NULL) continue;
+			for(unsigned int j = i + 1; j < node->data->size; j++)
+			{
+				if(gameObjects[j]->collider == NULL) continue;
+				CollisionManager_TestCollision(
+					collision,
+					gameObjects[i],
+					gameObjects[i]->body != NULL ? gameObjects[i]->body->frame : gameObjects[i]->frameOfReference,
+					gameObjects[j],
+					gameObjects[j]->body != NULL ? gameObjects[j]->body->frame : gameObjects[j]->frameOfReference);
+				numTests++;
+			}
+		}
+	}
+	return numTests;
+}
+
+///
+//Counts the pairs of objects which share a leaf of an oct tree node
+//
+//Parameters:
+//	node: The oct tree node to count the pairs in the leaves of
+//
+//Returns:
+//	The number of pairs the narrow phase tests for the node
+static unsigned long Benchmark_CountOctTreePairs(OctTree_Node* node)
+{
+	unsigned long numPairs = 0;
+	if(node->children != NULL)
+	{
+		for(int i = 0; i < 8; i++)
+		{
+			numPairs += Benchmark_CountOctTreePairs(node->children + i);
+		}
+	}
+	else if(node->data->size > 1)
+	{
+		numPairs = node->data->size * (node->data->size - 1) / 2;
+	}
+	return numPairs;
+}
+
+///
+//Clears the list of collisions each collider took part in
+//The collisions in those lists are freed by the next collision update, so a benchmark which registers collisions
+//Outside of the game loop must clear them before returning.
+static void Benchmark_ClearCurrentCollisions(void)
+{
+	DynamicArray* colliders = ObjectManager_GetObjectBuffer().objects[GOBJECT_ARRAY_COLLIDERS];
+	GObject** gameObjects = (GObject**)colliders->data;
+	for(unsigned int i = 0; i < colliders->size; i++)
+	{
+		DynamicArray_Clear(gameObjects[i]->collider->currentCollisions);
+	}
+}
+
+///
+//Tests the pairs found by the last update of a broad phase for collisions
+//
+//Parameters:
+//	broadPhase: The broad phase whose pairs are tested
+//
+//Returns:
+//	A pointer to the dynamic array of pointers to the collisions which occurred
+static DynamicArray* Benchmark_TestBroadPhasePairs(BroadPhase broadPhase)
+{
+	ObjectBuffer objects = ObjectManager_GetObjectBuffer();
+	switch(broadPhase)
+	{
+	case BROADPHASE_SWEEPANDPRUNE:
+		return CollisionManager_UpdateSweepAndPrune(objects.sweepAndPrune);
+	case BROADPHASE_AABBTREE:
+		return CollisionManager_UpdateAABBTree(objects.aabbTree);
+	case BROADPHASE_LOOSEOCTTREE:
+		return CollisionManager_UpdateOctTree(objects.looseOctTree);
+	case BROADPHASE_LINEAROCTTREE:
+		return CollisionManager_UpdateLinearOctTree(objects.linearOctTree);
+	default:
+		return CollisionManager_UpdateOctTree(objects.octTree);
+	}
+}
+
+///
+//Gets the name of a broad phase for printing
+//
+//Parameters:
+//	broadPhase: The broad phase to name
+//
+//Returns:
+//	A null terminated string naming the broad phase
+static const char* Benchmark_GetBroadPhaseName(BroadPhase broadPhase)
+{
+	switch(broadPhase)
+	{
+	case BROADPHASE_SWEEPANDPRUNE:
+		return "sweep and prune";
+	case BROADPHASE_AABBTREE:
+		return "AABB tree";
+	case BROADPHASE_LOOSEOCTTREE:
+		return "loose oct tree";
+	case BROADPHASE_LINEAROCTTREE:
+		return "linear oct tree";
+	default:
+		return "oct tree";
+	}
+}
+
+///
+//Creates a game object with a convex hull collider shaped like a regular prism
+//The prism has a radius of 1 and a height of 2, and has one axis per side as a hull built from a mesh would.
+//
+//Parameters:
+//	numSides: The number of sides of the prism's base
+//
+//Returns:
+//	A pointer to a newly allocated and initialized game object with the prism collider
+static GObject* Benchmark_CreatePrism(unsigned int numSides)
+{
+	GObject* obj = GObject_Allocate();
+	GObject_Initialize(obj);
+
+	obj->collider = Collider_Allocate();
+	ConvexHullCollider_Initialize(obj->collider);
+	ColliderData_ConvexHull* convexHull = obj->collider->data->convexHullData;
+
+	const float angleStep = 2.0f * 3.14159265f / numSides;
+	Vec3 vec;
+	for(unsigned int i = 0; i < numSides; i++)
+	{
+		float angle = angleStep * i;
+
+		//A point on the bottom and top of the prism
+		for(int j = -1; j <= 1; j += 2)
+		{
+			Vec3_Set(&vec, cosf(angle), (float)j, sinf(angle));
+			ConvexHullCollider_AddPoint(convexHull, &vec);
+		}
+
+		//The normal of the side between this point and the next
+		Vec3_Set(&vec, cosf(angle + angleStep / 2.0f), 0.0f, sinf(angle + angleStep / 2.0f));
+		ConvexHullCollider_AddAxis(convexHull, &vec);
+
+		//The direction of the edge of the base from this point to the next
+		Vec3_Set(&vec, cosf(angle + angleStep) - cosf(angle), 0.0f, sinf(angle + angleStep) - sinf(angle));
+		Vec3_Normalize(&vec);
+		ConvexHullCollider_AddEdge(convexHull, &vec);
+	}
+
+	//The bases share one axis, and all of the sides share one edge direction
+	Vec3_Set(&vec, 0.0f, 1.0f, 0.0f);
+	ConvexHullCollider_AddAxis(convexHull, &vec);
+	ConvexHullCollider_AddEdge(convexHull, &vec);
+
+	return obj;
+}
+
+///
+//Puts a body of the integration stress scene back in it's starting state.
+//Bodies start on a grid, spinning, and moving with a velocity which depends on their index.
+//
+//Parameters:
+//	obj: The game object of the body to reset
+//	index: The index of the body in the stress scene
+//	gridSize: The number of bodies along each side of the grid
+static void Benchmark_ResetIntegrationBody(GObject* obj, unsigned int index, unsigned int gridSize)
+{
+	Vector vec;
+	Vector_INIT_ON_STACK(vec, 3);
+
+	vec.components[0] = 3.0f * (index % gridSize);
+	vec.components[1] = 3.0f * ((index / gridSize) % gridSize);
+	vec.components[2] = 3.0f * (index / (gridSize * gridSize));
+	RigidBody_SetPosition(obj->body, &vec);
+
+	Matrix rotation;
+	Matrix_INIT_ON_STACK(rotation, 3, 3);
+	Matrix_ToIdentity(&rotation);
+	RigidBody_SetRotation(obj->body, &rotation);
+
+	//Additive recurrences give every body a different motion, and the same motion every run
+	for(int i = 0; i < 3; i++)
+	{
+		obj->body->velocity->components[i] = fmodf(0.5f + (0.8191725f + 0.1f * i) * index, 1.0f) * 2.0f - 1.0f;
+		obj->body->angularVelocity->components[i] = fmodf(0.5f + (0.6710436f + 0.1f * i) * index, 1.0f) * 4.0f - 2.0f;
+	}
+
+	RigidBody_Wake(obj->body);
+}
+
+///
+//Puts a prism of the moving broad phase stress scene back in it's starting place.
+//Prisms start spread through a cube, moving with a velocity which depends on their index.
+//
+//Parameters:
+//	obj: The prism to reset
+//	velocityDest: Array of 3 floats to store the prism's velocity in, in units per frame
+//	index: The index of the prism in the stress scene
+//	halfSize: Half the length of each side of the cube
+static void Benchmark_ResetMovingPrism(GObject* obj, float* velocityDest, unsigned int index, float halfSize)
+{
+	Vector vec;
+	Vector_INIT_ON_STACK(vec, 3);
+
+	//Additive recurrences spread the prisms evenly and give the same motion every run
+	vec.components[0] = (fmodf(0.5f + 0.8191725f * index, 1.0f) * 2.0f - 1.0f) * halfSize;
+	vec.components[1] = (fmodf(0.5f + 0.6710436f * index, 1.0f) * 2.0f - 1.0f) * halfSize;
+	vec.components[2] = (fmodf(0.5f + 0.5497005f * index, 1.0f) * 2.0f - 1.0f) * halfSize;
+	GObject_SetPosition(obj, &vec);
+
+	for(int i = 0; i < 3; i++)
+	{
+		velocityDest[i] = (fmodf(0.5f + (0.7548777f + 0.1f * i) * index, 1.0f) * 2.0f - 1.0f) * 0.5f;
+	}
+}
+
+///
+//Moves each prism of the moving broad phase stress scene by it's velocity,
+//Bouncing the prisms which left the cube back towards it's center.
+//
+//Parameters:
+//	prisms: The prisms to move
+//	velocities: 3 floats per prism holding it's velocity in units per frame
+//	numObjects: The number of prisms
+//	halfSize: Half the length of each side of the cube
+static void Benchmark_MovePrisms(GObject** prisms, float* velocities, unsigned int numObjects, float halfSize)
+{
+	Vector vec;
+	Vector_INIT_ON_STACK(vec, 3);
+
+	for(unsigned int i = 0; i < numObjects; i++)
+	{
+		float* velocity = velocities + 3 * i;
+		const float* position = prisms[i]->frameOfReference->position->components;
+		for(int j = 0; j < 3; j++)
+		{
+			if((position[j] > halfSize && velocity[j] > 0.0f) || (position[j] < -halfSize && velocity[j] < 0.0f))
+			{
+				velocity[j] = -velocity[j];
+			}
+			vec.components[j] = velocity[j];
+		}
+		GObject_Translate(prisms[i], &vec);
+	}
+}
+
+///
+//Begins counting heap allocations.
+//Allocations can only be counted in debug builds, where the debug CRT allows hooking the heap.
+void Benchmark_BeginAllocationCount(void)
+{
+	benchmarkAllocationCount = 0;
+	benchmarkCountingAllocations = 1;
+#ifdef _DEBUG
+	_CrtSetAllocHook(Benchmark_AllocationHook);
+#endif
+}
+
+///
+//Stops counting heap allocations
+//
+//Returns:
+//	The number of heap allocations made since Benchmark_BeginAllocationCount was called
+unsigned long Benchmark_EndAllocationCount(void)
+{
+	benchmarkCountingAllocations = 0;
+	return benchmarkAllocationCount;
+}
+
+///
+//Gets the current time of the high resolution performance counter
+//
+//Returns:
+//	The current time in seconds
+double Benchmark_GetSeconds(void)
+{
+	LARGE_INTEGER ticksPerSecond;
+	LARGE_INTEGER ticks;
+	QueryPerformanceFrequency(&ticksPerSecond);
+	QueryPerformanceCounter(&ticks);
+	return (double)ticks.QuadPart / (double)ticksPerSecond.QuadPart;
+}
+
+///
+//Runs the object and physics pipeline of the current scene for a number of frames
+//And prints the average number of heap allocations and milliseconds per frame.
+//The simulation is advanced by the frames which are run using the current delta time.
+//
+//Parameters:
+//	numFrames: The number of frames to run
+void Benchmark_PhysicsStep(unsigned int numFrames)
+{
+	if(numFrames == 0)
+	{
+		printf("Benchmark_PhysicsStep failed! Must run at least one frame. Benchmark not run.\n");
+		return;
+	}
+
+	Benchmark_BeginAllocationCount();
+	double start = Benchmark_GetSeconds();
+
+	for(unsigned int i = 0; i < numFrames; i++)
+	{
+		ObjectManager_Update();
+		PhysicsManager_Update(ObjectManager_GetObjectBuffer().objects[GOBJECT_ARRAY_BODIES]);
+		ObjectManager_UpdateBroadPhase();
+		ObjectManager_ClearCollisions();
+		DynamicArray* collisions = Benchmark_TestBroadPhasePairs(ObjectManager_GetObjectBuffer().broadPhase);
+		PhysicsManager_ResolveCollisions(collisions);
+		PhysicsManager_ClearForces();
+	}
+
+	double elapsed = Benchmark_GetSeconds() - start;
+	unsigned long allocations = Benchmark_EndAllocationCount();
+
+	Benchmark_ClearCurrentCollisions();
+
+	printf("Benchmark_PhysicsStep: %u frames, %u objects, %s broad phase\n", numFrames, ObjectManager_GetObjectBuffer().objects[GOBJECT_ARRAY_ALL]->size,
+		Benchmark_GetBroadPhaseName(ObjectManager_GetObjectBuffer().broadPhase));
+	printf("\t%f ms per frame\n", (elapsed * 1000.0) / numFrames);
+#ifdef _DEBUG
+	printf("\t%f heap allocations per frame\n", (double)allocations / numFrames);
+#else
+	(void)allocations;
+	printf("\tHeap allocations are only counted in debug builds\n");
+#endif
+}
+
+///
+//Times the SIMDMath kernels against the general loops which the Vector_*Array and Matrix_*Array functions
+//Used before the kernels existed, for the 3, 4, 3x3 and 4x4 cases.
+//Also prints the number of floats in which the results differ, which should always be 0.
+//
+//Parameters:
+//	iterations: The number of passes over the operands to time
+void Benchmark_MathKernels(unsigned int iterations)
+{
+	if(iterations == 0)
+	{
+		printf("Benchmark_MathKernels failed! Must run at least one iteration. Benchmark not run.\n");
+		return;
+	}
+
+	//Every operand gets room for a 4x4 matrix
+	const unsigned int numOperands = 256;
+	const unsigned int stride = 16;
+	const unsigned int numFloats = numOperands * stride;
+	const unsigned long numCalls = (unsigned long)iterations * numOperands;
+
+	float* LHS = (float*)malloc(sizeof(float) * numFloats);
+	float* RHS = (float*)malloc(sizeof(float) * numFloats);
+	float* results = (float*)malloc(sizeof(float) * numFloats);
+	float* kernelResults = (float*)malloc(sizeof(float) * numFloats);
+
+	//Same operands every run
+	srand(1);
+	for(unsigned int i = 0; i < numFloats; i++)
+	{
+		LHS[i] = 2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f;
+		RHS[i] = 2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f;
+	}
+
+	printf("Benchmark_MathKernels: %u iterations over %u operands using %s\n", iterations, numOperands, SIMDMath_IsAccelerated() ? "SSE kernels" : "scalar fallbacks");
+
+	double start;
+	double loopSeconds;
+	double kernelSeconds;
+	for(int dim = 3; dim <= 4; dim++)
+	{
+		float (*dotProductKernel)(const float*, const float*) = dim == 3 ? SIMDMath_DotProduct3 : SIMDMath_DotProduct4;
+		void (*addKernel)(float*, const float*, const float*) = dim == 3 ? SIMDMath_Add3 : SIMDMath_Add4;
+		void (*productKernel)(float*, const float*, const float*) = dim == 3 ? SIMDMath_GetProductMatrix3 : SIMDMath_GetProductMatrix4;
+		void (*transformKernel)(const float*, float*) = dim == 3 ? SIMDMath_TransformVector3 : SIMDMath_TransformVector4;
+
+		//Dot product
+		memset(results, 0, sizeof(float) * numFloats);
+		memset(kernelResults, 0, sizeof(float) * numFloats);
+		start = Benchmark_GetSeconds();
+		for(unsigned int i = 0; i < iterations; i++)
+			for(unsigned int j = 0; j < numOperands; j++)
+				results[j] = Benchmark_DotProductLoop(LHS + j * stride, RHS + j * stride, dim);
+		loopSeconds = Benchmark_GetSeconds() - start;
+		start = Benchmark_GetSeconds();
+		for(unsigned int i = 0; i < iterations; i++)
+			for(unsigned int j = 0; j < numOperands; j++)
+				kernelResults[j] = dotProductKernel(LHS + j * stride, RHS + j * stride);
+		kernelSeconds = Benchmark_GetSeconds() - start;
+		Benchmark_PrintKernelResult(dim == 3 ? "DotProduct3" : "DotProduct4", loopSeconds, kernelSeconds, numCalls, results, kernelResults, numFloats);
+
+		//Addition
+		memset(results, 0, sizeof(float) * numFloats);
+		memset(kernelResults, 0, sizeof(float) * numFloats);
+		start = Benchmark_GetSeconds();
+		for(unsigned int i = 0; i < iterations; i++)
+			for(unsigned int j = 0; j < numOperands; j++)
+				Benchmark_AddLoop(results + j * stride, LHS + j * stride, RHS + j * stride, dim);
+		loopSeconds = Benchmark_GetSeconds() - start;
+		start = Benchmark_GetSeconds();
+		for(unsigned int i = 0; i < iterations; i++)
+			for(unsigned int j = 0; j < numOperands; j++)
+				addKernel(kernelResults + j * stride, LHS + j * stride, RHS + j * stride);
+		kernelSeconds = Benchmark_GetSeconds() - start;
+		Benchmark_PrintKernelResult(dim == 3 ? "Add3" : "Add4", loopSeconds, kernelSeconds, numCalls, results, kernelResults, numFloats);
+
+		//Matrix product
+		memset(results, 0, sizeof(float) * numFloats);
+		memset(kernelResults, 0, sizeof(float) * numFloats);
+		start = Benchmark_GetSeconds();
+		for(unsigned int i = 0; i < iterations; i++)
+			for(unsigned int j = 0; j < numOperands; j++)
+				Benchmark_GetProductMatrixLoop(results + j * stride, LHS + j * stride, RHS + j * stride, dim);
+		loopSeconds = Benchmark_GetSeconds() - start;
+		start = Benchmark_GetSeconds();
+		for(unsigned int i = 0; i < iterations; i++)
+			for(unsigned int j = 0; j < numOperands; j++)
+				productKernel(kernelResults + j * stride, LHS + j * stride, RHS + j * stride);
+		kernelSeconds = Benchmark_GetSeconds() - start;
+		Benchmark_PrintKernelResult(dim == 3 ? "GetProductMatrix3" : "GetProductMatrix4", loopSeconds, kernelSeconds, numCalls, results, kernelResults, numFloats);
+
+		//Vector transformation, restarting from the same vectors every pass
+		start = Benchmark_GetSeconds();
+		for(unsigned int i = 0; i < iterations; i++)
+		{
+			memcpy(results, RHS, sizeof(float) * numFloats);
+			for(unsigned int j = 0; j < numOperands; j++)
+				Benchmark_TransformVectorLoop(LHS + j * stride, results + j * stride, dim);
+		}
+		loopSeconds = Benchmark_GetSeconds() - start;
+		start = Benchmark_GetSeconds();
+		for(unsigned int i = 0; i < iterations; i++)
+		{
+			memcpy(kernelResults, RHS, sizeof(float) * numFloats);
+			for(unsigned int j = 0; j < numOperands; j++)
+				transformKernel(LHS + j * stride, kernelResults + j * stride);
+		}
+		kernelSeconds = Benchmark_GetSeconds() - start;
+		Benchmark_PrintKernelResult(dim == 3 ? "TransformVector3" : "TransformVector4", loopSeconds, kernelSeconds, numCalls, results, kernelResults, numFloats);
+	}
+
+	free(LHS);
+	free(RHS);
+	free(results);
+	free(kernelResults);
+}
+
+///
+//Runs only the narrow phase tests on every pair of objects sharing an oct tree leaf in the current scene
+//For a number of frames, without moving any objects or registering any collisions.
+//The first frame is not measured so the convex hull world caches can be built,
+//After which the number of heap allocations per frame should be 0.
+//
+//Parameters:
+//	numFrames: The number of frames to measure
+void Benchmark_NarrowPhase(unsigned int numFrames)
+{
+	if(numFrames == 0)
+	{
+		printf("Benchmark_NarrowPhase failed! Must run at least one frame. Benchmark not run.\n");
+		return;
+	}
+
+	//Only the broad phase in use holds the objects, so the oct tree is put in use for the benchmark
+	BroadPhase broadPhaseInUse = ObjectManager_GetObjectBuffer().broadPhase;
+	ObjectManager_SetBroadPhase(BROADPHASE_OCTTREE);
+	OctTree* tree = ObjectManager_GetObjectBuffer().octTree;
+
+	//A single collision on the stack is reused for every test
+	Collision collision;
+	collision.minimumTranslationVector = Vec3_Storage_Initialize(&collision.minimumTranslationVectorStorage);
+
+	//Warm up
+	Benchmark_TestOctTreeNode(tree->root, &collision);
+
+	unsigned long numTests = 0;
+	Benchmark_BeginAllocationCount();
+	double start = Benchmark_GetSeconds();
+
+	for(unsigned int i = 0; i < numFrames; i++)
+	{
+		numTests += Benchmark_TestOctTreeNode(tree->root, &collision);
+	}
+
+	double elapsed = Benchmark_GetSeconds() - start;
+	unsigned long allocations = Benchmark_EndAllocationCount();
+
+	ObjectManager_SetBroadPhase(broadPhaseInUse);
+
+	printf("Benchmark_NarrowPhase: %u frames, %lu pair tests per frame\n", numFrames, numTests / numFrames);
+	printf("\t%f ms per frame\n", (elapsed * 1000.0) / numFrames);
+#ifdef _DEBUG
+	printf("\t%f heap allocations per frame\n", (double)allocations / numFrames);
+#else
+	(void)allocations;
+	printf("\tHeap allocations are only counted in debug builds\n");
+#endif
+}
+
+///
+//Times SAT against GJK and EPA on a pair of overlapping, rotated prisms with a growing number of points
+//And prints the overlap each algorithm finds and the angle between their minimum translation vectors.
+//
+//Parameters:
+//	iterations: The number of times each pair is tested with each algorithm
+void Benchmark_ConvexHullTests(unsigned int iterations)
+{
+	if(iterations == 0)
+	{
+		printf("Benchmark_ConvexHullTests failed! Must run at least one iteration. Benchmark not run.\n");
+		return;
+	}
+
+	Collision SATCollision;
+	SATCollision.minimumTranslationVector = Vec3_Storage_Initialize(&SATCollision.minimumTranslationVectorStorage);
+	Collision GJKCollision;
+	GJKCollision.minimumTranslationVector = Vec3_Storage_Initialize(&GJKCollision.minimumTranslationVectorStorage);
+
+	Vector vec;
+	Vector_INIT_ON_STACK(vec, 3);
+
+	printf("Benchmark_ConvexHullTests: %u iterations per pair\n", iterations);
+	printf("\tpoints\tSAT ms\t\tGJK ms\t\tSAT overlap\tGJK overlap\tMTV angle\n");
+
+	for(unsigned int numSides = 4; numSides <= 128; numSides *= 2)
+	{
+		GObject* obj1 = Benchmark_CreatePrism(numSides);
+		GObject* obj2 = Benchmark_CreatePrism(numSides);
+
+		//Tilt both prisms and sink the second one partially into the first
+		vec.components[0] = 1.0f;
+		vec.components[1] = 0.0f;
+		vec.components[2] = 0.0f;
+		GObject_Rotate(obj1, &vec, 0.3f);
+		vec.components[0] = 0.0f;
+		vec.components[2] = 1.0f;
+		GObject_Rotate(obj2, &vec, 1.1f);
+		vec.components[0] = 1.2f;
+		vec.components[1] = 0.9f;
+		vec.components[2] = 0.4f;
+		GObject_Translate(obj2, &vec);
+
+		//Build the world caches before timing
+		CollisionManager_TestConvexCollision(&SATCollision, obj1, obj1->frameOfReference, obj2, obj2->frameOfReference);
+
+		double start = Benchmark_GetSeconds();
+		for(unsigned int i = 0; i < iterations; i++)
+		{
+			CollisionManager_TestConvexCollision(&SATCollision, obj1, obj1->frameOfReference, obj2, obj2->frameOfReference);
+		}
+		double SATSeconds = Benchmark_GetSeconds() - start;
+
+		start = Benchmark_GetSeconds();
+		for(unsigned int i = 0; i < iterations; i++)
+		{
+			CollisionManager_TestGJKCollision(&GJKCollision, obj1, obj1->frameOfReference, obj2, obj2->frameOfReference);
+		}
+		double GJKSeconds = Benchmark_GetSeconds() - start;
+
+		float cosAngle = Vector_DotProduct(SATCollision.minimumTranslationVector, GJKCollision.minimumTranslationVector);
+		if(cosAngle > 1.0f) cosAngle = 1.0f;
+		else if(cosAngle < -1.0f) cosAngle = -1.0f;
+
+		printf("\t%u\t%f\t%f\t%f\t%f\t%f\n",
+			numSides * 2,
+			(SATSeconds * 1000.0) / iterations,
+			(GJKSeconds * 1000.0) / iterations,
+			SATCollision.obj1 != NULL ? SATCollision.overlap : 0.0f,
+			GJKCollision.obj1 != NULL ? GJKCollision.overlap : 0.0f,
+			acosf(cosAngle));
+
+		GObject_Free(obj1);
+		GObject_Free(obj2);
+	}
+}
+
+///
+//Times every broad phase on the current scene for a number of frames each,
+//Without moving any objects. For each broad phase prints the time spent updating it's structure,
+//The time spent testing the pairs it finds, the number of pairs and the number of collisions found.
+//Every broad phase should find the same number of collisions.
+//
+//Parameters:
+//	numFrames: The number of frames to measure each broad phase for
+void Benchmark_BroadPhase(unsigned int numFrames)
+{
+	if(numFrames == 0)
+	{
+		printf("Benchmark_BroadPhase failed! Must run at least one frame. Benchmark not run.\n");
+		return;
+	}
+
+	ObjectBuffer objects = ObjectManager_GetObjectBuffer();
+	BroadPhase broadPhaseInUse = objects.broadPhase;
+
+	printf("Benchmark_BroadPhase: %u frames, %u objects\n", numFrames, objects.objects[GOBJECT_ARRAY_ALL]->size);
+	printf("\tbroad phase\t\tupdate ms\ttest ms\t\tpairs\tcollisions\n");
+
+	for(int broadPhase = BROADPHASE_OCTTREE; broadPhase <= BROADPHASE_LINEAROCTTREE; broadPhase++)
+	{
+		//Switching empties the old structure and may allocate it again, so the buffer is fetched afresh
+		ObjectManager_SetBroadPhase((BroadPhase)broadPhase);
+		objects = ObjectManager_GetObjectBuffer();
+
+		double updateSeconds = 0.0;
+		double testSeconds = 0.0;
+		unsigned long numPairs = 0;
+		unsigned int numCollisions = 0;
+
+		//The first frame is not measured, it brings the structure up to date with the scene
+		for(unsigned int i = 0; i <= numFrames; i++)
+		{
+			Benchmark_ClearCurrentCollisions();
+
+			double start = Benchmark_GetSeconds();
+			ObjectManager_UpdateBroadPhase();
+			double tested = Benchmark_GetSeconds();
+			DynamicArray* collisions = Benchmark_TestBroadPhasePairs((BroadPhase)broadPhase);
+			double end = Benchmark_GetSeconds();
+
+			if(i == 0) continue;
+
+			updateSeconds += tested - start;
+			testSeconds += end - tested;
+			switch(broadPhase)
+			{
+			case BROADPHASE_OCTTREE:
+				numPairs += Benchmark_CountOctTreePairs(objects.octTree->root);
+				break;
+			case BROADPHASE_SWEEPANDPRUNE:
+				numPairs += objects.sweepAndPrune->pairs->size;
+				break;
+			case BROADPHASE_AABBTREE:
+				numPairs += objects.aabbTree->pairs->size;
+				break;
+			case BROADPHASE_LOOSEOCTTREE:
+				numPairs += objects.looseOctTree->pairs->size;
+				break;
+			case BROADPHASE_LINEAROCTTREE:
+				numPairs += objects.linearOctTree->pairs->size;
+				break;
+			}
+			numCollisions = collisions->size;
+		}
+
+		printf("\t%-24s%f\t%f\t%lu\t%u\n",
+			Benchmark_GetBroadPhaseName((BroadPhase)broadPhase),
+			(updateSeconds * 1000.0) / numFrames,
+			(testSeconds * 1000.0) / numFrames,
+			numPairs / numFrames,
+			numCollisions);
+	}
+
+	ObjectManager_SetBroadPhase(broadPhaseInUse);
+	Benchmark_ClearCurrentCollisions();
+}
+
+///
+//Builds a stress scene of overlapping prisms in an oct tree of it's own, then times the oct tree narrow phase on it
+//With every number of threads from 1 to the number of hardware threads for a number of frames each.
+//For each number of threads prints the milliseconds per frame, the speedup over 1 thread and the number of collisions found.
+//Every number of threads should find the same number of collisions. The stress scene is freed afterwards.
+//
+//Parameters:
+//	numObjects: The number of prisms in the stress scene
+//	numFrames: The number of frames to measure each number of threads for
+void Benchmark_NarrowPhaseThreads(unsigned int numObjects, unsigned int numFrames)
+{
+	if(numObjects < 2 || numFrames == 0)
+	{
+		printf("Benchmark_NarrowPhaseThreads failed! Must have at least two objects and one frame. Benchmark not run.\n");
+		return;
+	}
+
+	//Pack the prisms into a cube with about one and a half units between centers so most of them overlap a neighbor
+	float halfSize = 0.8f * powf((float)numObjects, 1.0f / 3.0f);
+
+	OctTree* tree = OctTree_Allocate();
+	OctTree_Initialize(tree, -halfSize - 2.0f, halfSize + 2.0f, -halfSize - 2.0f, halfSize + 2.0f, -halfSize - 2.0f, halfSize + 2.0f);
+
+	GObject** prisms = (GObject**)malloc(sizeof(GObject*) * numObjects);
+
+	Vector vec;
+	Vector_INIT_ON_STACK(vec, 3);
+	for(unsigned int i = 0; i < numObjects; i++)
+	{
+		prisms[i] = Benchmark_CreatePrism(8);
+
+		//Additive recurrences spread the prisms evenly and give the same scene every run
+		vec.components[0] = 1.0f;
+		vec.components[1] = 0.5f;
+		vec.components[2] = 0.25f;
+		Vector_Normalize(&vec);
+		GObject_Rotate(prisms[i], &vec, 0.7f * i);
+
+		vec.components[0] = (fmodf(0.5f + 0.8191725f * i, 1.0f) * 2.0f - 1.0f) * halfSize;
+		vec.components[1] = (fmodf(0.5f + 0.6710436f * i, 1.0f) * 2.0f - 1.0f) * halfSize;
+		vec.components[2] = (fmodf(0.5f + 0.5497005f * i, 1.0f) * 2.0f - 1.0f) * halfSize;
+		GObject_Translate(prisms[i], &vec);
+
+		OctTree_Add(tree, prisms[i]);
+	}
+
+	unsigned int numThreadsInUse = JobManager_GetNumThreads();
+	unsigned int maxThreads = ThreadPool_GetNumHardwareThreads();
+
+	printf("Benchmark_NarrowPhaseThreads: %u frames, %u objects\n", numFrames, numObjects);
+	printf("\tthreads\tms\t\tspeedup\t\tcollisions\n");
+
+	double serialMilliseconds = 0.0;
+	for(unsigned int numThreads = 1; numThreads <= maxThreads; numThreads++)
+	{
+		JobManager_SetNumThreads(numThreads);
+
+		double seconds = 0.0;
+		unsigned int numCollisions = 0;
+
+		//The first frame is not measured, it builds the world caches and grows the thread outputs
+		for(unsigned int i = 0; i <= numFrames; i++)
+		{
+			for(unsigned int j = 0; j < numObjects; j++)
+			{
+				DynamicArray_Clear(prisms[j]->collider->currentCollisions);
+			}
+
+			double start = Benchmark_GetSeconds();
+			DynamicArray* collisions = CollisionManager_UpdateOctTree(tree);
+			double end = Benchmark_GetSeconds();
+
+			if(i == 0) continue;
+
+			seconds += end - start;
+			numCollisions = collisions->size;
+		}
+
+		double milliseconds = (seconds * 1000.0) / numFrames;
+		if(numThreads == 1)
+		{
+			serialMilliseconds = milliseconds;
+		}
+
+		printf("\t%u\t%f\t%f\t%u\n", numThreads, milliseconds, serialMilliseconds / milliseconds, numCollisions);
+	}
+
+	JobManager_SetNumThreads(numThreadsInUse);
+
+	//Free the stress scene and find the collisions of the current scene again so no collision refers to a prism
+	OctTree_Free(tree);
+	for(unsigned int i = 0; i < numObjects; i++)
+	{
+		CollisionManager_RemoveContacts(prisms[i]);
+		GObject_Free(prisms[i]);
+	}
+	free(prisms);
+
+	Benchmark_ClearCurrentCollisions();
+	Benchmark_TestBroadPhasePairs(ObjectManager_GetObjectBuffer().broadPhase);
+}
+
+///
+//Builds a stress scene of rigid bodies without colliders in a list of it's own, then times the physics manager's update of it
+//With every number of threads from 1 to the number of hardware threads for a number of steps each.
+//For each number of threads prints the milliseconds per step, the speedup over 1 thread and the sum of the final positions.
+//The scene is reset before each number of threads, so every number of threads should give the same sum. The stress scene is freed afterwards.
+//
+//Parameters:
+//	numBodies: The number of bodies in the stress scene
+//	numSteps: The number of steps to measure each number of threads for
+void Benchmark_IntegrationThreads(unsigned int numBodies, unsigned int numSteps)
+{
+	if(numBodies == 0 || numSteps == 0)
+	{
+		printf("Benchmark_IntegrationThreads failed! Must have at least one body and one step. Benchmark not run.\n");
+		return;
+	}
+
+	//The bodies are kept out of the object manager so the current scene is neither moved nor tested against them
+	DynamicArray* bodies = DynamicArray_Allocate();
+	DynamicArray_Initialize(bodies, sizeof(GObject*));
+
+	unsigned int gridSize = (unsigned int)ceilf(powf((float)numBodies, 1.0f / 3.0f));
+	for(unsigned int i = 0; i < numBodies; i++)
+	{
+		GObject* obj = GObject_Allocate();
+		GObject_Initialize(obj);
+
+		obj->body = RigidBody_Allocate();
+		RigidBody_Initialize(obj->body, obj->frameOfReference, 1.0f);
+		RigidBody_SetInertiaOfCuboid(obj->body);
+
+		DynamicArray_Append(bodies, &obj);
+	}
+	GObject** gameObjects = (GObject**)bodies->data;
+
+	unsigned int numThreadsInUse = JobManager_GetNumThreads();
+	unsigned int maxThreads = ThreadPool_GetNumHardwareThreads();
+
+	printf("Benchmark_IntegrationThreads: %u steps, %u bodies\n", numSteps, numBodies);
+	printf("\tthreads\tms\t\tspeedup\t\tposition sum\n");
+
+	double serialMilliseconds = 0.0;
+	for(unsigned int numThreads = 1; numThreads <= maxThreads; numThreads++)
+	{
+		JobManager_SetNumThreads(numThreads);
+
+		for(unsigned int i = 0; i < numBodies; i++)
+		{
+			Benchmark_ResetIntegrationBody(gameObjects[i], i, gridSize);
+		}
+
+		double seconds = 0.0;
+
+		//The first step is not measured, it grows the physics buffer's arrays and wakes the workers
+		for(unsigned int i = 0; i <= numSteps; i++)
+		{
+			double start = Benchmark_GetSeconds();
+			PhysicsManager_Update(bodies);
+			double end = Benchmark_GetSeconds();
+
+			if(i == 0) continue;
+
+			seconds += end - start;
+		}
+
+		double positionSum = 0.0;
+		for(unsigned int i = 0; i < numBodies; i++)
+		{
+			const float* position = gameObjects[i]->frameOfReference->position->components;
+			positionSum += (double)position[0] + position[1] + position[2];
+		}
+
+		double milliseconds = (seconds * 1000.0) / numSteps;
+		if(numThreads == 1)
+		{
+			serialMilliseconds = milliseconds;
+		}
+
+		printf("\t%u\t%f\t%f\t%f\n", numThreads, milliseconds, serialMilliseconds / milliseconds, positionSum);
+	}
+
+	JobManager_SetNumThreads(numThreadsInUse);
+
+	for(unsigned int i = 0; i < numBodies; i++)
+	{
+		GObject_Free(gameObjects[i]);
+	}
+	DynamicArray_Free(bodies);
+}
+
+///
+//Builds a stress scene of prisms which all move every frame, in an oct tree, a loose oct tree and a linear oct tree of it's own,
+//Then times updating each structure as the prisms move for a number of frames.
+//The oct trees relocate the objects which moved while the linear oct tree is rebuilt from scratch, on one thread and then on every hardware thread.
+//For each prints the milliseconds per update and the number of pairs found per frame.
+//The loose and linear oct trees both find exactly the pairs whose bounds overlap, so they should find the same number of pairs.
+//Every run moves the prisms the same way. The stress scene is freed afterwards.
+//
+//Parameters:
+//	numObjects: The number of prisms in the stress scene
+//	numFrames: The number of frames to measure each structure for
+void Benchmark_MovingBroadPhase(unsigned int numObjects, unsigned int numFrames)
+{
+	if(numObjects < 2 || numFrames == 0)
+	{
+		printf("Benchmark_MovingBroadPhase failed! Must have at least two objects and one frame. Benchmark not run.\n");
+		return;
+	}
+
+	//Spread the prisms through a cube with about four units between centers, so a few overlap at any time
+	float halfSize = 2.0f * powf((float)numObjects, 1.0f / 3.0f);
+
+	//The prisms are kept out of the object manager so the current scene is neither moved nor tested against them
+	DynamicArray* prismArray = DynamicArray_Allocate();
+	DynamicArray_Initialize(prismArray, sizeof(GObject*));
+
+	GObject** prisms = (GObject**)malloc(sizeof(GObject*) * numObjects);
+	float* velocities = (float*)malloc(sizeof(float) * 3 * numObjects);
+
+	Vector vec;
+	Vector_INIT_ON_STACK(vec, 3);
+	vec.components[0] = 1.0f;
+	vec.components[1] = 0.5f;
+	vec.components[2] = 0.25f;
+	Vector_Normalize(&vec);
+	for(unsigned int i = 0; i < numObjects; i++)
+	{
+		prisms[i] = Benchmark_CreatePrism(8);
+		GObject_Rotate(prisms[i], &vec, 0.7f * i);
+		Benchmark_ResetMovingPrism(prisms[i], velocities + 3 * i, i, halfSize);
+	}
+
+	DynamicArray_AppendArray(prismArray, prisms, numObjects);
+
+	//The oct trees must hold every place a prism can bounce to
+	float bound = halfSize + 2.0f;
+	OctTree* octTree = OctTree_Allocate();
+	OctTree_Initialize(octTree, -bound, bound, -bound, bound, -bound, bound);
+	OctTree* looseOctTree = OctTree_Allocate();
+	OctTree_InitializeLoose(looseOctTree, -bound, bound, -bound, bound, -bound, bound);
+	LinearOctTree* linearOctTree = LinearOctTree_Allocate();
+	LinearOctTree_Initialize(linearOctTree);
+
+	for(unsigned int i = 0; i < numObjects; i++)
+	{
+		OctTree_AddAndLog(octTree, prisms[i]);
+		OctTree_Add(looseOctTree, prisms[i]);
+		LinearOctTree_Add(linearOctTree, prisms[i]);
+	}
+
+	unsigned int numThreadsInUse = JobManager_GetNumThreads();
+	unsigned int maxThreads = ThreadPool_GetNumHardwareThreads();
+
+	printf("Benchmark_MovingBroadPhase: %u frames, %u moving objects\n", numFrames, numObjects);
+	printf("\tstructure\t\tthreads\tupdate ms\tpairs\n");
+
+	//The oct tree, the loose oct tree, then the linear oct tree on one thread and on every hardware thread
+	const unsigned int numRuns = 4;
+	for(unsigned int run = 0; run < numRuns; run++)
+	{
+		unsigned int numThreads = run == numRuns - 1 ? maxThreads : 1;
+		JobManager_SetNumThreads(numThreads);
+
+		for(unsigned int i = 0; i < numObjects; i++)
+		{
+			Benchmark_ResetMovingPrism(prisms[i], velocities + 3 * i, i, halfSize);
+		}
+
+		double seconds = 0.0;
+		unsigned long numPairs = 0;
+
+		//The first frame is not measured, it brings the structure up to date with the reset prisms
+		for(unsigned int i = 0; i <= numFrames; i++)
+		{
+			if(i > 0)
+			{
+				Benchmark_MovePrisms(prisms, velocities, numObjects, halfSize);
+			}
+
+			double start = Benchmark_GetSeconds();
+			switch(run)
+			{
+			case 0:
+				OctTree_Update(octTree, prismArray);
+				break;
+			case 1:
+				OctTree_Update(looseOctTree, prismArray);
+				break;
+			default:
+				LinearOctTree_Update(linearOctTree);
+				break;
+			}
+			double end = Benchmark_GetSeconds();
+
+			if(i == 0) continue;
+
+			seconds += end - start;
+			switch(run)
+			{
+			case 0:
+				numPairs += Benchmark_CountOctTreePairs(octTree->root);
+				break;
+			case 1:
+				numPairs += looseOctTree->pairs->size;
+				break;
+			default:
+				numPairs += linearOctTree->pairs->size;
+				break;
+			}
+		}
+
+		printf("\t%-24s%u\t%f\t%lu\n",
+			run == 0 ? "oct tree" : run == 1 ? "loose oct tree" : "linear oct tree",
+			numThreads,
+			(seconds * 1000.0) / numFrames,
+			numPairs / numFrames);
+	}
+
+	printf("\tstructure\t\tlive nodes\tpeak nodes\tpooled nodes\n");
+	printf("\t%-24s%u\t\t%u\t\t%u\n", "oct tree", octTree->numLiveNodes, octTree->maxLiveNodes, octTree->numPooledNodes);
+	printf("\t%-24s%u\t\t%u\t\t%u\n", "loose oct tree", looseOctTree->numLiveNodes, looseOctTree->maxLiveNodes, looseOctTree->numPooledNodes);
+
+	JobManager_SetNumThreads(numThreadsInUse);
+
+	//No collisions were registered, so the prisms can be freed along with the structures
+	OctTree_Free(octTree);
+	OctTree_Free(looseOctTree);
+	LinearOctTree_Free(linearOctTree);
+	for(unsigned int i = 0; i < numObjects; i++)
+	{
+		GObject_Free(prisms[i]);
+	}
+	free(prisms);
+	free(velocities);
+	DynamicArray_Free(prismArray);
+}
+
+
+///
+//Times a hash map under the access pattern of the oct tree's map of object logs, keyed by pointers to objects.
+//Each key is checked for before it is added, as objects join the tree, then every key is looked up each frame as the tree is updated,
+//And each frame a sixteenth of the keys are removed and added back as objects leave and join the scene.
+//Prints the nanoseconds and heap allocations per add, lookup and removal,
+//And the number of lookups which did not find the data added with their key, which should be 0.
+//
+//Parameters:
+//	numKeys: The number of keys in the map
+//	numFrames: The number of frames of lookups and removals to measure
+void Benchmark_HashMap(unsigned int numKeys, unsigned int numFrames)
+{
+	if(numKeys < 16 || numFrames == 0)
+	{
+		printf("Benchmark_HashMap failed! Must have at least 16 keys and one frame. Benchmark not run.\n");
+		return;
+	}
+
+	//The keys are allocated one after another like objects joining the scene, the data of each is it's index plus 1
+	GObject** keys = (GObject**)malloc(sizeof(GObject*) * numKeys);
+	for(unsigned int i = 0; i < numKeys; i++)
+	{
+		keys[i] = (GObject*)malloc(sizeof(GObject));
+	}
+	HashMap* map = HashMap_Allocate();
+	HashMap_Initialize(map, 16);
+	map->Hash = Hash_Pointer;
+
+	Benchmark_BeginAllocationCount();
+	double start = Benchmark_GetSeconds();
+	for(size_t i = 0; i < numKeys; i++)
+	{
+		if(!HashMap_Contains(map, keys + i, sizeof(GObject*)))
+		{
+			HashMap_Add(map, keys + i, (void*)(i + 1), sizeof(GObject*));
+		}
+	}
+	double addSeconds = Benchmark_GetSeconds() - start;
+	unsigned long addAllocations = Benchmark_EndAllocationCount();
+
+	double lookUpSeconds = 0.0;
+	double churnSeconds = 0.0;
+	unsigned long lookUpAllocations = 0;
+	unsigned long churnAllocations = 0;
+	unsigned long numMissing = 0;
+	unsigned long numChurned = 0;
+	for(unsigned int frame = 0; frame < numFrames; frame++)
+	{
+		Benchmark_BeginAllocationCount();
+		start = Benchmark_GetSeconds();
+		for(size_t i = 0; i < numKeys; i++)
+		{
+			struct HashMap_KeyValuePair* pair = HashMap_LookUp(map, keys + i, sizeof(GObject*));
+			if(pair == NULL || (size_t)pair->data != i + 1)
+			{
+				numMissing++;
+			}
+		}
+		lookUpSeconds += Benchmark_GetSeconds() - start;
+		lookUpAllocations += Benchmark_EndAllocationCount();
+
+		//Removals and adds alternate as objects leave and join
+		Benchmark_BeginAllocationCount();
+		start = Benchmark_GetSeconds();
+		for(size_t i = frame % 16; i < numKeys; i += 16)
+		{
+			HashMap_Remove(map, keys + i, sizeof(GObject*));
+			HashMap_Add(map, keys + i, (void*)(i + 1), sizeof(GObject*));
+			numChurned++;
+		}
+		churnSeconds += Benchmark_GetSeconds() - start;
+		churnAllocations += Benchmark_EndAllocationCount();
+	}
+
+	unsigned long numLookUps = (unsigned long)numKeys * numFrames;
+	printf("Benchmark_HashMap: %u pointer keys, %u frames, %u slots\n", numKeys, numFrames, map->data->capacity);
+	printf("\toperation\t\tns\tallocations\n");
+	printf("\tcontains and add\t%f\t%f\n", addSeconds * 1e9 / numKeys, (double)addAllocations / numKeys);
+	printf("\tlook up\t\t\t%f\t%f\n", lookUpSeconds * 1e9 / numLookUps, (double)lookUpAllocations / numLookUps);
+	printf("\tremove and add\t\t%f\t%f\n", churnSeconds * 1e9 / numChurned, (double)churnAllocations / numChurned);
+	printf("\tmissing look ups\t%lu\n", numMissing);
+
+	HashMap_Free(map);
+	for(unsigned int i = 0; i < numKeys; i++)
+	{
+		free(keys[i]);
+	}
+	free(keys);
+}
+
+///
+//Times the ways of filling a dynamic array and of removing from one.
+//Vertices the size of a loaded mesh's positions are appended one at a time by copying, one at a time by writing in place, and all at once,
+//Then the occupants of a crowded oct tree node are each removed and added back,
+//Both by the ordered removal which shifts every later occupant and by moving the last occupant into the removed one's place.
+//Prints the nanoseconds and heap allocations per element for each,
+//And the number of occupants missing once every removal was added back, which should be 0.
+//
+//Parameters:
+//	numElements: The number of vertices appended by each fill
+//	numRepeats: The number of times each fill, and each removal of every occupant, is repeated
+void Benchmark_DynamicArray(unsigned int numElements, unsigned int numRepeats)
+{
+	if(numElements == 0 || numRepeats == 0)
+	{
+		printf("Benchmark_DynamicArray failed! Must have at least one element and one repeat. Benchmark not run.\n");
+		return;
+	}
+
+	Vec3* vertices = (Vec3*)malloc(sizeof(Vec3) * numElements);
+	for(unsigned int i = 0; i < numElements; i++)
+	{
+		Vec3_Set(vertices + i, (float)i, (float)(2 * i), (float)(3 * i));
+	}
+
+	//Each fill is 0) Append, 1) Emplace or 2) AppendArray
+	double fillSeconds[3] = { 0.0, 0.0, 0.0 };
+	unsigned long fillAllocations[3] = { 0, 0, 0 };
+	for(unsigned int repeat = 0; repeat < numRepeats; repeat++)
+	{
+		for(int fill = 0; fill < 3; fill++)
+		{
+			DynamicArray* arr = DynamicArray_Allocate();
+			DynamicArray_Initialize(arr, sizeof(Vec3));
+
+			Benchmark_BeginAllocationCount();
+			double start = Benchmark_GetSeconds();
+			if(fill == 0)
+			{
+				for(unsigned int i = 0; i < numElements; i++)
+				{
+					DynamicArray_Append(arr, vertices + i);
+				}
+			}
+			else if(fill == 1)
+			{
+				for(unsigned int i = 0; i < numElements; i++)
+				{
+					Vec3_Copy((Vec3*)DynamicArray_Emplace(arr), vertices + i);
+				}
+			}
+			else
+			{
+				DynamicArray_AppendArray(arr, vertices, numElements);
+			}
+			fillSeconds[fill] += Benchmark_GetSeconds() - start;
+			fillAllocations[fill] += Benchmark_EndAllocationCount();
+
+			DynamicArray_Free(arr);
+		}
+	}
+
+	//The occupants of a node at the deepest level of the tree, which cannot subdivide however crowded it gets
+	const unsigned int numOccupants = 16;
+	GObject* objects[16];
+	for(unsigned int i = 0; i < numOccupants; i++)
+	{
+		objects[i] = (GObject*)malloc(sizeof(GObject));
+	}
+	DynamicArray* occupants = DynamicArray_Allocate();
+	DynamicArray_Initialize(occupants, sizeof(GObject*));
+
+	//Each removal is 0) ContainsWithin and RemoveData or 1) IndexOf and SwapRemove
+	double removeSeconds[2] = { 0.0, 0.0 };
+	unsigned long removeAllocations[2] = { 0, 0 };
+	unsigned long numMissing = 0;
+	for(int removal = 0; removal < 2; removal++)
+	{
+		DynamicArray_Clear(occupants);
+		DynamicArray_AppendArray(occupants, objects, numOccupants);
+
+		Benchmark_BeginAllocationCount();
+		double start = Benchmark_GetSeconds();
+		for(unsigned int repeat = 0; repeat < numRepeats; repeat++)
+		{
+			for(unsigned int i = 0; i < numOccupants; i++)
+			{
+				GObject* occupant = *(GObject**)DynamicArray_Index(occupants, i);
+				if(removal == 0)
+				{
+					if(DynamicArray_ContainsWithin(occupants, &occupant, occupants->size) == 1)
+					{
+						DynamicArray_RemoveData(occupants, &occupant);
+					}
+				}
+				else
+				{
+					unsigned int index = DynamicArray_IndexOf(occupants, &occupant, occupants->size);
+					if(index < occupants->size)
+					{
+						DynamicArray_SwapRemove(occupants, index);
+					}
+				}
+				DynamicArray_Append(occupants, &occupant);
+			}
+		}
+		removeSeconds[removal] = Benchmark_GetSeconds() - start;
+		removeAllocations[removal] = Benchmark_EndAllocationCount();
+
+		for(unsigned int i = 0; i < numOccupants; i++)
+		{
+			if(!DynamicArray_Contains(occupants, objects + i))
+			{
+				numMissing++;
+			}
+		}
+	}
+
+	unsigned long numFilled = (unsigned long)numElements * numRepeats;
+	unsigned long numRemoved = (unsigned long)numOccupants * numRepeats;
+	printf("Benchmark_DynamicArray: %u vertices, %u occupants, %u repeats\n", numElements, numOccupants, numRepeats);
+	printf("\toperation\t\t\tns\tallocations\n");
+	printf("\tappend\t\t\t\t%f\t%f\n", fillSeconds[0] * 1e9 / numFilled, (double)fillAllocations[0] / numFilled);
+	printf("\templace\t\t\t\t%f\t%f\n", fillSeconds[1] * 1e9 / numFilled, (double)fillAllocations[1] / numFilled);
+	printf("\tappend array\t\t\t%f\t%f\n", fillSeconds[2] * 1e9 / numFilled, (double)fillAllocations[2] / numFilled);
+	printf("\tordered remove and add\t\t%f\t%f\n", removeSeconds[0] * 1e9 / numRemoved, (double)removeAllocations[0] / numRemoved);
+	printf("\tswap remove and add\t\t%f\t%f\n", removeSeconds[1] * 1e9 / numRemoved, (double)removeAllocations[1] / numRemoved);
+	printf("\tmissing occupants\t\t%lu\n", numMissing);
+
+	DynamicArray_Free(occupants);
+	for(unsigned int i = 0; i < numOccupants; i++)
+	{
+		free(objects[i]);
+	}
+	free(vertices);
+}
+
+///
+//Sweeps boxes and spheres along a floor built from two adjacent boxes, sunk into it by a little more each time
+//As resting bodies are, and into a wall standing where the second box of the floor would be.
+//Prints the nanoseconds per swept test, the number of sweeps which hit the second box of the floor, which should be 0 as the seam between it's boxes is not an obstacle,
+//And the number of sweeps which missed the wall, which should also be 0.
+//
+//Parameters:
+//	iterations: The number of times every sweep is tested
+void Benchmark_SweptTileSeams(unsigned int iterations)
+{
+	if(iterations == 0)
+	{
+		printf("Benchmark_SweptTileSeams failed! Must run at least one iteration. Benchmark not run.\n");
+		return;
+	}
+
+	//The shapes start on the floor's first box, from x = 0 to 1, and slide onto it's second box past the seam at x = 1.
+	//The wall takes the place of the second box but rises above the floor
+	const float floorMin[3] = { 1.0f, -1.0f, -1.0f };
+	const float floorMax[3] = { 2.0f, 0.0f, 1.0f };
+	const float wallMin[3] = { 1.0f, -1.0f, -1.0f };
+	const float wallMax[3] = { 2.0f, 2.0f, 1.0f };
+
+	const unsigned int numDepths = 5;
+	const float depths[5] = { 0.0f, 0.005f, 0.01f, 0.02f, 0.04f };
+	const unsigned int numFalls = 3;
+	const float falls[3] = { 0.0f, -0.01f, -0.05f };
+	const float halfSize = 0.25f;
+
+	unsigned long numSeamHits = 0;
+	unsigned long numWallMisses = 0;
+	unsigned long numTests = 0;
+	float min[3];
+	float max[3];
+	Vec3 center;
+	Vec3 motion;
+
+	double start = Benchmark_GetSeconds();
+	for(unsigned int iteration = 0; iteration < iterations; iteration++)
+	{
+		for(unsigned int i = 0; i < numDepths; i++)
+		{
+			//Each shape starts over the middle of the first box, sunk into the floor
+			center.components[0] = 0.5f;
+			center.components[1] = halfSize - depths[i];
+			center.components[2] = 0.0f;
+			for(int j = 0; j < 3; j++)
+			{
+				min[j] = center.components[j] - halfSize;
+				max[j] = center.components[j] + halfSize;
+			}
+
+			for(unsigned int j = 0; j < numFalls; j++)
+			{
+				//Slide across the seam, the leading side reaches the wall a quarter of the way along
+				motion.components[0] = 1.0f;
+				motion.components[1] = falls[j];
+				motion.components[2] = 0.0f;
+
+				//The first box is hit whenever the shape falls onto it, so only the second box is tested
+				if(CollisionManager_GetSweptAABBTimeOfImpact(min, max, &motion, floorMin, floorMax) >= 0.0f) numSeamHits++;
+				if(CollisionManager_GetSweptSphereTimeOfImpact(&center, halfSize, &motion, floorMin, floorMax) >= 0.0f) numSeamHits++;
+				if(CollisionManager_GetSweptAABBTimeOfImpact(min, max, &motion, wallMin, wallMax) < 0.0f) numWallMisses++;
+				if(CollisionManager_GetSweptSphereTimeOfImpact(&center, halfSize, &motion, wallMin, wallMax) < 0.0f) numWallMisses++;
+				numTests += 4;
+			}
+		}
+	}
+	double seconds = Benchmark_GetSeconds() - start;
+
+	printf("Benchmark_SweptTileSeams: %u iterations\n", iterations);
+	printf("\t%f nanoseconds per swept test\n", seconds * 1e9 / numTests);
+	printf("\t%lu sweeps hit the seam of the floor\n", numSeamHits / iterations);
+	printf("\t%lu sweeps missed the wall\n", numWallMisses / iterations);
+}
+
+///
+//Times the integration kernels which the physics manager runs over the rigid body store against the per body loops they replaced.
+//Two copies of the same bodies are integrated, every fifth body inactive as a sleeping body would be,
+//The impulses and instantaneous torques are restored before each step as the physics manager clears them after each step.
+//Prints the nanoseconds per body for each, and the number of floats and out of date flags in which the copies differ, which should be 0.
+//
+//Parameters:
+//	numBodies: The number of bodies to integrate
+//	iterations: The number of steps to time
+void Benchmark_IntegrationKernels(unsigned int numBodies, unsigned int iterations)
+{
+	if(numBodies == 0 || iterations == 0)
+	{
+		printf("Benchmark_IntegrationKernels failed! Must have at least one body and one iteration. Benchmark not run.\n");
+		return;
+	}
+
+	//Each copy of the bodies is one block of floats laid out as the rigid body store lays out it's arrays:
+	//9 arrays of Vec3, then the orientations, the inverse inertias and the inverse masses
+	const unsigned int numVec3Arrays = 9;
+	const unsigned int floatsPerBody = numVec3Arrays * 3 + 4 + 9 + 1;
+	const unsigned int numFloats = floatsPerBody * numBodies;
+	const unsigned long numCalls = (unsigned long)iterations * numBodies;
+
+	float* initial = (float*)malloc(sizeof(float) * numFloats);
+	float* results = (float*)malloc(sizeof(float) * numFloats);
+	float* kernelResults = (float*)malloc(sizeof(float) * numFloats);
+	unsigned char* active = (unsigned char*)malloc(numBodies);
+	unsigned char* outOfDate = (unsigned char*)malloc(numBodies);
+	unsigned char* kernelOutOfDate = (unsigned char*)malloc(numBodies);
+
+	//Same bodies every run
+	srand(1);
+	for(unsigned int i = 0; i < numFloats; i++)
+	{
+		initial[i] = 2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f;
+	}
+	for(unsigned int i = 0; i < numBodies; i++)
+	{
+		Quat_Normalize((Quat*)(initial + numVec3Arrays * 3 * numBodies) + i);
+		initial[(floatsPerBody - 1) * numBodies + i] = 0.5f + 0.5f * ((float)rand() / (float)RAND_MAX);
+		active[i] = i % 5 != 0;
+	}
+	memcpy(results, initial, sizeof(float) * numFloats);
+	memcpy(kernelResults, initial, sizeof(float) * numFloats);
+	memset(outOfDate, 0, numBodies);
+	memset(kernelOutOfDate, 0, numBodies);
+
+	//The arrays of each copy in the order they are laid out
+	Vec3* vec3s[2][9];
+	Quat* orientations[2];
+	Mat3* inverseInertias[2];
+	float* inverseMasses[2];
+	float* copies[2] = { results, kernelResults };
+	for(int copy = 0; copy < 2; copy++)
+	{
+		for(unsigned int i = 0; i < numVec3Arrays; i++)
+		{
+			vec3s[copy][i] = (Vec3*)(copies[copy] + i * 3 * numBodies);
+		}
+		orientations[copy] = (Quat*)(copies[copy] + numVec3Arrays * 3 * numBodies);
+		inverseInertias[copy] = (Mat3*)(copies[copy] + (numVec3Arrays * 3 + 4) * numBodies);
+		inverseMasses[copy] = copies[copy] + (floatsPerBody - 1) * numBodies;
+	}
+	//Positions, velocities, accelerations, impulses, forces, angular velocities, angular accelerations, instantaneous torques, torques
+	const unsigned int impulses = 3;
+	const unsigned int instantaneousTorques = 7;
+	const float dt = 1.0f / 120.0f;
+
+	printf("Benchmark_IntegrationKernels: %u iterations over %u bodies using %s\n", iterations, numBodies, SIMDMath_IsAccelerated() ? "SSE kernels" : "scalar fallbacks");
+
+	double start;
+	double loopSeconds;
+	double kernelSeconds;
+
+	//Linear integration
+	start = Benchmark_GetSeconds();
+	for(unsigned int i = 0; i < iterations; i++)
+	{
+		memcpy(vec3s[0][impulses], initial + impulses * 3 * numBodies, sizeof(Vec3) * numBodies);
+		Benchmark_IntegrateLinearLoop(vec3s[0][0], vec3s[0][1], vec3s[0][2], vec3s[0][3], vec3s[0][4], inverseMasses[0], active, numBodies, dt);
+	}
+	loopSeconds = Benchmark_GetSeconds() - start;
+	start = Benchmark_GetSeconds();
+	for(unsigned int i = 0; i < iterations; i++)
+	{
+		memcpy(vec3s[1][impulses], initial + impulses * 3 * numBodies, sizeof(Vec3) * numBodies);
+		SIMDMath_IntegrateLinear(vec3s[1][0]->components, vec3s[1][1]->components, vec3s[1][2]->components, vec3s[1][3]->components, vec3s[1][4]->components, inverseMasses[1], active, numBodies, dt);
+	}
+	kernelSeconds = Benchmark_GetSeconds() - start;
+	Benchmark_PrintKernelResult("IntegrateLinear", loopSeconds, kernelSeconds, numCalls, results, kernelResults, numFloats);
+
+	//Rotational integration
+	start = Benchmark_GetSeconds();
+	for(unsigned int i = 0; i < iterations; i++)
+	{
+		memcpy(vec3s[0][instantaneousTorques], initial + instantaneousTorques * 3 * numBodies, sizeof(Vec3) * numBodies);
+		Benchmark_IntegrateAngularLoop(orientations[0], outOfDate, vec3s[0][5], vec3s[0][6], vec3s[0][7], vec3s[0][8], inverseInertias[0], active, numBodies, dt);
+	}
+	loopSeconds = Benchmark_GetSeconds() - start;
+	start = Benchmark_GetSeconds();
+	for(unsigned int i = 0; i < iterations; i++)
+	{
+		memcpy(vec3s[1][instantaneousTorques], initial + instantaneousTorques * 3 * numBodies, sizeof(Vec3) * numBodies);
+		SIMDMath_IntegrateAngular(orientations[1]->components, kernelOutOfDate, vec3s[1][5]->components, vec3s[1][6]->components, vec3s[1][7]->components, vec3s[1][8]->components, inverseInertias[1]->components, active, numBodies, dt);
+	}
+	kernelSeconds = Benchmark_GetSeconds() - start;
+	Benchmark_PrintKernelResult("IntegrateAngular", loopSeconds, kernelSeconds, numCalls, results, kernelResults, numFloats);
+
+	unsigned int flagMismatches = 0;
+	for(unsigned int i = 0; i < numBodies; i++)
+	{
+		if(outOfDate[i] != kernelOutOfDate[i])
+		{
+			flagMismatches++;
+		}
+	}
+	printf("\t%u mismatched out of date flags\n", flagMismatches);
+
+	free(initial);
+	free(results);
+	free(kernelResults);
+	free(active);
+	free(outOfDate);
+	free(kernelOutOfDate);
+}
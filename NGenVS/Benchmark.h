@@ -0,0 +1,359 @@
+//Unfortunately Windows Only for a little while...
+#if defined(_WIN32) || defined(_WIN64)
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <windows.h>
+
+#include "CollisionManager.h"
+#include "ObjectManager.h"
+
+//Internals
+static unsigned long benchmarkAllocationCount;	//Heap allocations made since counting began
+static unsigned char benchmarkCountingAllocations;	//1 while allocations are being counted
+
+#ifdef _DEBUG
+///
+//Debug CRT allocation hook which counts every allocation and reallocation
+//
+//Parameters:
+//	allocType: The type of heap operation (_HOOK_ALLOC, _HOOK_REALLOC, _HOOK_FREE)
+//	All other parameters are ignored
+//
+//Returns:
+//	1 so the heap operation always proceeds
+static int Benchmark_AllocationHook(int allocType, void* userData, size_t size, int blockType, long requestNumber, const unsigned char* filename, int lineNumber);
+#endif
+
+//The general loops are kept out of line so they are timed through a call, just as the kernels are
+
+///
+//The general scalar dot product loop which Vector_DotProductArray used for every dimension
+//
+//Parameters:
+//	vec1: The first vector being dotted
+//	vec2: The other vector being dotted
+//	dim: The dimension of the vectors
+//
+//Returns:
+//	Float representing value of the dot product
+__declspec(noinline) static float Benchmark_DotProductLoop(const float* vec1, const float* vec2, const int dim);
+
+///
+//The general scalar addition loop which Vector_AddArray used for every dimension
+//
+//Parameters:
+//	dest: The destination of the sum
+//	vec1: The first addend
+//	vec2: The second addend
+//	dim: The dimension of the vectors
+__declspec(noinline) static void Benchmark_AddLoop(float* dest, const float* vec1, const float* vec2, const int dim);
+
+///
+//The general scalar product loop which Matrix_GetProductMatrixArray used for every size
+//
+//Parameters:
+//	dest: The destination of the product
+//	LHSMatrix: The left hand side matrix
+//	RHSMatrix: The right hand side matrix
+//	dim: The number of rows and columns in each matrix
+__declspec(noinline) static void Benchmark_GetProductMatrixLoop(float* dest, const float* LHSMatrix, const float* RHSMatrix, const int dim);
+
+///
+//The general scalar transformation which Matrix_TransformVectorArray used for every size,
+//Including it's heap allocated copy of the vector
+//
+//Parameters:
+//	LHSMatrix: The matrix
+//	RHSVector: The vector being transformed
+//	dim: The number of rows and columns in the matrix
+__declspec(noinline) static void Benchmark_TransformVectorLoop(const float* LHSMatrix, float* RHSVector, const int dim);
+
+///
+//The per body loop which PhysicsManager_UpdateLinearPhysicsOfBodies used before SIMDMath_IntegrateLinear,
+//Branching over each inactive body and integrating the others one component at a time
+//
+//Parameters:
+//	positions: The position of each body
+//	velocities: The velocity of each body
+//	accelerations: The destination of the acceleration of each body
+//	netImpulses: The net impulse of each body, scaled by the body's inverse mass
+//	netForces: The net force of each body
+//	inverseMasses: The inverse mass of each body
+//	active: 1 if the body is integrated, 0 if it is left as it is
+//	numBodies: The number of bodies to integrate
+//	dt: The time step
+__declspec(noinline) static void Benchmark_IntegrateLinearLoop(Vec3* positions, Vec3* velocities, Vec3* accelerations, Vec3* netImpulses, const Vec3* netForces, const float* inverseMasses, const unsigned char* active, unsigned int numBodies, float dt);
+
+///
+//The per body loop which PhysicsManager_UpdateRotationalPhysicsOfBodies used before SIMDMath_IntegrateAngular,
+//Branching over each inactive body and integrating the others through the Mat3, Vec3 and Quat functions
+//
+//Parameters:
+//	orientations: The orientation of each body
+//	rotationsOutOfDate: Set to 1 for each body which is integrated
+//	angularVelocities: The angular velocity of each body
+//	angularAccelerations: The destination of the angular acceleration of each body
+//	netInstantaneousTorques: The net instantaneous torque of each body, transformed by the body's inverse inertia
+//	netTorques: The net torque of each body
+//	inverseInertias: The inverse inertia of each body
+//	active: 1 if the body is integrated, 0 if it is left as it is
+//	numBodies: The number of bodies to integrate
+//	dt: The time step
+__declspec(noinline) static void Benchmark_IntegrateAngularLoop(Quat* orientations, unsigned char* rotationsOutOfDate, Vec3* angularVelocities, Vec3* angularAccelerations, Vec3* netInstantaneousTorques, const Vec3* netTorques, const Mat3* inverseInertias, const unsigned char* active, unsigned int numBodies, float dt);
+
+///
+//Prints the timings of a math kernel against the loop it replaces
+//And the number of floats in which their results differ
+//
+//Parameters:
+//	name: The name of the kernel
+//	loopSeconds: The seconds spent in the general loop
+//	kernelSeconds: The seconds spent in the kernel
+//	numCalls: The number of times each was called
+//	results: The results of the general loop
+//	kernelResults: The results of the kernel
+//	numResults: The number of floats in each set of results
+static void Benchmark_PrintKernelResult(const char* name, double loopSeconds, double kernelSeconds, unsigned long numCalls, const float* results, const float* kernelResults, unsigned int numResults);
+
+///
+//Runs the narrow phase test on every pair of objects which share a leaf of an oct tree node
+//
+//Parameters:
+//	node: The oct tree node to test the leaves of
+//	collision: The collision to store the results of each test in
+//
+//Returns:
+//	The number of pairs which were tested
+static unsigned long Benchmark_TestOctTreeNode(OctTree_Node* node, Collision* collision);
+
+///
+//Counts the pairs of objects which share a leaf of an oct tree node
+//
+//Parameters:
+//	node: The oct tree node to count the pairs in the leaves of
+//
+//Returns:
+//	The number of pairs the narrow phase tests for the node
+static unsigned long Benchmark_CountOctTreePairs(OctTree_Node* node);
+
+///
+//Clears the list of collisions each collider took part in
+//The collisions in those lists are freed by the next collision update, so a benchmark which registers collisions
+//Outside of the game loop must clear them before returning.
+static void Benchmark_ClearCurrentCollisions(void);
+
+///
+//Tests the pairs found by the last update of a broad phase for collisions
+//
+//Parameters:
+//	broadPhase: The broad phase whose pairs are tested
+//
+//Returns:
+//	A pointer to the dynamic array of pointers to the collisions which occurred
+static DynamicArray* Benchmark_TestBroadPhasePairs(BroadPhase broadPhase);
+
+///
+//Gets the name of a broad phase for printing
+//
+//Parameters:
+//	broadPhase: The broad phase to name
+//
+//Returns:
+//	A null terminated string naming the broad phase
+static const char* Benchmark_GetBroadPhaseName(BroadPhase broadPhase);
+
+///
+//Creates a game object with a convex hull collider shaped like a regular prism
+//The prism has a radius of 1 and a height of 2, and has one axis per side as a hull built from a mesh would.
+//
+//Parameters:
+//	numSides: The number of sides of the prism's base
+//
+//Returns:
+//	A pointer to a newly allocated and initialized game object with the prism collider
+static GObject* Benchmark_CreatePrism(unsigned int numSides);
+
+///
+//Puts a body of the integration stress scene back in it's starting state.
+//Bodies start on a grid, spinning, and moving with a velocity which depends on their index.
+//
+//Parameters:
+//	obj: The game object of the body to reset
+//	index: The index of the body in the stress scene
+//	gridSize: The number of bodies along each side of the grid
+static void Benchmark_ResetIntegrationBody(GObject* obj, unsigned int index, unsigned int gridSize);
+
+///
+//Puts a prism of the moving broad phase stress scene back in it's starting place.
+//Prisms start spread through a cube, moving with a velocity which depends on their index.
+//
+//Parameters:
+//	obj: The prism to reset
+//	velocityDest: Array of 3 floats to store the prism's velocity in, in units per frame
+//	index: The index of the prism in the stress scene
+//	halfSize: Half the length of each side of the cube
+static void Benchmark_ResetMovingPrism(GObject* obj, float* velocityDest, unsigned int index, float halfSize);
+
+///
+//Moves each prism of the moving broad phase stress scene by it's velocity,
+//Bouncing the prisms which left the cube back towards it's center.
+//
+//Parameters:
+//	prisms: The prisms to move
+//	velocities: 3 floats per prism holding it's velocity in units per frame
+//	numObjects: The number of prisms
+//	halfSize: Half the length of each side of the cube
+static void Benchmark_MovePrisms(GObject** prisms, float* velocities, unsigned int numObjects, float halfSize);
+
+//Functions
+
+///
+//Begins counting heap allocations.
+//Allocations can only be counted in debug builds, where the debug CRT allows hooking the heap.
+void Benchmark_BeginAllocationCount(void);
+
+///
+//Stops counting heap allocations
+//
+//Returns:
+//	The number of heap allocations made since Benchmark_BeginAllocationCount was called
+unsigned long Benchmark_EndAllocationCount(void);
+
+///
+//Gets the current time of the high resolution performance counter
+//
+//Returns:
+//	The current time in seconds
+double Benchmark_GetSeconds(void);
+
+///
+//Runs the object and physics pipeline of the current scene for a number of frames
+//And prints the average number of heap allocations and milliseconds per frame.
+//The simulation is advanced by the frames which are run using the current delta time.
+//
+//Parameters:
+//	numFrames: The number of frames to run
+void Benchmark_PhysicsStep(unsigned int numFrames);
+
+///
+//Times the SIMDMath kernels against the general loops which the Vector_*Array and Matrix_*Array functions
+//Used before the kernels existed, for the 3, 4, 3x3 and 4x4 cases.
+//Also prints the number of floats in which the results differ, which should always be 0.
+//
+//Parameters:
+//	iterations: The number of passes over the operands to time
+void Benchmark_MathKernels(unsigned int iterations);
+
+///
+//Runs only the narrow phase tests on every pair of objects sharing an oct tree leaf in the current scene
+//For a number of frames, without moving any objects or registering any collisions.
+//The first frame is not measured so the convex hull world caches can be built,
+//After which the number of heap allocations per frame should be 0.
+//
+//Parameters:
+//	numFrames: The number of frames to measure
+void Benchmark_NarrowPhase(unsigned int numFrames);
+
+///
+//Times SAT against GJK and EPA on a pair of overlapping, rotated prisms with a growing number of points
+//And prints the overlap each algorithm finds and the angle between their minimum translation vectors.
+//
+//Parameters:
+//	iterations: The number of times each pair is tested with each algorithm
+void Benchmark_ConvexHullTests(unsigned int iterations);
+
+///
+//Times every broad phase on the current scene for a number of frames each,
+//Without moving any objects. For each broad phase prints the time spent updating it's structure,
+//The time spent testing the pairs it finds, the number of pairs and the number of collisions found.
+//Every broad phase should find the same number of collisions.
+//
+//Parameters:
+//	numFrames: The number of frames to measure each broad phase for
+void Benchmark_BroadPhase(unsigned int numFrames);
+
+///
+//Builds a stress scene of overlapping prisms in an oct tree of it's own, then times the oct tree narrow phase on it
+//With every number of threads from 1 to the number of hardware threads for a number of frames each.
+//For each number of threads prints the milliseconds per frame, the speedup over 1 thread and the number of collisions found.
+//Every number of threads should find the same number of collisions. The stress scene is freed afterwards.
+//
+//Parameters:
+//	numObjects: The number of prisms in the stress scene
+//	numFrames: The number of frames to measure each number of threads for
+void Benchmark_NarrowPhaseThreads(unsigned int numObjects, unsigned int numFrames);
+
+///
+//Builds a stress scene of rigid bodies without colliders in a list of it's own, then times the physics manager's update of it
+//With every number of threads from 1 to the number of hardware threads for a number of steps each.
+//For each number of threads prints the milliseconds per step, the speedup over 1 thread and the sum of the final positions.
+//The scene is reset before each number of threads, so every number of threads should give the same sum. The stress scene is freed afterwards.
+//
+//Parameters:
+//	numBodies: The number of bodies in the stress scene
+//	numSteps: The number of steps to measure each number of threads for
+void Benchmark_IntegrationThreads(unsigned int numBodies, unsigned int numSteps);
+
+///
+//Builds a stress scene of prisms which all move every frame, in an oct tree, a loose oct tree and a linear oct tree of it's own,
+//Then times updating each structure as the prisms move for a number of frames.
+//The oct trees relocate the objects which moved while the linear oct tree is rebuilt from scratch, on one thread and then on every hardware thread.
+//For each prints the milliseconds per update and the number of pairs found per frame.
+//The loose and linear oct trees both find exactly the pairs whose bounds overlap, so they should find the same number of pairs.
+//Every run moves the prisms the same way. The stress scene is freed afterwards.
+//
+//Parameters:
+//	numObjects: The number of prisms in the stress scene
+//	numFrames: The number of frames to measure each structure for
+void Benchmark_MovingBroadPhase(unsigned int numObjects, unsigned int numFrames);
+
+///
+//Times a hash map under the access pattern of the oct tree's map of object logs, keyed by pointers to objects.
+//Each key is checked for before it is added, as objects join the tree, then every key is looked up each frame as the tree is updated,
+//And each frame a sixteenth of the keys are removed and added back as objects leave and join the scene.
+//Prints the nanoseconds and heap allocations per add, lookup and removal,
+//And the number of lookups which did not find the data added with their key, which should be 0.
+//
+//Parameters:
+//	numKeys: The number of keys in the map
+//	numFrames: The number of frames of lookups and removals to measure
+void Benchmark_HashMap(unsigned int numKeys, unsigned int numFrames);
+
+///
+//Times the ways of filling a dynamic array and of removing from one.
+//Vertices the size of a loaded mesh's positions are appended one at a time by copying, one at a time by writing in place, and all at once,
+//Then the occupants of a crowded oct tree node are each removed and added back,
+//Both by the ordered removal which shifts every later occupant and by moving the last occupant into the removed one's place.
+//Prints the nanoseconds and heap allocations per element for each,
+//And the number of occupants missing once every removal was added back, which should be 0.
+//
+//Parameters:
+//	numElements: The number of vertices appended by each fill
+//	numRepeats: The number of times each fill, and each removal of every occupant, is repeated
+void Benchmark_DynamicArray(unsigned int numElements, unsigned int numRepeats);
+
+///
+//Sweeps boxes and spheres along a floor built from two adjacent boxes, sunk into it by a little more each time
+//As resting bodies are, and into a wall standing where the second box of the floor would be.
+//Prints the nanoseconds per swept test, the number of sweeps which hit the second box of the floor, which should be 0 as the seam between it's boxes is not an obstacle,
+//And the number of sweeps which missed the wall, which should also be 0.
+//
+//Parameters:
+//	iterations: The number of times every sweep is tested
+void Benchmark_SweptTileSeams(unsigned int iterations);
+
+///
+//Times the integration kernels which the physics manager runs over the rigid body store against the per body loops they replaced.
+//Two copies of the same bodies are integrated, every fifth body inactive as a sleeping body would be,
+//The impulses and instantaneous torques are restored before each step as the physics manager clears them after each step.
+//Prints the nanoseconds per body for each, and the number of floats and out of date flags in which the copies differ, which should be 0.
+//
+//Parameters:
+//	numBodies: The number of bodies to integrate
+//	iterations: The number of steps to time
+void Benchmark_IntegrationKernels(unsigned int numBodies, unsigned int iterations);
+
+#endif	//If not defined
+#endif	//If Windows
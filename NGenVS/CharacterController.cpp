@@ -24,6 +24,7 @@ struct State_CharacterController_Members
 	float maxSpeed;
 	float coolDown;
 	float timer;
+	unsigned int bulletPool;	//Pool of the object manager the bullets are spawned from, so a bullet's components are reused once it is removed
 };
 
 
@@ -46,6 +47,7 @@ void State_CharacterController_Initialize(State* s, float velocity, float angula
 	members->maxSpeed = maxVel;
 	members->coolDown = shootSpeed;
 	members->timer = 0.0f;
+	members->bulletPool = ObjectManager_AddPool();
 	s->State_Update = State_CharacterController_Update;
 	s->State_Members_Free = State_CharacterController_Free;
 }
@@ -242,23 +244,35 @@ void State_CharacterController_ShootBullet(GObject* GO, State* state)
 			Matrix_SliceRow(&direction, cam->rotationMatrix, 2, 0, 3);
 			Vector_Scale(&direction,-1.0f);
 
-			// Create the bullet object
-			GObject* bullet = GObject_Allocate();
-			GObject_Initialize(bullet);
+			// Spawn the bullet object, a recycled bullet already has it's components and it's body is at rest
+			GObject* bullet = ObjectManager_SpawnObject(members->bulletPool);
 
-			//bullet->mesh = AssetManager_LookupMesh("Sphere");
-			bullet->mesh = AssetManager_LookupMesh("Arrow");
-			bullet->texture = AssetManager_LookupTexture("Arrow");
+			if(bullet->body == NULL)
+			{
+				//bullet->mesh = AssetManager_LookupMesh("Sphere");
+				bullet->mesh = AssetManager_LookupMesh("Arrow");
+				bullet->texture = AssetManager_LookupTexture("Arrow");
 
 
-			bullet->body = RigidBody_Allocate();
-			RigidBody_Initialize(bullet->body, bullet->frameOfReference, 0.45f);
-			bullet->body->coefficientOfRestitution = 0.2f;
+				bullet->body = RigidBody_Allocate();
+				RigidBody_Initialize(bullet->body, bullet->frameOfReference, 0.45f);
 
-			bullet->collider = Collider_Allocate();
-			ConvexHullCollider_Initialize(bullet->collider);
-			ConvexHullCollider_MakeRectangularCollider(bullet->collider->data->convexHullData, 0.1f, 2.0f, 0.1f);
-			//AABBCollider_Initialize(bullet->collider, 2.0f, 2.0f, 2.0f, &Vector_ZERO);
+				bullet->collider = Collider_Allocate();
+				ConvexHullCollider_Initialize(bullet->collider);
+				ConvexHullCollider_MakeRectangularCollider(bullet->collider->data->convexHullData, 0.1f, 2.0f, 0.1f);
+				//AABBCollider_Initialize(bullet->collider, 2.0f, 2.0f, 2.0f, &Vector_ZERO);
+
+				//Add remove state
+				State* state = State_Allocate();
+				State_Remove_Initialize(state, 5.0f);
+				GObject_AddState(bullet, state);
+			}
+			else
+			{
+				//A recycled bullet keeps it's states, so it's remove state is restarted
+				State_Remove_Reset(GObject_FindState(bullet, State_Remove_Update), 5.0f);
+			}
+			bullet->body->coefficientOfRestitution = 0.2f;
 
 			//Lay arrow flat
 			GObject_Rotate(bullet, &Vector_E1, -3.14159f / 2.0f);
@@ -271,8 +285,10 @@ void State_CharacterController_ShootBullet(GObject* GO, State* state)
 			//Transpose it to get correct direction
 			Matrix_Transpose(&rot);
 			//Rotate the bullet
-			Matrix_TransformMatrix(&rot, bullet->frameOfReference->rotation);
-			Matrix_TransformMatrix(&rot, bullet->body->frame->rotation);
+			Matrix orientation;
+			Matrix_INIT_ON_STACK(orientation, 3, 3);
+			Matrix_GetProductMatrix(&orientation, &rot, bullet->frameOfReference->rotation);
+			GObject_SetRotation(bullet, &orientation);
 
 
 			Vector vector;
@@ -293,11 +309,6 @@ void State_CharacterController_ShootBullet(GObject* GO, State* state)
 			//Vector_Increment(bullet->body->velocity,&direction);
 			RigidBody_ApplyImpulse(bullet->body,&direction,&Vector_ZERO);
 
-			//Add remove state
-			State* state = State_Allocate();
-			State_Remove_Initialize(state, 5.0f);
-			GObject_AddState(bullet, state);
-
 			ObjectManager_AddObject(bullet);
 
 			members->timer = 0;
@@ -31,6 +31,69 @@ Collider* Collider_Allocate()
 	return collider;
 }
 
+///
+//Gets the world space axis aligned bounds of a collider of any type
+//
+//Parameters:
+//	minDest: Array of 3 floats to store the minimum bound on each axis in
+//	maxDest: Array of 3 floats to store the maximum bound on each axis in
+//	collider: The collider to get the bounds of
+//	frame: The frame of reference orienting the collider in world space
+void Collider_GetWorldBounds(float* minDest, float* maxDest, Collider* collider, FrameOfReference* frame)
+{
+	FrameOfReference_UpdateRotation(frame);
+
+	switch(collider->type)
+	{
+	case COLLIDER_SPHERE:
+		{
+			float scaledRadius = SphereCollider_GetScaledRadius(collider->data->sphereData, frame);
+			for(int i = 0; i < 3; i++)
+			{
+				minDest[i] = frame->position->components[i] - scaledRadius;
+				maxDest[i] = frame->position->components[i] + scaledRadius;
+			}
+		}
+		break;
+	case COLLIDER_AABB:
+		{
+			ColliderData_AABB* AABB = collider->data->AABBData;
+			ColliderData_AABB scaled;
+			AABBCollider_GetScaledDimensions(&scaled, AABB, frame);
+
+			float halfDimensions[3] = { scaled.width / 2.0f, scaled.height / 2.0f, scaled.depth / 2.0f };
+			for(int i = 0; i < 3; i++)
+			{
+				float center = frame->position->components[i] + AABB->centroid->components[i];
+				minDest[i] = center - halfDimensions[i];
+				maxDest[i] = center + halfDimensions[i];
+			}
+		}
+		break;
+	case COLLIDER_CONVEXHULL:
+		{
+			//The world cache built here is reused by the narrow phase
+			ColliderData_ConvexHull* convexHull = collider->data->convexHullData;
+			const Vec3* worldPoints = ConvexHullCollider_GetWorldCache(convexHull, frame)->worldPoints;
+
+			for(int i = 0; i < 3; i++)
+			{
+				minDest[i] = maxDest[i] = convexHull->points->size > 0 ? worldPoints[0].components[i] : frame->position->components[i];
+			}
+			for(unsigned int j = 1; j < convexHull->points->size; j++)
+			{
+				for(int i = 0; i < 3; i++)
+				{
+					float value = worldPoints[j].components[i];
+					if(value < minDest[i]) minDest[i] = value;
+					else if(value > maxDest[i]) maxDest[i] = value;
+				}
+			}
+		}
+		break;
+	}
+}
+
 ///
 //Frees memory allocated by a collider of any type
 //
@@ -52,7 +115,7 @@ void Collider_Free(Collider* collider)
 		break;
 	}
 
-	LinkedList_Free(collider->currentCollisions);
+	DynamicArray_Free(collider->currentCollisions);
 
 	//Free the color matrix of the collider
 	Matrix_Free(collider->colorMatrix);
@@ -13,6 +13,9 @@ enum ColliderType
 	COLLIDER_CONVEXHULL
 };
 
+//Internals
+static const unsigned int Collider_numTypes = 3;	//The number of collider types, kept out of the enum so switches over a type need no case for it
+
 //union for the data different colliders will provide
 union ColliderData
 {
@@ -27,7 +30,7 @@ typedef struct Collider
 	ColliderType type;				//Type of collider
 	union ColliderData* data;		//Data of collider
 
-	LinkedList* currentCollisions;	//List of all collisions which occurred with this collider last frame
+	DynamicArray* currentCollisions;	//Pointers to all collisions which occurred with this collider in the last physics step
 
 	unsigned char debug;			//Is collider in debug mode?
 	Mesh* representation;			//ptr to Mesh representation of collider
@@ -55,8 +58,9 @@ static void Collider_Initialize(Collider* collider, ColliderType type, Mesh* rep
 	collider->data = (ColliderData*)malloc(sizeof(ColliderData));
 	collider->type = type;
 
-	collider->currentCollisions = LinkedList_Allocate();
-	LinkedList_Initialize(collider->currentCollisions);
+	//Cleared rather than freed each frame, so it only allocates when a collider is in more collisions than ever before
+	collider->currentCollisions = DynamicArray_Allocate();
+	DynamicArray_Initialize(collider->currentCollisions, sizeof(struct Collision*));
 
 	//Initialize with debug mode on & setup debug settings
 	collider->debug = 0;
@@ -85,6 +89,16 @@ InitializerPtr Collider_GetInitializer(void);
 //Destroys the above initializer pointer so no other files can access it!
 void Collider_DestroyInitializerPtr(void);
 
+///
+//Gets the world space axis aligned bounds of a collider of any type
+//
+//Parameters:
+//	minDest: Array of 3 floats to store the minimum bound on each axis in
+//	maxDest: Array of 3 floats to store the maximum bound on each axis in
+//	collider: The collider to get the bounds of
+//	frame: The frame of reference orienting the collider in world space
+void Collider_GetWorldBounds(float* minDest, float* maxDest, Collider* collider, FrameOfReference* frame);
+
 ///
 //Frees memory allocated by a collider of any type
 //
@@ -1,6 +1,7 @@
 #include "CollisionManager.h"
 #include <stdio.h>
 #include <math.h>
+#include <float.h>
 ///
 //Initializes the Collision Manager
 void CollisionManager_Initialize(void)
@@ -27,6 +28,65 @@ void CollisionManager_Free(void)
 	CollisionManager_FreeBuffer(collisionBuffer);
 }
 
+///
+//Sets the algorithm used to test a pair of collider types for collision
+//
+//Parameters:
+//	type1: The collider type of one object in the pair
+//	type2: The collider type of the other object in the pair
+//	algorithm: The algorithm to test the pair with
+void CollisionManager_SetNarrowPhaseAlgorithm(ColliderType type1, ColliderType type2, NarrowPhaseAlgorithm algorithm)
+{
+	//Pairs are tested in whichever order their objects are found, so both orders must agree
+	collisionBuffer->narrowPhaseAlgorithms[type1][type2] = algorithm;
+	collisionBuffer->narrowPhaseAlgorithms[type2][type1] = algorithm;
+}
+
+///
+//Gets the algorithm used to test a pair of collider types for collision
+//
+//Parameters:
+//	type1: The collider type of one object in the pair
+//	type2: The collider type of the other object in the pair
+//
+//Returns:
+//	The algorithm the pair is tested with
+NarrowPhaseAlgorithm CollisionManager_GetNarrowPhaseAlgorithm(ColliderType type1, ColliderType type2)
+{
+	return collisionBuffer->narrowPhaseAlgorithms[type1][type2];
+}
+
+///
+//Gets the pair cache kept by the oct tree, sweep and prune and AABB tree updates
+//
+//Returns:
+//	A pointer to the pair cache, holding an entry for each pair colliding in the last update
+PairCache* CollisionManager_GetPairCache(void)
+{
+	return collisionBuffer->pairCache;
+}
+
+///
+//Gets the pairs of objects which stopped colliding during the last oct tree, sweep and prune or AABB tree update
+//
+//Returns:
+//	A pointer to a dynamic array of PairCache_Entry, one for each pair whose contact ended
+DynamicArray* CollisionManager_GetEndedContacts(void)
+{
+	return collisionBuffer->pairCache->ended;
+}
+
+///
+//Forgets every pair containing an object.
+//Must be called when an object with a collider is removed, before it is freed.
+//
+//Parameters:
+//	obj: A pointer to the object to forget the pairs of
+void CollisionManager_RemoveContacts(GObject* obj)
+{
+	PairCache_RemoveObject(collisionBuffer->pairCache, obj);
+}
+
 ///
 //Tests for collisions on all objects which have colliders 
 //compiling a list of game objects which test true
@@ -35,27 +95,19 @@ void CollisionManager_Free(void)
 //	gameObjects: THe list of gameObjects to test
 //
 //Returns:
-//	A pointer to a linked list of collisions which occurred this frame.
-LinkedList* CollisionManager_UpdateList(LinkedList* gameObjects)
+//	A pointer to a dynamic array of pointers to the collisions which occurred this frame.
+DynamicArray* CollisionManager_UpdateList(LinkedList* gameObjects)
 {
-	//Clear the current list of collisions
-	LinkedList_Node* currentNode = collisionBuffer->collisions->head;
-	LinkedList_Node* nextNode = NULL;
-	while(currentNode != NULL)
-	{
-		nextNode = currentNode->next;
-		CollisionManager_FreeCollision((Collision*)currentNode->data);
-		currentNode = nextNode;
-	}
-	LinkedList_Clear(collisionBuffer->collisions);
+	//Free the collisions of the last update
+	CollisionManager_ClearCollisions();
 
 	//Allocates a collision to store the first registered collision
 	Collision* collision = CollisionManager_AllocateCollision();
 	CollisionManager_InitializeCollision(collision);
 
 	//Begin looping through gameObjects
-	currentNode = gameObjects->head;
-	nextNode = NULL;
+	LinkedList_Node* currentNode = gameObjects->head;
+	LinkedList_Node* nextNode = NULL;
 	LinkedList_Node* iterator = NULL;
 	while(currentNode != NULL)
 	{
@@ -73,7 +125,7 @@ LinkedList* CollisionManager_UpdateList(LinkedList* gameObjects)
 			{
 				//Get the next object & make sure it has a collider
 				GObject* iteratorObj = (GObject*)iterator->data;
-				if(iteratorObj->collider != NULL)
+				if(iteratorObj->collider != NULL && !PairCache_IsPairAsleep(currentObj, iteratorObj))
 				{
 					CollisionManager_TestCollision( 
 						collision,
@@ -95,7 +147,7 @@ LinkedList* CollisionManager_UpdateList(LinkedList* gameObjects)
 
 					//If code reaches this point, all tests detected collision.
 					//add to collided list
-					LinkedList_Append(collisionBuffer->collisions, collision);
+					DynamicArray_Append(collisionBuffer->collisions, &collision);
 
 					//TODO: Remove
 					//Change the color of colliders to red until they are drawn
@@ -127,35 +179,198 @@ LinkedList* CollisionManager_UpdateList(LinkedList* gameObjects)
 
 ///
 //Tests for collisions on all objects in an oct tree compiling a list of collisions which occur
+//A loose oct tree must have been updated first, as it's pairs are found by the update
 //
 //Parameters:
 //	tree: The oct tree holding the game objects to test
 //
-//Returns: A pointer to a linked list of collisions which occurred this frame
-LinkedList* CollisionManager_UpdateOctTree(OctTree* tree)
+//Returns: A pointer to a dynamic array of pointers to the collisions which occurred this frame
+DynamicArray* CollisionManager_UpdateOctTree(OctTree* tree)
 {
-	//Clear the current linked list of collisions
-	LinkedList_Node* currentNode = collisionBuffer->collisions->head;
-	LinkedList_Node* nextNode = NULL;
-	while(currentNode != NULL)
+	//Free the collisions of the last update
+	CollisionManager_ClearCollisions();
+
+	
+
+	//Update root node to fill the array of collisions with all collisions in the oct tree
+	PairCache_BeginFrame(collisionBuffer->pairCache);
+	if(tree->loose)
 	{
-		nextNode = currentNode->next;
-		CollisionManager_FreeCollision((Collision*)currentNode->data);
-		currentNode = nextNode;
+		//A loose tree finds it's pairs when it is updated, like the other broad phases
+		Collision* collision = CollisionManager_AllocateCollision();
+		CollisionManager_InitializeCollision(collision);
+
+		OctTree_Pair* pairs = (OctTree_Pair*)tree->pairs->data;
+		for(unsigned int i = 0; i < tree->pairs->size; i++)
+		{
+			collision = CollisionManager_TestPair(collision, pairs[i].obj1, pairs[i].obj2);
+		}
+
+		CollisionManager_FreeCollision(collision);
+	}
+	else if(JobManager_GetNumThreads() > 1)
+	{
+		CollisionManager_UpdateOctTreeParallel(tree);
 	}
-	LinkedList_Clear(collisionBuffer->collisions);
+	else
+	{
+		CollisionManager_UpdateOctTreeNode(tree->root);
+	}
+	PairCache_EndFrame(collisionBuffer->pairCache);
 
-	
+	//Return the array of collisions
+	return collisionBuffer->collisions;
+}
+
+///
+//Tests for collisions on every pair of objects a sweep and prune found to have overlapping bounds
+//Compiling a list of collisions which occur
+//
+//Parameters:
+//	sap: The updated sweep and prune holding the game objects to test
+//
+//Returns: A pointer to a dynamic array of pointers to the collisions which occurred this frame
+DynamicArray* CollisionManager_UpdateSweepAndPrune(SweepAndPrune* sap)
+{
+	//Free the collisions of the last update
+	CollisionManager_ClearCollisions();
 
-	//Update root node to fill the list of collisions with all collisions in the oct tree
-	CollisionManager_UpdateOctTreeNode(tree->root);
+	//Allocates a collision to store the first registered collision
+	Collision* collision = CollisionManager_AllocateCollision();
+	CollisionManager_InitializeCollision(collision);
+
+	PairCache_BeginFrame(collisionBuffer->pairCache);
+	SweepAndPrune_Pair* pairs = (SweepAndPrune_Pair*)sap->pairs->data;
+	for(unsigned int i = 0; i < sap->pairs->size; i++)
+	{
+		collision = CollisionManager_TestPair(collision, pairs[i].obj1, pairs[i].obj2);
+	}
+	PairCache_EndFrame(collisionBuffer->pairCache);
+
+	//Delete the last unused allocated collision
+	CollisionManager_FreeCollision(collision);
+
+	return collisionBuffer->collisions;
+}
+
+///
+//Tests for collisions on every pair of objects a dynamic AABB tree found to have overlapping bounds
+//Compiling a list of collisions which occur
+//
+//Parameters:
+//	tree: The updated dynamic AABB tree holding the game objects to test
+//
+//Returns: A pointer to a dynamic array of pointers to the collisions which occurred this frame
+DynamicArray* CollisionManager_UpdateAABBTree(AABBTree* tree)
+{
+	//Free the collisions of the last update
+	CollisionManager_ClearCollisions();
+
+	//Allocates a collision to store the first registered collision
+	Collision* collision = CollisionManager_AllocateCollision();
+	CollisionManager_InitializeCollision(collision);
+
+	PairCache_BeginFrame(collisionBuffer->pairCache);
+	AABBTree_Pair* pairs = (AABBTree_Pair*)tree->pairs->data;
+	for(unsigned int i = 0; i < tree->pairs->size; i++)
+	{
+		collision = CollisionManager_TestPair(collision, pairs[i].obj1, pairs[i].obj2);
+	}
+	PairCache_EndFrame(collisionBuffer->pairCache);
+
+	//Delete the last unused allocated collision
+	CollisionManager_FreeCollision(collision);
+
+	return collisionBuffer->collisions;
+}
+
+///
+//Tests for collisions on every pair of objects a linear oct tree found to have overlapping bounds
+//Compiling a list of collisions which occur
+//
+//Parameters:
+//	tree: The rebuilt linear oct tree holding the game objects to test
+//
+//Returns: A pointer to a dynamic array of pointers to the collisions which occurred this frame
+DynamicArray* CollisionManager_UpdateLinearOctTree(LinearOctTree* tree)
+{
+	//Free the collisions of the last update
+	CollisionManager_ClearCollisions();
+
+	//Allocates a collision to store the first registered collision
+	Collision* collision = CollisionManager_AllocateCollision();
+	CollisionManager_InitializeCollision(collision);
+
+	PairCache_BeginFrame(collisionBuffer->pairCache);
+	LinearOctTree_Pair* pairs = (LinearOctTree_Pair*)tree->pairs->data;
+	for(unsigned int i = 0; i < tree->pairs->size; i++)
+	{
+		collision = CollisionManager_TestPair(collision, pairs[i].obj1, pairs[i].obj2);
+	}
+	PairCache_EndFrame(collisionBuffer->pairCache);
+
+	//Delete the last unused allocated collision
+	CollisionManager_FreeCollision(collision);
 
-	//Return the list of collisions
 	return collisionBuffer->collisions;
 }
 
 ///
-//Tests for collisions on all objects within an oct tree node appending to a list of collisions which occur
+//Frees the collisions registered by the last update and clears the array holding them
+static void CollisionManager_ClearCollisions(void)
+{
+	Collision** collisions = (Collision**)collisionBuffer->collisions->data;
+	for(unsigned int i = 0; i < collisionBuffer->collisions->size; i++)
+	{
+		CollisionManager_FreeCollision(collisions[i]);
+	}
+	DynamicArray_Clear(collisionBuffer->collisions);
+}
+
+///
+//Tests for a collision between a pair of objects found by a broad phase, registering it if one occurs
+//
+//Parameters:
+//	collision: The collision to store the results of the test in
+//	obj1: First game object to test (Must have collider attached)
+//	obj2: Second game object to test (Must have collider attached)
+//
+//Returns:
+//	A newly allocated collision for the next test if this one was registered, else the given collision
+static Collision* CollisionManager_TestPair(Collision* collision, GObject* obj1, GObject* obj2)
+{
+	//Pairs which are asleep have not moved since they were last tested
+	if(PairCache_IsPairAsleep(obj1, obj2))
+	{
+		return collision;
+	}
+
+	CollisionManager_TestCollision(
+		collision,
+		obj1,
+		obj1->body != NULL ? obj1->body->frame : obj1->frameOfReference,		//If there is a rigidbody use that frame of reference, else use the objects
+		obj2,
+		obj2->body != NULL ? obj2->body->frame : obj2->frameOfReference);	//If there is a rigidbody use that frame of reference, else use the objects
+
+	if(collision->obj1 == NULL)
+	{
+		return collision;
+	}
+
+	//These broad phases find each pair once, so the pair cache is only needed for the pair's contact event
+	if(!CollisionManager_RegisterCollision(collision))
+	{
+		return collision;
+	}
+
+	//Allocate a new collision for next collision detected
+	collision = CollisionManager_AllocateCollision();
+	CollisionManager_InitializeCollision(collision);
+	return collision;
+}
+
+///
+//Tests for collisions on all objects within an oct tree node appending to the array of collisions which occur
 //
 //Parameters:
 //	node: A pointer to the node of the oct tree to check
@@ -179,7 +394,7 @@ static void CollisionManager_UpdateOctTreeNode(OctTree_Node* node)
 }
 
 ///
-//Tests for collisions on an array of objects within an oct tree node appending to a list of collisions which occur
+//Tests for collisions on an array of objects within an oct tree node appending to the array of collisions which occur
 //
 //Parameters:
 //	gameObjects: An array of pointers to game objects to check collisions
@@ -198,6 +413,9 @@ static void CollisionManager_UpdateOctTreeNodeArray(GObject** gameObjects, unsig
 			{
 				if(gameObjects[j]->collider != NULL)
 				{
+					//Pairs which are asleep have not moved since they were last tested
+					if(PairCache_IsPairAsleep(gameObjects[i], gameObjects[j])) continue;
+
 					CollisionManager_TestCollision( 
 						collision,
 						gameObjects[i],
@@ -210,25 +428,8 @@ static void CollisionManager_UpdateOctTreeNodeArray(GObject** gameObjects, unsig
 						continue;
 					}
 
-					unsigned char duplicate = 0;
-
-					//Loop through the current collisions for one object
-					LinkedList_Node* current = collision->obj1->collider->currentCollisions->head;
-					while(current != NULL)
-					{
-						Collision* currentCollision = (Collision*)current->data;
-						if(currentCollision->obj1 == collision->obj1 || currentCollision->obj2 == collision->obj1)
-						{
-							if(currentCollision->obj1 == collision->obj2 || currentCollision->obj2 == collision->obj2)
-							{
-								duplicate = 1;
-							}
-						}
-
-						current = current->next;
-					}
-
-					if(duplicate)
+					//Objects in more than one leaf are paired in each leaf, so reject collisions already registered this frame
+					if(!CollisionManager_RegisterCollision(collision))
 					{
 						collision->obj1 = NULL;
 						collision->obj2 = NULL;
@@ -238,24 +439,6 @@ static void CollisionManager_UpdateOctTreeNodeArray(GObject** gameObjects, unsig
 						continue;
 					}
 
-					//If code reaches this point, all tests detected collision.
-					//add to collided list
-					LinkedList_Append(collisionBuffer->collisions, collision);
-					
-
-					LinkedList_Append(collision->obj1->collider->currentCollisions, collision);
-					LinkedList_Append(collision->obj2->collider->currentCollisions, collision);
-
-					//TODO: Remove
-					//Change the color of colliders to red until they are drawn
-					*Matrix_Index(gameObjects[i]->collider->colorMatrix, 0, 0) = 1.0f;
-					*Matrix_Index(gameObjects[i]->collider->colorMatrix, 1, 1) = 0.0f;
-					*Matrix_Index(gameObjects[i]->collider->colorMatrix, 2, 2) = 0.0f;
-
-					*Matrix_Index(gameObjects[j]->collider->colorMatrix, 0, 0) = 1.0f;
-					*Matrix_Index(gameObjects[j]->collider->colorMatrix, 1, 1) = 0.0f;
-					*Matrix_Index(gameObjects[j]->collider->colorMatrix, 2, 2) = 0.0f;
-
 					//Allocate a new collision for next collision detected
 					collision = CollisionManager_AllocateCollision();
 					CollisionManager_InitializeCollision(collision);
@@ -268,120 +451,338 @@ static void CollisionManager_UpdateOctTreeNodeArray(GObject** gameObjects, unsig
 	CollisionManager_FreeCollision(collision);
 }
 
-
 ///
-//Tests for collisions on all objects which have colliders
-//compiling a list of collisions which occur
+//Registers a collision found by a test, appending it to the array of collisions and the current collisions of it's objects
 //
 //Parameters:
-//	gameObjects: An array of game objects to test
+//	collision: The collision to register
 //
 //Returns:
-//	A pointer to a linked list of collisions which occurred this frame
-LinkedList* CollisionManager_UpdateArray(GObject** gameObjects, unsigned int numObjects)
+//	1 if the collision was registered
+//	0 if the pair's collision was already registered this frame
+static unsigned char CollisionManager_RegisterCollision(Collision* collision)
 {
-	//Clear the current list of collisions
-	LinkedList_Node* currentNode = collisionBuffer->collisions->head;
-	LinkedList_Node* nextNode = NULL;
-	while(currentNode != NULL)
+	PairCache_Entry* entry = PairCache_Touch(collisionBuffer->pairCache, collision->obj1, collision->obj2);
+	if(entry == NULL)
 	{
-		nextNode = currentNode->next;
-		Collision* currentCollision = (Collision*)currentNode->data;
-		CollisionManager_FreeCollision(currentCollision);
-		currentNode = nextNode;
+		return 0;
 	}
-	LinkedList_Clear(collisionBuffer->collisions);
-
-	//Allocates a collision to store the first registered collision
-	Collision* collision = CollisionManager_AllocateCollision();
-	CollisionManager_InitializeCollision(collision);
+	collision->contactEvent = PairCache_SetColliding(entry);
 
-	for(int i = 0; i < numObjects; i++)
-	{
-		if(gameObjects[i]->collider != NULL)
-		{
-			for(int j = i+1; j < numObjects; j++)
-			{
-				if(gameObjects[j]->collider != NULL)
-				{
-					CollisionManager_TestCollision( 
-						collision,
-						gameObjects[i],
-						gameObjects[i]->body != NULL ? gameObjects[i]->body->frame : gameObjects[i]->frameOfReference,		//If there is a rigidbody use that frame of reference, else use the objects
-						gameObjects[j],
-						gameObjects[j]->body != NULL ? gameObjects[j]->body->frame : gameObjects[j]->frameOfReference);	//If there is a rigidbody use that frame of reference, else use the objects
+	//Add to collided list
+	DynamicArray_Append(collisionBuffer->collisions, &collision);
 
-					if(collision->obj1 == NULL)
-					{
-						continue;
-					}
+	DynamicArray_Append(collision->obj1->collider->currentCollisions, &collision);
+	DynamicArray_Append(collision->obj2->collider->currentCollisions, &collision);
 
-					//If code reaches this point, all tests detected collision.
-					//add to collided list
-					LinkedList_Append(collisionBuffer->collisions, collision);
-					
-					//Make copies of the collision to add to object's colliders
-					Collision* objCollision = CollisionManager_AllocateCollision();
-					CollisionManager_InitializeCollision(objCollision);
+	//TODO: Remove
+	//Change the color of colliders to red until they are drawn
+	*Matrix_Index(collision->obj1->collider->colorMatrix, 0, 0) = 1.0f;
+	*Matrix_Index(collision->obj1->collider->colorMatrix, 1, 1) = 0.0f;
+	*Matrix_Index(collision->obj1->collider->colorMatrix, 2, 2) = 0.0f;
 
-					//objCollision->minimumTranslationVector = collision->minimumTranslationVector;
-					Vector_Copy(objCollision->minimumTranslationVector, collision->minimumTranslationVector);
-					objCollision->obj1 = collision->obj1;
-					objCollision->obj1Frame = collision->obj1Frame;
-					objCollision->obj2 = collision->obj2;
-					objCollision->obj2Frame = collision->obj2Frame;
-					objCollision->overlap = collision->overlap;
+	*Matrix_Index(collision->obj2->collider->colorMatrix, 0, 0) = 1.0f;
+	*Matrix_Index(collision->obj2->collider->colorMatrix, 1, 1) = 0.0f;
+	*Matrix_Index(collision->obj2->collider->colorMatrix, 2, 2) = 0.0f;
 
-					LinkedList_Append(collision->obj1->collider->currentCollisions, objCollision);
+	return 1;
+}
 
-					 objCollision = CollisionManager_AllocateCollision();
-					CollisionManager_InitializeCollision(objCollision);
+///
+//Tests for collisions on all objects in an oct tree by spreading it's leaves across the threads of the job manager.
+//The collisions each thread finds are merged in the order a serial update would find them, whichever number of threads is used.
+//
+//Parameters:
+//	tree: The oct tree holding the game objects to test
+static void CollisionManager_UpdateOctTreeParallel(OctTree* tree)
+{
+	//The number of threads may have changed since the outputs were allocated
+	if(collisionBuffer->numNarrowPhaseThreads != JobManager_GetNumThreads())
+	{
+		CollisionManager_FreeNarrowPhaseThreads();
+		CollisionManager_AllocateNarrowPhaseThreads();
+	}
 
-					//objCollision->minimumTranslationVector = collision->minimumTranslationVector;
-					Vector_Copy(objCollision->minimumTranslationVector, collision->minimumTranslationVector);
-					objCollision->obj1 = collision->obj1;
-					objCollision->obj1Frame = collision->obj1Frame;
-					objCollision->obj2 = collision->obj2;
-					objCollision->obj2Frame = collision->obj2Frame;
-					objCollision->overlap = collision->overlap;
+	//Building a world cache writes to the collider, so every cache is built here before the threads share them
+	DynamicArray_Clear(collisionBuffer->octTreeLeaves);
+	CollisionManager_GatherOctTreeLeaves(tree->root);
 
-					LinkedList_Append(collision->obj2->collider->currentCollisions, objCollision);
+	JobManager_Run(CollisionManager_TestOctTreeLeaf, NULL, collisionBuffer->octTreeLeaves->size);
 
-					//TODO: Remove
-					//Change the color of colliders to red until they are drawn
-					*Matrix_Index(gameObjects[i]->collider->colorMatrix, 0, 0) = 1.0f;
-					*Matrix_Index(gameObjects[i]->collider->colorMatrix, 1, 1) = 0.0f;
-					*Matrix_Index(gameObjects[i]->collider->colorMatrix, 2, 2) = 0.0f;
+	//Registering touches the pair cache and the colliders, so it is done on this thread alone
+	CollisionManager_MergeLeafCollisions();
+}
 
-					*Matrix_Index(gameObjects[j]->collider->colorMatrix, 0, 0) = 1.0f;
-					*Matrix_Index(gameObjects[j]->collider->colorMatrix, 1, 1) = 0.0f;
-					*Matrix_Index(gameObjects[j]->collider->colorMatrix, 2, 2) = 0.0f;
+///
+//Appends to the collision buffer's leaves every leaf below an oct tree node holding a pair of objects,
+//And brings the world cache of each convex hull in them up to date so the threads only read the caches.
+//
+//Parameters:
+//	node: A pointer to the oct tree node to gather the leaves of
+static void CollisionManager_GatherOctTreeLeaves(OctTree_Node* node)
+{
+	if(node->children != NULL)
+	{
+		for(int i = 0; i < 8; i++)
+		{
+			CollisionManager_GatherOctTreeLeaves(node->children+i);
+		}
+	}
+	else if(node->data->size > 1)
+	{
+		struct OctTreeLeaf leaf;
+		leaf.node = node;
+		leaf.threadIndex = 0;
+		leaf.firstCollision = 0;
+		leaf.numCollisions = 0;
+		DynamicArray_Append(collisionBuffer->octTreeLeaves, &leaf);
 
-					//Allocate a new collision for next collision detected
-					collision = CollisionManager_AllocateCollision();
-					CollisionManager_InitializeCollision(collision);
-				}
+		//Rotation matrices are also brought up to date here, the threads testing the leaves may only read them
+		GObject** gameObjects = (GObject**)node->data->data;
+		for(unsigned int i = 0; i < node->data->size; i++)
+		{
+			GObject* obj = gameObjects[i];
+			FrameOfReference* frame = obj->body != NULL ? obj->body->frame : obj->frameOfReference;
+			FrameOfReference_UpdateRotation(frame);
+			if(obj->collider != NULL && obj->collider->type == COLLIDER_CONVEXHULL)
+			{
+				ConvexHullCollider_GetWorldCache(obj->collider->data->convexHullData, frame);
 			}
 		}
 	}
-
-	//Delete the last unused allocated collision
-	CollisionManager_FreeCollision(collision);
-
-	return collisionBuffer->collisions;
 }
 
 ///
-//Tests for a collision between two objects which have colliders
+//Tests every pair of objects within one of the gathered oct tree leaves, storing the collisions in the output of the testing thread.
+//Performed by the threads of the job manager.
 //
 //Parameters:
-//	dest: Collision to store the results of test in
-//	obj1: First game object to test (Must have collider attached)
-//	obj1FoR: Pointer to frame of reference to use to orient Object 1
-//	obj2: Second game object to test (Must have collider attached)
+//	data: Unused
+//	taskIndex: The index of the leaf to test
+//	threadIndex: The index of the thread performing the test
+static void CollisionManager_TestOctTreeLeaf(void* /*data*/, unsigned int taskIndex, unsigned int threadIndex)
+{
+	NarrowPhaseThread* thread = collisionBuffer->narrowPhaseThreads + threadIndex;
+	struct OctTreeLeaf* leaf = (struct OctTreeLeaf*)DynamicArray_Index(collisionBuffer->octTreeLeaves, taskIndex);
+
+	GObject** gameObjects = (GObject**)leaf->node->data->data;
+	unsigned int numObjects = leaf->node->data->size;
+
+	//Only this thread touches the leaf's entry while the leaves are tested
+	leaf->threadIndex = threadIndex;
+	leaf->firstCollision = thread->collisions->size;
+
+	for(unsigned int i = 0; i < numObjects; i++)
+	{
+		if(gameObjects[i]->collider == NULL) continue;
+
+		for(unsigned int j = i+1; j < numObjects; j++)
+		{
+			if(gameObjects[j]->collider == NULL) continue;
+
+			//Pairs which are asleep have not moved since they were last tested
+			if(PairCache_IsPairAsleep(gameObjects[i], gameObjects[j])) continue;
+
+			CollisionManager_TestCollision(
+				thread->spare,
+				gameObjects[i],
+				gameObjects[i]->body != NULL ? gameObjects[i]->body->frame : gameObjects[i]->frameOfReference,
+				gameObjects[j],
+				gameObjects[j]->body != NULL ? gameObjects[j]->body->frame : gameObjects[j]->frameOfReference);
+
+			if(thread->spare->obj1 == NULL) continue;
+
+			//Keep the collision for the merge and allocate a new collision for the thread's next test
+			DynamicArray_Append(thread->collisions, &thread->spare);
+
+			thread->spare = CollisionManager_AllocateCollision();
+			CollisionManager_InitializeCollision(thread->spare);
+		}
+	}
+
+	leaf->numCollisions = thread->collisions->size - leaf->firstCollision;
+}
+
+///
+//Registers the collisions found by each thread in increasing order of leaf, freeing collisions between pairs found in an earlier leaf
+static void CollisionManager_MergeLeafCollisions(void)
+{
+	NarrowPhaseThread* threads = collisionBuffer->narrowPhaseThreads;
+	struct OctTreeLeaf* leaves = (struct OctTreeLeaf*)collisionBuffer->octTreeLeaves->data;
+
+	//Threads steal leaves out of order, so the collisions are taken leaf by leaf rather than thread by thread
+	for(unsigned int i = 0; i < collisionBuffer->octTreeLeaves->size; i++)
+	{
+		Collision** found = (Collision**)threads[leaves[i].threadIndex].collisions->data + leaves[i].firstCollision;
+		for(unsigned int j = 0; j < leaves[i].numCollisions; j++)
+		{
+			if(!CollisionManager_RegisterCollision(found[j]))
+			{
+				//Objects in more than one leaf are paired in each leaf
+				CollisionManager_FreeCollision(found[j]);
+			}
+		}
+	}
+
+	for(unsigned int i = 0; i < collisionBuffer->numNarrowPhaseThreads; i++)
+	{
+		DynamicArray_Clear(threads[i].collisions);
+	}
+}
+
+///
+//Allocates the output of each thread of the job manager
+static void CollisionManager_AllocateNarrowPhaseThreads(void)
+{
+	unsigned int numThreads = JobManager_GetNumThreads();
+	collisionBuffer->numNarrowPhaseThreads = numThreads;
+	collisionBuffer->narrowPhaseThreads = (NarrowPhaseThread*)malloc(sizeof(NarrowPhaseThread) * numThreads);
+
+	for(unsigned int i = 0; i < numThreads; i++)
+	{
+		NarrowPhaseThread* thread = collisionBuffer->narrowPhaseThreads + i;
+
+		thread->collisions = DynamicArray_Allocate();
+		DynamicArray_Initialize(thread->collisions, sizeof(Collision*));
+
+		thread->spare = CollisionManager_AllocateCollision();
+		CollisionManager_InitializeCollision(thread->spare);
+	}
+}
+
+///
+//Frees the output of each thread the collision buffer's outputs were allocated for
+static void CollisionManager_FreeNarrowPhaseThreads(void)
+{
+	for(unsigned int i = 0; i < collisionBuffer->numNarrowPhaseThreads; i++)
+	{
+		DynamicArray_Free(collisionBuffer->narrowPhaseThreads[i].collisions);
+		CollisionManager_FreeCollision(collisionBuffer->narrowPhaseThreads[i].spare);
+	}
+
+	free(collisionBuffer->narrowPhaseThreads);
+	collisionBuffer->narrowPhaseThreads = NULL;
+	collisionBuffer->numNarrowPhaseThreads = 0;
+}
+
+
+///
+//Tests for collisions on all objects which have colliders
+//compiling a list of collisions which occur
+//
+//Parameters:
+//	gameObjects: An array of game objects to test
+//
+//Returns:
+//	A pointer to a dynamic array of pointers to the collisions which occurred this frame
+DynamicArray* CollisionManager_UpdateArray(GObject** gameObjects, unsigned int numObjects)
+{
+	//Free the collisions of the last update
+	CollisionManager_ClearCollisions();
+
+	//Allocates a collision to store the first registered collision
+	Collision* collision = CollisionManager_AllocateCollision();
+	CollisionManager_InitializeCollision(collision);
+
+	for(int i = 0; i < numObjects; i++)
+	{
+		if(gameObjects[i]->collider != NULL)
+		{
+			for(int j = i+1; j < numObjects; j++)
+			{
+				if(gameObjects[j]->collider != NULL)
+				{
+					//Pairs which are asleep have not moved since they were last tested
+					if(PairCache_IsPairAsleep(gameObjects[i], gameObjects[j])) continue;
+
+					CollisionManager_TestCollision( 
+						collision,
+						gameObjects[i],
+						gameObjects[i]->body != NULL ? gameObjects[i]->body->frame : gameObjects[i]->frameOfReference,		//If there is a rigidbody use that frame of reference, else use the objects
+						gameObjects[j],
+						gameObjects[j]->body != NULL ? gameObjects[j]->body->frame : gameObjects[j]->frameOfReference);	//If there is a rigidbody use that frame of reference, else use the objects
+
+					if(collision->obj1 == NULL)
+					{
+						continue;
+					}
+
+					//If code reaches this point, all tests detected collision.
+					//add to collided list
+					DynamicArray_Append(collisionBuffer->collisions, &collision);
+					
+					//Make copies of the collision to add to object's colliders
+					Collision* objCollision = CollisionManager_AllocateCollision();
+					CollisionManager_InitializeCollision(objCollision);
+
+					//objCollision->minimumTranslationVector = collision->minimumTranslationVector;
+					Vector_Copy(objCollision->minimumTranslationVector, collision->minimumTranslationVector);
+					objCollision->obj1 = collision->obj1;
+					objCollision->obj1Frame = collision->obj1Frame;
+					objCollision->obj2 = collision->obj2;
+					objCollision->obj2Frame = collision->obj2Frame;
+					objCollision->overlap = collision->overlap;
+
+					DynamicArray_Append(collision->obj1->collider->currentCollisions, &objCollision);
+
+					 objCollision = CollisionManager_AllocateCollision();
+					CollisionManager_InitializeCollision(objCollision);
+
+					//objCollision->minimumTranslationVector = collision->minimumTranslationVector;
+					Vector_Copy(objCollision->minimumTranslationVector, collision->minimumTranslationVector);
+					objCollision->obj1 = collision->obj1;
+					objCollision->obj1Frame = collision->obj1Frame;
+					objCollision->obj2 = collision->obj2;
+					objCollision->obj2Frame = collision->obj2Frame;
+					objCollision->overlap = collision->overlap;
+
+					DynamicArray_Append(collision->obj2->collider->currentCollisions, &objCollision);
+
+					//TODO: Remove
+					//Change the color of colliders to red until they are drawn
+					*Matrix_Index(gameObjects[i]->collider->colorMatrix, 0, 0) = 1.0f;
+					*Matrix_Index(gameObjects[i]->collider->colorMatrix, 1, 1) = 0.0f;
+					*Matrix_Index(gameObjects[i]->collider->colorMatrix, 2, 2) = 0.0f;
+
+					*Matrix_Index(gameObjects[j]->collider->colorMatrix, 0, 0) = 1.0f;
+					*Matrix_Index(gameObjects[j]->collider->colorMatrix, 1, 1) = 0.0f;
+					*Matrix_Index(gameObjects[j]->collider->colorMatrix, 2, 2) = 0.0f;
+
+					//Allocate a new collision for next collision detected
+					collision = CollisionManager_AllocateCollision();
+					CollisionManager_InitializeCollision(collision);
+				}
+			}
+		}
+	}
+
+	//Delete the last unused allocated collision
+	CollisionManager_FreeCollision(collision);
+
+	return collisionBuffer->collisions;
+}
+
+///
+//Tests for a collision between two objects which have colliders
+//
+//Parameters:
+//	dest: Collision to store the results of test in
+//	obj1: First game object to test (Must have collider attached)
+//	obj1FoR: Pointer to frame of reference to use to orient Object 1
+//	obj2: Second game object to test (Must have collider attached)
 //	obj2FoR: Pointer to frame of reference to use to orient Object 2
 void CollisionManager_TestCollision(Collision* dest, GObject* obj1, FrameOfReference* obj1FoR, GObject* obj2, FrameOfReference* obj2FoR)
 {
+	FrameOfReference_UpdateRotation(obj1FoR);
+	FrameOfReference_UpdateRotation(obj2FoR);
+
+	//GJK handles every pair of collider types with the same test
+	if(collisionBuffer->narrowPhaseAlgorithms[obj1->collider->type][obj2->collider->type] == NARROWPHASE_GJK)
+	{
+		CollisionManager_TestGJKCollision(dest, obj1, obj1FoR, obj2, obj2FoR);
+		return;
+	}
+
 	//Test the types of the colliders
 	switch(obj1->collider->type)
 	{
@@ -940,192 +1341,94 @@ void CollisionManager_TestAABBConvexCollision(Collision* dest, GObject* AABBObj,
 	AABBCollider_GetScaledDimensions(&scaledAABB, AABB, AABBObjFrame);
 
 	//We must convert the AABB to a convex hull and get the oriented axis and oriented points from both objects
-	Vector** orientedPointsAABB = (Vector**)malloc(sizeof(Vector*) * 8);
-	Vector** orientedPointsConvex = (Vector**)malloc(sizeof(Vector*) * convexHull->points->size);
-
-	Vector** orientedAxesAABB = (Vector**)malloc(sizeof(Vector*) * 3);
-	Vector** orientedAxesConvex = (Vector**)malloc(sizeof(Vector*) * convexHull->axes->size);
-
-	Vector** orientedEdgesAABB = (Vector**)malloc(sizeof(Vector*) * 3);
-	Vector** orientedEdgesConvex = (Vector**)malloc(sizeof(Vector*) * convexHull->edges->size);
-
-
-	//Allocate an initialize individual vectors in array of oriented points for AABB
-	for(int i = 0; i < 8; i++)
-	{
-		orientedPointsAABB[i] = Vector_Allocate();
-		Vector_Initialize(orientedPointsAABB[i], 3);
-	}
+	//The AABB always has 8 points and 3 axes / edges so it's arrays can live on the stack
+	Vec3 orientedPointsAABB[8];
+	Vec3 orientedAxesAABB[3];
+	Vec3 orientedEdgesAABB[3];
 
-	//Allocate and initialize individual vectors in array of oriented points for convex hull
-	for(unsigned int i = 0; i < convexHull->points->size; i++)
-	{
-		orientedPointsConvex[i] = Vector_Allocate();
-		Vector_Initialize(orientedPointsConvex[i], 3);
-	}
-
-	//Allocate and initialize individual vectors in array of oriented axes & edges for AABB
-	for(int i = 0; i < 3; i++)
-	{
-		orientedAxesAABB[i] = Vector_Allocate();
-		Vector_Initialize(orientedAxesAABB[i], 3);
-
-		orientedEdgesAABB[i] = Vector_Allocate();
-		Vector_Initialize(orientedEdgesAABB[i], 3);
-	}
-
-	//Allocate and initialize individual vectors in array of oriented axes for convex hull
-	for(unsigned int i = 0; i < convexHull->axes->size; i++)
-	{
-		orientedAxesConvex[i] = Vector_Allocate();
-		Vector_Initialize(orientedAxesConvex[i], 3);
-	}
-
-	//Allocate and initialize individual vectors in array of oriented edges for convex hull
-	for(unsigned int i = 0; i < convexHull->axes->size; i++)
-	{
-		orientedEdgesConvex[i] = Vector_Allocate();
-		Vector_Initialize(orientedEdgesConvex[i], 3);
-	}
+	//The convex hull's oriented arrays come from it's world cache
+	const ConvexHullCollider_WorldCache* convexCache = ConvexHullCollider_GetWorldCache(convexHull, convexObjFrame);
 
 	//Get oriented points of AABB
 	//Right Bottom Front
-	orientedPointsAABB[0]->components[0] = scaledAABB.width / 2.0f;
-	orientedPointsAABB[0]->components[1] = scaledAABB.height / -2.0f;
-	orientedPointsAABB[0]->components[2] = scaledAABB.depth / 2.0f;
+	Vec3_Set(orientedPointsAABB + 0, scaledAABB.width / 2.0f, scaledAABB.height / -2.0f, scaledAABB.depth / 2.0f);
 	//Translate by centroid of AABB
-	Vector_Increment(orientedPointsAABB[0], AABB->centroid);
+	Vec3_Increment(orientedPointsAABB + 0, Vec3_FROM_VECTOR(AABB->centroid));
 	//Translate point to position of obj
-	Vector_Increment(orientedPointsAABB[0], AABBObjFrame->position);
+	Vec3_Increment(orientedPointsAABB + 0, Vec3_FROM_VECTOR(AABBObjFrame->position));
 
 	//Right Bottom Back
-	orientedPointsAABB[1]->components[0] = scaledAABB.width / 2.0f;
-	orientedPointsAABB[1]->components[1] = scaledAABB.height / -2.0f;
-	orientedPointsAABB[1]->components[2] = scaledAABB.depth / -2.0f;
+	Vec3_Set(orientedPointsAABB + 1, scaledAABB.width / 2.0f, scaledAABB.height / -2.0f, scaledAABB.depth / -2.0f);
 	//Translate by centroid of AABB
-	Vector_Increment(orientedPointsAABB[1], AABB->centroid);
+	Vec3_Increment(orientedPointsAABB + 1, Vec3_FROM_VECTOR(AABB->centroid));
 	//Translate point to position of obj
-	Vector_Increment(orientedPointsAABB[1], AABBObjFrame->position);
+	Vec3_Increment(orientedPointsAABB + 1, Vec3_FROM_VECTOR(AABBObjFrame->position));
 
 	//Left Bottom Back
-	orientedPointsAABB[2]->components[0] = scaledAABB.width / -2.0f;
-	orientedPointsAABB[2]->components[1] = scaledAABB.height / -2.0f;
-	orientedPointsAABB[2]->components[2] = scaledAABB.depth / -2.0f;
+	Vec3_Set(orientedPointsAABB + 2, scaledAABB.width / -2.0f, scaledAABB.height / -2.0f, scaledAABB.depth / -2.0f);
 	//Translate by centroid of AABB
-	Vector_Increment(orientedPointsAABB[2], AABB->centroid);
+	Vec3_Increment(orientedPointsAABB + 2, Vec3_FROM_VECTOR(AABB->centroid));
 	//Translate point to position of obj
-	Vector_Increment(orientedPointsAABB[2], AABBObjFrame->position);
+	Vec3_Increment(orientedPointsAABB + 2, Vec3_FROM_VECTOR(AABBObjFrame->position));
 
 	//Left Bottom Front
-	orientedPointsAABB[3]->components[0] = scaledAABB.width / -2.0f;
-	orientedPointsAABB[3]->components[1] = scaledAABB.height / -2.0f;
-	orientedPointsAABB[3]->components[2] = scaledAABB.depth / 2.0f;
+	Vec3_Set(orientedPointsAABB + 3, scaledAABB.width / -2.0f, scaledAABB.height / -2.0f, scaledAABB.depth / 2.0f);
 	//Translate by centroid of AABB
-	Vector_Increment(orientedPointsAABB[3], AABB->centroid);
+	Vec3_Increment(orientedPointsAABB + 3, Vec3_FROM_VECTOR(AABB->centroid));
 	//Translate point to position of obj
-	Vector_Increment(orientedPointsAABB[3], AABBObjFrame->position);
+	Vec3_Increment(orientedPointsAABB + 3, Vec3_FROM_VECTOR(AABBObjFrame->position));
 
 	//Right Top Front
-	orientedPointsAABB[4]->components[0] = scaledAABB.width / 2.0f;
-	orientedPointsAABB[4]->components[1] = scaledAABB.height / 2.0f;
-	orientedPointsAABB[4]->components[2] = scaledAABB.depth / 2.0f;
+	Vec3_Set(orientedPointsAABB + 4, scaledAABB.width / 2.0f, scaledAABB.height / 2.0f, scaledAABB.depth / 2.0f);
 	//Translate by centroid of AABB
-	Vector_Increment(orientedPointsAABB[4], AABB->centroid);
+	Vec3_Increment(orientedPointsAABB + 4, Vec3_FROM_VECTOR(AABB->centroid));
 	//Translate point to position of obj
-	Vector_Increment(orientedPointsAABB[4], AABBObjFrame->position);
+	Vec3_Increment(orientedPointsAABB + 4, Vec3_FROM_VECTOR(AABBObjFrame->position));
 
 	//Right Top Back
-	orientedPointsAABB[5]->components[0] = scaledAABB.width / 2.0f;
-	orientedPointsAABB[5]->components[1] = scaledAABB.height / 2.0f;
-	orientedPointsAABB[5]->components[2] = scaledAABB.depth / -2.0f;
+	Vec3_Set(orientedPointsAABB + 5, scaledAABB.width / 2.0f, scaledAABB.height / 2.0f, scaledAABB.depth / -2.0f);
 	//Translate by centroid of AABB
-	Vector_Increment(orientedPointsAABB[5], AABB->centroid);
+	Vec3_Increment(orientedPointsAABB + 5, Vec3_FROM_VECTOR(AABB->centroid));
 	//Translate point to position of obj
-	Vector_Increment(orientedPointsAABB[5], AABBObjFrame->position);
+	Vec3_Increment(orientedPointsAABB + 5, Vec3_FROM_VECTOR(AABBObjFrame->position));
 
 	//Left Top Back
-	orientedPointsAABB[6]->components[0] = scaledAABB.width / -2.0f;
-	orientedPointsAABB[6]->components[1] = scaledAABB.height / 2.0f;
-	orientedPointsAABB[6]->components[2] = scaledAABB.depth / -2.0f;
+	Vec3_Set(orientedPointsAABB + 6, scaledAABB.width / -2.0f, scaledAABB.height / 2.0f, scaledAABB.depth / -2.0f);
 	//Translate by centroid of AABB
-	Vector_Increment(orientedPointsAABB[6], AABB->centroid);
+	Vec3_Increment(orientedPointsAABB + 6, Vec3_FROM_VECTOR(AABB->centroid));
 	//Translate point to position of obj
-	Vector_Increment(orientedPointsAABB[6], AABBObjFrame->position);
+	Vec3_Increment(orientedPointsAABB + 6, Vec3_FROM_VECTOR(AABBObjFrame->position));
 
 	//Left Top Front
-	orientedPointsAABB[7]->components[0] = scaledAABB.width / -2.0f;
-	orientedPointsAABB[7]->components[1] = scaledAABB.height / 2.0f;
-	orientedPointsAABB[7]->components[2] = scaledAABB.depth / 2.0f;
+	Vec3_Set(orientedPointsAABB + 7, scaledAABB.width / -2.0f, scaledAABB.height / 2.0f, scaledAABB.depth / 2.0f);
 	//Translate by centroid of AABB
-	Vector_Increment(orientedPointsAABB[7], AABB->centroid);
+	Vec3_Increment(orientedPointsAABB + 7, Vec3_FROM_VECTOR(AABB->centroid));
 	//Translate point to position of obj
-	Vector_Increment(orientedPointsAABB[7], AABBObjFrame->position);
-
-	//Get oriented points of Convex Hull
-	ConvexHullCollider_GetOrientedWorldPoints(orientedPointsConvex, convexHull, convexObjFrame);
+	Vec3_Increment(orientedPointsAABB + 7, Vec3_FROM_VECTOR(AABBObjFrame->position));
 
 	//Get oriented axes of AABB
-	Vector_Copy(orientedAxesAABB[0], &Vector_E1);
-	Vector_Copy(orientedAxesAABB[1], &Vector_E2);
-	Vector_Copy(orientedAxesAABB[2], &Vector_E3);
-
-	//Get oriented axes of convex hull
-	ConvexHullCollider_GetOrientedAxes(orientedAxesConvex, convexHull, convexObjFrame);
+	Vec3_Set(orientedAxesAABB + 0, 1.0f, 0.0f, 0.0f);
+	Vec3_Set(orientedAxesAABB + 1, 0.0f, 1.0f, 0.0f);
+	Vec3_Set(orientedAxesAABB + 2, 0.0f, 0.0f, 1.0f);
 
 	//Get oriented edges of AABB
-	Vector_Copy(orientedEdgesAABB[0], &Vector_E1);
-	Vector_Copy(orientedEdgesAABB[1], &Vector_E2);
-	Vector_Copy(orientedEdgesAABB[2], &Vector_E3);
-
-	//Get oriented edges of convex hull
-	ConvexHullCollider_GetOrientedEdges(orientedEdgesConvex, convexHull, convexObjFrame);
+	Vec3_Set(orientedEdgesAABB + 0, 1.0f, 0.0f, 0.0f);
+	Vec3_Set(orientedEdgesAABB + 1, 0.0f, 1.0f, 0.0f);
+	Vec3_Set(orientedEdgesAABB + 2, 0.0f, 0.0f, 1.0f);
 
 
 	//Perform SAT Alorithm for face normals
 	unsigned char detected = CollisionManager_PerformSATFaces(dest,
-		(const Vector**)orientedAxesAABB, 3, (const Vector**)orientedPointsAABB, 8,
-		(const Vector**)orientedAxesConvex, convexHull->axes->size, (const Vector**)orientedPointsConvex, convexHull->points->size);
+		orientedAxesAABB, 3, orientedPointsAABB, 8,
+		convexCache->axes, convexHull->axes->size, convexCache->worldPoints, convexHull->points->size);
 
 	//If a collisionn is detected, check edge normals
 	if(detected)
 	{
 		detected = CollisionManager_PerformSATEdges(dest,
-			(const Vector**)orientedEdgesAABB, 3, (const Vector**)orientedPointsAABB, 8,
-			(const Vector**)orientedEdgesConvex, convexHull->edges->size, (const Vector**)orientedPointsConvex, convexHull->points->size);
-	}
-
-	//Delete oriented arrays
-	for(int i = 0; i < 8; i++)
-	{
-		Vector_Free(orientedPointsAABB[i]);
+			orientedEdgesAABB, 3, orientedPointsAABB, 8,
+			convexCache->edges, convexHull->edges->size, convexCache->worldPoints, convexHull->points->size);
 	}
-	free(orientedPointsAABB);
-	for(unsigned int i = 0; i < convexHull->points->size; i++)
-	{
-		Vector_Free(orientedPointsConvex[i]);
-	}
-	free(orientedPointsConvex);
-	for(int i = 0; i < 3; i++)
-	{
-		Vector_Free(orientedAxesAABB[i]);
-	}
-	free(orientedAxesAABB);
-	for(unsigned int i = 0; i < convexHull->axes->size; i++)
-	{
-		Vector_Free(orientedAxesConvex[i]);
-	}
-	free(orientedAxesConvex);
-	for(int i = 0; i < 3; i++)
-	{
-		Vector_Free(orientedEdgesAABB[i]);
-	}
-	free(orientedEdgesAABB);
-	for(unsigned int i = 0; i < convexHull->edges->size; i++)
-	{
-		Vector_Free(orientedEdgesConvex[i]);
-	}
-	free(orientedEdgesConvex);
-
 
 	if(detected)
 	{
@@ -1178,303 +1481,963 @@ void CollisionManager_TestConvexCollision(Collision* dest, GObject* obj1, FrameO
 	ColliderData_ConvexHull* convexHull1 = obj1->collider->data->convexHullData;
 	ColliderData_ConvexHull* convexHull2 = obj2->collider->data->convexHullData;
 
-	//Create array of pointers to vectors to hold the oriented points of the colliders of objects in collision
-	Vector** orientedPoints1 = (Vector**)malloc(sizeof(Vector*) * convexHull1->points->size);
-	Vector** orientedPoints2 = (Vector**)malloc(sizeof(Vector*) * convexHull2->points->size);
+	//Get the oriented points, axes and edges of the colliders of objects in collision from their world caches
+	const ConvexHullCollider_WorldCache* cache1 = ConvexHullCollider_GetWorldCache(convexHull1, obj1FoR);
+	const ConvexHullCollider_WorldCache* cache2 = ConvexHullCollider_GetWorldCache(convexHull2, obj2FoR);
+
+	//Perform SAT Algorithm for face normals
+	detected = CollisionManager_PerformSATFaces(dest, 
+		cache1->axes, convexHull1->axes->size, cache1->worldPoints, convexHull1->points->size,
+		cache2->axes, convexHull2->axes->size, cache2->worldPoints, convexHull2->points->size);
+
+	//If there is a collision detection, test the edge normals
+	if(detected)
+	{
+		detected = CollisionManager_PerformSATEdges(dest, 
+			cache1->edges, convexHull1->edges->size, cache1->worldPoints, convexHull1->points->size,
+			cache2->edges, convexHull2->edges->size, cache2->worldPoints, convexHull2->points->size);
+	}
+
+	if(detected)
+	{
+		//MTV must always face obj1
+		Vector bToa;
+		Vector_INIT_ON_STACK(bToa, 3);
+
+		Vector_Subtract(&bToa, obj1FoR->position, obj2FoR->position);
+
+		//Check if MTV must be reversed to face Obj 1
+		if(Vector_DotProduct(&bToa, dest->minimumTranslationVector) < 0.0f)
+		{
+			Vector_Scale(dest->minimumTranslationVector, -1.0f);
+		}
+
+		dest->obj1 = obj1;
+		dest->obj1Frame = obj1FoR;
+		dest->obj2 = obj2;
+		dest->obj2Frame = obj2FoR;
+	}
+	else
+	{
+		//If there is no collision set collision atributes to null
+		dest->overlap = 0.0f;
+		dest->obj1 = NULL;
+		dest->obj2 = NULL;
+		dest->obj1Frame = NULL;
+		dest->obj2Frame = NULL;
+
+	}
+}
+
+///
+//Tests if a a game object's convex hull is colliding with a sphere
+//If there is no collision, collision.obj1 and obj2 will be set to null upon
+//The end of this function
+//
+//Parameters:
+//	dest: Collision to store the results of test in
+//	convexObj: The gameObject with the convex hull to test
+//	convexFoR: the frame of reference to use to orient the convex hull collider
+//	sphere: The gameobject with the sphere collider to test
+//	sphereFoR: The frame of reference to use to orient the sphere collider
+void CollisionManager_TestConvexSphereCollision(Collision* dest, GObject* convexObj, FrameOfReference* convexFoR, GObject* sphereObj, FrameOfReference* sphereFoR)
+{
+	float minOverlap = 0.0f;
+	unsigned char detected = 1;
+
+	//Get the convex hull data
+	ColliderData_ConvexHull* convexHull = convexObj->collider->data->convexHullData;
+	//Get the sphere data
+	ColliderData_Sphere* sphere = sphereObj->collider->data->sphereData;
+
+	//Get the oriented points and axes of the collider of convex obj in collision from it's world cache
+	const ConvexHullCollider_WorldCache* convexCache = ConvexHullCollider_GetWorldCache(convexHull, convexFoR);
+	const Vec3* orientedPoints = convexCache->worldPoints;
+	const Vec3* orientedAxes = convexCache->axes;
+
+	ProjectionBounds bounds[2];
+
+	Vec3 sphereSurfacePoints[2];
 
-	//Create array of pointers to vectors to hold the oriented axes of the colliders of objects in collision
-	Vector** orientedAxes1 = (Vector**)malloc(sizeof(Vector*) * convexHull1->axes->size);
-	Vector** orientedAxes2 = (Vector**)malloc(sizeof(Vector*) * convexHull2->axes->size);
+	Vec3 normalizedAxis;
+	for(unsigned int i = 0; i < convexHull->axes->size; i++)
+	{
+		Vec3_Copy(&normalizedAxis, orientedAxes + i);
+		Vec3_Normalize(&normalizedAxis);
+
+		//Scale sphere surface points to maximum scale in sphere's Frame of reference
+		float scaledRad = SphereCollider_GetScaledRadius(sphere, sphereFoR);
+		Vec3_Scale(&normalizedAxis, scaledRad);
+		Vec3_Add(sphereSurfacePoints + 0, Vec3_FROM_VECTOR(sphereFoR->position), &normalizedAxis);
+		Vec3_Subtract(sphereSurfacePoints + 1, Vec3_FROM_VECTOR(sphereFoR->position), &normalizedAxis);
+
+
+		CollisionManager_GetProjectionBounds(bounds, orientedAxes + i, orientedPoints, convexHull->points->size);
+		CollisionManager_GetProjectionBounds(bounds + 1, orientedAxes + i, sphereSurfacePoints, 2);
+
+		//Check for overlap
+		if(bounds[0].min <= bounds[1].max && bounds[0].max >= bounds[1].min)
+		{
+			//IF there is overlap we must keep track of the smallest overlap and the axis it occurs on
+			//If an axis is overlapping we must track which has the smallest overlap!
+			float overlap1 = bounds[1].max - bounds[0].min;
+			float overlap2 = bounds[0].max - bounds[1].min;
+
+			//Determine thesmallest overlap
+			float smallerOverlap = overlap1 < overlap2 ? overlap1 : overlap2;
+
+
+			//if the overlap is smaller than the current smallest overlap
+			if(smallerOverlap < minOverlap || i == 0)
+			{
+				//Assign the minimum overlap to the smallest of the two overlaps
+				minOverlap = smallerOverlap;
+				//Assign the MTV to the current axis
+				Vec3_Copy(Vec3_FROM_VECTOR(dest->minimumTranslationVector), orientedAxes + i);
+			}
+		}
+		else
+		{
+			//If any axis is not overlapping, there is no collision
+			detected = 0;
+			break;
+		}
+
+	}
+
+	if(detected)
+	{
+		//If there is a collision assign collision attributes
+		dest->overlap = minOverlap;
+		dest->obj1 = convexObj;
+		dest->obj1Frame = convexFoR;
+		dest->obj2 = sphereObj;
+		dest->obj2Frame = sphereFoR;
+
+		//Make sure MTV is normalized
+		Vector_Normalize(dest->minimumTranslationVector);
+
+		//By convention MTV must always point towards obj1
+		Vector bToa;
+		Vector_INIT_ON_STACK(bToa, 3);
+
+		//Vector_Subtract(&bToa, sphereFoR->position, convexFoR->position);
+		Vector_Subtract(&bToa, convexFoR->position, sphereFoR->position);
+		//Check if MTV must be reversed to face Obj 1
+		if(Vector_DotProduct(&bToa, dest->minimumTranslationVector) < 0.0f)
+		{
+			Vector_Scale(dest->minimumTranslationVector, -1.0f);
+		}
+	}
+	else
+	{
+		//If there is no collision set the collision attributes to 0.
+		dest->overlap = 0.0f;
+		dest->obj1 = NULL;
+		dest->obj1Frame = NULL;
+		dest->obj2 = NULL;
+		dest->obj2Frame = NULL;
+	}
+}
+
+///
+//Tests if two game objects' colliders are colliding with any combination of collider types
+//If there is no collision, collision.obj1 and obj2 will be set to null upon
+//The end of this function
+//
+//GJK only needs the furthest point of each collider in a direction, so unlike SAT
+//It's cost grows linearly with the number of points rather than with the product of the numbers of edges.
+//
+//Parameters:
+//	dest: Collision to store the results of test in
+//	obj1:		First game object to test (Must have collider attached)
+//	obj1FoR:	Pointer to frame of reference to use to orient Object 1 collider
+//	obj2:		Second game object to test (Must have collider attached)
+//	obj2FoR:	Pointer to frame of reference to use to orient Object 2 collider
+void CollisionManager_TestGJKCollision(Collision* dest, GObject* obj1, FrameOfReference* obj1FoR, GObject* obj2, FrameOfReference* obj2FoR)
+{
+	SupportShape shape1;
+	SupportShape shape2;
+	CollisionManager_InitializeSupportShape(&shape1, obj1, obj1FoR);
+	CollisionManager_InitializeSupportShape(&shape2, obj2, obj2FoR);
+
+	Vec3 simplex[4];
+	unsigned int simplexSize = 0;
+
+	unsigned char detected = CollisionManager_PerformGJK(simplex, &simplexSize, &shape1, &shape2);
+
+	//EPA needs a tetrahedron with volume
+	if(detected)
+	{
+		detected = CollisionManager_CompleteSimplex(simplex, &simplexSize, &shape1, &shape2);
+	}
+
+	if(detected)
+	{
+		//EPA finds the MTV pointing away from obj2, so it already faces obj1
+		CollisionManager_PerformEPA(dest, simplex, &shape1, &shape2);
+
+		dest->obj1 = obj1;
+		dest->obj1Frame = obj1FoR;
+		dest->obj2 = obj2;
+		dest->obj2Frame = obj2FoR;
+	}
+	else
+	{
+		//If there is no collision set collision atributes to null
+		dest->overlap = 0.0f;
+		dest->obj1 = NULL;
+		dest->obj2 = NULL;
+		dest->obj1Frame = NULL;
+		dest->obj2Frame = NULL;
+	}
+}
+
+///
+//Finds when an axis aligned box moving in a straight line first touches a stationary axis aligned box
+//
+//Parameters:
+//	min: The minimum bound of the moving box on each axis at the start of it's motion
+//	max: The maximum bound of the moving box on each axis at the start of it's motion
+//	motion: The displacement of the moving box over the motion
+//	targetMin: The minimum bound of the stationary box on each axis
+//	targetMax: The maximum bound of the stationary box on each axis
+//
+//A box sliding along a surface sinks slightly into it, so it also touches the side of the next box the surface is built from.
+//That side is an inner edge of the surface which does not oppose the motion, so hits on a box overlapped at the start
+//No deeper than CollisionManager_sweepSurfaceTolerance along another axis are ignored.
+//
+//Returns:
+//	The fraction of the motion at which the boxes first touch, from 0 to 1,
+//	Or -1 if they do not touch during the motion, already overlap at it's start or only meet at an inner edge of a surface
+float CollisionManager_GetSweptAABBTimeOfImpact(const float* min, const float* max, const Vec3* motion, const float* targetMin, const float* targetMax)
+{
+	float entryTime = -FLT_MAX;
+	float exitTime = FLT_MAX;
+	int entryAxis = -1;
+	float depths[3];
+	for(int i = 0; i < 3; i++)
+	{
+		//How deep the boxes overlap on this axis at the start of the motion, negative while they are apart
+		depths[i] = max[i] - targetMin[i] < targetMax[i] - min[i] ? max[i] - targetMin[i] : targetMax[i] - min[i];
+
+		float velocity = motion->components[i];
+		if(velocity == 0.0f)
+		{
+			//Not moving on this axis, so the boxes must already overlap on it
+			if(depths[i] <= 0.0f)
+			{
+				return -1.0f;
+			}
+			continue;
+		}
+
+		//The times the leading and trailing faces of the moving box cross the faces of the target on this axis
+		float entry = velocity > 0.0f ? (targetMin[i] - max[i]) / velocity : (targetMax[i] - min[i]) / velocity;
+		float exit = velocity > 0.0f ? (targetMax[i] - min[i]) / velocity : (targetMin[i] - max[i]) / velocity;
+
+		if(entry > entryTime)
+		{
+			entryTime = entry;
+			entryAxis = i;
+		}
+		if(exit < exitTime) exitTime = exit;
+	}
+
+	//The boxes touch once they overlap on every axis, and stop once they separate on any
+	if(entryTime > exitTime || entryTime > 1.0f || entryTime < 0.0f)
+	{
+		return -1.0f;
+	}
+
+	//A box only just sunk into the target on another axis is sliding along a surface the target is part of,
+	//And the face hit is the seam between the target and the part of the surface the box is on
+	for(int i = 0; i < 3; i++)
+	{
+		if(i != entryAxis && depths[i] >= 0.0f && depths[i] <= CollisionManager_sweepSurfaceTolerance)
+		{
+			return -1.0f;
+		}
+	}
+	return entryTime;
+}
+
+///
+//Finds when a sphere moving in a straight line first touches a stationary axis aligned box.
+//The box is grown by the radius of the sphere on each side, so near it's edges and corners the time may be slightly early.
+//
+//Parameters:
+//	center: The center of the sphere at the start of it's motion
+//	radius: The radius of the sphere
+//	motion: The displacement of the sphere over the motion
+//	targetMin: The minimum bound of the box on each axis
+//	targetMax: The maximum bound of the box on each axis
+//
+//Returns:
+//	The fraction of the motion at which the sphere first touches the box, from 0 to 1,
+//	Or -1 if they do not touch during the motion or already overlap at it's start
+float CollisionManager_GetSweptSphereTimeOfImpact(const Vec3* center, const float radius, const Vec3* motion, const float* targetMin, const float* targetMax)
+{
+	//Sweeping the center point against the grown box is the same as sweeping the sphere against the box
+	float grownMin[3];
+	float grownMax[3];
+	for(int i = 0; i < 3; i++)
+	{
+		grownMin[i] = targetMin[i] - radius;
+		grownMax[i] = targetMax[i] + radius;
+	}
+
+	return CollisionManager_GetSweptAABBTimeOfImpact(center->components, center->components, motion, grownMin, grownMax);
+}
+
+///
+//Finds when a sphere moving in a straight line first touches a stationary sphere
+//
+//Parameters:
+//	center: The center of the moving sphere at the start of it's motion
+//	radius: The radius of the moving sphere
+//	motion: The displacement of the moving sphere over the motion
+//	targetCenter: The center of the stationary sphere
+//	targetRadius: The radius of the stationary sphere
+//
+//Returns:
+//	The fraction of the motion at which the spheres first touch, from 0 to 1,
+//	Or -1 if they do not touch during the motion or already overlap at it's start
+float CollisionManager_GetSweptSphereSphereTimeOfImpact(const Vec3* center, const float radius, const Vec3* motion, const Vec3* targetCenter, const float targetRadius)
+{
+	//Solve |offset + motion * t| = radius + targetRadius for the first t
+	Vec3 offset;
+	Vec3_Subtract(&offset, center, targetCenter);
+	float radii = radius + targetRadius;
+
+	float a = Vec3_DotProduct(motion, motion);
+	float b = 2.0f * Vec3_DotProduct(&offset, motion);
+	float c = Vec3_DotProduct(&offset, &offset) - radii * radii;
+
+	//Already overlapping, or not moving so they cannot begin to touch
+	if(c < 0.0f || a == 0.0f)
+	{
+		return -1.0f;
+	}
+
+	float discriminant = b * b - 4.0f * a * c;
+	if(discriminant < 0.0f)
+	{
+		return -1.0f;
+	}
+
+	float time = (-b - sqrtf(discriminant)) / (2.0f * a);
+	if(time < 0.0f || time > 1.0f)
+	{
+		return -1.0f;
+	}
+	return time;
+}
+
+///
+//Fills in a support shape describing an object's collider in world space
+//
+//Parameters:
+//	dest: The support shape to fill in
+//	obj: The object with the collider to describe
+//	FoR: The frame of reference to orient the collider with
+static void CollisionManager_InitializeSupportShape(SupportShape* dest, GObject* obj, FrameOfReference* FoR)
+{
+	dest->type = obj->collider->type;
+	dest->points = NULL;
+	dest->numPoints = 0;
+	dest->radius = 0.0f;
+	Vec3_Copy(&dest->center, Vec3_FROM_VECTOR(FoR->position));
+	Vec3_Zero(&dest->halfDimensions);
+
+	switch(dest->type)
+	{
+	case COLLIDER_SPHERE:
+		dest->radius = SphereCollider_GetScaledRadius(obj->collider->data->sphereData, FoR);
+		break;
+	case COLLIDER_AABB:
+		{
+			ColliderData_AABB* AABB = obj->collider->data->AABBData;
+			ColliderData_AABB scaledAABB;
+			AABBCollider_GetScaledDimensions(&scaledAABB, AABB, FoR);
+
+			Vec3_Set(&dest->halfDimensions, scaledAABB.width / 2.0f, scaledAABB.height / 2.0f, scaledAABB.depth / 2.0f);
+			Vec3_Increment(&dest->center, Vec3_FROM_VECTOR(AABB->centroid));
+		}
+		break;
+	case COLLIDER_CONVEXHULL:
+		{
+			ColliderData_ConvexHull* convexHull = obj->collider->data->convexHullData;
+			dest->points = ConvexHullCollider_GetWorldCache(convexHull, FoR)->worldPoints;
+			dest->numPoints = convexHull->points->size;
+		}
+		break;
+	}
+}
+
+///
+//Gets the point of a support shape which is furthest in a direction
+//
+//Parameters:
+//	dest: The destination of the furthest point
+//	shape: The support shape to search
+//	direction: The direction to search in, need not be normalized
+static void CollisionManager_GetSupportPoint(Vec3* dest, const SupportShape* shape, const Vec3* direction)
+{
+	switch(shape->type)
+	{
+	case COLLIDER_SPHERE:
+		{
+			Vec3 offset;
+			Vec3_Copy(&offset, direction);
+			Vec3_Normalize(&offset);
+			//Any point on the surface will do if there is no direction
+			if(Vec3_GetMagSq(&offset) == 0.0f)
+			{
+				Vec3_Set(&offset, 1.0f, 0.0f, 0.0f);
+			}
+			Vec3_Scale(&offset, shape->radius);
+			Vec3_Add(dest, &shape->center, &offset);
+		}
+		break;
+	case COLLIDER_AABB:
+		for(int i = 0; i < 3; i++)
+		{
+			float halfDimension = shape->halfDimensions.components[i];
+			dest->components[i] = shape->center.components[i] + (direction->components[i] < 0.0f ? -halfDimension : halfDimension);
+		}
+		break;
+	case COLLIDER_CONVEXHULL:
+		{
+			unsigned int furthest = 0;
+			float maxProjection = Vec3_DotProduct(shape->points, direction);
+			for(unsigned int i = 1; i < shape->numPoints; i++)
+			{
+				float projection = Vec3_DotProduct(shape->points + i, direction);
+				if(projection > maxProjection)
+				{
+					maxProjection = projection;
+					furthest = i;
+				}
+			}
+			Vec3_Copy(dest, shape->points + furthest);
+		}
+		break;
+	}
+}
 
-	//Create array of pointers to hold oriented edges of colliders of objects in collision
-	Vector** orientedEdges1 = (Vector**)malloc(sizeof(Vector*) * convexHull1->edges->size);
-	Vector** orientedEdges2 = (Vector**)malloc(sizeof(Vector*) * convexHull2->edges->size);
+///
+//Gets the point of the minkowski difference of two support shapes (shape1 - shape2) which is furthest in a direction
+//
+//Parameters:
+//	dest: The destination of the furthest point
+//	shape1: The support shape being subtracted from
+//	shape2: The support shape being subtracted
+//	direction: The direction to search in, need not be normalized
+static void CollisionManager_GetMinkowskiSupportPoint(Vec3* dest, const SupportShape* shape1, const SupportShape* shape2, const Vec3* direction)
+{
+	Vec3 oppositeDirection;
+	Vec3_GetScalarProduct(&oppositeDirection, direction, -1.0f);
 
-	//Allocate & initialize individual vectors in array of point vectors for obj1
-	for(unsigned int i = 0; i < convexHull1->points->size; i++)
-	{
-		orientedPoints1[i] = Vector_Allocate();
-		Vector_Initialize(orientedPoints1[i], 3);
-	}
+	Vec3 support2;
+	CollisionManager_GetSupportPoint(dest, shape1, direction);
+	CollisionManager_GetSupportPoint(&support2, shape2, &oppositeDirection);
+	Vec3_Decrement(dest, &support2);
+}
 
-	//Allocate & initialize individual vectors in array in array of point vectors for obj2
-	for(unsigned int i = 0; i < convexHull2->points->size; i++)
+///
+//Performs the GJK intersection test, searching for a simplex of the minkowski difference of two shapes which contains the origin
+//
+//Parameters:
+//	simplex: An array of 4 Vec3s to store the final simplex in
+//	simplexSize: The destination of the number of points in the final simplex
+//	shape1: The first support shape to test
+//	shape2: The second support shape to test
+//
+//Returns:
+//	0 if the shapes are not intersecting
+//	1 if the shapes are intersecting
+static unsigned char CollisionManager_PerformGJK(Vec3* simplex, unsigned int* simplexSize, const SupportShape* shape1, const SupportShape* shape2)
+{
+	//Start searching from shape2 towards shape1
+	Vec3 direction;
+	Vec3_Subtract(&direction, &shape1->center, &shape2->center);
+	if(Vec3_GetMagSq(&direction) < GJK_tolerance * GJK_tolerance)
 	{
-		orientedPoints2[i] = Vector_Allocate();
-		Vector_Initialize(orientedPoints2[i], 3);
+		Vec3_Set(&direction, 1.0f, 0.0f, 0.0f);
 	}
 
-	//Allocate & initialize individual vectors in array of axes vectors for obj1
-	for(unsigned int i = 0; i < convexHull1->axes->size; i++)
-	{
-		orientedAxes1[i] = Vector_Allocate();
-		Vector_Initialize(orientedAxes1[i], 3);
-	}
+	CollisionManager_GetMinkowskiSupportPoint(simplex, shape1, shape2, &direction);
+	*simplexSize = 1;
+	Vec3_GetScalarProduct(&direction, simplex, -1.0f);
 
-	//Allocate & initialize individual vectors in array in array of axes vectors for obj2
-	for(unsigned int i = 0; i < convexHull2->axes->size; i++)
+	Vec3 support;
+	for(unsigned int i = 0; i < GJK_maxIterations; i++)
 	{
-		orientedAxes2[i] = Vector_Allocate();
-		Vector_Initialize(orientedAxes2[i], 3);
-	}
+		//If there is no direction left to search in the origin lies on the simplex
+		if(Vec3_GetMagSq(&direction) < GJK_tolerance * GJK_tolerance)
+		{
+			return 1;
+		}
 
-	//Allocate & initialize individual vectors in array of edges vectors for obj1
-	for(unsigned int i = 0; i < convexHull1->edges->size; i++)
-	{
-		orientedEdges1[i] = Vector_Allocate();
-		Vector_Initialize(orientedEdges1[i], 3);
-	}
+		CollisionManager_GetMinkowskiSupportPoint(&support, shape1, shape2, &direction);
 
-	//Allocate & initialize individual vectors in array in array of axes vectors for obj2
-	for(unsigned int i = 0; i < convexHull2->edges->size; i++)
-	{
-		orientedEdges2[i] = Vector_Allocate();
-		Vector_Initialize(orientedEdges2[i], 3);
-	}
+		//If the furthest point towards the origin does not pass it, the origin is outside of the minkowski difference
+		if(Vec3_DotProduct(&support, &direction) < 0.0f)
+		{
+			return 0;
+		}
 
-	//Get oriented points of objects
-	ConvexHullCollider_GetOrientedWorldPoints(orientedPoints1, convexHull1, obj1FoR);
-	ConvexHullCollider_GetOrientedWorldPoints(orientedPoints2, convexHull2, obj2FoR);
+		Vec3_Copy(simplex + *simplexSize, &support);
+		(*simplexSize)++;
 
-	//Get oriented axes of objects
-	ConvexHullCollider_GetOrientedAxes(orientedAxes1, convexHull1, obj1FoR);
-	ConvexHullCollider_GetOrientedAxes(orientedAxes2, convexHull2, obj2FoR);
+		if(CollisionManager_UpdateSimplex(simplex, simplexSize, &direction))
+		{
+			return 1;
+		}
+	}
 
-	//Get oriented edges of objects
-	ConvexHullCollider_GetOrientedEdges(orientedEdges1, convexHull1, obj1FoR);
-	ConvexHullCollider_GetOrientedEdges(orientedEdges2, convexHull2, obj2FoR);
+	//Only shapes which are just touching fail to converge
+	return 0;
+}
 
-	//Perform SAT Algorithm for face normals
-	detected = CollisionManager_PerformSATFaces(dest, 
-		(const Vector**)orientedAxes1, convexHull1->axes->size, (const Vector**)orientedPoints1, convexHull1->points->size,
-		(const Vector**)orientedAxes2, convexHull2->axes->size, (const Vector**)orientedPoints2, convexHull2->points->size);
+///
+//Reduces a GJK simplex to the feature closest to the origin and finds the next search direction.
+//The newest point must be the last point of the simplex.
+//
+//Parameters:
+//	simplex: The simplex to update
+//	simplexSize: A pointer to the number of points in the simplex
+//	direction: The destination of the next search direction
+//
+//Returns:
+//	0 if the simplex does not contain the origin
+//	1 if the simplex is a tetrahedron containing the origin
+static unsigned char CollisionManager_UpdateSimplex(Vec3* simplex, unsigned int* simplexSize, Vec3* direction)
+{
+	Vec3 a, b, c, d;
+	Vec3 ab, ac, ad, ao;
+	Vec3 normal, perpendicular;
 
-	//If there is a collision detection, test the edge normals
-	if(detected)
+	if(*simplexSize == 4)
 	{
-		detected = CollisionManager_PerformSATEdges(dest, 
-			(const Vector**)orientedEdges1, convexHull1->edges->size, (const Vector**)orientedPoints1, convexHull1->points->size,
-			(const Vector**)orientedEdges2, convexHull2->edges->size, (const Vector**)orientedPoints2, convexHull2->points->size);
-	}
+		//Check each face touching the newest point, the origin was already found to be beyond the opposite face
+		Vec3_Copy(&a, simplex + 3);
+		Vec3_GetScalarProduct(&ao, &a, -1.0f);
 
+		for(int i = 0; i < 3; i++)
+		{
+			//Each face is made of the newest point and two of the others, opposite the remaining one
+			Vec3_Copy(&b, simplex + i);
+			Vec3_Copy(&c, simplex + (i + 1) % 3);
+			Vec3_Copy(&d, simplex + (i + 2) % 3);
+
+			Vec3_Subtract(&ab, &b, &a);
+			Vec3_Subtract(&ac, &c, &a);
+			Vec3_Subtract(&ad, &d, &a);
+			Vec3_CrossProduct(&normal, &ab, &ac);
+			//Make the normal face away from the opposite point
+			if(Vec3_DotProduct(&normal, &ad) > 0.0f)
+			{
+				Vec3_Scale(&normal, -1.0f);
+			}
 
+			if(Vec3_DotProduct(&normal, &ao) > 0.0f)
+			{
+				//The origin is beyond this face, continue with it as a triangle
+				Vec3_Copy(simplex + 0, &c);
+				Vec3_Copy(simplex + 1, &b);
+				Vec3_Copy(simplex + 2, &a);
+				*simplexSize = 3;
+				return CollisionManager_UpdateSimplex(simplex, simplexSize, direction);
+			}
+		}
 
-	//Delete oriented arrays
-	for(unsigned int i = 0; i < convexHull1->points->size; i++)
-	{
-		Vector_Free(orientedPoints1[i]);
+		//The origin is not beyond any face
+		return 1;
 	}
-	free(orientedPoints1);
-	for(unsigned int i = 0; i < convexHull2->points->size; i++)
+	else if(*simplexSize == 3)
 	{
-		Vector_Free(orientedPoints2[i]);
-	}
-	free(orientedPoints2);
-	for(unsigned int i = 0; i < convexHull1->axes->size; i++)
-	{
-		Vector_Free(orientedAxes1[i]);
-	}
-	free(orientedAxes1);
-	for(unsigned int i = 0; i < convexHull2->axes->size; i++)
-	{
-		Vector_Free(orientedAxes2[i]);
-	}
-	free(orientedAxes2);
-	for(unsigned int i = 0; i < convexHull1->edges->size; i++)
-	{
-		Vector_Free(orientedEdges1[i]);
-	}
-	free(orientedEdges1);
-	for(unsigned int i = 0; i < convexHull2->edges->size; i++)
-	{
-		Vector_Free(orientedEdges2[i]);
-	}
-	free(orientedEdges2);
-
-	if(detected)
-	{
-		//MTV must always face obj1
-		Vector bToa;
-		Vector_INIT_ON_STACK(bToa, 3);
-
-		Vector_Subtract(&bToa, obj1FoR->position, obj2FoR->position);
+		Vec3_Copy(&a, simplex + 2);
+		Vec3_Copy(&b, simplex + 1);
+		Vec3_Copy(&c, simplex + 0);
+		Vec3_Subtract(&ab, &b, &a);
+		Vec3_Subtract(&ac, &c, &a);
+		Vec3_GetScalarProduct(&ao, &a, -1.0f);
+		Vec3_CrossProduct(&normal, &ab, &ac);
 
-		//Check if MTV must be reversed to face Obj 1
-		if(Vector_DotProduct(&bToa, dest->minimumTranslationVector) < 0.0f)
+		//Check if the origin is beyond edge AC
+		Vec3_CrossProduct(&perpendicular, &normal, &ac);
+		if(Vec3_DotProduct(&perpendicular, &ao) > 0.0f)
 		{
-			Vector_Scale(dest->minimumTranslationVector, -1.0f);
+			if(Vec3_DotProduct(&ac, &ao) > 0.0f)
+			{
+				//Closest to edge AC
+				Vec3_Copy(simplex + 0, &c);
+				Vec3_Copy(simplex + 1, &a);
+				*simplexSize = 2;
+				Vec3_CrossProduct(&perpendicular, &ac, &ao);
+				Vec3_CrossProduct(direction, &perpendicular, &ac);
+				return 0;
+			}
+		}
+		else
+		{
+			//Check if the origin is beyond edge AB
+			Vec3_CrossProduct(&perpendicular, &ab, &normal);
+			if(Vec3_DotProduct(&perpendicular, &ao) <= 0.0f)
+			{
+				//The origin is above or below the triangle
+				if(Vec3_DotProduct(&normal, &ao) > 0.0f)
+				{
+					Vec3_Copy(direction, &normal);
+				}
+				else
+				{
+					//Swap the winding so the next point is always added above the triangle
+					Vec3_Copy(simplex + 0, &b);
+					Vec3_Copy(simplex + 1, &c);
+					Vec3_GetScalarProduct(direction, &normal, -1.0f);
+				}
+				return 0;
+			}
 		}
 
-		dest->obj1 = obj1;
-		dest->obj1Frame = obj1FoR;
-		dest->obj2 = obj2;
-		dest->obj2Frame = obj2FoR;
+		//Closest to edge AB or point A
+		Vec3_Copy(simplex + 0, &b);
+		Vec3_Copy(simplex + 1, &a);
+		*simplexSize = 2;
+		return CollisionManager_UpdateSimplex(simplex, simplexSize, direction);
 	}
-	else
+	else if(*simplexSize == 2)
 	{
-		//If there is no collision set collision atributes to null
-		dest->overlap = 0.0f;
-		dest->obj1 = NULL;
-		dest->obj2 = NULL;
-		dest->obj1Frame = NULL;
-		dest->obj2Frame = NULL;
+		Vec3_Copy(&a, simplex + 1);
+		Vec3_Copy(&b, simplex + 0);
+		Vec3_Subtract(&ab, &b, &a);
+		Vec3_GetScalarProduct(&ao, &a, -1.0f);
 
+		if(Vec3_DotProduct(&ab, &ao) > 0.0f)
+		{
+			//Closest to the segment, search perpendicular to it towards the origin
+			Vec3_CrossProduct(&perpendicular, &ab, &ao);
+			Vec3_CrossProduct(direction, &perpendicular, &ab);
+		}
+		else
+		{
+			//Closest to the newest point
+			Vec3_Copy(simplex + 0, &a);
+			*simplexSize = 1;
+			Vec3_Copy(direction, &ao);
+		}
+		return 0;
 	}
+
+	//A single point
+	Vec3_GetScalarProduct(direction, simplex, -1.0f);
+	return 0;
 }
 
 ///
-//Tests if a a game object's convex hull is colliding with a sphere
-//If there is no collision, collision.obj1 and obj2 will be set to null upon
-//The end of this function
+//Adds points to a simplex from the minkowski difference of two shapes until it is a tetrahedron with volume.
+//GJK stops early when the origin lies on the simplex, but EPA needs a tetrahedron to expand.
+//A flat tetrahedron is rebuilt from it's first three points.
 //
 //Parameters:
-//	dest: Collision to store the results of test in
-//	convexObj: The gameObject with the convex hull to test
-//	convexFoR: the frame of reference to use to orient the convex hull collider
-//	sphere: The gameobject with the sphere collider to test
-//	sphereFoR: The frame of reference to use to orient the sphere collider
-void CollisionManager_TestConvexSphereCollision(Collision* dest, GObject* convexObj, FrameOfReference* convexFoR, GObject* sphereObj, FrameOfReference* sphereFoR)
+//	simplex: An array of 4 Vec3s holding the simplex to complete
+//	simplexSize: A pointer to the number of points in the simplex
+//	shape1: The first support shape
+//	shape2: The second support shape
+//
+//Returns:
+//	0 if the minkowski difference is flat and no tetrahedron could be built
+//	1 if the simplex is now a tetrahedron
+static unsigned char CollisionManager_CompleteSimplex(Vec3* simplex, unsigned int* simplexSize, const SupportShape* shape1, const SupportShape* shape2)
 {
-	float minOverlap = 0.0f;
-	unsigned char detected = 1;
-
-	//Get the convex hull data
-	ColliderData_ConvexHull* convexHull = convexObj->collider->data->convexHullData;
-	//Get the sphere data
-	ColliderData_Sphere* sphere = sphereObj->collider->data->sphereData;
-
-	//Create array of pointers to vectors to hold the oriented points of the collider of convex obj in collision
-	Vector** orientedPoints = (Vector**)malloc(sizeof(Vector*) * convexHull->points->size);
-	//Create array of pointers to vectors to hold the oriented axes of the collider of convex object in collision
-	Vector** orientedAxes = (Vector**)malloc(sizeof(Vector*) * convexHull->axes->size);
+	const float toleranceSq = GJK_tolerance * GJK_tolerance;
+
+	Vec3 directions[6];
+	Vec3 support;
+	Vec3 offset;
+	Vec3 normal;
+
+	//A tetrahedron which GJK found with it's points on a plane can't be expanded, so rebuild it from it's first face
+	if(*simplexSize == 4)
+	{
+		Vec3 ab, ac, ad;
+		Vec3_Subtract(&ab, simplex + 1, simplex);
+		Vec3_Subtract(&ac, simplex + 2, simplex);
+		Vec3_Subtract(&ad, simplex + 3, simplex);
+		Vec3_CrossProduct(&normal, &ab, &ac);
+		if(fabs(Vec3_DotProduct(&normal, &ad)) > GJK_tolerance * Vec3_GetMag(&normal))
+		{
+			return 1;
+		}
+		*simplexSize = 3;
+	}
 
-	//Allocate & initialize individual vectors in array of point vectors for convex obj
-	for(unsigned int i = 0; i < convexHull->points->size; i++)
+	if(*simplexSize == 1)
 	{
-		orientedPoints[i] = Vector_Allocate();
-		Vector_Initialize(orientedPoints[i], 3);
+		//Search along each axis for a second point
+		Vec3_Set(directions + 0, 1.0f, 0.0f, 0.0f);
+		Vec3_Set(directions + 1, -1.0f, 0.0f, 0.0f);
+		Vec3_Set(directions + 2, 0.0f, 1.0f, 0.0f);
+		Vec3_Set(directions + 3, 0.0f, -1.0f, 0.0f);
+		Vec3_Set(directions + 4, 0.0f, 0.0f, 1.0f);
+		Vec3_Set(directions + 5, 0.0f, 0.0f, -1.0f);
+
+		for(int i = 0; i < 6 && *simplexSize == 1; i++)
+		{
+			CollisionManager_GetMinkowskiSupportPoint(&support, shape1, shape2, directions + i);
+			Vec3_Subtract(&offset, &support, simplex);
+			if(Vec3_GetMagSq(&offset) > toleranceSq)
+			{
+				Vec3_Copy(simplex + 1, &support);
+				*simplexSize = 2;
+			}
+		}
+		if(*simplexSize == 1) return 0;
 	}
 
-	//Allocate & initialize individual vectors in array of axes vectors for convex obj
-	for(unsigned int i = 0; i < convexHull->axes->size; i++)
+	if(*simplexSize == 2)
 	{
-		orientedAxes[i] = Vector_Allocate();
-		Vector_Initialize(orientedAxes[i], 3);
-	}
+		//Search perpendicular to the segment for a third point
+		Vec3 segment;
+		Vec3_Subtract(&segment, simplex + 1, simplex);
 
-	ConvexHullCollider_GetOrientedAxes(orientedAxes, convexHull, convexFoR);
-	ConvexHullCollider_GetOrientedWorldPoints(orientedPoints, convexHull, convexFoR);
+		//Cross with the axis the segment is least aligned with
+		Vec3 axis;
+		Vec3_Zero(&axis);
+		int smallest = 0;
+		for(int i = 1; i < 3; i++)
+		{
+			if(fabs(segment.components[i]) < fabs(segment.components[smallest])) smallest = i;
+		}
+		axis.components[smallest] = 1.0f;
 
-	ProjectionBounds bounds[2];
+		Vec3_CrossProduct(directions + 0, &segment, &axis);
+		Vec3_CrossProduct(directions + 2, &segment, directions + 0);
+		Vec3_GetScalarProduct(directions + 1, directions + 0, -1.0f);
+		Vec3_GetScalarProduct(directions + 3, directions + 2, -1.0f);
 
-	Vector** sphereSurfacePoints = (Vector**)malloc(sizeof(Vector*) * 2);
-	for(int i = 0; i < 2; i++)
-	{
-		sphereSurfacePoints[i] = Vector_Allocate();
-		Vector_Initialize(sphereSurfacePoints[i], 3);
+		float segmentMagSq = Vec3_GetMagSq(&segment);
+		for(int i = 0; i < 4 && *simplexSize == 2; i++)
+		{
+			CollisionManager_GetMinkowskiSupportPoint(&support, shape1, shape2, directions + i);
+			//Make sure the point is not on the line through the segment
+			Vec3_Subtract(&offset, &support, simplex);
+			Vec3_CrossProduct(&normal, &offset, &segment);
+			if(Vec3_GetMagSq(&normal) > toleranceSq * segmentMagSq)
+			{
+				Vec3_Copy(simplex + 2, &support);
+				*simplexSize = 3;
+			}
+		}
+		if(*simplexSize == 2) return 0;
 	}
 
-	Vector normalizedAxis;
-	Vector_INIT_ON_STACK(normalizedAxis, 3);
-	for(unsigned int i = 0; i < convexHull->axes->size; i++)
+	if(*simplexSize == 3)
 	{
-		Vector_Copy(&normalizedAxis, orientedAxes[i]);
-		Vector_Normalize(&normalizedAxis);
+		//Search along both sides of the triangle's normal for a fourth point
+		Vec3 ab, ac;
+		Vec3_Subtract(&ab, simplex + 1, simplex);
+		Vec3_Subtract(&ac, simplex + 2, simplex);
+		Vec3_CrossProduct(&normal, &ab, &ac);
+		Vec3_Normalize(&normal);
 
-		//Scale sphere surface points to maximum scale in sphere's Frame of reference
-		float scaledRad = SphereCollider_GetScaledRadius(sphere, sphereFoR);
-		Vector_Scale(&normalizedAxis, scaledRad);
-		Vector_Add(sphereSurfacePoints[0], sphereFoR->position, &normalizedAxis);
-		Vector_Subtract(sphereSurfacePoints[1], sphereFoR->position, &normalizedAxis);
+		for(int i = 0; i < 2 && *simplexSize == 3; i++)
+		{
+			CollisionManager_GetMinkowskiSupportPoint(&support, shape1, shape2, &normal);
+			//Make sure the point is not on the plane of the triangle
+			Vec3_Subtract(&offset, &support, simplex);
+			if(fabs(Vec3_DotProduct(&offset, &normal)) > GJK_tolerance)
+			{
+				Vec3_Copy(simplex + 3, &support);
+				*simplexSize = 4;
+			}
+			Vec3_Scale(&normal, -1.0f);
+		}
+		if(*simplexSize == 3) return 0;
+	}
 
+	return 1;
+}
 
-		CollisionManager_GetProjectionBounds(bounds, orientedAxes[i],(const Vector**) orientedPoints, convexHull->points->size);
-		CollisionManager_GetProjectionBounds(bounds + 1, orientedAxes[i],(const Vector**) sphereSurfacePoints, 2);
+///
+//Performs the expanding polytope algorithm to find the penetration of two intersecting shapes
+//Storing the minimum translation vector of shape1 and the overlap in a collision
+//
+//Parameters:
+//	dest: The collision to store the results in
+//	simplex: A tetrahedron of the minkowski difference of the shapes which contains the origin
+//	shape1: The first support shape
+//	shape2: The second support shape
+static void CollisionManager_PerformEPA(Collision* dest, const Vec3* simplex, const SupportShape* shape1, const SupportShape* shape2)
+{
+	EPAPolytope polytope;
+	EPAEdge horizon[128];
+	const unsigned int maxHorizon = sizeof(horizon) / sizeof(EPAEdge);
+	const unsigned int maxVertices = sizeof(polytope.vertices) / sizeof(Vec3);
+	const unsigned int maxFaces = sizeof(polytope.faces) / sizeof(EPAFace);
+
+	for(int i = 0; i < 4; i++)
+	{
+		Vec3_Copy(polytope.vertices + i, simplex + i);
+	}
+	polytope.numVertices = 4;
+	polytope.numFaces = 0;
+
+	//Wind each face of the tetrahedron so it faces away from the vertex opposite of it
+	const unsigned int tetrahedron[4][4] = { {0, 1, 2, 3}, {0, 3, 1, 2}, {0, 2, 3, 1}, {1, 3, 2, 0} };
+	Vec3 ab, ac, ad, normal;
+	for(int i = 0; i < 4; i++)
+	{
+		const unsigned int* face = tetrahedron[i];
+		Vec3_Subtract(&ab, polytope.vertices + face[1], polytope.vertices + face[0]);
+		Vec3_Subtract(&ac, polytope.vertices + face[2], polytope.vertices + face[0]);
+		Vec3_Subtract(&ad, polytope.vertices + face[3], polytope.vertices + face[0]);
+		Vec3_CrossProduct(&normal, &ab, &ac);
+		if(Vec3_DotProduct(&normal, &ad) > 0.0f)
+		{
+			CollisionManager_AddEPAFace(&polytope, face[0], face[2], face[1]);
+		}
+		else
+		{
+			CollisionManager_AddEPAFace(&polytope, face[0], face[1], face[2]);
+		}
+	}
 
-		//Check for overlap
-		if(bounds[0].min <= bounds[1].max && bounds[0].max >= bounds[1].min)
+	unsigned int closest = 0;
+	Vec3 support;
+	Vec3 offset;
+	for(unsigned int iteration = 0; iteration < EPA_maxIterations; iteration++)
+	{
+		//Find the face closest to the origin
+		closest = 0;
+		for(unsigned int i = 1; i < polytope.numFaces; i++)
 		{
-			//IF there is overlap we must keep track of the smallest overlap and the axis it occurs on
-			//If an axis is overlapping we must track which has the smallest overlap!
-			float overlap1 = bounds[1].max - bounds[0].min;
-			float overlap2 = bounds[0].max - bounds[1].min;
+			if(polytope.faces[i].distance < polytope.faces[closest].distance) closest = i;
+		}
 
-			//Determine thesmallest overlap
-			float smallerOverlap = overlap1 < overlap2 ? overlap1 : overlap2;
+		//If the polytope can't be pushed out further past the closest face, it lies on the surface of the minkowski difference
+		CollisionManager_GetMinkowskiSupportPoint(&support, shape1, shape2, &polytope.faces[closest].normal);
+		if(Vec3_DotProduct(&support, &polytope.faces[closest].normal) - polytope.faces[closest].distance < GJK_tolerance)
+		{
+			break;
+		}
 
+		//Settle for the closest face so far if the polytope is full
+		if(polytope.numVertices == maxVertices)
+		{
+			break;
+		}
 
-			//if the overlap is smaller than the current smallest overlap
-			if(smallerOverlap < minOverlap || i == 0)
+		//Remove every face the new point can see, remembering the edges bordering the hole
+		unsigned int numHorizon = 0;
+		unsigned char overflow = 0;
+		for(unsigned int i = 0; i < polytope.numFaces; i++)
+		{
+			EPAFace* face = polytope.faces + i;
+			Vec3_Subtract(&offset, &support, polytope.vertices + face->a);
+			if(Vec3_DotProduct(&face->normal, &offset) <= 0.0f) continue;
+
+			const unsigned int edges[3][2] = { {face->a, face->b}, {face->b, face->c}, {face->c, face->a} };
+			for(int j = 0; j < 3; j++)
 			{
-				//Assign the minimum overlap to the smallest of the two overlaps
-				minOverlap = smallerOverlap;
-				//Assign the MTV to the current axis
-				Vector_Copy(dest->minimumTranslationVector, orientedAxes[i]);
+				//An edge shared with another removed face is not on the horizon
+				unsigned char shared = 0;
+				for(unsigned int k = 0; k < numHorizon; k++)
+				{
+					if(horizon[k].a == edges[j][1] && horizon[k].b == edges[j][0])
+					{
+						horizon[k] = horizon[--numHorizon];
+						shared = 1;
+						break;
+					}
+				}
+				if(!shared)
+				{
+					if(numHorizon == maxHorizon)
+					{
+						overflow = 1;
+						break;
+					}
+					horizon[numHorizon].a = edges[j][0];
+					horizon[numHorizon].b = edges[j][1];
+					numHorizon++;
+				}
 			}
+
+			//Replace the face with the last face and check the replacement next
+			polytope.faces[i] = polytope.faces[--polytope.numFaces];
+			i--;
+
+			if(overflow) break;
 		}
-		else
+
+		if(overflow || polytope.numFaces + numHorizon > maxFaces)
 		{
-			//If any axis is not overlapping, there is no collision
-			detected = 0;
+			//The polytope was left with a hole, settle for the closest face that remains
+			closest = 0;
+			for(unsigned int i = 1; i < polytope.numFaces; i++)
+			{
+				if(polytope.faces[i].distance < polytope.faces[closest].distance) closest = i;
+			}
 			break;
 		}
 
-	}
-
-	if(detected)
-	{
-		//If there is a collision assign collision attributes
-		dest->overlap = minOverlap;
-		dest->obj1 = convexObj;
-		dest->obj1Frame = convexFoR;
-		dest->obj2 = sphereObj;
-		dest->obj2Frame = sphereFoR;
-
-		//Make sure MTV is normalized
-		Vector_Normalize(dest->minimumTranslationVector);
-
-		//By convention MTV must always point towards obj1
-		Vector bToa;
-		Vector_INIT_ON_STACK(bToa, 3);
+		//Patch the hole with faces from each horizon edge to the new point
+		Vec3_Copy(polytope.vertices + polytope.numVertices, &support);
+		for(unsigned int i = 0; i < numHorizon; i++)
+		{
+			CollisionManager_AddEPAFace(&polytope, horizon[i].a, horizon[i].b, polytope.numVertices);
+		}
+		polytope.numVertices++;
 
-		//Vector_Subtract(&bToa, sphereFoR->position, convexFoR->position);
-		Vector_Subtract(&bToa, convexFoR->position, sphereFoR->position);
-		//Check if MTV must be reversed to face Obj 1
-		if(Vector_DotProduct(&bToa, dest->minimumTranslationVector) < 0.0f)
+		//Find the closest face for the result if this was the last iteration
+		closest = 0;
+		for(unsigned int i = 1; i < polytope.numFaces; i++)
 		{
-			Vector_Scale(dest->minimumTranslationVector, -1.0f);
+			if(polytope.faces[i].distance < polytope.faces[closest].distance) closest = i;
 		}
 	}
-	else
-	{
-		//If there is no collision set the collision attributes to 0.
-		dest->overlap = 0.0f;
-		dest->obj1 = NULL;
-		dest->obj1Frame = NULL;
-		dest->obj2 = NULL;
-		dest->obj2Frame = NULL;
-	}
 
-	//Delete heap allocated variables
-	for(unsigned int i = 0; i < convexHull->points->size; i++)
-	{
-		Vector_Free(orientedPoints[i]);
-	}
-	free(orientedPoints);
+	//The closest face's normal points from shape2 into shape1, moving shape1 against it separates them
+	Vec3_GetScalarProduct(Vec3_FROM_VECTOR(dest->minimumTranslationVector), &polytope.faces[closest].normal, -1.0f);
+	dest->overlap = polytope.faces[closest].distance > 0.0f ? polytope.faces[closest].distance : 0.0f;
+}
 
-	for(unsigned int i = 0; i < convexHull->axes->size; i++)
+///
+//Adds a face to an EPA polytope, computing it's normal and distance from the origin
+//
+//Parameters:
+//	polytope: The polytope to add the face to
+//	a: Index of the first vertex of the face
+//	b: Index of the second vertex of the face
+//	c: Index of the third vertex of the face
+static void CollisionManager_AddEPAFace(EPAPolytope* polytope, const unsigned int a, const unsigned int b, const unsigned int c)
+{
+	EPAFace* face = polytope->faces + polytope->numFaces;
+	face->a = a;
+	face->b = b;
+	face->c = c;
+
+	Vec3 ab, ac;
+	Vec3_Subtract(&ab, polytope->vertices + b, polytope->vertices + a);
+	Vec3_Subtract(&ac, polytope->vertices + c, polytope->vertices + a);
+	Vec3_CrossProduct(&face->normal, &ab, &ac);
+
+	if(Vec3_GetMagSq(&face->normal) > 0.0f)
 	{
-		Vector_Free(orientedAxes[i]);
+		Vec3_Normalize(&face->normal);
+		face->distance = Vec3_DotProduct(&face->normal, polytope->vertices + a);
 	}
-	free(orientedAxes);
-
-	for(unsigned int i = 0; i < 2; i++)
+	else
 	{
-		Vector_Free(sphereSurfacePoints[i]);
+		//A face with no area has no direction to expand in, so it must never be the closest
+		face->distance = FLT_MAX;
 	}
-	free(sphereSurfacePoints);
-
 
+	polytope->numFaces++;
 }
 
 ///
@@ -1482,23 +2445,23 @@ void CollisionManager_TestConvexSphereCollision(Collision* dest, GObject* convex
 //
 //Parameters:
 //	dest: A pointer to a collision to store the results of the test in. Results will not be stored if the test detects no collision
-//	orientedAxes1: An array of pointers to vectors representing the oriented axes of object 1 involved in the test
+//	orientedAxes1: A contiguous array of Vec3s representing the oriented axes of object 1 involved in the test
 //	numAxes1: The number of axes belonging to object 1
-//	orientedPoints1: An array of pointers to vectors representing the oriented points of object 1 involved in the test
+//	orientedPoints1: A contiguous array of Vec3s representing the oriented points of object 1 involved in the test
 //	numPoints1: The number of points belonging to object 1
-//	orientedAxes2: An array of pointersto vectors representing the oriented axes of object 2 involved in the test
+//	orientedAxes2: A contiguous array of Vec3s representing the oriented axes of object 2 involved in the test
 //	numAxes2: The number of axes belonging to object 2
-//	orientedPoints2: An array of pointers to vectors representing the oriented points of object 2 involved in the test
+//	orientedPoints2: A contiguous array of Vec3s representing the oriented points of object 2 involved in the test
 //	numPoints2: The number of points belonging to object 2
 //
 //Returns:
 //	0 if the test detects no collision
 //	1 if the test detects a collision
 static unsigned char CollisionManager_PerformSATFaces(Collision* dest, 
-													  const Vector** orientedAxes1, unsigned int numAxes1, 
-													  const Vector** orientedPoints1, const unsigned int numPoints1, 
-													  const Vector** orientedAxes2, const unsigned int numAxes2, 
-													  const Vector** orientedPoints2, const unsigned int numPoints2)
+													  const Vec3* orientedAxes1, unsigned int numAxes1, 
+													  const Vec3* orientedPoints1, const unsigned int numPoints1, 
+													  const Vec3* orientedAxes2, const unsigned int numAxes2, 
+													  const Vec3* orientedPoints2, const unsigned int numPoints2)
 {
 	unsigned char detected = 1;		//Tracks if any axis does not detect a collision
 	float minOverlap = 0.0f;		//Stores the minimum overlap of all axes
@@ -1509,8 +2472,8 @@ static unsigned char CollisionManager_PerformSATFaces(Collision* dest,
 	//Test obj1's axis
 	for(unsigned int i = 0; i < numAxes1; i++)
 	{
-		CollisionManager_GetProjectionBounds(bounds, orientedAxes1[i], orientedPoints1, numPoints1);
-		CollisionManager_GetProjectionBounds(bounds + 1, orientedAxes1[i], orientedPoints2, numPoints2);
+		CollisionManager_GetProjectionBounds(bounds, orientedAxes1 + i, orientedPoints1, numPoints1);
+		CollisionManager_GetProjectionBounds(bounds + 1, orientedAxes1 + i, orientedPoints2, numPoints2);
 
 		//Check if the min and max projections overlap on the axis
 		if(bounds[0].min < bounds[1].max && bounds[0].max > bounds[1].min)
@@ -1529,7 +2492,7 @@ static unsigned char CollisionManager_PerformSATFaces(Collision* dest,
 				//Assign the minimum overlap to the smallest of the two overlaps
 				minOverlap = smallerOverlap;
 				//Assign the MTV to the current axis
-				Vector_Copy(dest->minimumTranslationVector, orientedAxes1[i]);
+				Vec3_Copy(Vec3_FROM_VECTOR(dest->minimumTranslationVector), orientedAxes1 + i);
 			}
 
 		}
@@ -1546,8 +2509,8 @@ static unsigned char CollisionManager_PerformSATFaces(Collision* dest,
 	{
 		for(unsigned int i = 0; i < numAxes2; i++)
 		{
-			CollisionManager_GetProjectionBounds(bounds, orientedAxes2[i], orientedPoints1, numPoints1);
-			CollisionManager_GetProjectionBounds(bounds + 1, orientedAxes2[i], orientedPoints2, numPoints2);
+			CollisionManager_GetProjectionBounds(bounds, orientedAxes2 + i, orientedPoints1, numPoints1);
+			CollisionManager_GetProjectionBounds(bounds + 1, orientedAxes2 + i, orientedPoints2, numPoints2);
 
 
 			//Check for overlap
@@ -1568,7 +2531,7 @@ static unsigned char CollisionManager_PerformSATFaces(Collision* dest,
 					//Assign the minimum overlap to the smallest of the two overlaps
 					minOverlap = smallerOverlap;
 					//Assign the MTV to the current axis
-					Vector_Copy(dest->minimumTranslationVector, orientedAxes2[i]);
+					Vec3_Copy(Vec3_FROM_VECTOR(dest->minimumTranslationVector), orientedAxes2 + i);
 				}
 			}
 			else
@@ -1595,19 +2558,19 @@ static unsigned char CollisionManager_PerformSATFaces(Collision* dest,
 //
 //Parameters:
 //	dest: A pointer to the collision to store the results of the test in. Resultswill not be stored if the test detects no collisions
-//	orientedEdges1: An array of pointers to vectors representing the oriented edges of object 1
+//	orientedEdges1: A contiguous array of Vec3s representing the oriented edges of object 1
 //	numEdges1: The number of edges belonging to object 1
-//	orientedPoints1: An array of pointers to vectors representing the oriented points of object 1
+//	orientedPoints1: A contiguous array of Vec3s representing the oriented points of object 1
 //	numPoints1: The number of points belonging to object 1
-//	orientedEdges2: An array of pointers to vectors representing the oriented edges of object 2
+//	orientedEdges2: A contiguous array of Vec3s representing the oriented edges of object 2
 //	numEdges2: The number of edges belonging to object 2
-//  orientedPoints2: An array of pointers to vectors representing the oriented points of object 2
+//  orientedPoints2: A contiguous array of Vec3s representing the oriented points of object 2
 //	numPoints2: the number of points belonging to object 2
 static unsigned char CollisionManager_PerformSATEdges(Collision*dest,
-													  const Vector** orientedEdges1, const unsigned int numEdges1,
-													  const Vector** orientedPoints1, const unsigned int numPoints1,
-													  const Vector** orientedEdges2, const unsigned int numEdges2,
-													  const Vector** orientedPoints2, const unsigned int numPoints2)
+													  const Vec3* orientedEdges1, const unsigned int numEdges1,
+													  const Vec3* orientedPoints1, const unsigned int numPoints1,
+													  const Vec3* orientedEdges2, const unsigned int numEdges2,
+													  const Vec3* orientedPoints2, const unsigned int numPoints2)
 {
 	unsigned char detected = 1;		//Tracks if any axis does not detect a collision
 	float minOverlap = dest->overlap;		//Stores the minimum overlap of all axes
@@ -1616,8 +2579,7 @@ static unsigned char CollisionManager_PerformSATEdges(Collision*dest,
 	ProjectionBounds bounds[2];
 
 	//The normal from the cross product of each edge
-	Vector normal;
-	Vector_INIT_ON_STACK(normal, 3);
+	Vec3 normal;
 
 	//For each one of OBJ1's edges
 	for(unsigned int i = 0; i < numEdges1; i++)
@@ -1627,18 +2589,18 @@ static unsigned char CollisionManager_PerformSATEdges(Collision*dest,
 		{
 
 			//Calculate the normal from the cross product of the two edges
-			Vector_CrossProduct(&normal, orientedEdges1[i], orientedEdges2[j]);
+			Vec3_CrossProduct(&normal, orientedEdges1 + i, orientedEdges2 + j);
 
 			//Normalize it!
-			Vector_Normalize(&normal);
-
-			CollisionManager_GetProjectionBounds(bounds, &normal, orientedPoints1, numPoints1);
-			CollisionManager_GetProjectionBounds(bounds + 1, &normal, orientedPoints2, numPoints2);
+			Vec3_Normalize(&normal);
 
 			//If the normal vector is the zero vector, skip this axis test
-			if(Vector_GetMag(&normal) == 0)
+			if(Vec3_GetMagSq(&normal) == 0.0f)
 				continue;
 
+			CollisionManager_GetProjectionBounds(bounds, &normal, orientedPoints1, numPoints1);
+			CollisionManager_GetProjectionBounds(bounds + 1, &normal, orientedPoints2, numPoints2);
+
 			//Check if the min and max projections overlap on the axis
 			if(bounds[0].min <= bounds[1].max && bounds[0].max >= bounds[1].min)
 			{
@@ -1656,7 +2618,7 @@ static unsigned char CollisionManager_PerformSATEdges(Collision*dest,
 					//Assign the minimum overlap to the smallest of the two overlaps
 					minOverlap = smallerOverlap;
 					//Assign the MTV to the current axis
-					Vector_Copy(dest->minimumTranslationVector, &normal);
+					Vec3_Copy(Vec3_FROM_VECTOR(dest->minimumTranslationVector), &normal);
 				}
 
 			}
@@ -1681,17 +2643,18 @@ static unsigned char CollisionManager_PerformSATEdges(Collision*dest,
 //Parameters:
 //	dest: The destination of the projection bounds
 //	axis: The axis projecting onto
-//	points: The set of points to project onto the axis
-static void CollisionManager_GetProjectionBounds(ProjectionBounds* dest, const Vector* axis, const Vector** points, const int numPoints)
+//	points: The contiguous set of points to project onto the axis
+//	numPoints: The number of points in the set
+static void CollisionManager_GetProjectionBounds(ProjectionBounds* dest, const Vec3* axis, const Vec3* points, const int numPoints)
 {
-	float result = Vector_DotProduct(axis, points[0]);
+	float result = Vec3_DotProduct(axis, points);
 
 	dest->min = result;
 	dest->max = result;
 
-	for(int i = 0; i < numPoints; i++)
+	for(int i = 1; i < numPoints; i++)
 	{
-		result = Vector_DotProduct(axis, points[i]);
+		result = Vec3_DotProduct(axis, points + i);
 		if(result < dest->min) dest->min = result;
 		else if(result > dest->max) dest->max = result;
 	}
@@ -1716,8 +2679,27 @@ static CollisionBuffer* CollisionManager_AllocateBuffer(void)
 //	buffer: The buffer to initialize
 static void CollisionManager_InitializeBuffer(CollisionBuffer* buffer)
 {
-	buffer->collisions = LinkedList_Allocate();
-	LinkedList_Initialize(buffer->collisions);
+	buffer->collisions = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->collisions, sizeof(Collision*));
+
+	buffer->pairCache = PairCache_Allocate();
+	PairCache_Initialize(buffer->pairCache, PairCache_defaultCapacity);
+
+	//The outputs are allocated once the leaves are first tested on more than one thread
+	buffer->narrowPhaseThreads = NULL;
+	buffer->numNarrowPhaseThreads = 0;
+
+	buffer->octTreeLeaves = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->octTreeLeaves, sizeof(struct OctTreeLeaf));
+
+	//Every pair of collider types starts out tested by SAT
+	for(unsigned int i = 0; i < Collider_numTypes; i++)
+	{
+		for(unsigned int j = 0; j < Collider_numTypes; j++)
+		{
+			buffer->narrowPhaseAlgorithms[i][j] = NARROWPHASE_SAT;
+		}
+	}
 }
 
 
@@ -1728,7 +2710,12 @@ static void CollisionManager_InitializeBuffer(CollisionBuffer* buffer)
 //	buffer: A pointer to The collision buffer to free
 static void CollisionManager_FreeBuffer(CollisionBuffer* buffer)
 {
-	LinkedList_Free(buffer->collisions);
+	DynamicArray_Free(buffer->collisions);
+	PairCache_Free(buffer->pairCache);
+
+	CollisionManager_FreeNarrowPhaseThreads();
+	DynamicArray_Free(buffer->octTreeLeaves);
+
 	free(buffer);
 }
 
@@ -1754,9 +2741,9 @@ static void CollisionManager_InitializeCollision(Collision* collision)
 	collision->obj1Frame = NULL;
 	collision->obj2 = NULL;
 	collision->obj2Frame = NULL;
+	collision->contactEvent = CONTACT_BEGIN;
 
-	collision->minimumTranslationVector = Vector_Allocate();
-	Vector_Initialize(collision->minimumTranslationVector, 3);
+	collision->minimumTranslationVector = Vec3_Storage_Initialize(&collision->minimumTranslationVectorStorage);
 }
 
 ///
@@ -1767,6 +2754,5 @@ static void CollisionManager_InitializeCollision(Collision* collision)
 //	collision: The collision being freed
 void CollisionManager_FreeCollision(Collision* collision)
 {
-	Vector_Free(collision->minimumTranslationVector);
 	free(collision);
 }
\ No newline at end of file
@@ -5,6 +5,11 @@
 #include "LinkedList.h"
 
 #include "OctTree.h"
+#include "SweepAndPrune.h"
+#include "AABBTree.h"
+#include "LinearOctTree.h"
+#include "PairCache.h"
+#include "JobManager.h"
 
 struct Collision
 {
@@ -14,11 +19,30 @@ struct Collision
 	FrameOfReference* obj2Frame;
 	Vector* minimumTranslationVector;	//Normalized vector describing the collision / contact normal
 	float overlap;						//The magnitude of the overlap on the minimum translation axis
+
+	ContactEvent contactEvent;			//Whether the pair began colliding this frame or was already colliding last frame
+
+	Vec3_Storage minimumTranslationVectorStorage;	//Inline storage the minimumTranslationVector points into
+};
+
+//Dictates which algorithm tests a pair of collider types for collision
+enum NarrowPhaseAlgorithm
+{
+	NARROWPHASE_SAT,	//The separating axis theorem, or the specialized test for the pair
+	NARROWPHASE_GJK		//GJK intersection test followed by EPA for the penetration depth
 };
 
 typedef struct CollisionBuffer
 {
-	LinkedList* collisions;		//Contains the list of registered collisions for each frame
+	DynamicArray* collisions;	//Contains pointers to the registered collisions for each frame
+	PairCache* pairCache;		//The pairs tested this frame and the pairs colliding last frame, kept by the broad phase updates
+
+	//The algorithm used to test each pair of collider types, indexed by the ColliderType of each object
+	NarrowPhaseAlgorithm narrowPhaseAlgorithms[Collider_numTypes][Collider_numTypes];
+
+	struct NarrowPhaseThread* narrowPhaseThreads;		//The output of each thread of the job manager, NULL until the oct tree leaves are first tested in parallel
+	unsigned int numNarrowPhaseThreads;					//The number of threads narrowPhaseThreads was allocated for
+	DynamicArray* octTreeLeaves;						//OctTreeLeaf of each leaf with a pair to test, in the order a serial update visits them
 } CollisionBuffer;
 
 ///
@@ -29,6 +53,62 @@ struct ProjectionBounds
 	float min, max;
 };
 
+//Describes a collider in world space with everything it's support function needs
+struct SupportShape
+{
+	ColliderType type;
+	const Vec3* points;			//World space points of a convex hull
+	unsigned int numPoints;		//Number of points of a convex hull
+	Vec3 center;				//World space center of a sphere or AABB
+	Vec3 halfDimensions;		//Half of the scaled width, height and depth of an AABB
+	float radius;				//Scaled radius of a sphere
+};
+
+//A triangle on the surface of the polytope EPA expands, wound counter clockwise seen from outside
+struct EPAFace
+{
+	unsigned int a, b, c;		//Indices of the vertices of the face
+	Vec3 normal;				//Normalized outward facing normal
+	float distance;				//Distance from the origin to the plane of the face
+};
+
+//An edge on the horizon of the faces EPA removes when it expands the polytope
+struct EPAEdge
+{
+	unsigned int a, b;
+};
+
+//The polytope EPA expands. It lives on the stack so tests never allocate.
+struct EPAPolytope
+{
+	Vec3 vertices[128];
+	unsigned int numVertices;
+	EPAFace faces[256];
+	unsigned int numFaces;
+};
+
+//An oct tree leaf tested in parallel, and where the collisions found in it were stored.
+//A leaf is tested whole by one thread, so it's collisions are contiguous in that thread's output.
+struct OctTreeLeaf
+{
+	OctTree_Node* node;
+	unsigned int threadIndex;		//Index of the thread which tested the leaf
+	unsigned int firstCollision;	//Index of the leaf's first collision in the thread's output
+	unsigned int numCollisions;		//Number of collisions found in the leaf
+};
+
+//The collisions found by one thread of a parallel oct tree update, kept until they are merged
+struct NarrowPhaseThread
+{
+	DynamicArray* collisions;	//Collision* of each collision found, in the order the thread found them
+	Collision* spare;			//Collision to store the thread's next test in
+};
+
+static const unsigned int GJK_maxIterations = 64;		//GJK gives up and reports no collision after this many support points
+static const unsigned int EPA_maxIterations = 64;		//EPA settles for it's closest face after this many expansions
+static const float GJK_tolerance = 0.0001f;				//Distances smaller than this are considered to be 0
+static const float CollisionManager_sweepSurfaceTolerance = 0.05f;	//Deepest a swept box can sink into a surface it slides along
+
 static CollisionBuffer* collisionBuffer;
 
 ///
@@ -75,6 +155,99 @@ static void CollisionManager_InitializeCollision(Collision* collision);
 //	collision: The collision being freed
 void CollisionManager_FreeCollision(Collision* collision);
 
+///
+//Fills in a support shape describing an object's collider in world space
+//
+//Parameters:
+//	dest: The support shape to fill in
+//	obj: The object with the collider to describe
+//	FoR: The frame of reference to orient the collider with
+static void CollisionManager_InitializeSupportShape(SupportShape* dest, GObject* obj, FrameOfReference* FoR);
+
+///
+//Gets the point of a support shape which is furthest in a direction
+//
+//Parameters:
+//	dest: The destination of the furthest point
+//	shape: The support shape to search
+//	direction: The direction to search in, need not be normalized
+static void CollisionManager_GetSupportPoint(Vec3* dest, const SupportShape* shape, const Vec3* direction);
+
+///
+//Gets the point of the minkowski difference of two support shapes (shape1 - shape2) which is furthest in a direction
+//
+//Parameters:
+//	dest: The destination of the furthest point
+//	shape1: The support shape being subtracted from
+//	shape2: The support shape being subtracted
+//	direction: The direction to search in, need not be normalized
+static void CollisionManager_GetMinkowskiSupportPoint(Vec3* dest, const SupportShape* shape1, const SupportShape* shape2, const Vec3* direction);
+
+///
+//Performs the GJK intersection test, searching for a simplex of the minkowski difference of two shapes which contains the origin
+//
+//Parameters:
+//	simplex: An array of 4 Vec3s to store the final simplex in
+//	simplexSize: The destination of the number of points in the final simplex
+//	shape1: The first support shape to test
+//	shape2: The second support shape to test
+//
+//Returns:
+//	0 if the shapes are not intersecting
+//	1 if the shapes are intersecting
+static unsigned char CollisionManager_PerformGJK(Vec3* simplex, unsigned int* simplexSize, const SupportShape* shape1, const SupportShape* shape2);
+
+///
+//Reduces a GJK simplex to the feature closest to the origin and finds the next search direction.
+//The newest point must be the last point of the simplex.
+//
+//Parameters:
+//	simplex: The simplex to update
+//	simplexSize: A pointer to the number of points in the simplex
+//	direction: The destination of the next search direction
+//
+//Returns:
+//	0 if the simplex does not contain the origin
+//	1 if the simplex is a tetrahedron containing the origin
+static unsigned char CollisionManager_UpdateSimplex(Vec3* simplex, unsigned int* simplexSize, Vec3* direction);
+
+///
+//Adds points to a simplex from the minkowski difference of two shapes until it is a tetrahedron with volume.
+//GJK stops early when the origin lies on the simplex, but EPA needs a tetrahedron to expand.
+//A flat tetrahedron is rebuilt from it's first three points.
+//
+//Parameters:
+//	simplex: An array of 4 Vec3s holding the simplex to complete
+//	simplexSize: A pointer to the number of points in the simplex
+//	shape1: The first support shape
+//	shape2: The second support shape
+//
+//Returns:
+//	0 if the minkowski difference is flat and no tetrahedron could be built
+//	1 if the simplex is now a tetrahedron
+static unsigned char CollisionManager_CompleteSimplex(Vec3* simplex, unsigned int* simplexSize, const SupportShape* shape1, const SupportShape* shape2);
+
+///
+//Performs the expanding polytope algorithm to find the penetration of two intersecting shapes
+//Storing the minimum translation vector of shape1 and the overlap in a collision
+//
+//Parameters:
+//	dest: The collision to store the results in
+//	simplex: A tetrahedron of the minkowski difference of the shapes which contains the origin
+//	shape1: The first support shape
+//	shape2: The second support shape
+static void CollisionManager_PerformEPA(Collision* dest, const Vec3* simplex, const SupportShape* shape1, const SupportShape* shape2);
+
+///
+//Adds a face to an EPA polytope, computing it's normal and distance from the origin
+//
+//Parameters:
+//	polytope: The polytope to add the face to
+//	a: Index of the first vertex of the face
+//	b: Index of the second vertex of the face
+//	c: Index of the third vertex of the face
+static void CollisionManager_AddEPAFace(EPAPolytope* polytope, const unsigned int a, const unsigned int b, const unsigned int c);
+
 ///
 //Initializes the Collision Manager
 void CollisionManager_Initialize(void);
@@ -85,6 +258,26 @@ void CollisionManager_Free(void);
 
 
 
+///
+//Sets the algorithm used to test a pair of collider types for collision
+//
+//Parameters:
+//	type1: The collider type of one object in the pair
+//	type2: The collider type of the other object in the pair
+//	algorithm: The algorithm to test the pair with
+void CollisionManager_SetNarrowPhaseAlgorithm(ColliderType type1, ColliderType type2, NarrowPhaseAlgorithm algorithm);
+
+///
+//Gets the algorithm used to test a pair of collider types for collision
+//
+//Parameters:
+//	type1: The collider type of one object in the pair
+//	type2: The collider type of the other object in the pair
+//
+//Returns:
+//	The algorithm the pair is tested with
+NarrowPhaseAlgorithm CollisionManager_GetNarrowPhaseAlgorithm(ColliderType type1, ColliderType type2);
+
 ///
 //Tests for collisions on all objects which have colliders 
 //compiling a list of game objects which test true
@@ -93,8 +286,30 @@ void CollisionManager_Free(void);
 //	gameObjects: THe list of gameObjects to test
 //
 //Returns:
-//	A pointer to a linked list of collisions which occurred this frame.
-LinkedList* CollisionManager_UpdateList(LinkedList* gameObjects);
+//	A pointer to a dynamic array of pointers to the collisions which occurred this frame.
+DynamicArray* CollisionManager_UpdateList(LinkedList* gameObjects);
+
+///
+//Gets the pair cache kept by the oct tree, sweep and prune and AABB tree updates
+//
+//Returns:
+//	A pointer to the pair cache, holding an entry for each pair colliding in the last update
+PairCache* CollisionManager_GetPairCache(void);
+
+///
+//Gets the pairs of objects which stopped colliding during the last oct tree, sweep and prune or AABB tree update
+//
+//Returns:
+//	A pointer to a dynamic array of PairCache_Entry, one for each pair whose contact ended
+DynamicArray* CollisionManager_GetEndedContacts(void);
+
+///
+//Forgets every pair containing an object.
+//Must be called when an object with a collider is removed, before it is freed.
+//
+//Parameters:
+//	obj: A pointer to the object to forget the pairs of
+void CollisionManager_RemoveContacts(GObject* obj);
 
 ///
 //Tests for collisions on all objects which have colliders
@@ -104,33 +319,129 @@ LinkedList* CollisionManager_UpdateList(LinkedList* gameObjects);
 //	gameObjects: An array of game objects to test
 //
 //Returns:
-//	A pointer to a linked list of collisions which occurred this frame
-LinkedList* CollisionManager_UpdateArray(GObject** gameObjects, unsigned int numObjects);
+//	A pointer to a dynamic array of pointers to the collisions which occurred this frame
+DynamicArray* CollisionManager_UpdateArray(GObject** gameObjects, unsigned int numObjects);
 
 ///
 //Tests for collisions on all objects in an oct tree compiling a list of collisions which occur
+//A loose oct tree must have been updated first, as it's pairs are found by the update
 //
 //Parameters:
 //	tree: The oct tree holding the game objects to test
 //
-//Returns: A pointer to a linked list of collisions which occurred this frame
-LinkedList* CollisionManager_UpdateOctTree(OctTree* tree);
+//Returns: A pointer to a dynamic array of pointers to the collisions which occurred this frame
+DynamicArray* CollisionManager_UpdateOctTree(OctTree* tree);
 
 ///
-//Tests for collisions on all objects within an oct tree node appending to a list of collisions which occur
+//Tests for collisions on every pair of objects a sweep and prune found to have overlapping bounds
+//Compiling a list of collisions which occur
+//
+//Parameters:
+//	sap: The updated sweep and prune holding the game objects to test
+//
+//Returns: A pointer to a dynamic array of pointers to the collisions which occurred this frame
+DynamicArray* CollisionManager_UpdateSweepAndPrune(SweepAndPrune* sap);
+
+///
+//Tests for collisions on every pair of objects a dynamic AABB tree found to have overlapping bounds
+//Compiling a list of collisions which occur
+//
+//Parameters:
+//	tree: The updated dynamic AABB tree holding the game objects to test
+//
+//Returns: A pointer to a dynamic array of pointers to the collisions which occurred this frame
+DynamicArray* CollisionManager_UpdateAABBTree(AABBTree* tree);
+
+///
+//Tests for collisions on every pair of objects a linear oct tree found to have overlapping bounds
+//Compiling a list of collisions which occur
+//
+//Parameters:
+//	tree: The rebuilt linear oct tree holding the game objects to test
+//
+//Returns: A pointer to a dynamic array of pointers to the collisions which occurred this frame
+DynamicArray* CollisionManager_UpdateLinearOctTree(LinearOctTree* tree);
+
+///
+//Frees the collisions registered by the last update and clears the array holding them
+static void CollisionManager_ClearCollisions(void);
+
+///
+//Tests for a collision between a pair of objects found by a broad phase, registering it if one occurs
+//
+//Parameters:
+//	collision: The collision to store the results of the test in
+//	obj1: First game object to test (Must have collider attached)
+//	obj2: Second game object to test (Must have collider attached)
+//
+//Returns:
+//	A newly allocated collision for the next test if this one was registered, else the given collision
+static Collision* CollisionManager_TestPair(Collision* collision, GObject* obj1, GObject* obj2);
+
+///
+//Tests for collisions on all objects within an oct tree node appending to the array of collisions which occur
 //
 //Parameters:
 //	node: A pointer to the node of the oct tree to check
 static void CollisionManager_UpdateOctTreeNode(OctTree_Node* node);
 
 ///
-//Tests for collisions on an array of objects within an oct tree node appending to a list of collisions which occur
+//Tests for collisions on an array of objects within an oct tree node appending to the array of collisions which occur
 //
 //Parameters:
 //	gameObjects: An array of pointers to game objects to check collisions
 //	numObjects: The number of objects in the array
 static void CollisionManager_UpdateOctTreeNodeArray(GObject** gameObjects, unsigned int numObjects);
 
+///
+//Registers a collision found by a test, appending it to the array of collisions and the current collisions of it's objects
+//
+//Parameters:
+//	collision: The collision to register
+//
+//Returns:
+//	1 if the collision was registered
+//	0 if the pair's collision was already registered this frame
+static unsigned char CollisionManager_RegisterCollision(Collision* collision);
+
+///
+//Tests for collisions on all objects in an oct tree by spreading it's leaves across the threads of the job manager.
+//The collisions each thread finds are merged in the order a serial update would find them, whichever number of threads is used.
+//
+//Parameters:
+//	tree: The oct tree holding the game objects to test
+static void CollisionManager_UpdateOctTreeParallel(OctTree* tree);
+
+///
+//Appends to the collision buffer's leaves every leaf below an oct tree node holding a pair of objects,
+//And brings the world cache of each convex hull in them up to date so the threads only read the caches.
+//
+//Parameters:
+//	node: A pointer to the oct tree node to gather the leaves of
+static void CollisionManager_GatherOctTreeLeaves(OctTree_Node* node);
+
+///
+//Tests every pair of objects within one of the gathered oct tree leaves, storing the collisions in the output of the testing thread.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: Unused
+//	taskIndex: The index of the leaf to test
+//	threadIndex: The index of the thread performing the test
+static void CollisionManager_TestOctTreeLeaf(void* data, unsigned int taskIndex, unsigned int threadIndex);
+
+///
+//Registers the collisions found by each thread in increasing order of leaf, freeing collisions between pairs found in an earlier leaf
+static void CollisionManager_MergeLeafCollisions(void);
+
+///
+//Allocates the output of each thread of the job manager
+static void CollisionManager_AllocateNarrowPhaseThreads(void);
+
+///
+//Frees the output of each thread the collision buffer's outputs were allocated for
+static void CollisionManager_FreeNarrowPhaseThreads(void);
+
 ///
 //Tests for a collision between two objects which have colliders
 //
@@ -213,47 +524,109 @@ void CollisionManager_TestConvexCollision(Collision* dest, GObject* obj1, FrameO
 //	sphereFoR: The frame of reference to use to orient the sphere collider
 void CollisionManager_TestConvexSphereCollision(Collision* dest, GObject* convexObj, FrameOfReference* convexFoR, GObject* sphere, FrameOfReference* sphereFoR);
 
+///
+//Tests if two game objects' colliders are colliding with any combination of collider types
+//Utilizes the GJK intersection test and the expanding polytope algorithm
+//
+//Parameters:
+//	dest: Collision to store the results of test in
+//	obj1:		First game object to test (Must have collider attached)
+//	obj1FoR:	Pointer to frame of reference to use to orient Object 1 collider
+//	obj2:		Second game object to test (Must have collider attached)
+//	obj2FoR:	Pointer to frame of reference to use to orient Object 2 collider
+void CollisionManager_TestGJKCollision(Collision* dest, GObject* obj1, FrameOfReference* obj1FoR, GObject* obj2, FrameOfReference* obj2FoR);
+
+///
+//Finds when an axis aligned box moving in a straight line first touches a stationary axis aligned box
+//
+//Parameters:
+//	min: The minimum bound of the moving box on each axis at the start of it's motion
+//	max: The maximum bound of the moving box on each axis at the start of it's motion
+//	motion: The displacement of the moving box over the motion
+//	targetMin: The minimum bound of the stationary box on each axis
+//	targetMax: The maximum bound of the stationary box on each axis
+//
+//A box sliding along a surface sinks slightly into it, so it also touches the side of the next box the surface is built from.
+//That side is an inner edge of the surface which does not oppose the motion, so hits on a box overlapped at the start
+//No deeper than CollisionManager_sweepSurfaceTolerance along another axis are ignored.
+//
+//Returns:
+//	The fraction of the motion at which the boxes first touch, from 0 to 1,
+//	Or -1 if they do not touch during the motion, already overlap at it's start or only meet at an inner edge of a surface
+float CollisionManager_GetSweptAABBTimeOfImpact(const float* min, const float* max, const Vec3* motion, const float* targetMin, const float* targetMax);
+
+///
+//Finds when a sphere moving in a straight line first touches a stationary axis aligned box.
+//The box is grown by the radius of the sphere on each side, so near it's edges and corners the time may be slightly early.
+//
+//Parameters:
+//	center: The center of the sphere at the start of it's motion
+//	radius: The radius of the sphere
+//	motion: The displacement of the sphere over the motion
+//	targetMin: The minimum bound of the box on each axis
+//	targetMax: The maximum bound of the box on each axis
+//
+//Returns:
+//	The fraction of the motion at which the sphere first touches the box, from 0 to 1,
+//	Or -1 if they do not touch during the motion or already overlap at it's start
+float CollisionManager_GetSweptSphereTimeOfImpact(const Vec3* center, const float radius, const Vec3* motion, const float* targetMin, const float* targetMax);
+
+///
+//Finds when a sphere moving in a straight line first touches a stationary sphere
+//
+//Parameters:
+//	center: The center of the moving sphere at the start of it's motion
+//	radius: The radius of the moving sphere
+//	motion: The displacement of the moving sphere over the motion
+//	targetCenter: The center of the stationary sphere
+//	targetRadius: The radius of the stationary sphere
+//
+//Returns:
+//	The fraction of the motion at which the spheres first touch, from 0 to 1,
+//	Or -1 if they do not touch during the motion or already overlap at it's start
+float CollisionManager_GetSweptSphereSphereTimeOfImpact(const Vec3* center, const float radius, const Vec3* motion, const Vec3* targetCenter, const float targetRadius);
+
 ///
 //Performs the Separating Axis Theorem test with face normals
 //
 //Parameters:
 //	dest: A pointer to a collision to store the results of the test in. Results will not be stored if the test detects no collision
-//	orientedAxes1: An array of pointers to vectors representing the oriented axes of object 1 involved in the test
+//	orientedAxes1: A contiguous array of Vec3s representing the oriented axes of object 1 involved in the test
 //	numAxes1: The number of axes belonging to object 1
-//	orientedPoints1: An array of pointers to vectors representing the oriented points of object 1 involved in the test
+//	orientedPoints1: A contiguous array of Vec3s representing the oriented points of object 1 involved in the test
 //	numPoints1: The number of points belonging to object 1
-//	orientedAxes2: An array of pointersto vectors representing the oriented axes of object 2 involved in the test
+//	orientedAxes2: A contiguous array of Vec3s representing the oriented axes of object 2 involved in the test
 //	numAxes2: The number of axes belonging to object 2
-//	orientedPoints2: An array of pointers to vectors representing the oriented points of object 2 involved in the test
+//	orientedPoints2: A contiguous array of Vec3s representing the oriented points of object 2 involved in the test
 //	numPoints2: The number of points belonging to object 2
 //
 //Returns:
 //	0 if the test detects no collision
 //	1 if the test detects a collision
 static unsigned char CollisionManager_PerformSATFaces(Collision* dest, 
-										const Vector** orientedAxes1, const unsigned int numAxes1, 
-										const Vector** orientedPoints1, const unsigned int numPoints1, 
-										const Vector** orientedAxes2, const unsigned int numAxes2, 
-										const Vector** orientedPoints2, const unsigned int numPoints2);
+										const Vec3* orientedAxes1, const unsigned int numAxes1, 
+										const Vec3* orientedPoints1, const unsigned int numPoints1, 
+										const Vec3* orientedAxes2, const unsigned int numAxes2, 
+										const Vec3* orientedPoints2, const unsigned int numPoints2);
 
 ///
 //Performs the Separating axis theorem test with face normals
 //
 //Parameters:
 //	dest: A pointer to the collision to store the results of the test in. Resultswill not be stored if the test detects no collisions
-//	orientedEdges1: An array of pointers to vectors representing the oriented edges of object 1
+//	orientedEdges1: A contiguous array of Vec3s representing the oriented edges of object 1
 //	numEdges1: The number of edges belonging to object 1
-//	orientedPoints1: An array of pointers to vectors representing the oriented points of object 1
+//	orientedPoints1: A contiguous array of Vec3s representing the oriented points of object 1
 //	numPoints1: The number of points belonging to object 1
-//	orientedEdges2: An array of pointers to vectors representing the oriented edges of object 2
+//	orientedEdges2: A contiguous array of Vec3s representing the oriented edges of object 2
 //	numEdges2: The number of edges belonging to object 2
-//  orientedPoints2: An array of pointers to vectors representing the oriented points of object 2
+//  orientedPoints2: A contiguous array of Vec3s representing the oriented points of object 2
 //	numPoints2: the number of points belonging to object 2
 static unsigned char CollisionManager_PerformSATEdges(Collision*dest,
-										const Vector** orientedEdges1, const unsigned int numEdges1,
-										const Vector** orientedPoints1, const unsigned int numPoints1,
-										const Vector** orientedEdges2, const unsigned int numEdges2,
-										const Vector** orientedPoints2, const unsigned int numPoints2);
+										const Vec3* orientedEdges1, const unsigned int numEdges1,
+										const Vec3* orientedPoints1, const unsigned int numPoints1,
+										const Vec3* orientedEdges2, const unsigned int numEdges2,
+										const Vec3* orientedPoints2, const unsigned int numPoints2);
 
 ///
 //Projects a set of points onto a normalized axis getting the squared magnitude of the projection vector.
@@ -262,7 +635,8 @@ static unsigned char CollisionManager_PerformSATEdges(Collision*dest,
 //Parameters:
 //	dest: The destination of the projection bounds
 //	axis: The axis projecting onto
-//	points: The set of points to project onto the axis
-static void CollisionManager_GetProjectionBounds(ProjectionBounds* dest, const Vector* axis, const Vector** points, const int numPoints);
+//	points: The contiguous set of points to project onto the axis
+//	numPoints: The number of points in the set
+static void CollisionManager_GetProjectionBounds(ProjectionBounds* dest, const Vec3* axis, const Vec3* points, const int numPoints);
 
 #endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "ConvexHullCollider.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "Collider.h"
 
@@ -34,14 +35,19 @@ struct ColliderData_ConvexHull* ConvexHullCollider_AllocateData()
 //	convexData: THe convex Hull Data Set being initialized
 void ConvexHullCollider_InitializeData(struct ColliderData_ConvexHull* convexHullData)
 {
-	convexHullData->points = LinkedList_Allocate();
-	LinkedList_Initialize(convexHullData->points);
+	convexHullData->points = DynamicArray_Allocate();
+	DynamicArray_Initialize(convexHullData->points, sizeof(Vec3));
 
-	convexHullData->axes = LinkedList_Allocate();
-	LinkedList_Initialize(convexHullData->axes);
+	convexHullData->axes = DynamicArray_Allocate();
+	DynamicArray_Initialize(convexHullData->axes, sizeof(Vec3));
 
-	convexHullData->edges = LinkedList_Allocate();
-	LinkedList_Initialize(convexHullData->edges);
+	convexHullData->edges = DynamicArray_Allocate();
+	DynamicArray_Initialize(convexHullData->edges, sizeof(Vec3));
+
+	//The cache is given storage the first time it is built
+	convexHullData->worldCache.modelOrientedPoints = NULL;
+	convexHullData->worldCache.capacity = 0;
+	convexHullData->worldCache.valid = 0;
 }
 
 ///
@@ -69,48 +75,13 @@ void ConvexHullCollider_Initialize(Collider* collider)
 //	colliderData: A pointer to the convex hull collider data to free
 void ConvexHullCollider_FreeData(struct ColliderData_ConvexHull* colliderData)
 {
-	//Free all vectors in points & axes linked lists
-	LinkedList_Node* current = colliderData->points->head;
-	LinkedList_Node* next = NULL;
-
-	while(current != NULL)
-	{
-		next = current->next;
-
-		Vector* point = (Vector*)current->data;
-		Vector_Free(point);
-
-		current = next;
-	}
-	LinkedList_Free(colliderData->points);
-
-	current = colliderData->axes->head;
-	next = NULL;
-
-	while(current != NULL)
-	{
-		next = current->next;
+	//The points, axes and edges are stored by value in their arrays
+	DynamicArray_Free(colliderData->points);
+	DynamicArray_Free(colliderData->axes);
+	DynamicArray_Free(colliderData->edges);
 
-		Vector* axis = (Vector*)current->data;
-		Vector_Free(axis);
-
-		current = next;
-	}
-	LinkedList_Free(colliderData->axes);
-
-	current = colliderData->edges->head;
-	next = NULL;
-
-	while(current != NULL)
-	{
-		next = current->next;
-
-		Vector* axis = (Vector*)current->data;
-		Vector_Free(axis);
-
-		current = next;
-	}
-	LinkedList_Free(colliderData->edges);
+	//All of the cache's arrays share one block of storage
+	free(colliderData->worldCache.modelOrientedPoints);
 
 	free(colliderData);
 }
@@ -120,11 +91,11 @@ void ConvexHullCollider_FreeData(struct ColliderData_ConvexHull* colliderData)
 //
 //Parameters:
 //	collider: A pointer to the convex hull having a point added
-//	point: A pointer to a vector of dimension 3 representing the point to add
-void ConvexHullCollider_AddPoint(ColliderData_ConvexHull* collider, const Vector* point)
+//	point: A pointer to the point to add, which is copied
+void ConvexHullCollider_AddPoint(ColliderData_ConvexHull* collider, const Vec3* point)
 {
-	//The linked list will not manipulate the data
-	LinkedList_Append(collider->points, (Vector*)point);
+	DynamicArray_Append(collider->points, (Vec3*)point);
+	ConvexHullCollider_InvalidateWorldCache(collider);
 }
 
 ///
@@ -132,11 +103,11 @@ void ConvexHullCollider_AddPoint(ColliderData_ConvexHull* collider, const Vector
 //
 //Parameters:
 //	collider: A pointer to the convex hull collider having an axis added
-//	axis: A pointer to a vector of dimension 3 representing the axis to add
-void ConvexHullCollider_AddAxis(ColliderData_ConvexHull* collider, const Vector* axis)
+//	axis: A pointer to the axis to add, which is copied
+void ConvexHullCollider_AddAxis(ColliderData_ConvexHull* collider, const Vec3* axis)
 {
-	//The linked list will not manipulate the data
-	LinkedList_Append(collider->axes, (Vector*)axis);
+	DynamicArray_Append(collider->axes, (Vec3*)axis);
+	ConvexHullCollider_InvalidateWorldCache(collider);
 }
 
 ///
@@ -144,11 +115,11 @@ void ConvexHullCollider_AddAxis(ColliderData_ConvexHull* collider, const Vector*
 //
 //Parameters:
 //	Collider: A pointer to the convex hull collider having an axis added
-//	axis: A pointer to a vector of dimension 3 representing the direction vector of an edge on the collider
-void ConvexHullCollider_AddEdge(ColliderData_ConvexHull* collider, const Vector* edgeDirection)
+//	axis: A pointer to the direction of an edge on the collider, which is copied
+void ConvexHullCollider_AddEdge(ColliderData_ConvexHull* collider, const Vec3* edgeDirection)
 {
-	//The linked list will never manipulate the data
-	LinkedList_Append(collider->edges, (Vector*)edgeDirection);
+	DynamicArray_Append(collider->edges, (Vec3*)edgeDirection);
+	ConvexHullCollider_InvalidateWorldCache(collider);
 }
 
 ///
@@ -160,130 +131,7 @@ void ConvexHullCollider_AddEdge(ColliderData_ConvexHull* collider, const Vector*
 //	sideLength: The initial sidelength of the cube collider to make
 void ConvexHullCollider_MakeCubeCollider(ColliderData_ConvexHull* collider, float sideLength)
 {
-	//First add points
-	//1) Lower Right Front Corner
-	Vector* point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = sideLength / 2.0f;
-	point->components[1] = -sideLength / 2.0f;
-	point->components[2] = sideLength / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
-
-	//2) Lower Right Back Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = sideLength / 2.0f;
-	point->components[1] = -sideLength / 2.0f;
-	point->components[2] = -sideLength / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
-
-	//3) Lower Left Back Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = -sideLength / 2.0f;
-	point->components[1] = -sideLength / 2.0f;
-	point->components[2] = -sideLength / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
-
-	//4) Lower Left Front Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = -sideLength / 2.0f;
-	point->components[1] = -sideLength / 2.0f;
-	point->components[2] = sideLength / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
-
-	//5) Upper Right Front Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = sideLength / 2.0f;
-	point->components[1] = sideLength / 2.0f;
-	point->components[2] = sideLength / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
-
-	//6) Upper Right Back Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = sideLength / 2.0f;
-	point->components[1] = sideLength / 2.0f;
-	point->components[2] = -sideLength / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
-
-	//7) Upper LEft Back Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = -sideLength / 2.0f;
-	point->components[1] = sideLength / 2.0f;
-	point->components[2] = -sideLength / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
-
-	//8) Upper Left Front Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = -sideLength / 2.0f;
-	point->components[1] = sideLength / 2.0f;
-	point->components[2] = sideLength / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
-
-	//Second add axes & edges (same things)
-	//Right/Left face
-	Vector* axis = Vector_Allocate();
-	Vector_Initialize(axis, 3);
-	Vector* edge = Vector_Allocate();\
-		Vector_Initialize(edge, 3);
-
-
-	axis->components[0] = 1.0f;
-	Vector_Copy(edge, axis);
-
-	ConvexHullCollider_AddAxis(collider, axis);
-	ConvexHullCollider_AddEdge(collider, edge);
-
-
-	//Top/Bottom face
-	axis = Vector_Allocate();
-	Vector_Initialize(axis, 3);
-	edge = Vector_Allocate();
-	Vector_Initialize(edge, 3);
-
-
-	axis->components[1] = 1.0f;
-	Vector_Copy(edge, axis);
-
-
-	ConvexHullCollider_AddAxis(collider, axis);
-	ConvexHullCollider_AddEdge(collider, edge);
-
-
-	//Front/Back face
-	axis = Vector_Allocate();
-	Vector_Initialize(axis, 3);
-	edge = Vector_Allocate();
-	Vector_Initialize(edge, 3);
-
-	axis->components[2] = 1.0f;
-	Vector_Copy(edge, axis);
-
-
-	ConvexHullCollider_AddAxis(collider, axis);
-	ConvexHullCollider_AddEdge(collider, edge);
-
+	ConvexHullCollider_MakeRectangularCollider(collider, sideLength, sideLength, sideLength);
 }
 
 ///
@@ -296,139 +144,69 @@ void ConvexHullCollider_MakeCubeCollider(ColliderData_ConvexHull* collider, floa
 //	depth: The depth of the collider
 void ConvexHullCollider_MakeRectangularCollider(ColliderData_ConvexHull* collider, float width, float height, float depth)
 {
-		//First add points
-	//1) Lower Right Front Corner
-	Vector* point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = width / 2.0f;
-	point->components[1] = -height / 2.0f;
-	point->components[2] = depth / 2.0f;
+	//The points, axes and edges are copied into the collider
+	Vec3 point;
 
-	ConvexHullCollider_AddPoint(collider, point);
+	//First add points
+	//1) Lower Right Front Corner
+	Vec3_Set(&point, width / 2.0f, -height / 2.0f, depth / 2.0f);
+	ConvexHullCollider_AddPoint(collider, &point);
 
 	//2) Lower Right Back Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = width / 2.0f;
-	point->components[1] = -height / 2.0f;
-	point->components[2] = -depth / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
+	Vec3_Set(&point, width / 2.0f, -height / 2.0f, -depth / 2.0f);
+	ConvexHullCollider_AddPoint(collider, &point);
 
 	//3) Lower Left Back Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = -width / 2.0f;
-	point->components[1] = -height / 2.0f;
-	point->components[2] = -depth / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
+	Vec3_Set(&point, -width / 2.0f, -height / 2.0f, -depth / 2.0f);
+	ConvexHullCollider_AddPoint(collider, &point);
 
 	//4) Lower Left Front Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = -width / 2.0f;
-	point->components[1] = -height / 2.0f;
-	point->components[2] = depth / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
+	Vec3_Set(&point, -width / 2.0f, -height / 2.0f, depth / 2.0f);
+	ConvexHullCollider_AddPoint(collider, &point);
 
 	//5) Upper Right Front Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = width / 2.0f;
-	point->components[1] = height / 2.0f;
-	point->components[2] = depth / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
+	Vec3_Set(&point, width / 2.0f, height / 2.0f, depth / 2.0f);
+	ConvexHullCollider_AddPoint(collider, &point);
 
 	//6) Upper Right Back Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = width / 2.0f;
-	point->components[1] = height / 2.0f;
-	point->components[2] = -depth / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
-
-	//7) Upper LEft Back Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = -width / 2.0f;
-	point->components[1] = height / 2.0f;
-	point->components[2] = -depth / 2.0f;
+	Vec3_Set(&point, width / 2.0f, height / 2.0f, -depth / 2.0f);
+	ConvexHullCollider_AddPoint(collider, &point);
 
-	ConvexHullCollider_AddPoint(collider, point);
+	//7) Upper Left Back Corner
+	Vec3_Set(&point, -width / 2.0f, height / 2.0f, -depth / 2.0f);
+	ConvexHullCollider_AddPoint(collider, &point);
 
 	//8) Upper Left Front Corner
-	point = Vector_Allocate();
-	Vector_Initialize(point, 3);
-
-	point->components[0] = -width / 2.0f;
-	point->components[1] = height / 2.0f;
-	point->components[2] = depth / 2.0f;
-
-	ConvexHullCollider_AddPoint(collider, point);
+	Vec3_Set(&point, -width / 2.0f, height / 2.0f, depth / 2.0f);
+	ConvexHullCollider_AddPoint(collider, &point);
 
 	//Second add axes & edges (same things)
-	//Right/Left face
-	Vector* axis = Vector_Allocate();
-	Vector_Initialize(axis, 3);
-	Vector* edge = Vector_Allocate();\
-		Vector_Initialize(edge, 3);
-
-
-	axis->components[0] = 1.0f;
-	Vector_Copy(edge, axis);
-
-	ConvexHullCollider_AddAxis(collider, axis);
-	ConvexHullCollider_AddEdge(collider, edge);
+	Vec3 axis;
 
+	//Right/Left face
+	Vec3_Set(&axis, 1.0f, 0.0f, 0.0f);
+	ConvexHullCollider_AddAxis(collider, &axis);
+	ConvexHullCollider_AddEdge(collider, &axis);
 
 	//Top/Bottom face
-	axis = Vector_Allocate();
-	Vector_Initialize(axis, 3);
-	edge = Vector_Allocate();
-	Vector_Initialize(edge, 3);
-
-
-	axis->components[1] = 1.0f;
-	Vector_Copy(edge, axis);
-
-
-	ConvexHullCollider_AddAxis(collider, axis);
-	ConvexHullCollider_AddEdge(collider, edge);
-
+	Vec3_Set(&axis, 0.0f, 1.0f, 0.0f);
+	ConvexHullCollider_AddAxis(collider, &axis);
+	ConvexHullCollider_AddEdge(collider, &axis);
 
 	//Front/Back face
-	axis = Vector_Allocate();
-	Vector_Initialize(axis, 3);
-	edge = Vector_Allocate();
-	Vector_Initialize(edge, 3);
-
-	axis->components[2] = 1.0f;
-	Vector_Copy(edge, axis);
-
-
-	ConvexHullCollider_AddAxis(collider, axis);
-	ConvexHullCollider_AddEdge(collider, edge);
+	Vec3_Set(&axis, 0.0f, 0.0f, 1.0f);
+	ConvexHullCollider_AddAxis(collider, &axis);
+	ConvexHullCollider_AddEdge(collider, &axis);
 }
 
 ///
 //Gets the points of the collider oriented in world space to match a given frame of reference
 //
 //Parameters:
-//	dest: An array of pointers to initialized vectors of dimension 3 to store the oriented collider points
+//	dest: A contiguous array of Vec3s with room for every collider point to store the oriented collider points
 //	collider: The collider of which to orient the points of
 //	frame: The frame of reference with which to orient the points
-void ConvexHullCollider_GetOrientedWorldPoints(Vector** dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame)
+void ConvexHullCollider_GetOrientedWorldPoints(Vec3* dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame)
 {
 	//Get the points oriented in model space
 	ConvexHullCollider_GetOrientedModelPoints(dest, collider, frame);
@@ -436,7 +214,7 @@ void ConvexHullCollider_GetOrientedWorldPoints(Vector** dest, const ColliderData
 	//Translate to world space
 	for(int i = 0; i < collider->points->size; i++)
 	{
-		Vector_Increment(dest[i], frame->position);
+		Vec3_Increment(dest + i, Vec3_FROM_VECTOR(frame->position));
 	}
 
 }
@@ -445,25 +223,21 @@ void ConvexHullCollider_GetOrientedWorldPoints(Vector** dest, const ColliderData
 //Gets the points of the collider oriented in model space to match a given frame of reference
 //
 //Parameters:
-//	dest: An array of pointers to initialized vectors of dimension 3 to store the oriented collider points
+//	dest: A contiguous array of Vec3s with room for every collider point to store the oriented collider points
 //	collider: The collider of which to orient the points of
 //	frame: A pointer to the frame of reference with which to orient the points
-void ConvexHullCollider_GetOrientedModelPoints(Vector** dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame)
+void ConvexHullCollider_GetOrientedModelPoints(Vec3* dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame)
 {
 	//Create a transformation matrix to rotate and scale the points
-	Matrix trans;
-	Matrix_INIT_ON_STACK(trans, 3, 3);
-	Matrix_GetProductMatrix(&trans, frame->rotation, frame->scale);
+	Mat3 trans;
+	Mat3_GetProduct(&trans, Mat3_FROM_MATRIX(frame->rotation), Mat3_FROM_MATRIX(frame->scale));
 
 	//Loop through the colliders points
-	LinkedList_Node* currentPoint = collider->points->head;
+	const Vec3* points = (const Vec3*)collider->points->data;
 	for(unsigned int i = 0; i < collider->points->size; i++)
 	{
 		//Rotate and scale each point
-		Matrix_GetProductVector(dest[i], &trans, (Vector*)currentPoint->data);
-
-		//Move to next point
-		currentPoint = currentPoint->next;
+		Mat3_GetProductVec3(dest + i, &trans, points + i);
 	}
 }
 
@@ -471,20 +245,17 @@ void ConvexHullCollider_GetOrientedModelPoints(Vector** dest, const ColliderData
 //Gets the axes of a convex hull collider oriented to match a given frame of reference
 //
 //Parameters:
-//	dest: An array of pointers to initialized vectors of dimension 3 to store the oriented collider axes
+//	dest: A contiguous array of Vec3s with room for every collider axis to store the oriented collider axes
 //	collider: A pointer to the collider of which to orient the axes of
 //	frame: A pointer to the frame of reference with which to orient the axes
-void ConvexHullCollider_GetOrientedAxes(Vector** dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame)
+void ConvexHullCollider_GetOrientedAxes(Vec3* dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame)
 {
 	//Loop through axes
-	LinkedList_Node* currentAxis = collider->axes->head;
+	const Vec3* axes = (const Vec3*)collider->axes->data;
 	for(unsigned int i = 0; i < collider->axes->size; i++)
 	{
 		//Rotate each axis 
-		Matrix_GetProductVector(dest[i], frame->rotation, (Vector*)currentAxis->data);
-
-		//Move to next axis
-		currentAxis = currentAxis->next;
+		Mat3_GetProductVec3(dest + i, Mat3_FROM_MATRIX(frame->rotation), axes + i);
 	}
 }
 
@@ -492,21 +263,119 @@ void ConvexHullCollider_GetOrientedAxes(Vector** dest, const ColliderData_Convex
 //Gets the edges of a convex hull collider oriented to match a given frame of reference
 //
 //Parameters:
-//	dest: An array of pointers to initialized vectors of dimension 3 to store the oriented collider edges
+//	dest: A contiguous array of Vec3s with room for every collider edge to store the oriented collider edges
 //	collider: A pointer to the collider of which to orient the edges of
 //	frame: A pointer to the frame of reference with which to orient the edges
-void ConvexHullCollider_GetOrientedEdges(Vector** dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame)
+void ConvexHullCollider_GetOrientedEdges(Vec3* dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame)
 {
 	//Loop through edges
-	LinkedList_Node* currentEdge = collider->edges->head;
+	const Vec3* edges = (const Vec3*)collider->edges->data;
 	for(unsigned int i = 0; i < collider->edges->size; i++)
 	{
 		//Rotate each edge 
-		Matrix_GetProductVector(dest[i], frame->rotation, (Vector*)currentEdge->data);
+		Mat3_GetProductVec3(dest + i, Mat3_FROM_MATRIX(frame->rotation), edges + i);
+	}
+}
 
-		//Move to next edge
-		currentEdge = currentEdge->next;
+///
+//Gets the world cache of a convex hull collider oriented by a frame of reference.
+//The cache is only rebuilt if the frame, or the frame's scale, rotation or position, differ from the last call.
+//
+//Parameters:
+//	collider: A pointer to the convex hull collider data to get the cache of
+//	frame: A pointer to the frame of reference with which to orient the collider
+//
+//Returns:
+//	A pointer to the collider's up to date world cache. The cache must not be modified.
+const ConvexHullCollider_WorldCache* ConvexHullCollider_GetWorldCache(ColliderData_ConvexHull* collider, const FrameOfReference* frame)
+{
+	if(!ConvexHullCollider_IsWorldCacheCurrent(collider, frame))
+	{
+		ConvexHullCollider_RebuildWorldCache(collider, frame);
+	}
+	return &collider->worldCache;
+}
+
+///
+//Forces a convex hull collider's world cache to be rebuilt the next time it is retrieved.
+//Only necessary when the collider's points, axes or edges are modified in place.
+//
+//Parameters:
+//	collider: A pointer to the convex hull collider data of which to invalidate the cache
+void ConvexHullCollider_InvalidateWorldCache(ColliderData_ConvexHull* collider)
+{
+	collider->worldCache.valid = 0;
+}
+
+///
+//Determines if a convex hull collider's world cache was built from the current state of a frame of reference
+//
+//Parameters:
+//	collider: A pointer to the convex hull collider data of which to check the cache
+//	frame: A pointer to the frame of reference the cache must match
+//
+//Returns:
+//	1 if the cache can be used as is, 0 if it must be rebuilt
+static unsigned char ConvexHullCollider_IsWorldCacheCurrent(const ColliderData_ConvexHull* collider, const FrameOfReference* frame)
+{
+	const ConvexHullCollider_WorldCache* cache = &collider->worldCache;
+
+	if(!cache->valid || cache->frame != frame)
+		return 0;
+	if(cache->numPoints != collider->points->size || cache->numAxes != collider->axes->size || cache->numEdges != collider->edges->size)
+		return 0;
+
+	//Frames are modified directly all over the engine, so compare the values the cache was built from
+	if(memcmp(cache->position.components, frame->position->components, sizeof(Vec3)) != 0)
+		return 0;
+	if(memcmp(cache->rotation.components, frame->rotation->components, sizeof(Mat3)) != 0)
+		return 0;
+	if(memcmp(cache->scale.components, frame->scale->components, sizeof(Mat3)) != 0)
+		return 0;
+
+	return 1;
+}
+
+///
+//Rebuilds a convex hull collider's world cache from a frame of reference, growing it's storage if needed
+//
+//Parameters:
+//	collider: A pointer to the convex hull collider data of which to rebuild the cache
+//	frame: A pointer to the frame of reference to orient the collider with
+static void ConvexHullCollider_RebuildWorldCache(ColliderData_ConvexHull* collider, const FrameOfReference* frame)
+{
+	ConvexHullCollider_WorldCache* cache = &collider->worldCache;
+
+	//Model oriented points, world points, axes and edges share one contiguous block
+	unsigned int numVectors = 2 * collider->points->size + collider->axes->size + collider->edges->size;
+	if(numVectors > cache->capacity)
+	{
+		free(cache->modelOrientedPoints);
+		cache->modelOrientedPoints = (Vec3*)malloc(sizeof(Vec3) * numVectors);
+		cache->capacity = numVectors;
+	}
+	cache->worldPoints = cache->modelOrientedPoints + collider->points->size;
+	cache->axes = cache->worldPoints + collider->points->size;
+	cache->edges = cache->axes + collider->axes->size;
+
+	ConvexHullCollider_GetOrientedModelPoints(cache->modelOrientedPoints, collider, frame);
+	//Translating the model oriented points gives exactly what ConvexHullCollider_GetOrientedWorldPoints would
+	for(unsigned int i = 0; i < collider->points->size; i++)
+	{
+		Vec3_Add(cache->worldPoints + i, cache->modelOrientedPoints + i, Vec3_FROM_VECTOR(frame->position));
 	}
+	ConvexHullCollider_GetOrientedAxes(cache->axes, collider, frame);
+	ConvexHullCollider_GetOrientedEdges(cache->edges, collider, frame);
+
+	//Remember what the cache was built from
+	cache->frame = frame;
+	Vec3_Copy(&cache->position, Vec3_FROM_VECTOR(frame->position));
+	Mat3_Copy(&cache->rotation, Mat3_FROM_MATRIX(frame->rotation));
+	Mat3_Copy(&cache->scale, Mat3_FROM_MATRIX(frame->scale));
+	cache->numPoints = collider->points->size;
+	cache->numAxes = collider->axes->size;
+	cache->numEdges = collider->edges->size;
+	cache->valid = 1;
 }
 
 ///
@@ -516,21 +385,26 @@ void ConvexHullCollider_GetOrientedEdges(Vector** dest, const ColliderData_Conve
 //Parameters:
 //	dest: A dynamic array to store the set of points in
 //	collider: A pointer to a convex hull collider to get the subset of points from
-//	modelOrientedPoints: An array of pointers to vectors representing the colliders points oriented into modelSpace
+//	modelOrientedPoints: A contiguous array of Vec3s representing the colliders points oriented into modelSpace
 //	frame: The frame to orient the collider's points with
 //	direction: The direction in which the desired set of points are furthest in.
-void ConvexHullCollider_GetFurthestPoints(DynamicArray* dest, const ColliderData_ConvexHull* collider, const Vector** modelOrientedPoints, const Vector* direction)
+void ConvexHullCollider_GetFurthestPoints(DynamicArray* dest, const ColliderData_ConvexHull* collider, const Vec3* modelOrientedPoints, const Vector* direction)
 {
 
 	//Find the points furthest in direction of relative MTV for convexHull1
 	float currentMaxDistance = 0.0f;
 	float currentDistance = 0.0f;
 
+	//Vector header viewing the current point, copied into the dynamic array when logged
+	Vector pointView;
+	pointView.dimension = 3;
+
 	//Loop through points
 	for(unsigned int i = 0; i < collider->points->size; i++)
 	{
 		//Get the ith points distance in direction of MTV
-		currentDistance = Vector_DotProduct(modelOrientedPoints[i], direction);
+		currentDistance = Vec3_DotProduct(modelOrientedPoints + i, Vec3_FROM_VECTOR(direction));
+		pointView.components = (float*)modelOrientedPoints[i].components;
 
 		//Check if this point is further than the current furthest
 		if(currentDistance > currentMaxDistance)
@@ -543,13 +417,13 @@ void ConvexHullCollider_GetFurthestPoints(DynamicArray* dest, const ColliderData
 
 			//Log this point as the new furthest
 			currentMaxDistance = currentDistance;
-			DynamicArray_Append(dest, (void*)modelOrientedPoints[i]);
+			DynamicArray_Append(dest, &pointView);
 		}
 		//If it's not further, it may be just as far
 		else if(currentDistance == currentMaxDistance)
 		{
 			//Log this point as one of the furthest
-			DynamicArray_Append(dest, (void*)modelOrientedPoints[i]);
+			DynamicArray_Append(dest, &pointView);
 		}
 	}
 }
@@ -577,15 +451,17 @@ void ConvexHullCollider_GenerateMinimumAABB(ColliderData_AABB* dest, const Colli
 
 
 	//Loop through each point in the collider, and apply the transformation matrix	
-	LinkedList_Node* current = collider->points->head;
+	Vec3* points = (Vec3*)collider->points->data;
+	Vector point;
 	Vector currentPoint;
 	Vector_INIT_ON_STACK(currentPoint, 3);
 
 	unsigned char firstPointAssigned = 0;
 
-	while(current != NULL)
+	for(unsigned int j = 0; j < collider->points->size; j++)
 	{
-		Matrix_GetProductVector(&currentPoint, frame->rotation, (Vector*)current->data);
+		Vec3_INIT_VECTOR_VIEW(point, points[j]);
+		Matrix_GetProductVector(&currentPoint, frame->rotation, &point);
 
 		for(int i = 0; i < 3; i++)
 		{
@@ -601,8 +477,6 @@ void ConvexHullCollider_GenerateMinimumAABB(ColliderData_AABB* dest, const Colli
 		}
 
 		firstPointAssigned = 1;
-
-		current = current->next;
 	}
 
 	//Determine the centroid & dimensions of the AABB
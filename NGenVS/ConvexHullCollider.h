@@ -1,7 +1,6 @@
 #ifndef CONVEXHULLCOLLIDER_H
 #define CONVEXHULLCOLLIDER_H
 
-#include "LinkedList.h"
 #include "DynamicArray.h"
 
 #include "Vector.h"
@@ -25,13 +24,60 @@ static void(*ConvexHullCollider_ColliderInitializePtr)(struct Collider*, Collide
 void ConvexHullCollider_SetColliderInitializer(void(*funcPtr)(struct Collider*, ColliderType, Mesh*));
 
 
+///
+//The points, axes and edges of a convex hull collider oriented by a frame of reference.
+//The cache remembers the frame it was built from and is only rebuilt once that frame changes,
+//So every test a collider takes part in during a physics step shares one transformation.
+typedef struct ConvexHullCollider_WorldCache
+{
+	Vec3* modelOrientedPoints;	//Points rotated and scaled into model space
+	Vec3* worldPoints;			//Points rotated, scaled and translated into world space
+	Vec3* axes;					//Axes rotated into world space
+	Vec3* edges;				//Edges rotated into world space
+	unsigned int capacity;		//The number of Vec3s the storage has room for
+
+	//The state the cache was built from
+	unsigned char valid;
+	const FrameOfReference* frame;
+	Mat3 scale;
+	Mat3 rotation;
+	Vec3 position;
+	unsigned int numPoints;
+	unsigned int numAxes;
+	unsigned int numEdges;
+} ConvexHullCollider_WorldCache;
+
 struct ColliderData_ConvexHull
 {
-	LinkedList* points;
-	LinkedList* axes;
-	LinkedList* edges;
+	DynamicArray* points;		//The Vec3 points of the hull in model space
+	DynamicArray* axes;			//The Vec3 axes to test the hull along in model space
+	DynamicArray* edges;		//The Vec3 directions of the hull's edges in model space
+
+	ConvexHullCollider_WorldCache worldCache;
 };
 
+///
+//Internals
+
+///
+//Determines if a convex hull collider's world cache was built from the current state of a frame of reference
+//
+//Parameters:
+//	collider: A pointer to the convex hull collider data of which to check the cache
+//	frame: A pointer to the frame of reference the cache must match
+//
+//Returns:
+//	1 if the cache can be used as is, 0 if it must be rebuilt
+static unsigned char ConvexHullCollider_IsWorldCacheCurrent(const ColliderData_ConvexHull* collider, const FrameOfReference* frame);
+
+///
+//Rebuilds a convex hull collider's world cache from a frame of reference, growing it's storage if needed
+//
+//Parameters:
+//	collider: A pointer to the convex hull collider data of which to rebuild the cache
+//	frame: A pointer to the frame of reference to orient the collider with
+static void ConvexHullCollider_RebuildWorldCache(ColliderData_ConvexHull* collider, const FrameOfReference* frame);
+
 ///
 //Allocates memory for a new convex hull collider data set
 //
@@ -65,24 +111,24 @@ void ConvexHullCollider_FreeData(struct ColliderData_ConvexHull* colliderData);
 //
 //Parameters:
 //	collider: A pointer to the convex hull having a point added
-//	point: A pointer to a vector of dimension 3 representing the point to add
-void ConvexHullCollider_AddPoint(ColliderData_ConvexHull* collider, const Vector* point);
+//	point: A pointer to the point to add, which is copied
+void ConvexHullCollider_AddPoint(ColliderData_ConvexHull* collider, const Vec3* point);
 
 ///
 //Adds an axis to a convex hull collider
 //
 //Parameters:
 //	collider: A pointer to the convex hull collider having an axis added
-//	axis: A pointer to a vector of dimension 3 representing the axis to add
-void ConvexHullCollider_AddAxis(ColliderData_ConvexHull* collider, const Vector* axis);
+//	axis: A pointer to the axis to add, which is copied
+void ConvexHullCollider_AddAxis(ColliderData_ConvexHull* collider, const Vec3* axis);
 
 ///
 //Adds an edge to a convex hull collider
 //
 //Parameters:
 //	Collider: A pointer to the convex hull collider having an axis added
-//	axis: A pointer to a vector of dimension 3 representing the direction vector of an edge on the collider
-void ConvexHullCollider_AddEdge(ColliderData_ConvexHull* collider, const Vector* edgeDirection);
+//	axis: A pointer to the direction of an edge on the collider, which is copied
+void ConvexHullCollider_AddEdge(ColliderData_ConvexHull* collider, const Vec3* edgeDirection);
 
 ///
 //Makes a cube convex hull collider from a blank initialized convex hull collider
@@ -106,37 +152,57 @@ void ConvexHullCollider_MakeRectangularCollider(ColliderData_ConvexHull* collide
 //Gets the points of the collider oriented in world space to match a given frame of reference
 //
 //Parameters:
-//	dest: An array of pointers to initialized vectors of dimension 3 to store the oriented collider points
+//	dest: A contiguous array of Vec3s with room for every collider point to store the oriented collider points
 //	collider: The collider of which to orient the points of
 //	frame: The frame of reference with which to orient the points
-void ConvexHullCollider_GetOrientedWorldPoints(Vector** dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame);
+void ConvexHullCollider_GetOrientedWorldPoints(Vec3* dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame);
 
 ///
 //Gets the points of the collider oriented in model space to match a given frame of reference
 //
 //Parameters:
-//	dest: An array of pointers to initialized vectors of dimension 3 to store the oriented collider points
+//	dest: A contiguous array of Vec3s with room for every collider point to store the oriented collider points
 //	collider: The collider of which to orient the points of
 //	frame: A pointer to the frame of reference with which to orient the points
-void ConvexHullCollider_GetOrientedModelPoints(Vector** dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame);
+void ConvexHullCollider_GetOrientedModelPoints(Vec3* dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame);
 
 ///
 //Gets the axes of a convex hull collider oriented to match a given frame of reference
 //
 //Parameters:
-//	dest: An array of pointers to initialized vectors of dimension 3 to store the oriented collider axes
+//	dest: A contiguous array of Vec3s with room for every collider axis to store the oriented collider axes
 //	collider: A pointer to the collider of which to orient the axes of
 //	frame: A pointer to the frame of reference with which to orient the axes
-void ConvexHullCollider_GetOrientedAxes(Vector** dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame);
+void ConvexHullCollider_GetOrientedAxes(Vec3* dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame);
 
 ///
 //Gets the edges of a convex hull collider oriented to match a given frame of reference
 //
 //Parameters:
-//	dest: An array of pointers to initialized vectors of dimension 3 to store the oriented collider edges
+//	dest: A contiguous array of Vec3s with room for every collider edge to store the oriented collider edges
 //	collider: A pointer to the collider of which to orient the edges of
 //	frame: A pointer to the frame of reference with which to orient the edges
-void ConvexHullCollider_GetOrientedEdges(Vector** dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame);
+void ConvexHullCollider_GetOrientedEdges(Vec3* dest, const ColliderData_ConvexHull* collider, const FrameOfReference* frame);
+
+///
+//Gets the world cache of a convex hull collider oriented by a frame of reference.
+//The cache is only rebuilt if the frame, or the frame's scale, rotation or position, differ from the last call.
+//
+//Parameters:
+//	collider: A pointer to the convex hull collider data to get the cache of
+//	frame: A pointer to the frame of reference with which to orient the collider
+//
+//Returns:
+//	A pointer to the collider's up to date world cache. The cache must not be modified.
+const ConvexHullCollider_WorldCache* ConvexHullCollider_GetWorldCache(ColliderData_ConvexHull* collider, const FrameOfReference* frame);
+
+///
+//Forces a convex hull collider's world cache to be rebuilt the next time it is retrieved.
+//Only necessary when the collider's points, axes or edges are modified in place.
+//
+//Parameters:
+//	collider: A pointer to the convex hull collider data of which to invalidate the cache
+void ConvexHullCollider_InvalidateWorldCache(ColliderData_ConvexHull* collider);
 
 ///
 //Determines the subset set of a convex hull colliders points oriented to a given orientation furthest in a given direction.
@@ -145,10 +211,10 @@ void ConvexHullCollider_GetOrientedEdges(Vector** dest, const ColliderData_Conve
 //Parameters:
 //	dest: A dynamic array to store the set of points in
 //	collider: A pointer to a convex hull collider to get the subset of points from
-//	modelOrientedPoints: An array of pointers to vectors representing the colliders points oriented into modelSpace
+//	modelOrientedPoints: A contiguous array of Vec3s representing the colliders points oriented into modelSpace
 //	frame: The frame to orient the collider's points with
 //	direction: The direction in which the desired set of points are furthest in.
-void ConvexHullCollider_GetFurthestPoints(DynamicArray* dest, const ColliderData_ConvexHull* collider, const Vector** modelOrientedPoints, const Vector* direction);
+void ConvexHullCollider_GetFurthestPoints(DynamicArray* dest, const ColliderData_ConvexHull* collider, const Vec3* modelOrientedPoints, const Vector* direction);
 
 ///
 //Determines the minimum axis aligned bounding box which can contain the convex hull
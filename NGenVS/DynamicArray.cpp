@@ -52,6 +52,55 @@ void DynamicArray_Append(DynamicArray* arr, void* data)
 	arr->size++;
 }
 
+///
+//Makes sure a dynamic array can hold a number of elements without growing
+//
+//Parameters:
+//	arr: The dynamic array to reserve room in
+//	capacity: The number of elements the array must have room for
+void DynamicArray_Reserve(DynamicArray* arr, unsigned int capacity)
+{
+	if(capacity > arr->capacity) DynamicArray_SetCapacity(arr, capacity);
+}
+
+///
+//Appends an element to a dynamic array without copying anything into it,
+//So the element can be written in place instead of being built elsewhere and copied in.
+//
+//Parameters:
+//	arr: The dynamic array to append
+//
+//Returns:
+//	Pointer to the new element, whose contents are undefined
+void* DynamicArray_Emplace(DynamicArray* arr)
+{
+	if (arr->size == arr->capacity) DynamicArray_Grow(arr);
+	void* element = ((char*)arr->data) + (arr->dataSize * arr->size);
+	arr->size++;
+	return element;
+}
+
+///
+//Appends a dynamic array with a contiguous array of elements,
+//Growing at most once and copying all of the elements at once
+//
+//Parameters:
+//	arr: The dynamic array to append
+//	data: Pointer to the first element to append
+//	count: The number of elements to append
+void DynamicArray_AppendArray(DynamicArray* arr, const void* data, unsigned int count)
+{
+	unsigned int size = arr->size + count;
+	if(size > arr->capacity)
+	{
+		//Grow by the growth rate as appending one element at a time would, unless even that is too small
+		unsigned int capacity = (unsigned int)(arr->growthRate * arr->capacity);
+		DynamicArray_SetCapacity(arr, capacity > size ? capacity : size);
+	}
+	memcpy(((char*)arr->data) + (arr->dataSize * arr->size), data, arr->dataSize * count);
+	arr->size = size;
+}
+
 
 ///
 //Indexes a dynamic array
@@ -70,13 +119,14 @@ void* DynamicArray_Index(DynamicArray* arr, unsigned int index)
 
 ///
 //Clears a dynamic array setting all indices & size to 0
+//Only the elements in use are zeroed, elements past the size are never read
 //Does not lessen capacity
 //
 //Parameters:
 //	arr: Pointer to dynamic array being cleared
 void DynamicArray_Clear(DynamicArray* arr)
 {
-	memset(arr->data, 0, arr->capacity * arr->dataSize);
+	memset(arr->data, 0, arr->size * arr->dataSize);
 	arr->size = 0;
 }
 
@@ -117,6 +167,26 @@ void DynamicArray_Remove(DynamicArray* arr, const unsigned int index)
 	arr->size--;
 }
 
+///
+//Removes an element from the dynamic array by moving the last element into it's place.
+//Takes the same time however many elements follow it, but does not keep the order of the elements.
+//
+//Parameters:
+//	arr: A pointer to the dynamic array to remove an element from
+//	index: The index of the element to remove
+void DynamicArray_SwapRemove(DynamicArray* arr, const unsigned int index)
+{
+	arr->size--;
+	char* last = (char*)arr->data + (arr->size * arr->dataSize);
+	if(index != arr->size)
+	{
+		memcpy((char*)arr->data + (index * arr->dataSize), last, arr->dataSize);
+	}
+
+	//Leave the slot past the end zeroed, as DynamicArray_Remove does
+	memset(last, 0, arr->dataSize);
+}
+
 ///
 //Removes a specified data from the dynamic array
 //Then copies all data back one space to ensure no gaps in data exist
@@ -126,14 +196,54 @@ void DynamicArray_Remove(DynamicArray* arr, const unsigned int index)
 //	data: The data to remove
 void DynamicArray_RemoveData(DynamicArray* arr, void* data)
 {
-	for(int i = 0; i < arr->capacity; i++)
+	unsigned int index = DynamicArray_IndexOf(arr, data, arr->size);
+	if(index < arr->size)
 	{
-		if(memcmp(data, (char*)arr->data + (i * arr->dataSize), arr->dataSize) == 0)
+		DynamicArray_Remove(arr, index);
+	}
+}
+
+///
+//Finds the index of the first of the first n elements of the array equal to data.
+//Elements the size of an int or a pointer are compared as a whole rather than byte by byte.
+//
+//Parameters:
+//	arr: The array to search for the data
+//	data: The data being searched for
+//	n: The number of elements to search from the start of the array
+//
+//Returns:
+//	The index of the first matching element, or n if none of them match
+unsigned int DynamicArray_IndexOf(DynamicArray* arr, const void* data, unsigned int n)
+{
+	if(arr->dataSize == sizeof(unsigned int))
+	{
+		unsigned int value;
+		memcpy(&value, data, sizeof(unsigned int));
+		const unsigned int* elements = (const unsigned int*)arr->data;
+		for(unsigned int i = 0; i < n; i++)
+		{
+			if(elements[i] == value) return i;
+		}
+	}
+	else if(arr->dataSize == sizeof(void*))
+	{
+		void* value;
+		memcpy(&value, data, sizeof(void*));
+		void* const* elements = (void* const*)arr->data;
+		for(unsigned int i = 0; i < n; i++)
+		{
+			if(elements[i] == value) return i;
+		}
+	}
+	else
+	{
+		for(unsigned int i = 0; i < n; i++)
 		{
-			DynamicArray_Remove(arr, i);
-			break;
+			if(memcmp(data, (char*)arr->data + (i * arr->dataSize), arr->dataSize) == 0) return i;
 		}
 	}
+	return n;
 }
 
 ///
@@ -149,14 +259,7 @@ void DynamicArray_RemoveData(DynamicArray* arr, void* data)
 //	1 if the data is contained
 unsigned char DynamicArray_Contains(DynamicArray* arr, void* data)
 {
-	for(int i = 0; i < arr->capacity; i++)
-	{
-		if(memcmp(data, (char*)arr->data + (i * arr->dataSize), arr->dataSize) == 0)
-		{
-			return 1;
-		}
-	}
-	return 0;
+	return DynamicArray_IndexOf(arr, data, arr->size) < arr->size;
 }
 
 ///
@@ -172,14 +275,7 @@ unsigned char DynamicArray_Contains(DynamicArray* arr, void* data)
 //	1 if the data is contained
 unsigned char DynamicArray_ContainsWithin(DynamicArray* arr, void* data, unsigned int n)
 {
-	for(int i = 0; i < n; i++)
-	{
-		if(memcmp(data, (char*)arr->data + (i * arr->dataSize), arr->dataSize) == 0)
-		{
-			return 1;
-		}
-	}
-	return 0;
+	return DynamicArray_IndexOf(arr, data, n) < n;
 }
 
 
@@ -193,16 +289,21 @@ unsigned char DynamicArray_ContainsWithin(DynamicArray* arr, void* data, unsigne
 //	arr: the array to increase in capacity
 void DynamicArray_Grow(DynamicArray* arr)
 {
-	//This information gets lost, we need it in case things go wrong.
-	unsigned int oldSize = arr->capacity;
-
-	//Change capacity
-	arr->capacity = (unsigned int)(arr->growthRate * arr->capacity);
+	//A small capacity or growth rate may not grow at all, so always make room for at least one more element
+	unsigned int capacity = (unsigned int)(arr->growthRate * arr->capacity);
+	DynamicArray_SetCapacity(arr, capacity > arr->capacity ? capacity : arr->capacity + 1);
+}
 
-	//Allocate new larger memory
-	void* newPtr = malloc(arr->dataSize * arr->capacity);
-	memcpy(newPtr, arr->data, oldSize * arr->dataSize);
-	free(arr->data);
-	arr->data = newPtr;
+///
+//Changes the capacity of a dynamic array, keeping the data within the new capacity
+//
+//Parameters:
+//	arr: The dynamic array to change the capacity of
+//	capacity: The new capacity of the array, no less than it's size
+static void DynamicArray_SetCapacity(DynamicArray* arr, unsigned int capacity)
+{
+	//Reallocating can often extend the block in place instead of copying it
+	arr->data = realloc(arr->data, arr->dataSize * capacity);
+	arr->capacity = capacity;
 }
 
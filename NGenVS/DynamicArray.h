@@ -36,6 +36,14 @@ static int defaultCapacity = 8;
 static float defaultGrowth = 2.0f;
 //Internal functions
 
+///
+//Changes the capacity of a dynamic array, keeping the data within the new capacity
+//
+//Parameters:
+//	arr: The dynamic array to change the capacity of
+//	capacity: The new capacity of the array, no less than it's size
+static void DynamicArray_SetCapacity(DynamicArray* arr, unsigned int capacity);
+
 
 //Functions
 
@@ -54,6 +62,35 @@ void DynamicArray_Grow(DynamicArray* arr);
 //	data: Data to append to array
 void DynamicArray_Append(DynamicArray* arr, void* data);
 
+///
+//Makes sure a dynamic array can hold a number of elements without growing
+//
+//Parameters:
+//	arr: The dynamic array to reserve room in
+//	capacity: The number of elements the array must have room for
+void DynamicArray_Reserve(DynamicArray* arr, unsigned int capacity);
+
+///
+//Appends an element to a dynamic array without copying anything into it,
+//So the element can be written in place instead of being built elsewhere and copied in.
+//
+//Parameters:
+//	arr: The dynamic array to append
+//
+//Returns:
+//	Pointer to the new element, whose contents are undefined
+void* DynamicArray_Emplace(DynamicArray* arr);
+
+///
+//Appends a dynamic array with a contiguous array of elements,
+//Growing at most once and copying all of the elements at once
+//
+//Parameters:
+//	arr: The dynamic array to append
+//	data: Pointer to the first element to append
+//	count: The number of elements to append
+void DynamicArray_AppendArray(DynamicArray* arr, const void* data, unsigned int count);
+
 ///
 //Indexes a dynamic array
 //
@@ -67,6 +104,7 @@ void* DynamicArray_Index(DynamicArray* arr, unsigned int index);
 
 ///
 //Clears a dynamic array setting all indices & size to 0
+//Only the elements in use are zeroed, elements past the size are never read
 //Does not lessen capacity
 //
 //Parameters:
@@ -82,6 +120,15 @@ void DynamicArray_Clear(DynamicArray* arr);
 //	index: The index of the element to remove
 void DynamicArray_Remove(DynamicArray* arr, const unsigned int index);
 
+///
+//Removes an element from the dynamic array by moving the last element into it's place.
+//Takes the same time however many elements follow it, but does not keep the order of the elements.
+//
+//Parameters:
+//	arr: A pointer to the dynamic array to remove an element from
+//	index: The index of the element to remove
+void DynamicArray_SwapRemove(DynamicArray* arr, const unsigned int index);
+
 ///
 //Removes a specified data from the dynamic array
 //Then copies all data back one space to ensure no gaps in data exist
@@ -91,6 +138,19 @@ void DynamicArray_Remove(DynamicArray* arr, const unsigned int index);
 //	data: The data to remove
 void DynamicArray_RemoveData(DynamicArray* arr, void* data);
 
+///
+//Finds the index of the first of the first n elements of the array equal to data.
+//Elements the size of an int or a pointer are compared as a whole rather than byte by byte.
+//
+//Parameters:
+//	arr: The array to search for the data
+//	data: The data being searched for
+//	n: The number of elements to search from the start of the array
+//
+//Returns:
+//	The index of the first matching element, or n if none of them match
+unsigned int DynamicArray_IndexOf(DynamicArray* arr, const void* data, unsigned int n);
+
 ///
 //Determines if data is already contained in the array
 //Searches the entire array
@@ -17,20 +17,24 @@ FrameOfReference* FrameOfReference_Allocate(void)
 
 ///
 //Initializes a Frame of REference
+//The scale, rotation, position and orientation handles are bound to storage within the frame itself
 //
 //Parameters:
 //	FoRef: The frame of reference to initialize
 void FrameOfReference_Initialize(FrameOfReference* FoRef)
 {
-	FoRef->scale = Matrix_Allocate();
-	Matrix_Initialize(FoRef->scale, 3, 3);
+	FoRef->scale = Mat3_Storage_Initialize(&FoRef->scaleStorage);
+	FoRef->rotation = Mat3_Storage_Initialize(&FoRef->rotationStorage);
+	FoRef->position = Vec3_Storage_Initialize(&FoRef->positionStorage);
 
-	FoRef->rotation = Matrix_Allocate();
-	Matrix_Initialize(FoRef->rotation, 3, 3);
-
-	FoRef->position = Vector_Allocate();
-	Vector_Initialize(FoRef->position, 3);
+	FoRef->orientation = &FoRef->orientationStorage;
+	Quat_ToIdentity(FoRef->orientation);
+	FoRef->rotationOutOfDate = &FoRef->rotationOutOfDateStorage;
+	*FoRef->rotationOutOfDate = 0;
 
+	Mat4_ToIdentity(&FoRef->worldMatrix);
+	FoRef->viewProjectionRevision = 0;
+	FrameOfReference_InvalidateWorldMatrix(FoRef);
 }
 
 ///
@@ -40,9 +44,6 @@ void FrameOfReference_Initialize(FrameOfReference* FoRef)
 //	FoRef: A pointer to the frame of reference to free
 void FrameOfReference_Free(FrameOfReference* FoRef)
 {
-	Vector_Free(FoRef->position);
-	Matrix_Free(FoRef->scale);
-	Matrix_Free(FoRef->rotation);
 	free(FoRef);
 }
 
@@ -56,6 +57,7 @@ void FrameOfReference_Translate(FrameOfReference* FoRef, const Vector* translati
 {
 
 	Vector_Increment(FoRef->position, translation);
+	FrameOfReference_InvalidateWorldMatrix(FoRef);
 }
 
 ///
@@ -67,36 +69,19 @@ void FrameOfReference_Translate(FrameOfReference* FoRef, const Vector* translati
 //	radians: The amount of radians to rotate by
 void FrameOfReference_Rotate(FrameOfReference* FoRef, const Vector* axis, const float radians)
 {
+	Vec3 copyOfAxis;
+	Vec3_Copy(&copyOfAxis, Vec3_FROM_VECTOR(axis));
+	Vec3_Normalize(&copyOfAxis);
 
-	Vector copyOfAxis;
-	Vector_INIT_ON_STACK(copyOfAxis, 3);
-	Vector_Copy(&copyOfAxis, axis);
-
-	Vector_Normalize(&copyOfAxis);
-
-	//Construct a rotation matrix based on rodriguez' formula
-	Matrix rotMat;
-	Matrix_INIT_ON_STACK(rotMat, 3, 3);
-
-	//Row 1
-	*Matrix_Index(&rotMat, 0, 0) = cosf(radians) + powf(copyOfAxis.components[0], 2.0f) * (1.0f - cosf(radians));
-	*Matrix_Index(&rotMat, 0, 1) = copyOfAxis.components[0] * copyOfAxis.components[1] * (1.0f - cosf(radians)) - copyOfAxis.components[2] * sinf(radians);
-	*Matrix_Index(&rotMat, 0, 2) = copyOfAxis.components[0] * copyOfAxis.components[2] * (1.0f - cosf(radians)) + copyOfAxis.components[1] * sinf(radians);
+	Quat rotation;
+	Quat_SetAxisAngle(&rotation, &copyOfAxis, radians);
+	Quat_GetProduct(FoRef->orientation, &rotation, FoRef->orientation);
+	Quat_Normalize(FoRef->orientation);
 
-	//Row 2
-	*Matrix_Index(&rotMat, 1, 0) = copyOfAxis.components[0] * copyOfAxis.components[1] * (1.0f - cosf(radians)) + copyOfAxis.components[2] * sinf(radians);
-	*Matrix_Index(&rotMat, 1, 1) = cosf(radians) + powf(copyOfAxis.components[1], 2.0f) * (1.0f - cosf(radians));
-	*Matrix_Index(&rotMat, 1, 2) = copyOfAxis.components[1] * copyOfAxis.components[2] * (1.0f - cosf(radians)) - copyOfAxis.components[0] * sinf(radians);
-
-	//Row 3
-	*Matrix_Index(&rotMat, 2, 0) = copyOfAxis.components[0] * copyOfAxis.components[2] * (1.0f - cosf(radians)) - copyOfAxis.components[1] * sinf(radians);
-	*Matrix_Index(&rotMat, 2, 1) = copyOfAxis.components[1] * copyOfAxis.components[2] * (1.0f - cosf(radians)) + copyOfAxis.components[0] * sinf(radians);
-	*Matrix_Index(&rotMat, 2, 2) = cosf(radians) + powf(copyOfAxis.components[2], 2.0f) * (1.0f - cosf(radians));
-
-
-	Matrix_TransformMatrix(&rotMat, FoRef->rotation);
-
-	//Matrix_Free(&rotMat);
+	//Rotating is rare next to integrating, so the matrix is kept up to date here
+	Quat_ToMat3(Mat3_FROM_MATRIX(FoRef->rotation), FoRef->orientation);
+	*FoRef->rotationOutOfDate = 0;
+	FrameOfReference_InvalidateWorldMatrix(FoRef);
 }
 
 ///
@@ -111,6 +96,7 @@ void FrameOfReference_Scale(FrameOfReference* FoRef, const Vector* scaleVector)
 	{
 		*Matrix_Index(FoRef->scale, i, i) *= scaleVector->components[i];
 	}
+	FrameOfReference_InvalidateWorldMatrix(FoRef);
 }
 
 
@@ -140,7 +126,7 @@ void FrameOfReference_ConstructRotationMatrix(Matrix* destination, const Vector*
 }
 
 ///
-//Compiles the Frame of Reference into a 4x4 matrix
+//Compiles the Frame of Reference into a 4x4 matrix, bringing it's rotation matrix up to date first
 //Where the first 3x3 is a rotation matrix with scale information on the diagnol
 //And the 4th column is a Vector 3 holding xyz position info
 //
@@ -149,21 +135,82 @@ void FrameOfReference_ConstructRotationMatrix(Matrix* destination, const Vector*
 //	dest: A pointer to a 4x4 destination matrix
 void FrameOfReference_ToMatrix4(FrameOfReference* source, Matrix* dest)
 {
-	Matrix temp;
-	Matrix_INIT_ON_STACK(temp, 3, 3);
+	FrameOfReference_UpdateRotation(source);
 
-	Matrix_GetProductMatrix(&temp, source->rotation, source->scale);
+	Mat3 temp;
+	Mat3_GetProduct(&temp, Mat3_FROM_MATRIX(source->rotation), Mat3_FROM_MATRIX(source->scale));
 
 	for (int i = 0; i < 3; i++)
 	{
 		for (int j = 0; j < 3; j++)
 		{
-			*Matrix_Index(dest, i, j) = Matrix_GetIndex(&temp, i, j);
+			*Matrix_Index(dest, i, j) = temp.components[i * 3 + j];
 		}	
 		*Matrix_Index(dest, i, 3) = source->position->components[i];
 	}
 }
 
+///
+//Gets the frame of reference compiled into a 4x4 matrix as by FrameOfReference_ToMatrix4,
+//Only compiling it again if the frame has changed since it was last compiled
+//
+//Parameters:
+//	frame: The frame of reference to get the world matrix of
+//
+//Returns:
+//	A pointer to the frame's cached world matrix
+const Mat4* FrameOfReference_GetWorldMatrix(FrameOfReference* frame)
+{
+	if(frame->worldMatrixOutOfDate)
+	{
+		//The bottom row is never written, it stays as it was set on initialization
+		Matrix world;
+		Mat4_INIT_MATRIX_VIEW(world, frame->worldMatrix);
+		FrameOfReference_ToMatrix4(frame, &world);
+
+		frame->worldMatrixOutOfDate = 0;
+		frame->modelViewProjectionOutOfDate = 1;
+	}
+	return &frame->worldMatrix;
+}
+
+///
+//Gets the world matrix of a frame of reference transformed by a view projection matrix,
+//Only multiplying them again if the frame or the view projection matrix has changed since they were last multiplied
+//
+//Parameters:
+//	frame: The frame of reference to get the model view projection matrix of
+//	viewProjection: The view projection matrix to transform the world matrix by
+//	viewProjectionRevision: Identifies the view projection matrix, must change whenever it's components do
+//
+//Returns:
+//	A pointer to the frame's cached model view projection matrix
+const Mat4* FrameOfReference_GetModelViewProjectionMatrix(FrameOfReference* frame, const Mat4* viewProjection, unsigned int viewProjectionRevision)
+{
+	const Mat4* world = FrameOfReference_GetWorldMatrix(frame);
+	if(frame->modelViewProjectionOutOfDate || frame->viewProjectionRevision != viewProjectionRevision)
+	{
+		Mat4_GetProduct(&frame->modelViewProjectionMatrix, viewProjection, world);
+
+		frame->viewProjectionRevision = viewProjectionRevision;
+		frame->modelViewProjectionOutOfDate = 0;
+	}
+	return &frame->modelViewProjectionMatrix;
+}
+
+///
+//Marks the matrices cached by a frame of reference as out of date.
+//The functions which change a frame do this themselves,
+//Code which writes to the position or scale of a frame directly must call it afterwards.
+//
+//Parameters:
+//	frame: The frame of reference to invalidate the cached matrices of
+void FrameOfReference_InvalidateWorldMatrix(FrameOfReference* frame)
+{
+	frame->worldMatrixOutOfDate = 1;
+	frame->modelViewProjectionOutOfDate = 1;
+}
+
 ///
 //Sets the position of a frame of reference
 //
@@ -173,6 +220,7 @@ void FrameOfReference_ToMatrix4(FrameOfReference* source, Matrix* dest)
 void FrameOfReference_SetPosition(FrameOfReference* frame, const Vector* position)
 {
         Vector_Copy(frame->position, position);
+        FrameOfReference_InvalidateWorldMatrix(frame);
 }
 
 ///
@@ -184,4 +232,36 @@ void FrameOfReference_SetPosition(FrameOfReference* frame, const Vector* positio
 void FrameOfReference_SetRotation(FrameOfReference* frame, Matrix* rotation)
 {
 	Matrix_Copy(frame->rotation, rotation);
+	Quat_FromMat3(frame->orientation, Mat3_FROM_MATRIX(frame->rotation));
+	*frame->rotationOutOfDate = 0;
+	FrameOfReference_InvalidateWorldMatrix(frame);
+}
+
+///
+//Sets the orientation of a frame of reference,
+//Leaving the rotation matrix out of date until FrameOfReference_UpdateRotation is called
+//
+//Parameters:
+//	frame: The frame of reference to set the orientation of
+//	orientation: The unit quaternion to set the orientation to
+void FrameOfReference_SetOrientation(FrameOfReference* frame, const Quat* orientation)
+{
+	*frame->orientation = *orientation;
+	*frame->rotationOutOfDate = 1;
+	FrameOfReference_InvalidateWorldMatrix(frame);
+}
+
+///
+//Brings the rotation matrix of a frame of reference up to date with it's orientation.
+//Does nothing if the matrix is already up to date, so it may be called by anything about to read the matrix.
+//
+//Parameters:
+//	frame: The frame of reference to update the rotation matrix of
+void FrameOfReference_UpdateRotation(FrameOfReference* frame)
+{
+	if(*frame->rotationOutOfDate)
+	{
+		Quat_ToMat3(Mat3_FROM_MATRIX(frame->rotation), frame->orientation);
+		*frame->rotationOutOfDate = 0;
+	}
 }
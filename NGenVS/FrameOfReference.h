@@ -2,13 +2,32 @@
 #define FRAME_OF_REFERENCE
 
 #include "Matrix.h"
+#include "Mat3.h"
+#include "Mat4.h"
+#include "Quat.h"
 
 typedef struct FrameOfReference
 {
 	Matrix* scale;
-	Matrix* rotation; // Where the 3 columns represent the Right, Up, and Back Vectors,
+	Matrix* rotation; // Where the 3 columns represent the Right, Up, and Back Vectors, built from orientation when it is read
 	Vector* position; // In worldspace	
 
+	Quat* orientation;					//The rotation of the frame, rotation is only a matrix form of it
+	unsigned char* rotationOutOfDate;	//1 while orientation has changed since the rotation matrix was last built
+
+	//Matrices compiled from the frame, kept until the frame changes
+	Mat4 worldMatrix;								//The frame compiled into a 4x4 matrix
+	Mat4 modelViewProjectionMatrix;					//The world matrix transformed by a view projection matrix
+	unsigned int viewProjectionRevision;			//Revision of the view projection matrix the cached model view projection was built with
+	unsigned char worldMatrixOutOfDate;				//1 while the frame has changed since the world matrix was last built
+	unsigned char modelViewProjectionOutOfDate;		//1 while the frame has changed since the model view projection matrix was last built
+
+	//Inline storage the handles above point into after initialization
+	Mat3_Storage scaleStorage;
+	Mat3_Storage rotationStorage;
+	Vec3_Storage positionStorage;
+	Quat orientationStorage;
+	unsigned char rotationOutOfDateStorage;
 } FrameOfReference;
 
 ///
@@ -20,6 +39,7 @@ FrameOfReference* FrameOfReference_Allocate(void);
 
 ///
 //Initializes a Frame of REference
+//The scale, rotation, position and orientation handles are bound to storage within the frame itself
 //
 //Parameters:
 //	FoRef: The frame of reference to initialize
@@ -67,7 +87,7 @@ void FrameOfReference_Scale(FrameOfReference* FoRef, const Vector* scaleVector);
 void FrameOfReference_ConstructRotationMatrix(Matrix* destination, const Vector* axis, const float radians);
 
 ///
-//Compiles the Frame of Reference into a 4x4 matrix
+//Compiles the Frame of Reference into a 4x4 matrix, bringing it's rotation matrix up to date first
 //Where the first 3x3 is a rotation matrix with scale information on the diagnol
 //And the 4th column is a Vector 3 holding xyz position info
 //
@@ -76,6 +96,39 @@ void FrameOfReference_ConstructRotationMatrix(Matrix* destination, const Vector*
 //	dest: A pointer to a 4x4 destination matrix
 void FrameOfReference_ToMatrix4(FrameOfReference* source, Matrix* dest);
 
+///
+//Gets the frame of reference compiled into a 4x4 matrix as by FrameOfReference_ToMatrix4,
+//Only compiling it again if the frame has changed since it was last compiled
+//
+//Parameters:
+//	frame: The frame of reference to get the world matrix of
+//
+//Returns:
+//	A pointer to the frame's cached world matrix
+const Mat4* FrameOfReference_GetWorldMatrix(FrameOfReference* frame);
+
+///
+//Gets the world matrix of a frame of reference transformed by a view projection matrix,
+//Only multiplying them again if the frame or the view projection matrix has changed since they were last multiplied
+//
+//Parameters:
+//	frame: The frame of reference to get the model view projection matrix of
+//	viewProjection: The view projection matrix to transform the world matrix by
+//	viewProjectionRevision: Identifies the view projection matrix, must change whenever it's components do
+//
+//Returns:
+//	A pointer to the frame's cached model view projection matrix
+const Mat4* FrameOfReference_GetModelViewProjectionMatrix(FrameOfReference* frame, const Mat4* viewProjection, unsigned int viewProjectionRevision);
+
+///
+//Marks the matrices cached by a frame of reference as out of date.
+//The functions which change a frame do this themselves,
+//Code which writes to the position or scale of a frame directly must call it afterwards.
+//
+//Parameters:
+//	frame: The frame of reference to invalidate the cached matrices of
+void FrameOfReference_InvalidateWorldMatrix(FrameOfReference* frame);
+
 ///
 //Sets the positio of a FrameOfReference
 //
@@ -86,10 +139,28 @@ void FrameOfReference_SetPosition(FrameOfReference* frame, const Vector* positio
 
 ///
 //Sets the rotation of a GObject
+//Code which writes to the rotation matrix directly must set it through this afterwards so the orientation follows it.
 //
 //Parameters:
 //  frame: The frame of reference to set the rotation of
 //  position: The rotation to set the frame to
 void FrameOfReference_SetRotation(FrameOfReference* frame, Matrix* rotation);
 
+///
+//Sets the orientation of a frame of reference,
+//Leaving the rotation matrix out of date until FrameOfReference_UpdateRotation is called
+//
+//Parameters:
+//	frame: The frame of reference to set the orientation of
+//	orientation: The unit quaternion to set the orientation to
+void FrameOfReference_SetOrientation(FrameOfReference* frame, const Quat* orientation);
+
+///
+//Brings the rotation matrix of a frame of reference up to date with it's orientation.
+//Does nothing if the matrix is already up to date, so it may be called by anything about to read the matrix.
+//
+//Parameters:
+//	frame: The frame of reference to update the rotation matrix of
+void FrameOfReference_UpdateRotation(FrameOfReference* frame);
+
 #endif
\ No newline at end of file
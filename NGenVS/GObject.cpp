@@ -32,7 +32,14 @@ void GObject_Initialize(GObject* GO)
 	GO->body = NULL;
 	GO->collider = NULL;
 
-
+	//The object manager places the object in it's arrays when it is added
+	for(int i = 0; i < GOBJECT_NUMARRAYS; i++)
+	{
+		GO->arrayIndices[i] = GObject_notInArray;
+	}
+	GO->handle.index = GObject_notInArray;
+	GO->handle.generation = 0;
+	GO->pool = 0;
 }
 
 ///
@@ -108,6 +115,30 @@ void GObject_RemoveState(GObject* GO, int stateIndex)
 	LinkedList_RemoveIndex(GO->states, stateIndex);
 }
 
+///
+//Finds the first state of a game object which is updated by a given function
+//
+//Parameters:
+//	GO: Pointer to game object to search the states of
+//	updateFunc: The update function of the kind of state to find
+//
+//Returns:
+//	A pointer to the first state updated by updateFunc, or NULL if the game object has none
+State* GObject_FindState(GObject* GO, void(*updateFunc)(GObject*, State*))
+{
+	LinkedList_Node* current = GO->states->head;
+	while(current != NULL)
+	{
+		State* currentState = (State*)current->data;
+		if(currentState->State_Update == updateFunc)
+		{
+			return currentState;
+		}
+		current = current->next;
+	}
+	return NULL;
+}
+
 ///
 //Calls the update function of each state attached to a gameobject
 //
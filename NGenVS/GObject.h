@@ -5,12 +5,34 @@
 #include "Mesh.h"
 #include "Texture.h"
 
+#include "LinkedList.h"
+
 #include "State.h"
 
 #include "RigidBody.h"
 
 #include "Collider.h"
 
+//The dense arrays of objects kept by the object manager.
+//Each holds exactly the objects with a component, so a manager only walks the objects it works on.
+enum GObject_Array
+{
+	GOBJECT_ARRAY_ALL,			//Every object
+	GOBJECT_ARRAY_BODIES,		//Objects with a rigid body
+	GOBJECT_ARRAY_COLLIDERS,	//Objects with a collider
+	GOBJECT_ARRAY_MESHES,		//Objects with a mesh
+	GOBJECT_NUMARRAYS
+};
+
+//A reference to an object which can be held past the object's removal.
+//The object manager gives each slot a new generation whenever it's object is removed,
+//So a handle to a removed object no longer matches it's slot and looks up as NULL instead of dangling.
+typedef struct GObjectHandle
+{
+	unsigned int index;			//Index of the object's slot in the object manager
+	unsigned int generation;	//Generation of the slot when the object was added
+} GObjectHandle;
+
 typedef struct GObject
 {
 	FrameOfReference* frameOfReference;
@@ -21,8 +43,15 @@ typedef struct GObject
 	Collider* collider;
 
 	Matrix* colorMatrix;
+
+	unsigned int arrayIndices[GOBJECT_NUMARRAYS];	//Index of the object in each of the object manager's arrays, GObject_notInArray in those not holding it
+	GObjectHandle handle;							//Handle of the object while it is managed by the object manager, it's index is GObject_notInArray otherwise
+	unsigned int pool;								//Pool of the object manager the object is recycled into when it is deleted, 0 if it is freed instead
 } GObject;
 
+//Internals
+static const unsigned int GObject_notInArray = 0xFFFFFFFF;	//Array index of an object not held by an array
+
 ///
 //Allocates memory for a new Game Object
 //
@@ -60,6 +89,17 @@ void GObject_AddState(GObject* GO, State* state);
 //	stateIndex: Index of the state to remove (0 is the first state, up to the most recent)
 void GObject_RemoveState(GObject* GO, int stateIndex);
 
+///
+//Finds the first state of a game object which is updated by a given function
+//
+//Parameters:
+//	GO: Pointer to game object to search the states of
+//	updateFunc: The update function of the kind of state to find
+//
+//Returns:
+//	A pointer to the first state updated by updateFunc, or NULL if the game object has none
+State* GObject_FindState(GObject* GO, void(*updateFunc)(GObject*, State*));
+
 ///
 //Calls the update function of each state attached to a gameobject
 //
@@ -23,4 +23,22 @@ unsigned long Hash_SDBM(void* key, unsigned int keyLength)
 		hash = byteVal + (hash << 6) + (hash << 16) - hash;
 	}
 	return hash;
+}
+
+///
+//Hashes a key no larger than a pointer, such as a pointer itself.
+//The low bits of an aligned pointer are always 0, so they are dropped, and the high bits are folded in so pointers far apart still spread out.
+//Pointers close together get hashes close together, so looking up objects in the order they were allocated walks through a map's slots in order.
+//
+//Parameters:
+//	key: The key to hash
+//	keyLength: The size of the key in bytes, no more than 8
+//
+//Returns:
+//	The hashvalue of the key
+unsigned long Hash_Pointer(void* key, unsigned int keyLength)
+{
+	unsigned long long bits = 0;
+	memcpy(&bits, key, keyLength);
+	return (unsigned long)((bits >> 3) ^ (bits >> 24));
 }
\ No newline at end of file
@@ -23,10 +23,20 @@ HashMap* HashMap_Allocate(void)
 //
 //Parameters:
 //	map: Hashmap to initialize
+//	capacity: The number of slots the map starts with, rounded up to a power of 2 of at least HashMap_minCapacity
 void HashMap_Initialize(HashMap* map, unsigned int capacity)
 {
+	//Slots are found by masking the hash, so there must be a power of 2 of them
+	unsigned int numSlots = HashMap_minCapacity;
+	while(numSlots < capacity)
+	{
+		numSlots *= 2;
+	}
+
+	//Zeroed slots are empty
 	map->data = DynamicArray_Allocate();
-	DynamicArray_Initialize(map->data, sizeof(struct HashMap_KeyValuePair*));
+	map->data->capacity = numSlots;
+	DynamicArray_Initialize(map->data, sizeof(struct HashMap_KeyValuePair));
 	map->Hash = Hash_SDBM;
 }
 
@@ -38,19 +48,15 @@ void HashMap_Initialize(HashMap* map, unsigned int capacity)
 //	map: The Hashmap to free
 void HashMap_Free(HashMap* map)
 {
-	//for (unsigned int i = 0; i < map->size; i++)
+	struct HashMap_KeyValuePair* slots = (struct HashMap_KeyValuePair*)map->data->data;
 	for(unsigned int i = 0; i < map->data->capacity; i++)
 	{
-		HashMap_KeyValuePair* pair = NULL;
-		if((pair = *(HashMap_KeyValuePair**)DynamicArray_Index(map->data, i)) != NULL)
+		if(slots[i].probeLength != 0)
 		{
-			HashMap_KeyValuePair_Free(pair);
-			DynamicArray_Remove(map->data, i);
+			HashMap_KeyValuePair_Free(slots + i);
 		}
-
 	}
 
-	//free(map->data);
 	DynamicArray_Free(map->data);
 	free(map);
 }
@@ -65,20 +71,15 @@ void HashMap_Free(HashMap* map)
 //	keyLength: The size of the key in bytes
 void HashMap_Add(HashMap* map, void* key, void* data, unsigned int keyLength)
 {
-	struct HashMap_KeyValuePair* pair = HashMap_KeyValuePair_Allocate();
-	HashMap_KeyValuePair_Initialize(pair, key, data, keyLength);
+	struct HashMap_KeyValuePair pair;
+	HashMap_KeyValuePair_Initialize(&pair, key, data, keyLength, (unsigned int)map->Hash(key, keyLength));
 
-	unsigned int index = map->Hash(key, keyLength) % map->data->capacity;
-	while(*(struct HashMap_KeyValuePair**)DynamicArray_Index(map->data, index) != NULL)
-	{
-		index = (index + 1) % map->data->capacity;
-	}
+	unsigned int longestHash = 0;
+	unsigned int longestProbe = HashMap_AddPair(map, pair, &longestHash);
 
-	*(struct HashMap_KeyValuePair**)DynamicArray_Index(map->data, index) = pair;
-	map->data->size++;
-
-	//If the array needs to grow
-	if(map->data->size == map->data->capacity)
+	//Grow once the map is 7/8 full, or as soon as an entry has drifted too far from it's slot however empty the map is.
+	//The only exception is when more entries share that entry's hash than the bound allows, as no number of slots would spread them out.
+	if(map->data->size * 8 >= map->data->capacity * 7 || (longestProbe > HashMap_maxProbeLength && HashMap_CountHash(map, longestHash) <= HashMap_maxProbeLength))
 	{
 		HashMap_Grow(map);
 	}
@@ -86,46 +87,42 @@ void HashMap_Add(HashMap* map, void* key, void* data, unsigned int keyLength)
 
 ///
 //Removes an entry from the hashmap
+//The entries after it are shifted back, so no tombstone is left behind
 //Does not delete data!
 //
 //Parameters:
 //	map: Map to remove entry from
 //	key: Key relating to data to be removed
 //	keyLength: The size of the key in bytes
+//
+//Returns:
+//	The data of the removed entry, NULL if the key was not found
 void* HashMap_Remove(HashMap* map, void* key, unsigned int keyLength)
 {
-	unsigned short found = 0;
-
-	unsigned int index = (map->Hash(key, keyLength) % map->data->capacity);
-	struct HashMap_KeyValuePair* pairToRemove = 0;
-	//for (unsigned int i = 0; i < map->capacity; i++)
-	for(unsigned int i = 0; i < map->data->capacity; i++)
+	unsigned int index = HashMap_FindSlot(map, key, keyLength);
+	if(index == map->data->capacity)
 	{
-		pairToRemove = *(HashMap_KeyValuePair**)DynamicArray_Index(map->data, (index + i) % map->data->capacity);
-		
-		if(pairToRemove == NULL)
-		{
-			//printf("Pair NULL..\n");
-		}
-		else if(keyLength == pairToRemove->keyLength)
-		{
-			if (memcmp(key, pairToRemove->key, pairToRemove->keyLength) == 0)
-			{
-				index = (index + i) % map->data->capacity;
-				found = 1;
-				break;
-			}
-		}
+		return NULL;
 	}
-	void* data = NULL;
-	if (found == 1)
+
+	struct HashMap_KeyValuePair* slots = (struct HashMap_KeyValuePair*)map->data->data;
+	unsigned int mask = map->data->capacity - 1;
+
+	void* data = slots[index].data;
+	HashMap_KeyValuePair_Free(slots + index);
+
+	//Shift back each following entry which is not already in it's own slot, until an empty slot or an entry in it's own slot is reached
+	unsigned int next = (index + 1) & mask;
+	while(slots[next].probeLength > 1)
 	{
-		data = pairToRemove->data;
-		HashMap_KeyValuePair_Free(pairToRemove);
-		//DynamicArray_Remove(map->data, index);
-		memset((char*)map->data->data + index * map->data->dataSize, 0, map->data->dataSize);
-		map->data->size--;
+		slots[index] = slots[next];
+		slots[index].probeLength--;
+		index = next;
+		next = (next + 1) & mask;
 	}
+	slots[index].probeLength = 0;
+	map->data->size--;
+
 	return data;
 }
 
@@ -138,22 +135,16 @@ void* HashMap_Remove(HashMap* map, void* key, unsigned int keyLength)
 //	keyLength: The size of the key in bytes
 //
 //Returns:
-//	Pointer to data
+//	Pointer to the key value pair holding the data, which is only valid until the map is next added to or removed from.
+//	NULL if the key was not found
 struct HashMap_KeyValuePair* HashMap_LookUp(HashMap* map, void* key, unsigned int keyLength)
 {
-	unsigned int index = (map->Hash(key, keyLength) % map->data->capacity);
-	struct HashMap_KeyValuePair* pair = 0;
-	for (unsigned int i = 0; i < map->data->capacity; i++)
+	unsigned int index = HashMap_FindSlot(map, key, keyLength);
+	if(index == map->data->capacity)
 	{
-		pair = *(struct HashMap_KeyValuePair**)DynamicArray_Index(map->data, (index + i) % map->data->capacity);
-		if (pair != NULL)
-			if(keyLength == pair->keyLength)
-				if (memcmp(key, pair->key, pair->keyLength) == 0) 	return pair;
-
+		return NULL;
 	}
-
-	return NULL;
-
+	return (struct HashMap_KeyValuePair*)map->data->data + index;
 }
 
 ///
@@ -165,28 +156,7 @@ struct HashMap_KeyValuePair* HashMap_LookUp(HashMap* map, void* key, unsigned in
 //	keyLength: The length of the key in bytes
 unsigned char HashMap_Contains(HashMap* map, void* key, unsigned int keyLength)
 {
-	unsigned int index = (map->Hash(key, keyLength) % map->data->capacity);
-	struct HashMap_KeyValuePair* pair = NULL;
-	for(unsigned int i = 0; i < map->data->capacity; i++)
-	{
-		pair = *(struct HashMap_KeyValuePair**)DynamicArray_Index(map->data, (index + i) % map->data->capacity);
-
-
-		if(pair == NULL)
-		{
-			//This cannot be assumed because what if there is a collision, then the object which initially caused the collision is removed
-			//And we search for the object which was subject to the collision.
-			//break;
-		}
-		else
-		{
-			if(keyLength == pair->keyLength)
-			{
-				if(memcmp(key, pair->key, pair->keyLength) == 0) return 1;
-			}
-		}
-	}
-	return 0;
+	return HashMap_FindSlot(map, key, keyLength) != map->data->capacity;
 }
 
 
@@ -194,88 +164,188 @@ unsigned char HashMap_Contains(HashMap* map, void* key, unsigned int keyLength)
 //Internals
 
 ///
-//Allocates memory for a Key Value Pair for the HashMap data structure
-//
-//Returns:
-//	A pointer to a newly allocated Key Value Pair
-struct HashMap_KeyValuePair* HashMap_KeyValuePair_Allocate()
-{
-	struct HashMap_KeyValuePair* pair = (HashMap_KeyValuePair*)malloc(sizeof(struct HashMap_KeyValuePair));
-	return pair;
-}
-
-///
-//Initializes a key value pair
+//Initializes a key value pair, copying the key into the pair or onto the heap if it is larger than a pointer
 //
 //Parameters:
 //	pair: The key value pair being initialized
-//	key: A null terminated character array containing the key to map the data to
+//	key: A pointer to the bytes of the key to map the data to
 //	data: A pointer to the data to be contained in this key value pair
 //	keyLength: The size of the key in bytes
-void HashMap_KeyValuePair_Initialize(struct HashMap_KeyValuePair* pair, void* key, void* data, unsigned int keyLength)
+//	hash: The hash of the key
+void HashMap_KeyValuePair_Initialize(struct HashMap_KeyValuePair* pair, void* key, void* data, unsigned int keyLength, unsigned int hash)
 {
-	pair->key = (char*)malloc(sizeof(char) * keyLength);
-	memcpy(pair->key, key, keyLength);
-	pair->keyLength = keyLength;
+	if(keyLength <= sizeof(pair->key))
+	{
+		pair->key = NULL;
+		memcpy(&pair->key, key, keyLength);
+	}
+	else
+	{
+		pair->key = (char*)malloc(sizeof(char) * keyLength);
+		memcpy(pair->key, key, keyLength);
+	}
+	pair->keyLength = (unsigned short)keyLength;
 	pair->data = data;
+	pair->hash = hash;
+	pair->probeLength = 1;
 }
 
 ///
-//Frees memory being used by a Key Value Pair
+//Frees memory being used by a Key Value Pair's key
 //Does not delete data!!
 //
 //PArameters:
 //	pair: Key value pair to free
 void HashMap_KeyValuePair_Free(struct HashMap_KeyValuePair* pair)
 {
-	free(pair->key);
-	free(pair);
+	if(pair->keyLength > sizeof(pair->key))
+	{
+		free(pair->key);
+	}
 }
 
 ///
-//Increases the internal storage of the hashmap, and re-hashes all existing key value pairs
+//Increases the internal storage of the hashmap, and re-adds all existing key value pairs by their stored hash
 //
 //Parameters:
 //	map: THe hashmap to increase the internal storage of
 static void HashMap_Grow(HashMap* map)
 {
-	//Grow it
-	DynamicArray_Grow(map->data);
-
-	//Copy data
-	struct HashMap_KeyValuePair** copy = (struct HashMap_KeyValuePair**)malloc(sizeof(struct HashMap_KeyValuePair*) * map->data->size);
-	memcpy(copy, map->data->data, sizeof(struct HashMap_KeyValuePair*) * map->data->size);
+	struct HashMap_KeyValuePair* oldSlots = (struct HashMap_KeyValuePair*)map->data->data;
+	unsigned int oldCapacity = map->data->capacity;
 
-	//Save size
-	unsigned int size = map->data->size;
+	//Zeroed slots are empty
+	map->data->capacity = (unsigned int)(map->data->growthRate * oldCapacity);
+	map->data->data = calloc(map->data->capacity, sizeof(struct HashMap_KeyValuePair));
+	map->data->size = 0;
 
-	//Clear dynamic array
-	DynamicArray_Clear(map->data);
-
-	//Re-Add all entries
-	for(unsigned int i = 0; i < size; i++)
+	//Re-Add all entries, the keys stay where they are
+	for(unsigned int i = 0; i < oldCapacity; i++)
 	{
-		HashMap_AddPair(map, copy[i]);
+		if(oldSlots[i].probeLength != 0)
+		{
+			oldSlots[i].probeLength = 1;
+			HashMap_AddPair(map, oldSlots[i], NULL);
+		}
 	}
+
+	free(oldSlots);
 }
 
 ///
-//Takes an existing key value pair and re-hashes and re-adds it to the hashmap
-//To be used when a hashmap is growing in size
+//Takes an initialized key value pair and adds it to the hashmap,
+//Moving each entry which is closer to it's own slot than the pair is one slot along.
 //
 //Parameters:
-//	map: THe hashmap the existing pair is being added to
+//	map: THe hashmap the pair is being added to
 //	pair: THe pair to add
-static void HashMap_AddPair(HashMap* map, struct HashMap_KeyValuePair* pair)
+//
+//	longestHash: Set to the hash of the entry which was moved furthest from it's slot, may be NULL
+//
+//Returns:
+//	The longest distance from it's slot any entry was moved to
+static unsigned int HashMap_AddPair(HashMap* map, struct HashMap_KeyValuePair pair, unsigned int* longestHash)
 {
-	unsigned int hash = map->Hash(pair->key, pair->keyLength);
-	unsigned int index = hash % map->data->capacity;
+	struct HashMap_KeyValuePair* slots = (struct HashMap_KeyValuePair*)map->data->data;
+	unsigned int mask = map->data->capacity - 1;
+	unsigned int index = pair.hash & mask;
+	unsigned int longestProbe = 0;
 
-	while(*(struct HashMap_KeyValuePair**)DynamicArray_Index(map->data, index) != NULL)
+	while(slots[index].probeLength != 0)
 	{
-		index = (index + 1) % map->data->capacity;
+		//The entry further from it's slot takes this one, and the other carries on looking
+		if(slots[index].probeLength < pair.probeLength)
+		{
+			struct HashMap_KeyValuePair displaced = slots[index];
+			slots[index] = pair;
+			pair = displaced;
+		}
+
+		index = (index + 1) & mask;
+		pair.probeLength++;
+		if(pair.probeLength > longestProbe)
+		{
+			longestProbe = pair.probeLength;
+			if(longestHash != NULL)
+			{
+				*longestHash = pair.hash;
+			}
+		}
 	}
 
-	*(struct HashMap_KeyValuePair**)DynamicArray_Index(map->data, index) = pair;
+	slots[index] = pair;
 	map->data->size++;
+	return longestProbe;
+}
+
+///
+//Finds the slot holding a key
+//
+//Parameters:
+//	map: The hashmap to search
+//	key: The key to search for
+//	keyLength: The size of the key in bytes
+//
+//Returns:
+//	The index of the slot holding the key, the map's capacity if it is not in the map
+static unsigned int HashMap_FindSlot(HashMap* map, void* key, unsigned int keyLength)
+{
+	struct HashMap_KeyValuePair* slots = (struct HashMap_KeyValuePair*)map->data->data;
+	unsigned int mask = map->data->capacity - 1;
+	unsigned int hash = (unsigned int)map->Hash(key, keyLength);
+	unsigned int index = hash & mask;
+
+	//Keys no larger than a pointer are compared as they are stored, without following a pointer
+	void* inlineKey = NULL;
+	unsigned char isInline = keyLength <= sizeof(inlineKey);
+	if(isInline)
+	{
+		memcpy(&inlineKey, key, keyLength);
+	}
+
+	//Once the search is further from the key's slot than the entry it reaches, the key would have taken that entry's place
+	for(unsigned int probeLength = 1; probeLength <= slots[index].probeLength; probeLength++)
+	{
+		struct HashMap_KeyValuePair* pair = slots + index;
+		if(pair->hash == hash && pair->keyLength == keyLength)
+		{
+			if(isInline ? pair->key == inlineKey : memcmp(pair->key, key, keyLength) == 0)
+			{
+				return index;
+			}
+		}
+		index = (index + 1) & mask;
+	}
+
+	return map->data->capacity;
+}
+
+///
+//Counts the entries whose keys have exactly the given hash.
+//Growing the map cannot move these entries apart, so it can only keep them within HashMap_maxProbeLength of their slot if there are no more than that many.
+//
+//Parameters:
+//	map: The hashmap to search
+//	hash: The hash to count the entries of
+//
+//Returns:
+//	The number of entries with the given hash
+static unsigned int HashMap_CountHash(HashMap* map, unsigned int hash)
+{
+	struct HashMap_KeyValuePair* slots = (struct HashMap_KeyValuePair*)map->data->data;
+	unsigned int mask = map->data->capacity - 1;
+	unsigned int index = hash & mask;
+	unsigned int count = 0;
+
+	//Every entry with the hash lies between it's slot and the first entry closer to it's own slot than the search is
+	for(unsigned int probeLength = 1; probeLength <= slots[index].probeLength; probeLength++)
+	{
+		if(slots[index].hash == hash)
+		{
+			count++;
+		}
+		index = (index + 1) & mask;
+	}
+
+	return count;
 }
\ No newline at end of file
@@ -3,46 +3,49 @@
 
 #include "DynamicArray.h"
 
+//An open addressing hash map using Robin Hood hashing.
+//Each entry is kept in the first slot at or after the slot it's key hashes to which is not held by an entry closer to it's own slot,
+//So a lookup can stop as soon as it passes the distance the key would be at, and removing an entry shifts the entries after it back instead of leaving a tombstone.
 typedef struct HashMap
 {
 	//unsigned int capacity;
 	//unsigned int size;
 	//struct HashMap_KeyValuePair** data;
-	DynamicArray* data;
-	unsigned long(*Hash)(void* key, unsigned int keyLength);
+	DynamicArray* data;		//The slots of the map holding each HashMap_KeyValuePair inline, the capacity is always a power of 2
+	unsigned long(*Hash)(void* key, unsigned int keyLength);	//Hash_SDBM unless set to a hash better suited to the map's keys, such as Hash_Pointer
 
 } HashMap;
 
 struct HashMap_KeyValuePair
 {
-	void* key;
-	unsigned int keyLength;	//Size in bytes of key
+	void* key;						//A copy of the key, or the bytes of the key itself when it is no larger than a pointer
 	void* data;
+
+	unsigned int hash;				//Hash of the key
+	unsigned short keyLength;		//Size in bytes of key
+	unsigned short probeLength;		//1 more than the distance from the slot the key hashes to, 0 if the slot is empty
 };
 
+static const unsigned int HashMap_minCapacity = 8;		//Fewest slots a map is initialized with
+static const unsigned int HashMap_maxProbeLength = 16;	//A map grows rather than keep an entry further than this from it's slot, unless more entries than this share the entry's hash
+
 ///
 //Internals
 ///
 
 ///
-//Allocates memory for a Key Value Pair for the HashMap data structure
-//
-//Returns:
-//	A pointer to a newly allocated Key Value Pair
-struct HashMap_KeyValuePair* HashMap_KeyValuePair_Allocate();
-
-///
-//Initializes a key value pair
+//Initializes a key value pair, copying the key into the pair or onto the heap if it is larger than a pointer
 //
 //Parameters:
 //	pair: The key value pair being initialized
-//	key: A null terminated character array containing the key to map the data to
+//	key: A pointer to the bytes of the key to map the data to
 //	data: A pointer to the data to be contained in this key value pair
 //	keyLength: The size of the key in bytes
-void HashMap_KeyValuePair_Initialize(struct HashMap_KeyValuePair* pair, void* key, void* data, unsigned int keyLength);
+//	hash: The hash of the key
+void HashMap_KeyValuePair_Initialize(struct HashMap_KeyValuePair* pair, void* key, void* data, unsigned int keyLength, unsigned int hash);
 
 ///
-//Frees memory being used by a Key Value Pair
+//Frees memory being used by a Key Value Pair's key
 //Does not delete data!!
 //
 //PArameters:
@@ -65,6 +68,7 @@ HashMap* HashMap_Allocate(void);
 //
 //Parameters:
 //	map: Hashmap to initialize
+//	capacity: The number of slots the map starts with, rounded up to a power of 2 of at least HashMap_minCapacity
 void HashMap_Initialize(HashMap* map, unsigned int capacity);
 
 ///
@@ -87,11 +91,15 @@ void HashMap_Add(HashMap* map, void* key, void* data, unsigned int keyLength);
 
 ///
 //Removes an entry from the hashmap
+//The entries after it are shifted back, so no tombstone is left behind
 //
 //Parameters:
 //	map: Map to remove entry from
 //	key: Key relating to data to be removed
 //	keyLength: The size of the key in bytes
+//
+//Returns:
+//	The data of the removed entry, NULL if the key was not found
 void* HashMap_Remove(HashMap* map, void* key, unsigned int keyLength);
 
 ///
@@ -103,7 +111,8 @@ void* HashMap_Remove(HashMap* map, void* key, unsigned int keyLength);
 //	keyLength: The size of the key in bytes
 //
 //Returns:
-//	Pointer to data
+//	Pointer to the key value pair holding the data, which is only valid until the map is next added to or removed from.
+//	NULL if the key was not found
 struct HashMap_KeyValuePair* HashMap_LookUp(HashMap* map, void* key, unsigned int keyLength);
 
 ///
@@ -116,19 +125,48 @@ struct HashMap_KeyValuePair* HashMap_LookUp(HashMap* map, void* key, unsigned in
 unsigned char HashMap_Contains(HashMap* map, void* key, unsigned int keyLength);
 
 ///
-//Increases the internal storage of the hashmap, and re-hashes all existing key value pairs
+//Increases the internal storage of the hashmap, and re-adds all existing key value pairs by their stored hash
 //
 //Parameters:
 //	map: THe hashmap to increase the internal storage of
 static void HashMap_Grow(HashMap* map);
 
 ///
-//Takes an existing key value pair and re-hashes and re-adds it to the hashmap
-//To be used when a hashmap is growing in size
+//Takes an initialized key value pair and adds it to the hashmap,
+//Moving each entry which is closer to it's own slot than the pair is one slot along.
 //
 //Parameters:
-//	map: THe hashmap the existing pair is being added to
+//	map: THe hashmap the pair is being added to
 //	pair: THe pair to add
-static void HashMap_AddPair(HashMap* map, struct HashMap_KeyValuePair* pair);
+//
+//	longestHash: Set to the hash of the entry which was moved furthest from it's slot, may be NULL
+//
+//Returns:
+//	The longest distance from it's slot any entry was moved to
+static unsigned int HashMap_AddPair(HashMap* map, struct HashMap_KeyValuePair pair, unsigned int* longestHash);
+
+///
+//Counts the entries whose keys have exactly the given hash.
+//Growing the map cannot move these entries apart, so it can only keep them within HashMap_maxProbeLength of their slot if there are no more than that many.
+//
+//Parameters:
+//	map: The hashmap to search
+//	hash: The hash to count the entries of
+//
+//Returns:
+//	The number of entries with the given hash
+static unsigned int HashMap_CountHash(HashMap* map, unsigned int hash);
+
+///
+//Finds the slot holding a key
+//
+//Parameters:
+//	map: The hashmap to search
+//	key: The key to search for
+//	keyLength: The size of the key in bytes
+//
+//Returns:
+//	The index of the slot holding the key, the map's capacity if it is not in the map
+static unsigned int HashMap_FindSlot(HashMap* map, void* key, unsigned int keyLength);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "JobManager.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+///
+//Initializes the job manager, jobs are performed on the calling thread until a number of threads is set
+void JobManager_Initialize(void)
+{
+	jobBuffer = JobManager_AllocateBuffer();
+	JobManager_InitializeBuffer(jobBuffer);
+}
+
+///
+//Frees any resources allocated by the job manager, stopping it's threads
+void JobManager_Free(void)
+{
+	JobManager_FreeBuffer(jobBuffer);
+}
+
+///
+//Sets the number of threads every batch of jobs is spread across.
+//Must not be called from within a job.
+//
+//Parameters:
+//	numThreads: The number of threads including the calling thread, 1 to perform jobs on the calling thread alone
+void JobManager_SetNumThreads(unsigned int numThreads)
+{
+	if(numThreads == 0)
+	{
+		printf("JobManager_SetNumThreads failed! Must use at least one thread. Number of threads not changed.\n");
+		return;
+	}
+	if(numThreads == JobManager_GetNumThreads())
+	{
+		return;
+	}
+
+	ThreadPool_Free(jobBuffer->threadPool);
+	jobBuffer->threadPool = ThreadPool_Allocate();
+	ThreadPool_Initialize(jobBuffer->threadPool, numThreads);
+}
+
+///
+//Gets the number of threads every batch of jobs is spread across
+//
+//Returns:
+//	The number of threads including the calling thread
+unsigned int JobManager_GetNumThreads(void)
+{
+	return jobBuffer->threadPool->numThreads;
+}
+
+///
+//Performs a batch of tasks spread across the job manager's threads, returning once every task is done.
+//Threads which run out of tasks steal them from the threads which have not.
+//Must not be called from within a job.
+//
+//Parameters:
+//	function: The function performing each task
+//	data: Data to pass to each call of function
+//	numTasks: The number of tasks in the batch
+void JobManager_Run(ThreadPool_TaskFunction function, void* data, unsigned int numTasks)
+{
+	ThreadPool_Run(jobBuffer->threadPool, function, data, numTasks);
+}
+
+///
+//Splits a number of items into contiguous chunks and performs the chunks as a batch spread across the job manager's threads,
+//Returning once every chunk is done.
+//Must not be called from within a job.
+//
+//Parameters:
+//	function: The function performing each chunk
+//	data: Data to pass to each call of function
+//	numItems: The number of items to split into chunks
+//	chunkSize: The number of items in each chunk, at least 1
+void JobManager_RunChunks(JobManager_ChunkFunction function, void* data, unsigned int numItems, unsigned int chunkSize)
+{
+	if(chunkSize == 0)
+	{
+		printf("JobManager_RunChunks failed! Chunks must hold at least one item. Chunks not run.\n");
+		return;
+	}
+
+	struct JobManager_Chunks chunks;
+	chunks.function = function;
+	chunks.data = data;
+	chunks.numItems = numItems;
+	chunks.chunkSize = chunkSize;
+
+	unsigned int numChunks = numItems / chunkSize + (numItems % chunkSize != 0);
+	ThreadPool_Run(jobBuffer->threadPool, JobManager_PerformChunk, &chunks, numChunks);
+}
+
+///
+//Allocates a new job buffer
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized job buffer
+static JobBuffer* JobManager_AllocateBuffer(void)
+{
+	JobBuffer* buffer = (JobBuffer*)malloc(sizeof(JobBuffer));
+	return buffer;
+}
+
+///
+//Initializes a job buffer with a pool of 1 thread
+//
+//Parameters:
+//	buffer: The buffer to initialize
+static void JobManager_InitializeBuffer(JobBuffer* buffer)
+{
+	buffer->threadPool = ThreadPool_Allocate();
+	ThreadPool_Initialize(buffer->threadPool, 1);
+}
+
+///
+//Frees resources allocated by a job buffer
+//
+//Parameters:
+//	buffer: A pointer to the job buffer to free
+static void JobManager_FreeBuffer(JobBuffer* buffer)
+{
+	ThreadPool_Free(buffer->threadPool);
+	free(buffer);
+}
+
+///
+//Performs one chunk of a batch of chunks.
+//Performed by the threads of the thread pool.
+//
+//Parameters:
+//	data: A pointer to the JobManager_Chunks being performed
+//	taskIndex: The index of the chunk to perform
+//	threadIndex: The index of the thread performing the chunk
+static void JobManager_PerformChunk(void* data, unsigned int taskIndex, unsigned int threadIndex)
+{
+	struct JobManager_Chunks* chunks = (struct JobManager_Chunks*)data;
+
+	unsigned int first = taskIndex * chunks->chunkSize;
+	unsigned int end = first + chunks->chunkSize;
+	if(end > chunks->numItems)
+	{
+		end = chunks->numItems;
+	}
+
+	chunks->function(chunks->data, first, end, threadIndex);
+}
@@ -0,0 +1,114 @@
+#ifndef JOBMANAGER_H
+#define JOBMANAGER_H
+
+#include "ThreadPool.h"
+
+//A function run once for each chunk of items of a batch
+//
+//Parameters:
+//	data: The data the batch was run with
+//	first: The index of the first item of the chunk
+//	end: One past the index of the last item of the chunk
+//	threadIndex: The index of the thread performing the chunk, 0 for the thread which ran the batch
+typedef void (*JobManager_ChunkFunction)(void* data, unsigned int first, unsigned int end, unsigned int threadIndex);
+
+//The engine wide pool of threads which the other managers spread their work across
+typedef struct JobBuffer
+{
+	ThreadPool* threadPool;		//The pool every batch of jobs is performed on, a pool of 1 thread performs them on the calling thread
+} JobBuffer;
+
+//Internals
+static JobBuffer* jobBuffer;
+
+//A batch of chunks being performed by the job manager
+struct JobManager_Chunks
+{
+	JobManager_ChunkFunction function;		//The function performing each chunk
+	void* data;								//The data the batch was run with
+	unsigned int numItems;					//The number of items split into chunks
+	unsigned int chunkSize;					//The number of items in every chunk but the last
+};
+
+//Internal functions
+
+///
+//Allocates a new job buffer
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized job buffer
+static JobBuffer* JobManager_AllocateBuffer(void);
+
+///
+//Initializes a job buffer with a pool of 1 thread
+//
+//Parameters:
+//	buffer: The buffer to initialize
+static void JobManager_InitializeBuffer(JobBuffer* buffer);
+
+///
+//Frees resources allocated by a job buffer
+//
+//Parameters:
+//	buffer: A pointer to the job buffer to free
+static void JobManager_FreeBuffer(JobBuffer* buffer);
+
+///
+//Performs one chunk of a batch of chunks.
+//Performed by the threads of the thread pool.
+//
+//Parameters:
+//	data: A pointer to the JobManager_Chunks being performed
+//	taskIndex: The index of the chunk to perform
+//	threadIndex: The index of the thread performing the chunk
+static void JobManager_PerformChunk(void* data, unsigned int taskIndex, unsigned int threadIndex);
+
+//Functions
+
+///
+//Initializes the job manager, jobs are performed on the calling thread until a number of threads is set
+void JobManager_Initialize(void);
+
+///
+//Frees any resources allocated by the job manager, stopping it's threads
+void JobManager_Free(void);
+
+///
+//Sets the number of threads every batch of jobs is spread across.
+//Must not be called from within a job.
+//
+//Parameters:
+//	numThreads: The number of threads including the calling thread, 1 to perform jobs on the calling thread alone
+void JobManager_SetNumThreads(unsigned int numThreads);
+
+///
+//Gets the number of threads every batch of jobs is spread across
+//
+//Returns:
+//	The number of threads including the calling thread
+unsigned int JobManager_GetNumThreads(void);
+
+///
+//Performs a batch of tasks spread across the job manager's threads, returning once every task is done.
+//Threads which run out of tasks steal them from the threads which have not.
+//Must not be called from within a job.
+//
+//Parameters:
+//	function: The function performing each task
+//	data: Data to pass to each call of function
+//	numTasks: The number of tasks in the batch
+void JobManager_Run(ThreadPool_TaskFunction function, void* data, unsigned int numTasks);
+
+///
+//Splits a number of items into contiguous chunks and performs the chunks as a batch spread across the job manager's threads,
+//Returning once every chunk is done.
+//Must not be called from within a job.
+//
+//Parameters:
+//	function: The function performing each chunk
+//	data: Data to pass to each call of function
+//	numItems: The number of items to split into chunks
+//	chunkSize: The number of items in each chunk, at least 1
+void JobManager_RunChunks(JobManager_ChunkFunction function, void* data, unsigned int numItems, unsigned int chunkSize);
+
+#endif
@@ -0,0 +1,687 @@
+#include "LinearOctTree.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "JobManager.h"
+
+///
+//Allocates memory for a linear oct tree
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized linear oct tree
+LinearOctTree* LinearOctTree_Allocate(void)
+{
+	LinearOctTree* tree = (LinearOctTree*)malloc(sizeof(LinearOctTree));
+	return tree;
+}
+
+///
+//Initializes a linear oct tree with no objects
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to initialize
+void LinearOctTree_Initialize(LinearOctTree* tree)
+{
+	tree->proxies = DynamicArray_Allocate();
+	DynamicArray_Initialize(tree->proxies, sizeof(LinearOctTree_Proxy));
+
+	tree->cells = DynamicArray_Allocate();
+	DynamicArray_Initialize(tree->cells, sizeof(LinearOctTree_Cell));
+
+	tree->sortedCells = DynamicArray_Allocate();
+	DynamicArray_Initialize(tree->sortedCells, sizeof(LinearOctTree_Cell));
+
+	tree->pairs = DynamicArray_Allocate();
+	DynamicArray_Initialize(tree->pairs, sizeof(LinearOctTree_Pair));
+
+	for(int i = 0; i < 3; i++)
+	{
+		tree->rootMin[i] = 0.0f;
+	}
+	tree->rootSize = 1.0f;
+	tree->occupiedDepths = 0;
+
+	tree->numChunks = 0;
+	tree->digitCounts = NULL;
+	tree->chunkPairs = NULL;
+	tree->radixShift = 0;
+}
+
+///
+//Frees the data allocated by a linear oct tree.
+//Does not free any of the objects contained within the linear oct tree!
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to free
+void LinearOctTree_Free(LinearOctTree* tree)
+{
+	DynamicArray_Free(tree->proxies);
+	DynamicArray_Free(tree->cells);
+	DynamicArray_Free(tree->sortedCells);
+	DynamicArray_Free(tree->pairs);
+
+	for(unsigned int i = 0; i < tree->numChunks; i++)
+	{
+		DynamicArray_Free(tree->chunkPairs[i]);
+	}
+	free(tree->chunkPairs);
+	free(tree->digitCounts);
+
+	free(tree);
+}
+
+///
+//Adds a game object to the linear oct tree, the next update places it in a cell
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to add a game object to
+//	obj: A pointer to the game object to add (Must have collider attached)
+void LinearOctTree_Add(LinearOctTree* tree, GObject* obj)
+{
+	LinearOctTree_Proxy proxy;
+	proxy.obj = obj;
+
+	//If there is a rigidbody use that frame of reference, else use the objects
+	FrameOfReference* frame = obj->body != NULL ? obj->body->frame : obj->frameOfReference;
+	Collider_GetWorldBounds(proxy.min, proxy.max, obj->collider, frame);
+
+	proxy.depth = 0;
+	for(int i = 0; i < 3; i++)
+	{
+		proxy.cell[i] = 0;
+	}
+
+	DynamicArray_Append(tree->proxies, &proxy);
+}
+
+///
+//Removes a game object from the linear oct tree.
+//The cells stay sorted, so the tree can still be queried before the next update.
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to remove the game object from
+//	obj: A pointer to the game object to remove
+void LinearOctTree_Remove(LinearOctTree* tree, GObject* obj)
+{
+	LinearOctTree_Proxy* proxies = (LinearOctTree_Proxy*)tree->proxies->data;
+
+	//Find the object's proxy
+	unsigned int proxyIndex = 0;
+	while(proxyIndex < tree->proxies->size && proxies[proxyIndex].obj != obj)
+	{
+		proxyIndex++;
+	}
+	if(proxyIndex == tree->proxies->size) return;
+
+	//A placed proxy's cell is removed keeping the rest in order, and the last placed proxy is moved into it's place
+	unsigned int numPlaced = tree->cells->size;
+	if(proxyIndex < numPlaced)
+	{
+		unsigned int lastPlaced = numPlaced - 1;
+		LinearOctTree_Cell* cells = (LinearOctTree_Cell*)tree->cells->data;
+		unsigned int kept = 0;
+		for(unsigned int i = 0; i < numPlaced; i++)
+		{
+			if(cells[i].proxyIndex == proxyIndex) continue;
+			if(cells[i].proxyIndex == lastPlaced) cells[i].proxyIndex = proxyIndex;
+			cells[kept++] = cells[i];
+		}
+		tree->cells->size = kept;
+
+		proxies[proxyIndex] = proxies[lastPlaced];
+		proxyIndex = lastPlaced;
+	}
+
+	//The last proxy fills the gap, so the proxies added since the last update still follow the placed proxies
+	proxies[proxyIndex] = proxies[tree->proxies->size - 1];
+	tree->proxies->size--;
+}
+
+///
+//Rebuilds a linear oct tree from the current bounds of it's objects and finds every pair of objects whose bounds overlap.
+//The root cell is fit to the objects, the objects are placed in cells and the cells are sorted and searched,
+//Each step spread across the threads of the job manager. Pairs are found in the same order whichever number of threads is used.
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to update
+void LinearOctTree_Update(LinearOctTree* tree)
+{
+	DynamicArray_Clear(tree->pairs);
+
+	unsigned int numProxies = tree->proxies->size;
+	if(numProxies == 0) return;
+
+	unsigned int numChunks = numProxies / LinearOctTree_proxiesPerJob + (numProxies % LinearOctTree_proxiesPerJob != 0);
+	LinearOctTree_ReserveChunks(tree, numChunks);
+
+	JobManager_RunChunks(LinearOctTree_UpdateProxies, tree, numProxies, LinearOctTree_proxiesPerJob);
+
+	//Fit the root cell around the center of every proxy
+	LinearOctTree_Proxy* proxies = (LinearOctTree_Proxy*)tree->proxies->data;
+	float rootMax[3];
+	for(int i = 0; i < 3; i++)
+	{
+		tree->rootMin[i] = rootMax[i] = (proxies[0].min[i] + proxies[0].max[i]) / 2.0f;
+	}
+	for(unsigned int i = 1; i < numProxies; i++)
+	{
+		for(int j = 0; j < 3; j++)
+		{
+			float center = (proxies[i].min[j] + proxies[i].max[j]) / 2.0f;
+			if(center < tree->rootMin[j]) tree->rootMin[j] = center;
+			else if(center > rootMax[j]) rootMax[j] = center;
+		}
+	}
+
+	tree->rootSize = 0.0f;
+	for(int i = 0; i < 3; i++)
+	{
+		if(rootMax[i] - tree->rootMin[i] > tree->rootSize)
+		{
+			tree->rootSize = rootMax[i] - tree->rootMin[i];
+		}
+	}
+	if(tree->rootSize <= 0.0f) tree->rootSize = 1.0f;
+
+	//Both arrays of cells hold one cell per proxy
+	DynamicArray_Reserve(tree->cells, numProxies);
+	DynamicArray_Reserve(tree->sortedCells, numProxies);
+	tree->cells->size = numProxies;
+	tree->sortedCells->size = numProxies;
+
+	JobManager_RunChunks(LinearOctTree_PlaceProxies, tree, numProxies, LinearOctTree_proxiesPerJob);
+	tree->occupiedDepths = 0;
+	for(unsigned int i = 0; i < numProxies; i++)
+	{
+		tree->occupiedDepths |= 1u << proxies[i].depth;
+	}
+	LinearOctTree_SortCells(tree);
+	JobManager_RunChunks(LinearOctTree_FindPairs, tree, numProxies, LinearOctTree_proxiesPerJob);
+
+	//Merging the chunks in order gives the same pairs in the same order whichever threads found them
+	for(unsigned int i = 0; i < numChunks; i++)
+	{
+		LinearOctTree_Pair* pairs = (LinearOctTree_Pair*)tree->chunkPairs[i]->data;
+		for(unsigned int j = 0; j < tree->chunkPairs[i]->size; j++)
+		{
+			DynamicArray_Append(tree->pairs, pairs + j);
+		}
+	}
+}
+
+
+///
+//Finds every game object in a linear oct tree whose bounds as of the last update overlap a box.
+//The box is searched for like a proxy placed at the depth of the smallest cells at least as large as it,
+//Which finds the proxies at that depth or deeper, while the proxies at each shallower depth are looked up in the few cells of that depth near the box.
+//Objects added since the last update have no cell yet, so each of them is tested.
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to query
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the overlapping game objects to
+void LinearOctTree_QueryBox(LinearOctTree* tree, const float* min, const float* max, DynamicArray* results)
+{
+	LinearOctTree_Proxy* proxies = (LinearOctTree_Proxy*)tree->proxies->data;
+	LinearOctTree_Cell* cells = (LinearOctTree_Cell*)tree->cells->data;
+	unsigned int numCells = tree->cells->size;
+
+	if(numCells > 0)
+	{
+		float extent = 0.0f;
+		for(int i = 0; i < 3; i++)
+		{
+			if(max[i] - min[i] > extent)
+			{
+				extent = max[i] - min[i];
+			}
+		}
+
+		//Find the deepest cells which are at least as large as the box, as a proxy with the box's bounds would be placed
+		unsigned int boxDepth = 0;
+		float boxCellSize = tree->rootSize;
+		while(boxDepth < LinearOctTree_maxDepth && boxCellSize / 2.0f >= extent)
+		{
+			boxCellSize /= 2.0f;
+			boxDepth++;
+		}
+
+		unsigned int hint = 0;
+		for(unsigned int depth = 0; depth <= boxDepth; depth++)
+		{
+			if(depth < boxDepth && (tree->occupiedDepths & (1u << depth)) == 0) continue;
+
+			//Every proxy reaches at most half a cell past it's cell, and a proxy deeper than the box's depth lies within a cell at that depth,
+			//So only the cells within a cell and a half of the box's minimum or half a cell of it's maximum can hold an overlapping proxy
+			float cellSize = tree->rootSize / (float)(1u << depth);
+			unsigned int lastCell = (1u << depth) - 1;
+			unsigned int minCell[3];
+			unsigned int maxCell[3];
+			for(int i = 0; i < 3; i++)
+			{
+				float low = ceilf((min[i] - tree->rootMin[i]) / cellSize - 1.5f);
+				float high = floorf((max[i] - tree->rootMin[i]) / cellSize + 0.5f);
+				minCell[i] = low > 0.0f ? (unsigned int)low : 0;
+				maxCell[i] = high > 0.0f ? (unsigned int)high : 0;
+				if(minCell[i] > lastCell) minCell[i] = lastCell;
+				if(maxCell[i] > lastCell) maxCell[i] = lastCell;
+			}
+
+			unsigned int cell[3];
+			for(cell[2] = minCell[2]; cell[2] <= maxCell[2]; cell[2]++)
+			{
+				for(cell[1] = minCell[1]; cell[1] <= maxCell[1]; cell[1]++)
+				{
+					for(cell[0] = minCell[0]; cell[0] <= maxCell[0]; cell[0]++)
+					{
+						//At the box's depth the cell and every cell it contains are searched,
+						//At a shallower depth only the cell itself, as the cells it contains are searched at their own depth
+						unsigned int key = LinearOctTree_GetKey(cell, depth);
+						unsigned int endKey = depth == boxDepth ? (key & ~15u) + (1u << (3 * (LinearOctTree_maxDepth - depth) + 4)) : key + 1;
+
+						unsigned int j = LinearOctTree_FindFirstCell(cells, numCells, key, hint);
+						hint = j < numCells ? j : numCells - 1;
+						for(; j < numCells && cells[j].key < endKey; j++)
+						{
+							LinearOctTree_Proxy* proxy = proxies + cells[j].proxyIndex;
+							if(proxy->min[0] <= max[0] && proxy->max[0] >= min[0] &&
+								proxy->min[1] <= max[1] && proxy->max[1] >= min[1] &&
+								proxy->min[2] <= max[2] && proxy->max[2] >= min[2])
+							{
+								DynamicArray_Append(results, &proxy->obj);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	//Objects added since the last update have not been placed in a cell yet
+	for(unsigned int i = numCells; i < tree->proxies->size; i++)
+	{
+		LinearOctTree_Proxy* proxy = proxies + i;
+		if(proxy->min[0] <= max[0] && proxy->max[0] >= min[0] &&
+			proxy->min[1] <= max[1] && proxy->max[1] >= min[1] &&
+			proxy->min[2] <= max[2] && proxy->max[2] >= min[2])
+		{
+			DynamicArray_Append(results, &proxy->obj);
+		}
+	}
+}
+
+///
+//Spreads the lowest 10 bits of a number out so there are two 0 bits between each of them
+//
+//Parameters:
+//	bits: The bits to spread
+//
+//Returns:
+//	The spread bits, bit n of the number is moved to bit 3n
+static unsigned int LinearOctTree_SpreadBits(unsigned int bits)
+{
+	bits &= 0x000003FF;
+	bits = (bits | (bits << 16)) & 0x030000FF;
+	bits = (bits | (bits << 8)) & 0x0300F00F;
+	bits = (bits | (bits << 4)) & 0x030C30C3;
+	bits = (bits | (bits << 2)) & 0x09249249;
+	return bits;
+}
+
+///
+//Gets the key of a cell
+//
+//Parameters:
+//	cell: Coordinates of the cell among the cells at it's depth
+//	depth: The depth of the cell
+//
+//Returns:
+//	The key of the cell
+static unsigned int LinearOctTree_GetKey(const unsigned int* cell, unsigned int depth)
+{
+	unsigned int shift = LinearOctTree_maxDepth - depth;
+	unsigned int mortonCode =
+		LinearOctTree_SpreadBits(cell[0] << shift) |
+		(LinearOctTree_SpreadBits(cell[1] << shift) << 1) |
+		(LinearOctTree_SpreadBits(cell[2] << shift) << 2);
+	return (mortonCode << 4) | depth;
+}
+
+///
+//Finds the first sorted cell with a key no less than a given key.
+//The search gallops outwards from a hint before searching the last step by bisection,
+//So it takes few steps when the cell is close to the hint.
+//
+//Parameters:
+//	cells: The cells sorted by key
+//	numCells: The number of cells
+//	key: The key to search for
+//	hint: The index of a cell near the cell being searched for, less than numCells
+//
+//Returns:
+//	The index of the first cell with a key no less than key, numCells if there is none
+static unsigned int LinearOctTree_FindFirstCell(const LinearOctTree_Cell* cells, unsigned int numCells, unsigned int key, unsigned int hint)
+{
+	unsigned int low;
+	unsigned int high;
+	unsigned int step = 1;
+	if(cells[hint].key < key)
+	{
+		low = hint + 1;
+		while(hint + step < numCells && cells[hint + step].key < key)
+		{
+			low = hint + step + 1;
+			step *= 2;
+		}
+		high = hint + step < numCells ? hint + step : numCells;
+	}
+	else
+	{
+		high = hint;
+		while(step <= hint && cells[hint - step].key >= key)
+		{
+			high = hint - step;
+			step *= 2;
+		}
+		low = step <= hint ? hint - step + 1 : 0;
+	}
+
+	while(low < high)
+	{
+		unsigned int middle = low + (high - low) / 2;
+		if(cells[middle].key < key)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	return low;
+}
+
+///
+//Makes sure a linear oct tree has scratch storage for a number of chunks
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree
+//	numChunks: The number of chunks the scratch storage is needed for
+static void LinearOctTree_ReserveChunks(LinearOctTree* tree, unsigned int numChunks)
+{
+	if(numChunks <= tree->numChunks) return;
+
+	unsigned int numDigits = 1u << LinearOctTree_radixBits;
+	tree->digitCounts = (unsigned int*)realloc(tree->digitCounts, sizeof(unsigned int) * numDigits * numChunks);
+	tree->chunkPairs = (DynamicArray**)realloc(tree->chunkPairs, sizeof(DynamicArray*) * numChunks);
+
+	for(unsigned int i = tree->numChunks; i < numChunks; i++)
+	{
+		tree->chunkPairs[i] = DynamicArray_Allocate();
+		DynamicArray_Initialize(tree->chunkPairs[i], sizeof(LinearOctTree_Pair));
+	}
+	tree->numChunks = numChunks;
+}
+
+///
+//Gets the world space bounds of the objects of a chunk of proxies.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the linear oct tree being updated
+//	first: The index of the first proxy of the chunk
+//	end: One past the index of the last proxy of the chunk
+//	threadIndex: Unused
+static void LinearOctTree_UpdateProxies(void* data, unsigned int first, unsigned int end, unsigned int /*threadIndex*/)
+{
+	LinearOctTree* tree = (LinearOctTree*)data;
+	LinearOctTree_Proxy* proxies = (LinearOctTree_Proxy*)tree->proxies->data;
+
+	for(unsigned int i = first; i < end; i++)
+	{
+		GObject* obj = proxies[i].obj;
+
+		//Sleeping objects have not moved, so their bounds are still correct
+		if(obj->body == NULL || obj->body->isAwake)
+		{
+			//Each object is in one proxy, so the frames and world caches the bounds are read from are never shared between threads
+			FrameOfReference* frame = obj->body != NULL ? obj->body->frame : obj->frameOfReference;
+			Collider_GetWorldBounds(proxies[i].min, proxies[i].max, obj->collider, frame);
+		}
+	}
+}
+
+///
+//Places each proxy of a chunk in a cell and stores the cell at the proxy's index.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the linear oct tree being updated
+//	first: The index of the first proxy of the chunk
+//	end: One past the index of the last proxy of the chunk
+//	threadIndex: Unused
+static void LinearOctTree_PlaceProxies(void* data, unsigned int first, unsigned int end, unsigned int /*threadIndex*/)
+{
+	LinearOctTree* tree = (LinearOctTree*)data;
+	LinearOctTree_Proxy* proxies = (LinearOctTree_Proxy*)tree->proxies->data;
+	LinearOctTree_Cell* cells = (LinearOctTree_Cell*)tree->cells->data;
+
+	for(unsigned int i = first; i < end; i++)
+	{
+		LinearOctTree_Proxy* proxy = proxies + i;
+
+		float extent = 0.0f;
+		for(int j = 0; j < 3; j++)
+		{
+			if(proxy->max[j] - proxy->min[j] > extent)
+			{
+				extent = proxy->max[j] - proxy->min[j];
+			}
+		}
+
+		//Find the deepest cells which are at least as large as the bounds
+		float cellSize = tree->rootSize;
+		proxy->depth = 0;
+		while(proxy->depth < LinearOctTree_maxDepth && cellSize / 2.0f >= extent)
+		{
+			cellSize /= 2.0f;
+			proxy->depth++;
+		}
+
+		//Take the cell at that depth which holds the center of the bounds
+		unsigned int numCells = 1u << proxy->depth;
+		for(int j = 0; j < 3; j++)
+		{
+			float coordinate = ((proxy->min[j] + proxy->max[j]) / 2.0f - tree->rootMin[j]) / cellSize;
+			proxy->cell[j] = coordinate > 0.0f ? (unsigned int)coordinate : 0;
+			if(proxy->cell[j] >= numCells) proxy->cell[j] = numCells - 1;
+		}
+
+		cells[i].key = LinearOctTree_GetKey(proxy->cell, proxy->depth);
+		cells[i].proxyIndex = i;
+	}
+}
+
+///
+//Counts the digits of the current radix sort pass in a chunk of cells.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the linear oct tree being sorted
+//	first: The index of the first cell of the chunk
+//	end: One past the index of the last cell of the chunk
+//	threadIndex: Unused
+static void LinearOctTree_CountDigits(void* data, unsigned int first, unsigned int end, unsigned int /*threadIndex*/)
+{
+	LinearOctTree* tree = (LinearOctTree*)data;
+	LinearOctTree_Cell* cells = (LinearOctTree_Cell*)tree->cells->data;
+
+	unsigned int numDigits = 1u << LinearOctTree_radixBits;
+	unsigned int* counts = tree->digitCounts + (first / LinearOctTree_proxiesPerJob) * numDigits;
+	memset(counts, 0, sizeof(unsigned int) * numDigits);
+
+	for(unsigned int i = first; i < end; i++)
+	{
+		counts[(cells[i].key >> tree->radixShift) & (numDigits - 1)]++;
+	}
+}
+
+///
+//Scatters a chunk of cells into the sorted cells by the digit of the current radix sort pass.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the linear oct tree being sorted
+//	first: The index of the first cell of the chunk
+//	end: One past the index of the last cell of the chunk
+//	threadIndex: Unused
+static void LinearOctTree_ScatterCells(void* data, unsigned int first, unsigned int end, unsigned int /*threadIndex*/)
+{
+	LinearOctTree* tree = (LinearOctTree*)data;
+	LinearOctTree_Cell* cells = (LinearOctTree_Cell*)tree->cells->data;
+	LinearOctTree_Cell* sortedCells = (LinearOctTree_Cell*)tree->sortedCells->data;
+
+	unsigned int numDigits = 1u << LinearOctTree_radixBits;
+	unsigned int* indices = tree->digitCounts + (first / LinearOctTree_proxiesPerJob) * numDigits;
+
+	for(unsigned int i = first; i < end; i++)
+	{
+		sortedCells[indices[(cells[i].key >> tree->radixShift) & (numDigits - 1)]++] = cells[i];
+	}
+}
+
+///
+//Sorts the cells of a linear oct tree by key with a least significant digit radix sort,
+//Spreading the counting and scattering of each pass across the threads of the job manager.
+//Cells with equal keys keep the order of their proxies.
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to sort the cells of
+static void LinearOctTree_SortCells(LinearOctTree* tree)
+{
+	unsigned int numCells = tree->cells->size;
+	unsigned int numChunks = numCells / LinearOctTree_proxiesPerJob + (numCells % LinearOctTree_proxiesPerJob != 0);
+	unsigned int numDigits = 1u << LinearOctTree_radixBits;
+	unsigned int numKeyBits = 3 * LinearOctTree_maxDepth + 4;
+
+	for(tree->radixShift = 0; tree->radixShift < numKeyBits; tree->radixShift += LinearOctTree_radixBits)
+	{
+		JobManager_RunChunks(LinearOctTree_CountDigits, tree, numCells, LinearOctTree_proxiesPerJob);
+
+		//Each chunk scatters each digit after the earlier chunks, so cells with equal digits keep their order
+		unsigned int index = 0;
+		unsigned char allEqual = 0;
+		for(unsigned int digit = 0; digit < numDigits; digit++)
+		{
+			unsigned int digitStart = index;
+			for(unsigned int chunk = 0; chunk < numChunks; chunk++)
+			{
+				unsigned int* count = tree->digitCounts + chunk * numDigits + digit;
+				unsigned int chunkCount = *count;
+				*count = index;
+				index += chunkCount;
+			}
+
+			if(index - digitStart == numCells) allEqual = 1;
+		}
+
+		//A pass over a digit every cell shares would not move any cell
+		if(allEqual) continue;
+
+		JobManager_RunChunks(LinearOctTree_ScatterCells, tree, numCells, LinearOctTree_proxiesPerJob);
+
+		DynamicArray* temp = tree->cells;
+		tree->cells = tree->sortedCells;
+		tree->sortedCells = temp;
+	}
+}
+
+///
+//Finds the pairs of objects with overlapping bounds which the proxy of each cell in a chunk of sorted cells is responsible for.
+//A proxy is responsible for it's pairs with the proxies in deeper cells, and with the proxies after it in cells at it's depth.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the linear oct tree being updated
+//	first: The index of the first sorted cell of the chunk
+//	end: One past the index of the last sorted cell of the chunk
+//	threadIndex: Unused
+static void LinearOctTree_FindPairs(void* data, unsigned int first, unsigned int end, unsigned int /*threadIndex*/)
+{
+	LinearOctTree* tree = (LinearOctTree*)data;
+	LinearOctTree_Proxy* proxies = (LinearOctTree_Proxy*)tree->proxies->data;
+	LinearOctTree_Cell* cells = (LinearOctTree_Cell*)tree->cells->data;
+	unsigned int numCells = tree->cells->size;
+
+	DynamicArray* pairs = tree->chunkPairs[first / LinearOctTree_proxiesPerJob];
+	DynamicArray_Clear(pairs);
+
+	LinearOctTree_Pair pair;
+	for(unsigned int i = first; i < end; i++)
+	{
+		LinearOctTree_Proxy* proxy = proxies + cells[i].proxyIndex;
+		unsigned int depth = proxy->depth;
+		float cellSize = tree->rootSize / (float)(1u << depth);
+		unsigned int lastCell = (1u << depth) - 1;
+
+		//Every proxy reaches at most half a cell past it's cell, and a deeper proxy's cell lies within a cell at this depth,
+		//So only the cells at this depth within a cell and a half of the bounds' minimum or half a cell of their maximum can hold an overlapping proxy
+		unsigned int minCell[3];
+		unsigned int maxCell[3];
+		for(int j = 0; j < 3; j++)
+		{
+			float low = ceilf((proxy->min[j] - tree->rootMin[j]) / cellSize - 1.5f);
+			float high = floorf((proxy->max[j] - tree->rootMin[j]) / cellSize + 0.5f);
+			minCell[j] = low > 0.0f ? (unsigned int)low : 0;
+			maxCell[j] = high > 0.0f ? (unsigned int)high : 0;
+			if(minCell[j] > lastCell) minCell[j] = lastCell;
+			if(maxCell[j] > lastCell) maxCell[j] = lastCell;
+		}
+
+		//Cells next to each other along x are often next to each other in Morton order, so x is searched innermost
+		unsigned int cell[3];
+		unsigned int j = numCells;
+		unsigned int endKey = ~0u;
+		for(cell[2] = minCell[2]; cell[2] <= maxCell[2]; cell[2]++)
+		{
+			for(cell[1] = minCell[1]; cell[1] <= maxCell[1]; cell[1]++)
+			{
+				for(cell[0] = minCell[0]; cell[0] <= maxCell[0]; cell[0]++)
+				{
+					//The cell and every cell it contains are one range of the sorted cells,
+					//And the cells containing it have the same Morton code at a lesser depth so they come before the range
+					unsigned int key = LinearOctTree_GetKey(cell, depth);
+					if((key & ~15u) == endKey)
+					{
+						//The range follows the last one, so only the cells containing this one lie between them
+						while(j < numCells && cells[j].key < key) j++;
+					}
+					else
+					{
+						j = LinearOctTree_FindFirstCell(cells, numCells, key, i);
+					}
+					endKey = (key & ~15u) + (1u << (3 * (LinearOctTree_maxDepth - depth) + 4));
+
+					for(; j < numCells && cells[j].key < endKey; j++)
+					{
+						//Proxies at the same depth both find each other, so the pair is left to the earlier one
+						if(j <= i && (cells[j].key & 15u) == depth) continue;
+
+						LinearOctTree_Proxy* other = proxies + cells[j].proxyIndex;
+						if(proxy->min[0] <= other->max[0] && proxy->max[0] >= other->min[0] &&
+							proxy->min[1] <= other->max[1] && proxy->max[1] >= other->min[1] &&
+							proxy->min[2] <= other->max[2] && proxy->max[2] >= other->min[2])
+						{
+							pair.obj1 = proxy->obj;
+							pair.obj2 = other->obj;
+							DynamicArray_Append(pairs, &pair);
+						}
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,235 @@
+#ifndef LINEAROCTTREE_H
+#define LINEAROCTTREE_H
+
+#include "GObject.h"		//The data the linear oct tree will contain
+#include "DynamicArray.h"
+
+//The world space bounds of an object's collider and the cell of the tree it was placed in by the last update
+typedef struct LinearOctTree_Proxy
+{
+	GObject* obj;				//The object being bounded
+	float min[3];				//Minimum bound on each axis
+	float max[3];				//Maximum bound on each axis
+
+	unsigned int depth;			//Depth of the proxy's cell, the root has a depth of 0
+	unsigned int cell[3];		//Coordinates of the proxy's cell among the cells at it's depth
+} LinearOctTree_Proxy;
+
+//A proxy's cell, identified by a key which orders every cell before the cells it contains
+typedef struct LinearOctTree_Cell
+{
+	unsigned int key;			//Morton code of the cell's minimum corner at the deepest level, shifted left 4 bits and combined with the cell's depth
+	unsigned int proxyIndex;	//Index of the proxy placed in the cell
+} LinearOctTree_Cell;
+
+//Two objects whose bounds overlap
+typedef struct LinearOctTree_Pair
+{
+	GObject* obj1;
+	GObject* obj2;
+} LinearOctTree_Pair;
+
+//An oct tree stored as the sorted array of the cells it's objects are placed in, with no nodes.
+//It is rebuilt from scratch every update, which costs the same however far the objects moved.
+//
+//Each object is placed by the center of it's bounds in the deepest cell at least as large as it's bounds,
+//So an object never reaches more than half a cell past the cell it is placed in.
+//The cells are sorted by Morton code, so a cell and every cell it contains are one contiguous range of the array,
+//And the objects an object may overlap are found in the ranges of the few cells at it's depth which it can reach.
+typedef struct LinearOctTree
+{
+	DynamicArray* proxies;			//The bounds of every object, those placed in a cell by the last update followed by those added since
+	DynamicArray* cells;			//The cell of every placed proxy, sorted by key after an update
+	DynamicArray* sortedCells;		//Scratch storage each radix sort pass scatters the cells into
+	DynamicArray* pairs;			//The pairs of objects with overlapping bounds found by the last update
+
+	float rootMin[3];				//Minimum corner of the root cell, which bounds the center of every proxy
+	float rootSize;					//Length of each side of the root cell
+	unsigned int occupiedDepths;	//Bit n is set if the last update placed a proxy in a cell at depth n
+
+	unsigned int numChunks;			//Number of chunks the scratch storage below is allocated for
+	unsigned int* digitCounts;		//Count of each digit in each chunk for the current radix sort pass, then the index each chunk scatters each digit to
+	DynamicArray** chunkPairs;		//The pairs found by each chunk of cells, merged into pairs in chunk order
+	unsigned int radixShift;		//Number of bits the digit of the current radix sort pass is shifted by
+} LinearOctTree;
+
+//Internal members
+static const unsigned int LinearOctTree_maxDepth = 9;			//Depth of the smallest cells, 3 bits per level so the Morton code and depth fit a key
+static const unsigned int LinearOctTree_radixBits = 8;			//Bits of the key sorted by each radix sort pass
+static const unsigned int LinearOctTree_proxiesPerJob = 256;	//Proxies or cells handled by each job, enough to outweigh the cost of taking a job
+
+//Internal functions
+
+///
+//Spreads the lowest 10 bits of a number out so there are two 0 bits between each of them
+//
+//Parameters:
+//	bits: The bits to spread
+//
+//Returns:
+//	The spread bits, bit n of the number is moved to bit 3n
+static unsigned int LinearOctTree_SpreadBits(unsigned int bits);
+
+///
+//Gets the key of a cell
+//
+//Parameters:
+//	cell: Coordinates of the cell among the cells at it's depth
+//	depth: The depth of the cell
+//
+//Returns:
+//	The key of the cell
+static unsigned int LinearOctTree_GetKey(const unsigned int* cell, unsigned int depth);
+
+///
+//Finds the first sorted cell with a key no less than a given key.
+//The search gallops outwards from a hint before searching the last step by bisection,
+//So it takes few steps when the cell is close to the hint.
+//
+//Parameters:
+//	cells: The cells sorted by key
+//	numCells: The number of cells
+//	key: The key to search for
+//	hint: The index of a cell near the cell being searched for, less than numCells
+//
+//Returns:
+//	The index of the first cell with a key no less than key, numCells if there is none
+static unsigned int LinearOctTree_FindFirstCell(const LinearOctTree_Cell* cells, unsigned int numCells, unsigned int key, unsigned int hint);
+
+///
+//Makes sure a linear oct tree has scratch storage for a number of chunks
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree
+//	numChunks: The number of chunks the scratch storage is needed for
+static void LinearOctTree_ReserveChunks(LinearOctTree* tree, unsigned int numChunks);
+
+///
+//Gets the world space bounds of the objects of a chunk of proxies.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the linear oct tree being updated
+//	first: The index of the first proxy of the chunk
+//	end: One past the index of the last proxy of the chunk
+//	threadIndex: Unused
+static void LinearOctTree_UpdateProxies(void* data, unsigned int first, unsigned int end, unsigned int threadIndex);
+
+///
+//Places each proxy of a chunk in a cell and stores the cell at the proxy's index.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the linear oct tree being updated
+//	first: The index of the first proxy of the chunk
+//	end: One past the index of the last proxy of the chunk
+//	threadIndex: Unused
+static void LinearOctTree_PlaceProxies(void* data, unsigned int first, unsigned int end, unsigned int threadIndex);
+
+///
+//Counts the digits of the current radix sort pass in a chunk of cells.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the linear oct tree being sorted
+//	first: The index of the first cell of the chunk
+//	end: One past the index of the last cell of the chunk
+//	threadIndex: Unused
+static void LinearOctTree_CountDigits(void* data, unsigned int first, unsigned int end, unsigned int threadIndex);
+
+///
+//Scatters a chunk of cells into the sorted cells by the digit of the current radix sort pass.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the linear oct tree being sorted
+//	first: The index of the first cell of the chunk
+//	end: One past the index of the last cell of the chunk
+//	threadIndex: Unused
+static void LinearOctTree_ScatterCells(void* data, unsigned int first, unsigned int end, unsigned int threadIndex);
+
+///
+//Sorts the cells of a linear oct tree by key with a least significant digit radix sort,
+//Spreading the counting and scattering of each pass across the threads of the job manager.
+//Cells with equal keys keep the order of their proxies.
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to sort the cells of
+static void LinearOctTree_SortCells(LinearOctTree* tree);
+
+///
+//Finds the pairs of objects with overlapping bounds which the proxy of each cell in a chunk of sorted cells is responsible for.
+//A proxy is responsible for it's pairs with the proxies in deeper cells, and with the proxies after it in cells at it's depth.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the linear oct tree being updated
+//	first: The index of the first sorted cell of the chunk
+//	end: One past the index of the last sorted cell of the chunk
+//	threadIndex: Unused
+static void LinearOctTree_FindPairs(void* data, unsigned int first, unsigned int end, unsigned int threadIndex);
+
+//Functions
+
+///
+//Allocates memory for a linear oct tree
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized linear oct tree
+LinearOctTree* LinearOctTree_Allocate(void);
+
+///
+//Initializes a linear oct tree with no objects
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to initialize
+void LinearOctTree_Initialize(LinearOctTree* tree);
+
+///
+//Frees the data allocated by a linear oct tree.
+//Does not free any of the objects contained within the linear oct tree!
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to free
+void LinearOctTree_Free(LinearOctTree* tree);
+
+///
+//Adds a game object to the linear oct tree, the next update places it in a cell
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to add a game object to
+//	obj: A pointer to the game object to add (Must have collider attached)
+void LinearOctTree_Add(LinearOctTree* tree, GObject* obj);
+
+///
+//Removes a game object from the linear oct tree.
+//The cells stay sorted, so the tree can still be queried before the next update.
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to remove the game object from
+//	obj: A pointer to the game object to remove
+void LinearOctTree_Remove(LinearOctTree* tree, GObject* obj);
+
+///
+//Rebuilds a linear oct tree from the current bounds of it's objects and finds every pair of objects whose bounds overlap.
+//The root cell is fit to the objects, the objects are placed in cells and the cells are sorted and searched,
+//Each step spread across the threads of the job manager. Pairs are found in the same order whichever number of threads is used.
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to update
+void LinearOctTree_Update(LinearOctTree* tree);
+
+///
+//Finds every game object in a linear oct tree whose bounds as of the last update overlap a box.
+//The box is searched for like a proxy placed at the depth of the smallest cells at least as large as it,
+//Which finds the proxies at that depth or deeper, while the proxies at each shallower depth are looked up in the few cells of that depth near the box.
+//Objects added since the last update have no cell yet, so each of them is tested.
+//
+//Parameters:
+//	tree: A pointer to the linear oct tree to query
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the overlapping game objects to
+void LinearOctTree_QueryBox(LinearOctTree* tree, const float* min, const float* max, DynamicArray* results);
+
+#endif
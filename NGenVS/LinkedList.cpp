@@ -23,22 +23,26 @@ void LinkedList_Initialize(LinkedList* list)
 	list->head = NULL;
 	list->tail = NULL;
 	list->size = 0;
+
+	list->freeNodes = NULL;
+	list->slabs = NULL;
+	list->capacity = 0;
 }
 
 
 ///
-//Frees resources taken by a linked list
+//Frees resources taken by a linked list, including every block of nodes it allocated
 //Parameters:
 //	list: The linked list to free
 void LinkedList_Free(LinkedList* list)
 {
-	struct LinkedList_Node* current = list->head;
-
-	while (current != NULL)
+	//Every node belongs to one of the list's blocks
+	struct LinkedList_Node* slab = list->slabs;
+	while (slab != NULL)
 	{
-		struct LinkedList_Node* next = current->next;
-		LinkedList_Node_Free(current);
-		current = next;
+		struct LinkedList_Node* next = slab->next;
+		free(slab);
+		slab = next;
 	}
 
 	free(list);
@@ -102,7 +106,7 @@ struct LinkedList_Node* LinkedList_SearchByIndex(LinkedList* list, unsigned int
 //	data: The data to append with
 void LinkedList_Append(LinkedList* list, void* data)
 {
-	struct LinkedList_Node* node = LinkedList_Node_Allocate();
+	struct LinkedList_Node* node = LinkedList_Node_Allocate(list);
 	LinkedList_Node_Initialize(node, data);
 
 	//Case 1: There is no head
@@ -129,7 +133,7 @@ void LinkedList_Append(LinkedList* list, void* data)
 //	data: The data to prepend with
 void LinkedList_Prepend(LinkedList* list, void* data)
 {
-	struct LinkedList_Node* node = LinkedList_Node_Allocate();
+	struct LinkedList_Node* node = LinkedList_Node_Allocate(list);
 	LinkedList_Node_Initialize(node, data);
 
 	if (list->size == 0)
@@ -162,7 +166,7 @@ void LinkedList_Insert(LinkedList* list, unsigned int index, void* data)
 		LinkedList_Prepend(list, data);
 	else
 	{
-		struct LinkedList_Node* node = LinkedList_Node_Allocate();
+		struct LinkedList_Node* node = LinkedList_Node_Allocate(list);
 		LinkedList_Node_Initialize(node, data);
 
 		struct LinkedList_Node* current = list->head;
@@ -242,7 +246,7 @@ void LinkedList_RemoveNode(LinkedList* list, struct LinkedList_Node* nodeToRemov
 	{
 		list->head = NULL;
 		list->tail = NULL;
-		LinkedList_Node_Free(nodeToRemove);
+		LinkedList_Node_Free(list, nodeToRemove);
 	}
 	else
 	{
@@ -250,40 +254,37 @@ void LinkedList_RemoveNode(LinkedList* list, struct LinkedList_Node* nodeToRemov
 		{
 			list->head = nodeToRemove->next;
 			list->head->previous = NULL;
-			LinkedList_Node_Free(nodeToRemove);
+			LinkedList_Node_Free(list, nodeToRemove);
 		}
 		else if (nodeToRemove == list->tail)
 		{
 			list->tail = nodeToRemove->previous;
 			list->tail->next = NULL;
-			LinkedList_Node_Free(nodeToRemove);
+			LinkedList_Node_Free(list, nodeToRemove);
 		}
 		else
 		{
 			nodeToRemove->next->previous = nodeToRemove->previous;
 			nodeToRemove->previous->next = nodeToRemove->next;
-			LinkedList_Node_Free(nodeToRemove);
+			LinkedList_Node_Free(list, nodeToRemove);
 		}
 	}
 	list->size--;
 }
 
 ///
-//Clears a list of all nodes
+//Clears a list of all nodes, keeping them on the list's free list for reuse
 //Does not delete the data in the nodes!
 //
 //Parameters:
 //	list: The linked list to clear
 void LinkedList_Clear(LinkedList* list)
 {
-	LinkedList_Node* current = list->head;
-	LinkedList_Node* next = NULL;
-	while(current != NULL)
+	//The nodes are already linked through their next pointers, so they join the free list all at once
+	if(list->head != NULL)
 	{
-		next = current->next;
-
-		LinkedList_Node_Free(current);
-		current = next;
+		list->tail->next = list->freeNodes;
+		list->freeNodes = list->head;
 	}
 
 	list->head = NULL;
@@ -294,13 +295,49 @@ void LinkedList_Clear(LinkedList* list)
 //Internals
 
 ///
-//Allocates a Node for a Linked List
+//Allocates a block of nodes for a linked list and puts them on it's free list.
+//
+//Parameters:
+//	list: The list to allocate a block of nodes for
+static void LinkedList_AllocateSlab(LinkedList* list)
+{
+	//Each block doubles the capacity of the list, so a growing list allocates few blocks
+	unsigned int numNodes = list->capacity;
+	if(numNodes < LinkedList_minSlabNodes) numNodes = LinkedList_minSlabNodes;
+	if(numNodes > LinkedList_maxSlabNodes) numNodes = LinkedList_maxSlabNodes;
+
+	//The first node of the block links it to the list's other blocks
+	struct LinkedList_Node* slab = (struct LinkedList_Node*)malloc(sizeof(struct LinkedList_Node) * (numNodes + 1));
+	slab->next = list->slabs;
+	list->slabs = slab;
+
+	for(unsigned int i = 1; i < numNodes; i++)
+	{
+		slab[i].next = slab + i + 1;
+	}
+	slab[numNodes].next = list->freeNodes;
+	list->freeNodes = slab + 1;
+
+	list->capacity += numNodes;
+}
+
+///
+//Takes a Node for a Linked List from it's free list, allocating a block of nodes if it is empty
+//
+//Parameters:
+//	list: The list the node is for
 //
 //Returns:
-//	Newly allocated Pointer to linked list node
-static struct LinkedList_Node* LinkedList_Node_Allocate(void)
+//	Pointer to an uninitialized linked list node
+static struct LinkedList_Node* LinkedList_Node_Allocate(LinkedList* list)
 {
-	struct LinkedList_Node* node = (struct LinkedList_Node*)malloc(sizeof(struct LinkedList_Node));
+	if(list->freeNodes == NULL)
+	{
+		LinkedList_AllocateSlab(list);
+	}
+
+	struct LinkedList_Node* node = list->freeNodes;
+	list->freeNodes = node->next;
 	return node;
 }
 
@@ -318,12 +355,14 @@ static void LinkedList_Node_Initialize(struct LinkedList_Node* node, void* data)
 }
 
 ///
-//Frees resources being used by a Linked List node
+//Returns a node to the free list of the Linked List it was taken from
 //Does NOT free the data in the node. If the data is on the heap, delete before this!
 //
 //Parameters:
+//	list: The list the node was taken from
 //	node: The node to free
-static void LinkedList_Node_Free(struct LinkedList_Node* node)
+static void LinkedList_Node_Free(LinkedList* list, struct LinkedList_Node* node)
 {
-	free(node);
+	node->next = list->freeNodes;
+	list->freeNodes = node;
 }
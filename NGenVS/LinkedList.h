@@ -8,21 +8,40 @@ struct LinkedList_Node
 	struct LinkedList_Node* previous;
 };
 
+//A doubly linked list whose nodes are allocated in blocks owned by the list.
+//Removed nodes are kept on a free list and reused by the next insertions,
+//So a list which is cleared and refilled every frame stops allocating once it has reached it's largest size.
 typedef struct LinkedList
 {
 	struct LinkedList_Node* head;
 	struct LinkedList_Node* tail;
 	unsigned int size;
+
+	struct LinkedList_Node* freeNodes;	//Nodes not in the list, linked through their next pointers
+	struct LinkedList_Node* slabs;		//Blocks of nodes allocated by the list, linked through the next pointer of each block's first node
+	unsigned int capacity;				//Number of nodes in the list's blocks, not counting the first node of each block
 } LinkedList;
 
 //Internals
+static const unsigned int LinkedList_minSlabNodes = 2;		//Nodes in the first block a list allocates, each block after holds as many nodes as all blocks before it
+static const unsigned int LinkedList_maxSlabNodes = 1024;	//Most nodes in a single block
 
 ///
-//Allocates a Node for a Linked List
+//Allocates a block of nodes for a linked list and puts them on it's free list.
+//
+//Parameters:
+//	list: The list to allocate a block of nodes for
+static void LinkedList_AllocateSlab(LinkedList* list);
+
+///
+//Takes a Node for a Linked List from it's free list, allocating a block of nodes if it is empty
+//
+//Parameters:
+//	list: The list the node is for
 //
 //Returns:
-//	Newly allocated Pointer to linked list node
-static struct LinkedList_Node* LinkedList_Node_Allocate(void);
+//	Pointer to an uninitialized linked list node
+static struct LinkedList_Node* LinkedList_Node_Allocate(LinkedList* list);
 
 ///
 //Initializes a new node for a linked list
@@ -33,11 +52,12 @@ static struct LinkedList_Node* LinkedList_Node_Allocate(void);
 static void LinkedList_Node_Initialize(struct LinkedList_Node* node, void* data);
 
 ///
-//Frees resources being used by a Linked List node
+//Returns a node to the free list of the Linked List it was taken from
 //
 //Parameters:
+//	list: The list the node was taken from
 //	node: The node to free
-static void LinkedList_Node_Free(struct LinkedList_Node* node);
+static void LinkedList_Node_Free(LinkedList* list, struct LinkedList_Node* node);
 
 
 //Functions
@@ -55,7 +75,7 @@ LinkedList* LinkedList_Allocate(void);
 void LinkedList_Initialize(LinkedList* list);
 
 ///
-//Frees resources taken by a linked list
+//Frees resources taken by a linked list, including every block of nodes it allocated
 //Parameters:
 //	list: The linked list to free
 void LinkedList_Free(LinkedList* list);
@@ -142,7 +162,7 @@ void LinkedList_RemoveAllValues(LinkedList* list, void* data);
 void LinkedList_RemoveNode(LinkedList* list, struct LinkedList_Node* node);
 
 ///
-//Clears a list of all nodes
+//Clears a list of all nodes, keeping them on the list's free list for reuse
 //Does not delete the data in the nodes!
 //
 //Parameters:
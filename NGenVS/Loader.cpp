@@ -111,33 +111,32 @@ Mesh* Loader_LoadOBJFile(const char* fPath)
 		//If we are reading Vertices, Texture Coordinates, or Normals
 		if (type[0] == 'v')
 		{
+			//Each attribute is read straight into the end of it's array
 			//Normals
 			if (type[1] == 'n')
 			{
-				struct VertexAttr3 vn;
-				fscanf(fp, " %f %f %f", &vn.x, &vn.y, &vn.z);
-				DynamicArray_Append(normals, &vn);
+				struct VertexAttr3* vn = (struct VertexAttr3*)DynamicArray_Emplace(normals);
+				fscanf(fp, " %f %f %f", &vn->x, &vn->y, &vn->z);
 			}
 			//Texture coordinates
 			else if (type[1] == 't')
 			{
-				struct VertexAttr2 vt;
-				fscanf(fp, " %f %f", &vt.x, &vt.y);
-				DynamicArray_Append(texCoords, &vt);
+				struct VertexAttr2* vt = (struct VertexAttr2*)DynamicArray_Emplace(texCoords);
+				fscanf(fp, " %f %f", &vt->x, &vt->y);
 			}
 			//Vertices
 			else
 			{
-				struct VertexAttr3 v;
-				fscanf(fp, " %f %f %f", &v.x, &v.y, &v.z);
-				DynamicArray_Append(vertices, &v);
+				struct VertexAttr3* v = (struct VertexAttr3*)DynamicArray_Emplace(vertices);
+				fscanf(fp, " %f %f %f", &v->x, &v->y, &v->z);
 			}
 		}
 		//Else if we are reading Face information
 		else if (type[0] == 'f')
 		{
 			int indices[3];
-			struct Triangle t;
+			//The triangle is built in place at the end of the array of triangles
+			struct Triangle* t = (struct Triangle*)DynamicArray_Emplace(triangles);
 			struct Vertex v;
 			struct VertexAttr3* vAtt3;
 			struct VertexAttr2* vAtt2;
@@ -167,11 +166,9 @@ Mesh* Loader_LoadOBJFile(const char* fPath)
 				}
 
 				//Store vertex in triangle t
-				*(&(t.a) + i) = v;
+				*(&(t->a) + i) = v;
 
 			}
-			//And add to triangles array
-			DynamicArray_Append(triangles, &t);
 		}
 		//Else if we are reading a comment
 		else if (type[0] == '#')
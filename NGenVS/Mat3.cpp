@@ -0,0 +1,147 @@
+#include <stdio.h>
+
+#include "Mat3.h"
+#include "SIMDMath.h"
+
+///
+//Initializes a Mat3_Storage binding it's Matrix header to it's value and setting the value to identity
+//
+//Parameters:
+//	storage: The storage to initialize
+//
+//Returns:
+//	A pointer to the bound Matrix header
+Matrix* Mat3_Storage_Initialize(Mat3_Storage* storage)
+{
+	Mat3_INIT_MATRIX_VIEW(storage->matrix, storage->value);
+	Mat3_ToIdentity(&storage->value);
+	return &storage->matrix;
+}
+
+///
+//Transforms a Mat3 into the 3x3 identity matrix
+//
+//Parameters:
+//	mat: The Mat3 to transform
+void Mat3_ToIdentity(Mat3* mat)
+{
+	for(int i = 0; i < 9; i++)
+	{
+		mat->components[i] = 0.0f;
+	}
+	mat->components[0] = mat->components[4] = mat->components[8] = 1.0f;
+}
+
+///
+//Copies a Mat3
+//
+//Parameters:
+//	dest: The destination of the copy
+//	src: The Mat3 to copy
+void Mat3_Copy(Mat3* dest, const Mat3* src)
+{
+	*dest = *src;
+}
+
+///
+//Scales every component of a Mat3 by a scalar
+//
+//Parameters:
+//	mat: The Mat3 to scale
+//	scalarValue: The scale factor
+void Mat3_Scale(Mat3* mat, const float scalarValue)
+{
+	for(int i = 0; i < 9; i++)
+	{
+		mat->components[i] *= scalarValue;
+	}
+}
+
+///
+//Gets the transpose of a Mat3
+//
+//Parameters:
+//	dest: The destination of the transpose (may not alias src)
+//	src: The Mat3 to get the transpose of
+void Mat3_GetTranspose(Mat3* dest, const Mat3* src)
+{
+	for(int row = 0; row < 3; row++)
+	{
+		for(int col = 0; col < 3; col++)
+		{
+			dest->components[col * 3 + row] = src->components[row * 3 + col];
+		}
+	}
+}
+
+///
+//Transposes a Mat3 in place
+//
+//Parameters:
+//	mat: The Mat3 to transpose
+void Mat3_Transpose(Mat3* mat)
+{
+	Mat3 copy = *mat;
+	Mat3_GetTranspose(mat, &copy);
+}
+
+///
+//Gets the product of two Mat3s
+//
+//Parameters:
+//	dest: The destination of the product (may alias RHSMatrix but not LHSMatrix)
+//	LHSMatrix: The left hand side matrix
+//	RHSMatrix: The right hand side matrix
+void Mat3_GetProduct(Mat3* dest, const Mat3* LHSMatrix, const Mat3* RHSMatrix)
+{
+	SIMDMath_GetProductMatrix3(dest->components, LHSMatrix->components, RHSMatrix->components);
+}
+
+///
+//Multiplies a Mat3 onto another, transforming the latter.
+//
+//Parameters:
+//	LHSMatrix: Left hand side matrix (Will not be altered)
+//	RHSMatrix: Right hand side matrix (Destination of product)
+void Mat3_Transform(const Mat3* LHSMatrix, Mat3* RHSMatrix)
+{
+	//The kernel reads the whole right hand side before writing the product over it
+	SIMDMath_GetProductMatrix3(RHSMatrix->components, LHSMatrix->components, RHSMatrix->components);
+}
+
+///
+//Gets the product of a Mat3 acting upon a Vec3
+//
+//Parameters:
+//	dest: The destination of the product (may not alias vec)
+//	LHSMatrix: The left hand side matrix operand
+//	vec: The right hand side Vec3 operand
+void Mat3_GetProductVec3(Vec3* dest, const Mat3* LHSMatrix, const Vec3* vec)
+{
+	const float* m = LHSMatrix->components;
+	const float* v = vec->components;
+	dest->components[0] = m[0] * v[0] + m[1] * v[1] + m[2] * v[2];
+	dest->components[1] = m[3] * v[0] + m[4] * v[1] + m[5] * v[2];
+	dest->components[2] = m[6] * v[0] + m[7] * v[1] + m[8] * v[2];
+}
+
+///
+//Multiplies a Mat3 onto a Vec3, transforming the Vec3
+//
+//Parameters:
+//	LHSMatrix: The left hand side operand, the matrix
+//	vec: The right hand side operand and the destination, the Vec3
+void Mat3_TransformVec3(const Mat3* LHSMatrix, Vec3* vec)
+{
+	SIMDMath_TransformVector3(LHSMatrix->components, vec->components);
+}
+
+///
+//Prints out the contents of a Mat3
+//
+//Parameters:
+//	mat: The Mat3 to print
+void Mat3_Print(const Mat3* mat)
+{
+	Matrix_PrintArray(mat->components, 3, 3);
+}
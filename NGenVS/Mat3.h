@@ -0,0 +1,122 @@
+#ifndef MAT3_H
+#define MAT3_H
+
+#include "Matrix.h"
+#include "Vec3.h"
+
+///
+//A Mat3 is a fixed size, row major 3x3 matrix stored by value.
+//Unlike a Matrix it owns it's components inline and never touches the heap.
+typedef struct Mat3
+{
+	float components[9];
+} Mat3;
+
+///
+//A Matrix header bundled with the Mat3 it views.
+//Embedding one of these lets a structure hand out a Matrix* without a separate heap allocation.
+typedef struct Mat3_Storage
+{
+	Matrix matrix;
+	Mat3 value;
+} Mat3_Storage;
+
+//Views the components of a 3x3 Matrix as a Mat3
+#define Mat3_FROM_MATRIX( matPtr ) ((Mat3*)(matPtr)->components)
+
+//Binds a Matrix header to the components of a Mat3 so the Matrix_* functions can operate on it in place
+#define Mat3_INIT_MATRIX_VIEW( mat , mat3 ) \
+	mat.numRows = 3; \
+	mat.numColumns = 3; \
+	mat.components = (mat3).components;
+
+///
+//Initializes a Mat3_Storage binding it's Matrix header to it's value and setting the value to identity
+//
+//Parameters:
+//	storage: The storage to initialize
+//
+//Returns:
+//	A pointer to the bound Matrix header
+Matrix* Mat3_Storage_Initialize(Mat3_Storage* storage);
+
+///
+//Transforms a Mat3 into the 3x3 identity matrix
+//
+//Parameters:
+//	mat: The Mat3 to transform
+void Mat3_ToIdentity(Mat3* mat);
+
+///
+//Copies a Mat3
+//
+//Parameters:
+//	dest: The destination of the copy
+//	src: The Mat3 to copy
+void Mat3_Copy(Mat3* dest, const Mat3* src);
+
+///
+//Scales every component of a Mat3 by a scalar
+//
+//Parameters:
+//	mat: The Mat3 to scale
+//	scalarValue: The scale factor
+void Mat3_Scale(Mat3* mat, const float scalarValue);
+
+///
+//Gets the transpose of a Mat3
+//
+//Parameters:
+//	dest: The destination of the transpose (may not alias src)
+//	src: The Mat3 to get the transpose of
+void Mat3_GetTranspose(Mat3* dest, const Mat3* src);
+
+///
+//Transposes a Mat3 in place
+//
+//Parameters:
+//	mat: The Mat3 to transpose
+void Mat3_Transpose(Mat3* mat);
+
+///
+//Gets the product of two Mat3s
+//
+//Parameters:
+//	dest: The destination of the product (may alias RHSMatrix but not LHSMatrix)
+//	LHSMatrix: The left hand side matrix
+//	RHSMatrix: The right hand side matrix
+void Mat3_GetProduct(Mat3* dest, const Mat3* LHSMatrix, const Mat3* RHSMatrix);
+
+///
+//Multiplies a Mat3 onto another, transforming the latter.
+//
+//Parameters:
+//	LHSMatrix: Left hand side matrix (Will not be altered)
+//	RHSMatrix: Right hand side matrix (Destination of product)
+void Mat3_Transform(const Mat3* LHSMatrix, Mat3* RHSMatrix);
+
+///
+//Gets the product of a Mat3 acting upon a Vec3
+//
+//Parameters:
+//	dest: The destination of the product (may not alias vec)
+//	LHSMatrix: The left hand side matrix operand
+//	vec: The right hand side Vec3 operand
+void Mat3_GetProductVec3(Vec3* dest, const Mat3* LHSMatrix, const Vec3* vec);
+
+///
+//Multiplies a Mat3 onto a Vec3, transforming the Vec3
+//
+//Parameters:
+//	LHSMatrix: The left hand side operand, the matrix
+//	vec: The right hand side operand and the destination, the Vec3
+void Mat3_TransformVec3(const Mat3* LHSMatrix, Vec3* vec);
+
+///
+//Prints out the contents of a Mat3
+//
+//Parameters:
+//	mat: The Mat3 to print
+void Mat3_Print(const Mat3* mat);
+
+#endif
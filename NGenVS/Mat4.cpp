@@ -0,0 +1,61 @@
+#include "Mat4.h"
+#include "SIMDMath.h"
+
+///
+//Transforms a Mat4 into the 4x4 identity matrix
+//
+//Parameters:
+//	mat: The Mat4 to transform
+void Mat4_ToIdentity(Mat4* mat)
+{
+	for(int i = 0; i < 16; i++)
+	{
+		mat->components[i] = 0.0f;
+	}
+	mat->components[0] = mat->components[5] = mat->components[10] = mat->components[15] = 1.0f;
+}
+
+///
+//Copies a Mat4
+//
+//Parameters:
+//	dest: The destination of the copy
+//	src: The Mat4 to copy
+void Mat4_Copy(Mat4* dest, const Mat4* src)
+{
+	*dest = *src;
+}
+
+///
+//Gets the product of two Mat4s
+//
+//Parameters:
+//	dest: The destination of the product (may alias RHSMatrix but not LHSMatrix)
+//	LHSMatrix: The left hand side matrix
+//	RHSMatrix: The right hand side matrix
+void Mat4_GetProduct(Mat4* dest, const Mat4* LHSMatrix, const Mat4* RHSMatrix)
+{
+	SIMDMath_GetProductMatrix4(dest->components, LHSMatrix->components, RHSMatrix->components);
+}
+
+///
+//Multiplies a Mat4 onto another, transforming the latter.
+//
+//Parameters:
+//	LHSMatrix: Left hand side matrix (Will not be altered)
+//	RHSMatrix: Right hand side matrix (Destination of product)
+void Mat4_Transform(const Mat4* LHSMatrix, Mat4* RHSMatrix)
+{
+	//The kernel reads the whole right hand side before writing the product over it
+	SIMDMath_GetProductMatrix4(RHSMatrix->components, LHSMatrix->components, RHSMatrix->components);
+}
+
+///
+//Prints out the contents of a Mat4
+//
+//Parameters:
+//	mat: The Mat4 to print
+void Mat4_Print(const Mat4* mat)
+{
+	Matrix_PrintArray(mat->components, 4, 4);
+}
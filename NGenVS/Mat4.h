@@ -0,0 +1,62 @@
+#ifndef MAT4_H
+#define MAT4_H
+
+#include "Matrix.h"
+
+///
+//A Mat4 is a fixed size, row major 4x4 matrix stored by value.
+//Unlike a Matrix it owns it's components inline and never touches the heap.
+typedef struct Mat4
+{
+	float components[16];
+} Mat4;
+
+//Views the components of a 4x4 Matrix as a Mat4
+#define Mat4_FROM_MATRIX( matPtr ) ((Mat4*)(matPtr)->components)
+
+//Binds a Matrix header to the components of a Mat4 so the Matrix_* functions can operate on it in place
+#define Mat4_INIT_MATRIX_VIEW( mat , mat4 ) \
+	mat.numRows = 4; \
+	mat.numColumns = 4; \
+	mat.components = (mat4).components;
+
+///
+//Transforms a Mat4 into the 4x4 identity matrix
+//
+//Parameters:
+//	mat: The Mat4 to transform
+void Mat4_ToIdentity(Mat4* mat);
+
+///
+//Copies a Mat4
+//
+//Parameters:
+//	dest: The destination of the copy
+//	src: The Mat4 to copy
+void Mat4_Copy(Mat4* dest, const Mat4* src);
+
+///
+//Gets the product of two Mat4s
+//
+//Parameters:
+//	dest: The destination of the product (may alias RHSMatrix but not LHSMatrix)
+//	LHSMatrix: The left hand side matrix
+//	RHSMatrix: The right hand side matrix
+void Mat4_GetProduct(Mat4* dest, const Mat4* LHSMatrix, const Mat4* RHSMatrix);
+
+///
+//Multiplies a Mat4 onto another, transforming the latter.
+//
+//Parameters:
+//	LHSMatrix: Left hand side matrix (Will not be altered)
+//	RHSMatrix: Right hand side matrix (Destination of product)
+void Mat4_Transform(const Mat4* LHSMatrix, Mat4* RHSMatrix);
+
+///
+//Prints out the contents of a Mat4
+//
+//Parameters:
+//	mat: The Mat4 to print
+void Mat4_Print(const Mat4* mat);
+
+#endif
@@ -3,6 +3,7 @@
 #include <math.h>
 
 #include "Matrix.h"
+#include "SIMDMath.h"
 
 ///
 //Allocates memory for a new matrix
@@ -582,6 +583,21 @@ void Matrix_GetInverse(Matrix* dest, const Matrix* matrix)
 //	LHSNumCols: Number of columns in the left hand side matrix (Must be equal to the number of rows in the right hand side matrix)
 void Matrix_TransformMatrixArray(const float* LHSMatrix, float* RHSMatrix, const int LHSNumRows, const int LHSNumCols, const int RHSNumCols)
 {
+	//The specialized square kernels may write their product over the right hand side
+	if (LHSNumRows == LHSNumCols && LHSNumCols == RHSNumCols)
+	{
+		if (LHSNumRows == 3)
+		{
+			SIMDMath_GetProductMatrix3(RHSMatrix, LHSMatrix, RHSMatrix);
+			return;
+		}
+		if (LHSNumRows == 4)
+		{
+			SIMDMath_GetProductMatrix4(RHSMatrix, LHSMatrix, RHSMatrix);
+			return;
+		}
+	}
+
 	//Create a copy of the right hand side matrix
 	float* RHSCopy = (float*)malloc(sizeof(float) * LHSNumCols * RHSNumCols);
 	//float RHSCopy[LHSNumCols * RHSNumCols];
@@ -621,6 +637,21 @@ void Matrix_TransformMatrix(const Matrix* LHSMatrix, Matrix* RHSMatrix)
 //	LHSNumCols: The number of columns in the left hand side matrix
 void Matrix_GetProductMatrixArray(float* destMatrix, const float* LHSMatrix, const float* RHSMatrix, const int LHSNumRows, const int LHSNumCols, const int RHSNumCols)
 {
+	//Use the specialized kernels for square 3x3 and 4x4 products
+	if (LHSNumRows == LHSNumCols && LHSNumCols == RHSNumCols)
+	{
+		if (LHSNumRows == 3)
+		{
+			SIMDMath_GetProductMatrix3(destMatrix, LHSMatrix, RHSMatrix);
+			return;
+		}
+		if (LHSNumRows == 4)
+		{
+			SIMDMath_GetProductMatrix4(destMatrix, LHSMatrix, RHSMatrix);
+			return;
+		}
+	}
+
 	for (int rows = 0; rows < LHSNumRows; rows++)
 	{
 		for (int cols = 0; cols < RHSNumCols; cols++)
@@ -662,6 +693,21 @@ void Matrix_GetProductMatrix(Matrix* destMatrix, const Matrix* LHSMatrix, const
 //	LHSNumCols: The number of rows in the Right Hand Side matrix
 void Matrix_TransformVectorArray(const float* LHSMatrix, float* RHSVector, const int LHSNumRows, const int LHSNumCols)
 {
+	//Use the specialized kernels for square 3x3 and 4x4 transformations
+	if (LHSNumRows == LHSNumCols)
+	{
+		if (LHSNumRows == 3)
+		{
+			SIMDMath_TransformVector3(LHSMatrix, RHSVector);
+			return;
+		}
+		if (LHSNumRows == 4)
+		{
+			SIMDMath_TransformVector4(LHSMatrix, RHSVector);
+			return;
+		}
+	}
+
 	//float RHSCopy[LHSNumCols];
 	float* RHSCopy = (float*)malloc(sizeof(float)* LHSNumCols);
 
@@ -32,74 +32,183 @@ ObjectBuffer ObjectManager_GetObjectBuffer(void)
 //Updates the internal state of all contained objects.
 void ObjectManager_Update(void)
 {
-	struct LinkedList_Node* current = objectBuffer->gameObjects->head;
-	struct LinkedList_Node* next = NULL;
-	while (current != NULL)
+	//A state may add objects, so the array is indexed afresh for each object
+	DynamicArray* gameObjects = objectBuffer->objects[GOBJECT_ARRAY_ALL];
+	for(unsigned int i = 0; i < gameObjects->size; i++)
 	{
-		next = current->next;
-		GObject* gameObj = (GObject*)(current->data);
+		GObject_Update(*(GObject**)DynamicArray_Index(gameObjects, i));
+	}
 
-		GObject_Update(gameObj);
+	//Delete the to delete queue, an object queued more than once is only deleted the first time
+	DynamicArray* toDelete = objectBuffer->toDelete;
+	for(unsigned int i = 0; i < toDelete->size; i++)
+	{
+		GObject* gameObj = ObjectManager_LookupObject(*(GObjectHandle*)DynamicArray_Index(toDelete, i));
+		if(gameObj != NULL)
+		{
+			ObjectManager_DeleteObject(gameObj);
+		}
+	}
+
+	DynamicArray_Clear(toDelete);
+}
 
-		
-		//Clear the game objects list of collisions which occurred with itself last frame
-		if(gameObj->collider != NULL)
+///
+//Clears every collider's list of the collisions it took part in.
+//The collision updates free the collisions of the update before, so this must be called before each of them.
+//The states see the collisions of the last physics step taken, a frame which takes no steps leaves them in place.
+void ObjectManager_ClearCollisions(void)
+{
+	DynamicArray* colliders = objectBuffer->objects[GOBJECT_ARRAY_COLLIDERS];
+	for(unsigned int i = 0; i < colliders->size; i++)
+	{
+		GObject* gameObj = *(GObject**)DynamicArray_Index(colliders, i);
+		if(gameObj->collider->currentCollisions->size > 0)
 		{
-			if(gameObj->collider->currentCollisions->size > 0)
-			{
-				/*
-				//Clear the current list of collisions
-				LinkedList_Node* currentNode = gameObj->collider->currentCollisions->head;
-				LinkedList_Node* nextNode = NULL;
-				while(currentNode != NULL)
-				{
-					nextNode = currentNode->next;
-					Collision* currentCollision = (Collision*)currentNode->data;
-					CollisionManager_FreeCollision(currentCollision);
-					currentNode = nextNode;
-				}
-				*/
-				LinkedList_Clear(gameObj->collider->currentCollisions);
-			}
+			DynamicArray_Clear(gameObj->collider->currentCollisions);
 		}
-		
+	}
+}
+
+///
+//Updates the internal state of the OctTree.
+//The oct tree only holds the objects while it is the broad phase in use, so it must not be updated otherwise.
+void ObjectManager_UpdateOctTree(void)
+{
+	OctTree_Update(objectBuffer->octTree, objectBuffer->objects[GOBJECT_ARRAY_COLLIDERS]);
+}
+
+///
+//Updates the internal state of the sweep and prune, finding the pairs of objects with overlapping bounds
+void ObjectManager_UpdateSweepAndPrune(void)
+{
+	SweepAndPrune_Update(objectBuffer->sweepAndPrune);
+}
+
+///
+//Updates the internal state of the dynamic AABB tree, finding the pairs of objects with overlapping bounds
+void ObjectManager_UpdateAABBTree(void)
+{
+	AABBTree_Update(objectBuffer->aabbTree);
+}
 
-		current = next;
+///
+//Updates the internal state of the loose oct tree, finding the pairs of objects with overlapping bounds.
+//Like the oct tree, it must be the broad phase in use.
+void ObjectManager_UpdateLooseOctTree(void)
+{
+	OctTree_Update(objectBuffer->looseOctTree, objectBuffer->objects[GOBJECT_ARRAY_COLLIDERS]);
+}
+
+///
+//Rebuilds the linear oct tree, finding the pairs of objects with overlapping bounds
+void ObjectManager_UpdateLinearOctTree(void)
+{
+	LinearOctTree_Update(objectBuffer->linearOctTree);
+}
+
+///
+//Updates the internal state of the broad phase in use
+void ObjectManager_UpdateBroadPhase(void)
+{
+	switch(objectBuffer->broadPhase)
+	{
+	case BROADPHASE_OCTTREE:
+		ObjectManager_UpdateOctTree();
+		break;
+	case BROADPHASE_SWEEPANDPRUNE:
+		ObjectManager_UpdateSweepAndPrune();
+		break;
+	case BROADPHASE_AABBTREE:
+		ObjectManager_UpdateAABBTree();
+		break;
+	case BROADPHASE_LOOSEOCTTREE:
+		ObjectManager_UpdateLooseOctTree();
+		break;
+	case BROADPHASE_LINEAROCTTREE:
+		ObjectManager_UpdateLinearOctTree();
+		break;
 	}
+}
 
-	//Delete the to delete queue
-	current = objectBuffer->toDelete->head;
-	next = NULL;
-	while(current != NULL)
+///
+//Sets the broad phase used to find the pairs of objects which might be colliding.
+//Only the broad phase in use holds the objects with colliders, so the old structure is emptied and the new one is filled.
+//The emptied structure may be allocated again, so pointers to it taken before the switch must be fetched again.
+//
+//Parameters:
+//	broadPhase: The broad phase to use
+void ObjectManager_SetBroadPhase(BroadPhase broadPhase)
+{
+	if(broadPhase == objectBuffer->broadPhase)
 	{
-		next = current->next;
-		GObject* gameObj = (GObject*)(current->data);
-		ObjectManager_DeleteObject(gameObj);
-		current = next;
+		return;
 	}
 
-	LinkedList_Clear(objectBuffer->toDelete);
+	ObjectManager_ClearBroadPhase();
+	objectBuffer->broadPhase = broadPhase;
+
+	DynamicArray* colliders = objectBuffer->objects[GOBJECT_ARRAY_COLLIDERS];
+	for(unsigned int i = 0; i < colliders->size; i++)
+	{
+		ObjectManager_AddToBroadPhase(*(GObject**)DynamicArray_Index(colliders, i));
+	}
 }
 
 ///
-//Updates the internal state of the OctTree
-void ObjectManager_UpdateOctTree(void)
+//Finds every object with a collider which the broad phase in use places near a box,
+//As it placed them when it was last updated, without testing their colliders.
+//Each object is appended at most once.
+//
+//Parameters:
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the objects to
+void ObjectManager_QueryBox(const float* min, const float* max, DynamicArray* results)
 {
-	OctTree_Update(objectBuffer->octTree, objectBuffer->gameObjects);
+	switch(objectBuffer->broadPhase)
+	{
+	case BROADPHASE_OCTTREE:
+		OctTree_QueryBox(objectBuffer->octTree, min, max, results);
+		break;
+	case BROADPHASE_SWEEPANDPRUNE:
+		SweepAndPrune_QueryBox(objectBuffer->sweepAndPrune, min, max, results);
+		break;
+	case BROADPHASE_AABBTREE:
+		AABBTree_QueryBox(objectBuffer->aabbTree, min, max, results);
+		break;
+	case BROADPHASE_LOOSEOCTTREE:
+		OctTree_QueryBox(objectBuffer->looseOctTree, min, max, results);
+		break;
+	case BROADPHASE_LINEAROCTTREE:
+		LinearOctTree_QueryBox(objectBuffer->linearOctTree, min, max, results);
+		break;
+	}
 }
 
 ///
-//Adds an object to collection of objects managed by the Object Manager
+//Adds an object to collection of objects managed by the Object Manager.
+//The object is placed in the arrays of the components it has now, so every component must be attached before it is added.
 //
 //Parameters:
 //	obj: The object to add
 void ObjectManager_AddObject(GObject* obj)
 {
-	LinkedList_Append(objectBuffer->gameObjects, obj);
+	ObjectManager_AcquireSlot(obj);
+
+	ObjectManager_AddToArray(obj, GOBJECT_ARRAY_ALL);
+	if(obj->body != NULL)
+	{
+		ObjectManager_AddToArray(obj, GOBJECT_ARRAY_BODIES);
+	}
+	if(obj->mesh != NULL)
+	{
+		ObjectManager_AddToArray(obj, GOBJECT_ARRAY_MESHES);
+	}
 	if(obj->collider != NULL)
 	{
-		//Add the object
-		OctTree_AddAndLog(objectBuffer->octTree, obj);
+		ObjectManager_AddToArray(obj, GOBJECT_ARRAY_COLLIDERS);
+		ObjectManager_AddToBroadPhase(obj);
 	}
 }
 
@@ -111,23 +220,45 @@ void ObjectManager_AddObject(GObject* obj)
 //	obj: The object to remove
 void ObjectManager_RemoveObject(GObject* obj)
 {
-	LinkedList_RemoveValue(objectBuffer->gameObjects, obj);
+	//An object which was already removed holds no slot
+	if(ObjectManager_LookupObject(obj->handle) != obj)
+	{
+		return;
+	}
+
+	//The object is only in the arrays of the components it had when it was added
+	for(int i = 0; i < GOBJECT_NUMARRAYS; i++)
+	{
+		ObjectManager_RemoveFromArray(obj, (GObject_Array)i);
+	}
 	if(obj->collider != NULL)
 	{
-		OctTree_RemoveAndUnLog(objectBuffer->octTree, obj);
+		ObjectManager_RemoveFromBroadPhase(obj);
+		CollisionManager_RemoveContacts(obj);
+		ObjectManager_RemoveCollisions(obj);
 	}
+
+	ObjectManager_ReleaseSlot(obj);
 }
 
 ///
 //Removes an object from the collection of objects being managed by the object manager.
-//Upon removal the object manager will deallocate memory being used by the object.
+//Upon removal the object manager will deallocate memory being used by the object,
+//Unless the object was spawned from a pool, in which case it is recycled into it's pool.
 //
 //Parameters:
 //	obj: the object to remove and free
 void ObjectManager_DeleteObject(GObject* obj)
 {
 	ObjectManager_RemoveObject(obj);
-	GObject_Free(obj);
+	if(obj->pool != 0)
+	{
+		ObjectManager_RecycleObject(obj);
+	}
+	else
+	{
+		GObject_Free(obj);
+	}
 }
 
 ///
@@ -137,9 +268,321 @@ void ObjectManager_DeleteObject(GObject* obj)
 //	obj: A pointer to the object to queue the deletion of
 void ObjectManager_QueueDelete(GObject* obj)
 {
-	LinkedList_Append(objectBuffer->toDelete, obj);
+	DynamicArray_Append(objectBuffer->toDelete, &obj->handle);
+}
+
+///
+//Gets a handle to an object managed by the object manager,
+//Which can be held without dangling after the object is removed
+//
+//Parameters:
+//	obj: A pointer to the object to get the handle of
+//
+//Returns:
+//	The handle of the object
+GObjectHandle ObjectManager_GetHandle(const GObject* obj)
+{
+	return obj->handle;
+}
+
+///
+//Looks up the object a handle refers to
+//
+//Parameters:
+//	handle: The handle of the object
+//
+//Returns:
+//	A pointer to the object, or NULL if the object has been removed since the handle was taken
+GObject* ObjectManager_LookupObject(GObjectHandle handle)
+{
+	if(handle.index >= objectBuffer->slots->size)
+	{
+		return NULL;
+	}
+
+	ObjectManager_Slot* slot = (ObjectManager_Slot*)DynamicArray_Index(objectBuffer->slots, handle.index);
+	if(slot->generation != handle.generation)
+	{
+		return NULL;
+	}
+	return slot->object;
+}
+
+///
+//Adds a pool of recycled objects to the object manager.
+//Objects spawned from the same pool should be built with the same components,
+//So a recycled object only needs it's state reset before it is used again.
+//
+//Returns:
+//	The pool's identifier, never 0
+unsigned int ObjectManager_AddPool(void)
+{
+	DynamicArray* pool = DynamicArray_Allocate();
+	DynamicArray_Initialize(pool, sizeof(GObject*));
+	DynamicArray_Append(objectBuffer->pools, &pool);
+
+	//0 marks an object which is not pooled, so identifiers start at 1
+	return objectBuffer->pools->size;
+}
+
+///
+//Spawns an object from a pool.
+//The object is a recycled object of the pool if there is one, it keeps the components it was built with
+//And it's rigid body is reset as if it were initialized at the origin, at rest with the same mass.
+//It also keeps it's states, which the caller resets. Otherwise the object is newly allocated and initialized with no components or states.
+//Either way the object is not yet managed, it must be added with ObjectManager_AddObject once it is built.
+//
+//Parameters:
+//	pool: The identifier of the pool to spawn the object from
+//
+//Returns:
+//	A pointer to the spawned object, which is recycled into the pool when it is deleted
+GObject* ObjectManager_SpawnObject(unsigned int pool)
+{
+	DynamicArray* recycled = *(DynamicArray**)DynamicArray_Index(objectBuffer->pools, pool - 1);
+
+	GObject* obj;
+	if(recycled->size > 0)
+	{
+		obj = *(GObject**)DynamicArray_Index(recycled, --recycled->size);
+	}
+	else
+	{
+		obj = GObject_Allocate();
+		GObject_Initialize(obj);
+	}
+
+	obj->pool = pool;
+	return obj;
+}
+
+///
+//Appends an object to one of the object buffer's arrays, remembering it's index there
+//
+//Parameters:
+//	obj: The object to add
+//	array: The array to add the object to
+static void ObjectManager_AddToArray(GObject* obj, GObject_Array array)
+{
+	obj->arrayIndices[array] = objectBuffer->objects[array]->size;
+	DynamicArray_Append(objectBuffer->objects[array], &obj);
+}
+
+///
+//Removes an object from one of the object buffer's arrays if it is held there.
+//The last object of the array takes it's place, so removal takes the same time however many objects there are.
+//
+//Parameters:
+//	obj: The object to remove
+//	array: The array to remove the object from
+static void ObjectManager_RemoveFromArray(GObject* obj, GObject_Array array)
+{
+	unsigned int index = obj->arrayIndices[array];
+	if(index == GObject_notInArray)
+	{
+		return;
+	}
+
+	DynamicArray* objects = objectBuffer->objects[array];
+	DynamicArray_SwapRemove(objects, index);
+	if(index < objects->size)
+	{
+		GObject* moved = *(GObject**)DynamicArray_Index(objects, index);
+		moved->arrayIndices[array] = index;
+	}
+	obj->arrayIndices[array] = GObject_notInArray;
+}
+
+///
+//Gives an object a slot in the object buffer's table of handles,
+//Reusing a free slot when there is one
+//
+//Parameters:
+//	obj: The object to give a slot
+static void ObjectManager_AcquireSlot(GObject* obj)
+{
+	unsigned int index = objectBuffer->firstFreeSlot;
+	ObjectManager_Slot* slot;
+	if(index == GObject_notInArray)
+	{
+		index = objectBuffer->slots->size;
+		slot = (ObjectManager_Slot*)DynamicArray_Emplace(objectBuffer->slots);
+		slot->generation = 0;
+	}
+	else
+	{
+		slot = (ObjectManager_Slot*)DynamicArray_Index(objectBuffer->slots, index);
+		objectBuffer->firstFreeSlot = slot->nextFree;
+	}
+
+	slot->object = obj;
+	slot->nextFree = GObject_notInArray;
+
+	obj->handle.index = index;
+	obj->handle.generation = slot->generation;
 }
 
+///
+//Frees the slot of an object in the object buffer's table of handles.
+//The slot moves to the next generation, so every handle to the object becomes stale.
+//
+//Parameters:
+//	obj: The object to free the slot of
+static void ObjectManager_ReleaseSlot(GObject* obj)
+{
+	ObjectManager_Slot* slot = (ObjectManager_Slot*)DynamicArray_Index(objectBuffer->slots, obj->handle.index);
+	slot->object = NULL;
+	slot->generation++;
+	slot->nextFree = objectBuffer->firstFreeSlot;
+	objectBuffer->firstFreeSlot = obj->handle.index;
+
+	obj->handle.index = GObject_notInArray;
+}
+
+///
+//Returns a removed object to it's pool so it can be spawned again.
+//The object's frame of reference, color and rigid body are reset,
+//But it keeps it's mesh, texture, rigid body, collider and states so spawning it again allocates nothing.
+//
+//Parameters:
+//	obj: The object to recycle
+static void ObjectManager_RecycleObject(GObject* obj)
+{
+	FrameOfReference_Initialize(obj->frameOfReference);
+	Matrix_ToIdentity(obj->colorMatrix);
+
+	//The body keeps it's slot in the rigid body store, where it is not integrated while no manager holds it's object,
+	//But is brought to rest so it does not carry it's old motion into it's next use
+	if(obj->body != NULL)
+	{
+		float mass = obj->body->inverseMass != 0.0f ? 1.0f / obj->body->inverseMass : 0.0f;
+		RigidBody_Reset(obj->body, obj->frameOfReference, mass);
+	}
+
+	DynamicArray* recycled = *(DynamicArray**)DynamicArray_Index(objectBuffer->pools, obj->pool - 1);
+	DynamicArray_Append(recycled, &obj);
+}
+
+///
+//Takes every collision a removed object took part in out of the other colliders' lists, and empties the object's own list.
+//The lists last until the next physics step, which may be frames away,
+//So without this the other objects' states would read a freed or recycled object.
+//
+//Parameters:
+//	obj: The object with a collider being removed
+static void ObjectManager_RemoveCollisions(GObject* obj)
+{
+	DynamicArray* collisions = obj->collider->currentCollisions;
+	for(unsigned int i = 0; i < collisions->size; i++)
+	{
+		Collision* collision = *(Collision**)DynamicArray_Index(collisions, i);
+		GObject* other = collision->obj1 == obj ? collision->obj2 : collision->obj1;
+
+		//The other collider may hold it's own copy of the collision, so it's collisions are matched by object
+		DynamicArray* otherCollisions = other->collider->currentCollisions;
+		for(unsigned int j = otherCollisions->size; j > 0; j--)
+		{
+			Collision* otherCollision = *(Collision**)DynamicArray_Index(otherCollisions, j - 1);
+			if(otherCollision->obj1 == obj || otherCollision->obj2 == obj)
+			{
+				DynamicArray_SwapRemove(otherCollisions, j - 1);
+			}
+		}
+	}
+
+	DynamicArray_Clear(collisions);
+}
+
+///
+//Adds an object with a collider to the structure of the broad phase in use
+//
+//Parameters:
+//	obj: The object to add
+static void ObjectManager_AddToBroadPhase(GObject* obj)
+{
+	switch(objectBuffer->broadPhase)
+	{
+	case BROADPHASE_OCTTREE:
+		OctTree_AddAndLog(objectBuffer->octTree, obj);
+		break;
+	case BROADPHASE_SWEEPANDPRUNE:
+		SweepAndPrune_Add(objectBuffer->sweepAndPrune, obj);
+		break;
+	case BROADPHASE_AABBTREE:
+		AABBTree_Add(objectBuffer->aabbTree, obj);
+		break;
+	case BROADPHASE_LOOSEOCTTREE:
+		OctTree_Add(objectBuffer->looseOctTree, obj);
+		break;
+	case BROADPHASE_LINEAROCTTREE:
+		LinearOctTree_Add(objectBuffer->linearOctTree, obj);
+		break;
+	}
+}
+
+///
+//Removes an object with a collider from the structure of the broad phase in use
+//
+//Parameters:
+//	obj: The object to remove
+static void ObjectManager_RemoveFromBroadPhase(GObject* obj)
+{
+	switch(objectBuffer->broadPhase)
+	{
+	case BROADPHASE_OCTTREE:
+		OctTree_RemoveAndUnLog(objectBuffer->octTree, obj);
+		break;
+	case BROADPHASE_SWEEPANDPRUNE:
+		SweepAndPrune_Remove(objectBuffer->sweepAndPrune, obj);
+		break;
+	case BROADPHASE_AABBTREE:
+		AABBTree_Remove(objectBuffer->aabbTree, obj);
+		break;
+	case BROADPHASE_LOOSEOCTTREE:
+		OctTree_Remove(objectBuffer->looseOctTree, obj);
+		break;
+	case BROADPHASE_LINEAROCTTREE:
+		LinearOctTree_Remove(objectBuffer->linearOctTree, obj);
+		break;
+	}
+}
+
+///
+//Empties the structure of the broad phase in use.
+//The tight oct tree has every object removed so it's logs are freed, the other structures are freed and allocated again empty.
+static void ObjectManager_ClearBroadPhase(void)
+{
+	DynamicArray* colliders = objectBuffer->objects[GOBJECT_ARRAY_COLLIDERS];
+	switch(objectBuffer->broadPhase)
+	{
+	case BROADPHASE_OCTTREE:
+		for(unsigned int i = 0; i < colliders->size; i++)
+		{
+			OctTree_RemoveAndUnLog(objectBuffer->octTree, *(GObject**)DynamicArray_Index(colliders, i));
+		}
+		break;
+	case BROADPHASE_SWEEPANDPRUNE:
+		SweepAndPrune_Free(objectBuffer->sweepAndPrune);
+		objectBuffer->sweepAndPrune = SweepAndPrune_Allocate();
+		SweepAndPrune_Initialize(objectBuffer->sweepAndPrune);
+		break;
+	case BROADPHASE_AABBTREE:
+		AABBTree_Free(objectBuffer->aabbTree);
+		objectBuffer->aabbTree = AABBTree_Allocate();
+		AABBTree_Initialize(objectBuffer->aabbTree, AABBTree_defaultMargin);
+		break;
+	case BROADPHASE_LOOSEOCTTREE:
+		OctTree_Free(objectBuffer->looseOctTree);
+		objectBuffer->looseOctTree = OctTree_Allocate();
+		OctTree_InitializeLoose(objectBuffer->looseOctTree, -ObjectManager_octTreeBound, ObjectManager_octTreeBound, -ObjectManager_octTreeBound, ObjectManager_octTreeBound, -ObjectManager_octTreeBound, ObjectManager_octTreeBound);
+		break;
+	case BROADPHASE_LINEAROCTTREE:
+		LinearOctTree_Free(objectBuffer->linearOctTree);
+		objectBuffer->linearOctTree = LinearOctTree_Allocate();
+		LinearOctTree_Initialize(objectBuffer->linearOctTree);
+		break;
+	}
+}
 
 ///
 //Allocates a new Object buffer
@@ -159,14 +602,38 @@ static ObjectBuffer* ObjectManager_AllocateBuffer(void)
 //	buffer: The object buffer to initialize
 static void ObjectManager_InitializeBuffer(ObjectBuffer* buffer)
 {
-	buffer->toDelete = LinkedList_Allocate();
-	LinkedList_Initialize(buffer->toDelete);
+	buffer->toDelete = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->toDelete, sizeof(GObjectHandle));
+
+	for(int i = 0; i < GOBJECT_NUMARRAYS; i++)
+	{
+		buffer->objects[i] = DynamicArray_Allocate();
+		DynamicArray_Initialize(buffer->objects[i], sizeof(GObject*));
+	}
+
+	buffer->slots = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->slots, sizeof(ObjectManager_Slot));
+	buffer->firstFreeSlot = GObject_notInArray;
 
-	buffer->gameObjects = LinkedList_Allocate();
-	LinkedList_Initialize(buffer->gameObjects);
+	buffer->pools = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->pools, sizeof(DynamicArray*));
 
 	buffer->octTree = OctTree_Allocate();
-	OctTree_Initialize(buffer->octTree, -5000.0f, 5000.0f, -5000.0f, 5000.0f, -5000.0f, 5000.0f);
+	OctTree_Initialize(buffer->octTree, -ObjectManager_octTreeBound, ObjectManager_octTreeBound, -ObjectManager_octTreeBound, ObjectManager_octTreeBound, -ObjectManager_octTreeBound, ObjectManager_octTreeBound);
+
+	buffer->sweepAndPrune = SweepAndPrune_Allocate();
+	SweepAndPrune_Initialize(buffer->sweepAndPrune);
+
+	buffer->aabbTree = AABBTree_Allocate();
+	AABBTree_Initialize(buffer->aabbTree, AABBTree_defaultMargin);
+
+	buffer->looseOctTree = OctTree_Allocate();
+	OctTree_InitializeLoose(buffer->looseOctTree, -ObjectManager_octTreeBound, ObjectManager_octTreeBound, -ObjectManager_octTreeBound, ObjectManager_octTreeBound, -ObjectManager_octTreeBound, ObjectManager_octTreeBound);
+
+	buffer->linearOctTree = LinearOctTree_Allocate();
+	LinearOctTree_Initialize(buffer->linearOctTree);
+
+	buffer->broadPhase = BROADPHASE_OCTTREE;
 }
 
 ///
@@ -178,20 +645,41 @@ static void ObjectManager_FreeBuffer(ObjectBuffer* buffer)
 {
 	//Free the oct tree
 	OctTree_Free(buffer->octTree);
+	//And the sweep and prune
+	SweepAndPrune_Free(buffer->sweepAndPrune);
+	//And the dynamic AABB tree
+	AABBTree_Free(buffer->aabbTree);
+	//And the loose oct tree
+	OctTree_Free(buffer->looseOctTree);
+	//And the linear oct tree
+	LinearOctTree_Free(buffer->linearOctTree);
 
 	//Delete all Objects being held in the object buffer
-	struct LinkedList_Node* current = buffer->gameObjects->head;
+	DynamicArray* gameObjects = buffer->objects[GOBJECT_ARRAY_ALL];
+	for(unsigned int i = 0; i < gameObjects->size; i++)
+	{
+		GObject_Free(*(GObject**)DynamicArray_Index(gameObjects, i));
+	}
 
-	while (current != NULL)
+	//And the recycled objects waiting in each pool
+	for(unsigned int i = 0; i < buffer->pools->size; i++)
 	{
-		GObject* data = (GObject*)current->data;
-		GObject_Free(data);
-		current = current->next;
+		DynamicArray* recycled = *(DynamicArray**)DynamicArray_Index(buffer->pools, i);
+		for(unsigned int j = 0; j < recycled->size; j++)
+		{
+			GObject_Free(*(GObject**)DynamicArray_Index(recycled, j));
+		}
+		DynamicArray_Free(recycled);
 	}
+	DynamicArray_Free(buffer->pools);
 
-	//Now remove the list
-	LinkedList_Free(buffer->gameObjects);
+	//Now remove the arrays
+	for(int i = 0; i < GOBJECT_NUMARRAYS; i++)
+	{
+		DynamicArray_Free(buffer->objects[i]);
+	}
 
-	LinkedList_Free(buffer->toDelete);
+	DynamicArray_Free(buffer->slots);
+	DynamicArray_Free(buffer->toDelete);
 
 }
\ No newline at end of file
@@ -4,17 +4,117 @@
 #include "LinkedList.h"
 #include "GObject.h"
 #include "OctTree.h"
+#include "SweepAndPrune.h"
+#include "AABBTree.h"
+#include "LinearOctTree.h"
 #include "HashMap.h"
 
+//Dictates which structure finds the pairs of objects which might be colliding
+enum BroadPhase
+{
+	BROADPHASE_OCTTREE,			//Objects sharing a leaf of the oct tree are tested
+	BROADPHASE_SWEEPANDPRUNE,	//Objects whose bounds overlap along the sorted axes are tested
+	BROADPHASE_AABBTREE,		//Objects whose enlarged bounds overlap in the dynamic AABB tree are tested
+	BROADPHASE_LOOSEOCTTREE,	//Objects whose bounds overlap in the loose oct tree are tested
+	BROADPHASE_LINEAROCTTREE	//Objects whose bounds overlap in the linear oct tree, rebuilt every frame, are tested
+};
+
+//An entry of the object manager's table of handles
+typedef struct ObjectManager_Slot
+{
+	GObject* object;			//The object held by the slot, NULL while the slot is free
+	unsigned int generation;	//Incremented each time the slot's object is removed, so old handles to the slot no longer match
+	unsigned int nextFree;		//Index of the next free slot while the slot is free, GObject_notInArray at the end of the free list
+} ObjectManager_Slot;
+
 typedef struct ObjectBuffer
 {
-	LinkedList* toDelete;
-	LinkedList* gameObjects;
+	DynamicArray* toDelete;						//Handles of the objects queued for deletion, a handle of an object already deleted looks up as NULL
+	DynamicArray* objects[GOBJECT_NUMARRAYS];	//Dense arrays of GObject*, one of every object and one of exactly the objects with each component
+	DynamicArray* slots;						//The ObjectManager_Slot each handle indexes
+	unsigned int firstFreeSlot;					//Index of the first free slot, GObject_notInArray if every slot holds an object
+	DynamicArray* pools;						//DynamicArray* of the deleted GObject* waiting to be spawned again, pool n is at index n - 1
 	OctTree* octTree;
+	SweepAndPrune* sweepAndPrune;
+	AABBTree* aabbTree;
+	OctTree* looseOctTree;
+	LinearOctTree* linearOctTree;
+	BroadPhase broadPhase;		//The broad phase in use, only it's structure holds the objects and is updated each frame
 } ObjectBuffer;
 
 //Internal
 static ObjectBuffer* objectBuffer;
+static const float ObjectManager_octTreeBound = 5000.0f;	//The oct trees cover from minus this to this on each axis
+
+///
+//Appends an object to one of the object buffer's arrays, remembering it's index there
+//
+//Parameters:
+//	obj: The object to add
+//	array: The array to add the object to
+static void ObjectManager_AddToArray(GObject* obj, GObject_Array array);
+
+///
+//Removes an object from one of the object buffer's arrays if it is held there.
+//The last object of the array takes it's place, so removal takes the same time however many objects there are.
+//
+//Parameters:
+//	obj: The object to remove
+//	array: The array to remove the object from
+static void ObjectManager_RemoveFromArray(GObject* obj, GObject_Array array);
+
+///
+//Gives an object a slot in the object buffer's table of handles,
+//Reusing a free slot when there is one
+//
+//Parameters:
+//	obj: The object to give a slot
+static void ObjectManager_AcquireSlot(GObject* obj);
+
+///
+//Frees the slot of an object in the object buffer's table of handles.
+//The slot moves to the next generation, so every handle to the object becomes stale.
+//
+//Parameters:
+//	obj: The object to free the slot of
+static void ObjectManager_ReleaseSlot(GObject* obj);
+
+///
+//Takes every collision a removed object took part in out of the other colliders' lists, and empties the object's own list.
+//The lists last until the next physics step, which may be frames away,
+//So without this the other objects' states would read a freed or recycled object.
+//
+//Parameters:
+//	obj: The object with a collider being removed
+static void ObjectManager_RemoveCollisions(GObject* obj);
+
+///
+//Returns a removed object to it's pool so it can be spawned again.
+//The object's frame of reference, color and rigid body are reset,
+//But it keeps it's mesh, texture, rigid body, collider and states so spawning it again allocates nothing.
+//
+//Parameters:
+//	obj: The object to recycle
+static void ObjectManager_RecycleObject(GObject* obj);
+
+///
+//Adds an object with a collider to the structure of the broad phase in use
+//
+//Parameters:
+//	obj: The object to add
+static void ObjectManager_AddToBroadPhase(GObject* obj);
+
+///
+//Removes an object with a collider from the structure of the broad phase in use
+//
+//Parameters:
+//	obj: The object to remove
+static void ObjectManager_RemoveFromBroadPhase(GObject* obj);
+
+///
+//Empties the structure of the broad phase in use.
+//The tight oct tree has every object removed so it's logs are freed, the other structures are freed and allocated again empty.
+static void ObjectManager_ClearBroadPhase(void);
 
 ///
 //Allocates a new Object buffer
@@ -59,11 +159,60 @@ ObjectBuffer ObjectManager_GetObjectBuffer(void);
 void ObjectManager_Update(void);
 
 ///
-//Updates the internal state of the OctTree
+//Clears every collider's list of the collisions it took part in.
+//The collision updates free the collisions of the update before, so this must be called before each of them.
+//The states see the collisions of the last physics step taken, a frame which takes no steps leaves them in place.
+void ObjectManager_ClearCollisions(void);
+
+///
+//Updates the internal state of the OctTree.
+//The oct tree only holds the objects while it is the broad phase in use, so it must not be updated otherwise.
 void ObjectManager_UpdateOctTree(void);
 
 ///
-//Adds an object to collection of objects managed by the Object Manager
+//Updates the internal state of the sweep and prune, finding the pairs of objects with overlapping bounds
+void ObjectManager_UpdateSweepAndPrune(void);
+
+///
+//Updates the internal state of the dynamic AABB tree, finding the pairs of objects with overlapping bounds
+void ObjectManager_UpdateAABBTree(void);
+
+///
+//Updates the internal state of the loose oct tree, finding the pairs of objects with overlapping bounds.
+//Like the oct tree, it must be the broad phase in use.
+void ObjectManager_UpdateLooseOctTree(void);
+
+///
+//Rebuilds the linear oct tree, finding the pairs of objects with overlapping bounds
+void ObjectManager_UpdateLinearOctTree(void);
+
+///
+//Updates the internal state of the broad phase in use
+void ObjectManager_UpdateBroadPhase(void);
+
+///
+//Sets the broad phase used to find the pairs of objects which might be colliding.
+//Only the broad phase in use holds the objects with colliders, so the old structure is emptied and the new one is filled.
+//The emptied structure may be allocated again, so pointers to it taken before the switch must be fetched again.
+//
+//Parameters:
+//	broadPhase: The broad phase to use
+void ObjectManager_SetBroadPhase(BroadPhase broadPhase);
+
+///
+//Finds every object with a collider which the broad phase in use places near a box,
+//As it placed them when it was last updated, without testing their colliders.
+//Each object is appended at most once.
+//
+//Parameters:
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the objects to
+void ObjectManager_QueryBox(const float* min, const float* max, DynamicArray* results);
+
+///
+//Adds an object to collection of objects managed by the Object Manager.
+//The object is placed in the arrays of the components it has now, so every component must be attached before it is added.
 //
 //Parameters:
 //	obj: The object to add
@@ -80,7 +229,8 @@ void ObjectManager_RemoveObject(GObject* obj);
 
 ///
 //Removes an object from the collection of objects being managed by the object manager.
-//Upon removal the object manager will deallocate memory being used by the object.
+//Upon removal the object manager will deallocate memory being used by the object,
+//Unless the object was spawned from a pool, in which case it is recycled into it's pool.
 //
 //Parameters:
 //	obj: the object to remove and free
@@ -93,4 +243,48 @@ void ObjectManager_DeleteObject(GObject* obj);
 //	obj: A pointer to the object to queue the deletion of
 void ObjectManager_QueueDelete(GObject* obj);
 
+///
+//Gets a handle to an object managed by the object manager,
+//Which can be held without dangling after the object is removed
+//
+//Parameters:
+//	obj: A pointer to the object to get the handle of
+//
+//Returns:
+//	The handle of the object
+GObjectHandle ObjectManager_GetHandle(const GObject* obj);
+
+///
+//Looks up the object a handle refers to
+//
+//Parameters:
+//	handle: The handle of the object
+//
+//Returns:
+//	A pointer to the object, or NULL if the object has been removed since the handle was taken
+GObject* ObjectManager_LookupObject(GObjectHandle handle);
+
+///
+//Adds a pool of recycled objects to the object manager.
+//Objects spawned from the same pool should be built with the same components,
+//So a recycled object only needs it's state reset before it is used again.
+//
+//Returns:
+//	The pool's identifier, never 0
+unsigned int ObjectManager_AddPool(void);
+
+///
+//Spawns an object from a pool.
+//The object is a recycled object of the pool if there is one, it keeps the components it was built with
+//And it's rigid body is reset as if it were initialized at the origin, at rest with the same mass.
+//It also keeps it's states, which the caller resets. Otherwise the object is newly allocated and initialized with no components or states.
+//Either way the object is not yet managed, it must be added with ObjectManager_AddObject once it is built.
+//
+//Parameters:
+//	pool: The identifier of the pool to spawn the object from
+//
+//Returns:
+//	A pointer to the spawned object, which is recycled into the pool when it is deleted
+GObject* ObjectManager_SpawnObject(unsigned int pool);
+
 #endif
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include <stdlib.h>
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
+
+#include "Hash.h"
 
 ///
 //Allocates memory for an octtree node
@@ -35,14 +38,17 @@ static void OctTree_Node_Initialize(struct OctTree_Node* node, OctTree* tree, st
 	node->children = NULL;
 	node->parent = parent;
 
-	//Create data array
-	node->data = DynamicArray_Allocate();
-	//Set a max capacity of the dynamic array to the max occupancy of the oct tree
-	node->data->capacity = tree->maxOccupancy;
-	DynamicArray_Initialize(node->data, sizeof(GObject*));
+	//Create data array, which holds as many occupants as fit in the node's inline storage before spilling to the heap
+	node->data = &node->occupants;
+	node->data->size = 0;
+	node->data->dataSize = tree->loose ? sizeof(unsigned int) : sizeof(GObject*);
+	node->data->capacity = sizeof(node->inlineOccupants) / node->data->dataSize;
+	node->data->growthRate = defaultGrowth;
+	node->data->data = node->inlineOccupants;
 
 	//Set depth
 	node->depth = depth;
+	node->numLooseOccupants = 0;
 
 	//Set bounds
 	node->left = leftBound;
@@ -54,42 +60,108 @@ static void OctTree_Node_Initialize(struct OctTree_Node* node, OctTree* tree, st
 }
 
 ///
-//Frees data allocated by an oct tree node
+//Frees data allocated by an oct tree node, returning it's descendants to the tree's node pool
 //
 //Parameters:
+//	tree: A pointer to the oct tree this node is part of
 //	node: A pointer to the oct tree node to free
-static void OctTree_Node_Free(struct OctTree_Node* node)
+static void OctTree_Node_Free(OctTree* tree, struct OctTree_Node* node)
 {
 	//If this node has children
 	if(node->children != NULL)
 	{
-		for(int i = 0; i < 8; i++)
-		{
-			//Free the children!
-			OctTree_Node_Free(node->children + i);
-		}
-		//Free the children container...
-		free(node->children);
+		//Free the children!
+		OctTree_Node_FreeChildren(tree, node);
 	}
 
-	//Free the data contained within this tree
-	DynamicArray_Free(node->data);
+	//Free the data contained within this node if it outgrew the inline storage
+	if(node->data->data != node->inlineOccupants)
+	{
+		free(node->data->data);
+	}
 
 	//Free this node
 	//free(node);
 }
 
 ///
-//Allocates the children of an oct tree node
+//Takes the children of an oct tree node from the tree's node pool,
+//Allocating another slab of blocks only when the pool has none free
+//
+//Parameters:
+//	tree: A pointer to the oct tree the children will be a part of
 //
 //Returns:
-//	A pointer to an array of 8 newly allocated, uninitialized node children
-static struct OctTree_Node* OctTree_Node_AllocateChildren()
+//	A pointer to an array of 8 uninitialized node children
+static struct OctTree_Node* OctTree_Node_AllocateChildren(OctTree* tree)
 {
-	struct OctTree_Node* children = (struct OctTree_Node*)malloc(sizeof(struct OctTree_Node) * 8);
+	if(tree->freeChildren == NULL)
+	{
+		struct OctTree_Node* slab = (struct OctTree_Node*)malloc(sizeof(struct OctTree_Node) * 8 * childBlocksPerSlab);
+		DynamicArray_Append(tree->nodeSlabs, &slab);
+		tree->numPooledNodes += 8 * childBlocksPerSlab;
+
+		//Link the new blocks into the free list in order, so they are handed out front to back
+		for(unsigned int i = 0; i < childBlocksPerSlab; i++)
+		{
+			slab[8 * i].children = i + 1 < childBlocksPerSlab ? slab + 8 * (i + 1) : NULL;
+		}
+		tree->freeChildren = slab;
+	}
+
+	struct OctTree_Node* children = tree->freeChildren;
+	tree->freeChildren = children->children;
+
+	tree->numLiveNodes += 8;
+	if(tree->numLiveNodes > tree->maxLiveNodes)
+	{
+		tree->maxLiveNodes = tree->numLiveNodes;
+	}
 	return children;
 }
 
+///
+//Frees the children of an oct tree node and returns them to the tree's node pool
+//
+//Parameters:
+//	tree: A pointer to the oct tree the node is part of
+//	node: A pointer to the node to free the children of
+static void OctTree_Node_FreeChildren(OctTree* tree, struct OctTree_Node* node)
+{
+	struct OctTree_Node* children = node->children;
+	for(int i = 0; i < 8; i++)
+	{
+		OctTree_Node_Free(tree, children + i);
+	}
+
+	children->children = tree->freeChildren;
+	tree->freeChildren = children;
+	tree->numLiveNodes -= 8;
+
+	node->children = NULL;
+}
+
+///
+//Appends an occupant to the data of an oct tree node.
+//The occupants are moved from the node's inline storage to the heap once they no longer fit,
+//Which only happens to nodes holding more than the tree's max occupancy.
+//
+//Parameters:
+//	node: A pointer to the node to append the occupant to
+//	occupant: A pointer to the GObject* or occupant index to append
+static void OctTree_Node_AppendOccupant(struct OctTree_Node* node, void* occupant)
+{
+	DynamicArray* arr = node->data;
+	//Growing the array would reallocate the inline storage, so the first growth is done here
+	if(arr->size == arr->capacity && arr->data == node->inlineOccupants)
+	{
+		arr->capacity = (unsigned int)(arr->growthRate * arr->capacity);
+		arr->data = malloc(arr->dataSize * arr->capacity);
+		memcpy(arr->data, node->inlineOccupants, sizeof(node->inlineOccupants));
+	}
+	DynamicArray_Append(arr, occupant);
+}
+
 ///
 //Initializes the children of an oct tree node
 //
@@ -153,6 +225,358 @@ static void OctTree_Node_InitializeChildren(OctTree* tree, struct OctTree_Node*
 
 }
 
+///
+//Refits the bounds of every object in a loose oct tree, moves the objects which no longer belong in their node,
+//And finds every pair of objects whose bounds overlap.
+//Sleeping objects have not moved, so they are left where they are.
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree to update
+static void OctTree_UpdateLoose(OctTree* tree)
+{
+	tree->numReinserts = 0;
+
+	OctTree_Occupant* occupants = (OctTree_Occupant*)tree->occupants->data;
+	for(unsigned int i = 0; i < tree->occupants->size; i++)
+	{
+		OctTree_Occupant* occupant = occupants + i;
+		GObject* obj = occupant->obj;
+		if(obj->body != NULL && !obj->body->isAwake) continue;
+
+		Collider_GetWorldBounds(occupant->min, occupant->max, obj->collider, obj->body != NULL ? obj->body->frame : obj->frameOfReference);
+
+		//The object stays put while it's node still fits it, unless the node has since been split by an object which could go deeper
+		float center[3];
+		float radius = OctTree_Occupant_GetCenter(center, occupant);
+		struct OctTree_Node* node = occupant->node;
+		if(node == tree->root || OctTree_Node_CanLooselyContain(node, center, radius))
+		{
+			if(node->children == NULL || !OctTree_Node_CanLooselyContain(OctTree_Node_GetChildContaining(node, center), center, radius))
+			{
+				continue;
+			}
+		}
+
+		//Every node fitting the object lies on the path from the root to the octant of it's center, so the root is searched from
+		OctTree_Node_RemoveLooseOccupant(tree, i);
+		OctTree_Node_AddLooseOccupant(tree, tree->root, i);
+		tree->numReinserts++;
+	}
+
+	DynamicArray_Clear(tree->pairs);
+	for(unsigned int i = 0; i < tree->occupants->size; i++)
+	{
+		OctTree_FindLoosePairs(tree, i);
+	}
+}
+
+///
+//Adds a game object to a loose oct tree
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree to add the object to
+//	obj: A pointer to the game object to add
+static void OctTree_AddLoose(OctTree* tree, GObject* obj)
+{
+	OctTree_Occupant occupant;
+	occupant.obj = obj;
+	occupant.node = NULL;
+	Collider_GetWorldBounds(occupant.min, occupant.max, obj->collider, obj->body != NULL ? obj->body->frame : obj->frameOfReference);
+
+	DynamicArray_Append(tree->occupants, &occupant);
+	HashMap_Add(tree->map, &obj, (void*)(size_t)(tree->occupants->size - 1), sizeof(GObject*));
+	OctTree_Node_AddLooseOccupant(tree, tree->root, tree->occupants->size - 1);
+}
+
+///
+//Removes a game object from a loose oct tree.
+//The object's occupant is found through the tree's map, and the last occupant is moved into it's slot,
+//So removal takes the same time however many objects the tree holds.
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree to remove the object from
+//	obj: A pointer to the game object to remove
+static void OctTree_RemoveLoose(OctTree* tree, GObject* obj)
+{
+	struct HashMap_KeyValuePair* pair = HashMap_LookUp(tree->map, &obj, sizeof(GObject*));
+	if(pair == NULL)
+	{
+		return;
+	}
+	unsigned int index = (unsigned int)(size_t)pair->data;
+	HashMap_Remove(tree->map, &obj, sizeof(GObject*));
+
+	OctTree_Node_RemoveLooseOccupant(tree, index);
+
+	unsigned int last = --tree->occupants->size;
+	if(index == last)
+	{
+		return;
+	}
+
+	//The last occupant takes the removed one's index, in the tree's map and in the node holding it
+	OctTree_Occupant* occupants = (OctTree_Occupant*)tree->occupants->data;
+	occupants[index] = occupants[last];
+	HashMap_LookUp(tree->map, &occupants[index].obj, sizeof(GObject*))->data = (void*)(size_t)index;
+	((unsigned int*)occupants[index].node->data->data)[occupants[index].nodeSlot] = index;
+}
+
+///
+//Places an occupant of a loose oct tree in the deepest node below a node which fits it,
+//Subdividing full leaves on the way down.
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree holding the occupant
+//	node: A pointer to the node to start searching down from
+//	occupantIndex: The index of the occupant to place
+static void OctTree_Node_AddLooseOccupant(OctTree* tree, struct OctTree_Node* node, unsigned int occupantIndex)
+{
+	OctTree_Occupant* occupant = (OctTree_Occupant*)DynamicArray_Index(tree->occupants, occupantIndex);
+	float center[3];
+	float radius = OctTree_Occupant_GetCenter(center, occupant);
+
+	while(1)
+	{
+		//Leaves are only split once they are full and too shallow
+		if(node->children == NULL)
+		{
+			if(node->data->size < tree->maxOccupancy || node->depth >= tree->maxDepth)
+			{
+				break;
+			}
+			OctTree_Node_SubdivideLoose(tree, node);
+		}
+
+		struct OctTree_Node* child = OctTree_Node_GetChildContaining(node, center);
+		if(!OctTree_Node_CanLooselyContain(child, center, radius))
+		{
+			break;
+		}
+		node = child;
+	}
+
+	occupant->nodeSlot = node->data->size;
+	OctTree_Node_AppendOccupant(node, &occupantIndex);
+	occupant->node = node;
+
+	for(struct OctTree_Node* current = node; current != NULL; current = current->parent)
+	{
+		current->numLooseOccupants++;
+	}
+}
+
+///
+//Removes an occupant's index from the node of a loose oct tree holding it.
+//The occupant knows where it's index lies in the node, so the node's occupants are not searched.
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree holding the occupant
+//	occupantIndex: The index of the occupant to remove
+static void OctTree_Node_RemoveLooseOccupant(OctTree* tree, unsigned int occupantIndex)
+{
+	OctTree_Occupant* occupants = (OctTree_Occupant*)tree->occupants->data;
+	struct OctTree_Node* node = occupants[occupantIndex].node;
+
+	//The order of a node's occupants does not matter, so the last takes the removed one's place
+	unsigned int slot = occupants[occupantIndex].nodeSlot;
+	unsigned int* indices = (unsigned int*)node->data->data;
+	indices[slot] = indices[--node->data->size];
+	occupants[indices[slot]].nodeSlot = slot;
+
+	for(struct OctTree_Node* current = node; current != NULL; current = current->parent)
+	{
+		current->numLooseOccupants--;
+	}
+}
+
+///
+//Subdivides a node of a loose oct tree into 8 child nodes, moving each occupant which fits in a child down into it
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree in which this node lives
+//	node: A pointer to the node being subdivided
+static void OctTree_Node_SubdivideLoose(OctTree* tree, struct OctTree_Node* node)
+{
+	//Allocate this nodes children
+	node->children = OctTree_Node_AllocateChildren(tree);
+
+	//Initialize this nodes children
+	OctTree_Node_InitializeChildren(tree, node);
+
+	//Occupants too large for the children stay in this node
+	OctTree_Occupant* occupants = (OctTree_Occupant*)tree->occupants->data;
+	unsigned int* indices = (unsigned int*)node->data->data;
+	unsigned int numKept = 0;
+	for(unsigned int i = 0; i < node->data->size; i++)
+	{
+		OctTree_Occupant* occupant = occupants + indices[i];
+		float center[3];
+		float radius = OctTree_Occupant_GetCenter(center, occupant);
+
+		struct OctTree_Node* child = OctTree_Node_GetChildContaining(node, center);
+		if(OctTree_Node_CanLooselyContain(child, center, radius))
+		{
+			occupant->nodeSlot = child->data->size;
+			OctTree_Node_AppendOccupant(child, indices + i);
+			child->numLooseOccupants++;
+			occupant->node = child;
+		}
+		else
+		{
+			occupant->nodeSlot = numKept;
+			indices[numKept++] = indices[i];
+		}
+	}
+	node->data->size = numKept;
+}
+
+///
+//Gets the child of a node whose octant a point lies in, or would lie in if the point is outside of the node
+//
+//Parameters:
+//	node: A pointer to the node to get the child of, must have children
+//	point: An array of 3 floats holding the point
+//
+//Returns:
+//	A pointer to the child
+static struct OctTree_Node* OctTree_Node_GetChildContaining(struct OctTree_Node* node, const float* point)
+{
+	//The bottom back left child's far bounds are where the node is split on each axis
+	const struct OctTree_Node* split = node->children + 1;
+	unsigned char right = point[0] >= split->right;
+	unsigned char top = point[1] >= split->top;
+	unsigned char front = point[2] >= split->front;
+
+	//Follows the order of OctTree_Node_InitializeChildren
+	static const unsigned int bottomOctants[2][2] =
+	{
+		{ 1, 2 },	//Left back, left front
+		{ 0, 3 }	//Right back, right front
+	};
+	return node->children + bottomOctants[right][front] + (top ? 4 : 0);
+}
+
+///
+//Determines if the loose bounds of an oct tree node are sure to contain an object
+//
+//Parameters:
+//	node: A pointer to the node to test
+//	center: An array of 3 floats holding the center of the object's bounds
+//	radius: Half of the largest dimension of the object's bounds
+//
+//Returns:
+//	1 if the node contains the center and is at least as large as the object, else 0
+static unsigned char OctTree_Node_CanLooselyContain(struct OctTree_Node* node, const float* center, float radius)
+{
+	if(center[0] < node->left || center[0] > node->right) return 0;
+	if(center[1] < node->bottom || center[1] > node->top) return 0;
+	if(center[2] < node->back || center[2] > node->front) return 0;
+
+	//The loose bounds reach half of the node's size past each side, so the object may stick out of the node by it's radius
+	return radius * 2.0f <= node->right - node->left
+		&& radius * 2.0f <= node->top - node->bottom
+		&& radius * 2.0f <= node->front - node->back;
+}
+
+///
+//Determines if the loose bounds of an oct tree node overlap a box
+//
+//Parameters:
+//	node: A pointer to the node to test
+//	min: The minimum bound of the box on each axis
+//	max: The maximum bound of the box on each axis
+//
+//Returns:
+//	1 if the bounds overlap, else 0
+static unsigned char OctTree_Node_DoesLooseBoundsOverlap(struct OctTree_Node* node, const float* min, const float* max)
+{
+	float halfWidth = (node->right - node->left) / 2.0f;
+	float halfHeight = (node->top - node->bottom) / 2.0f;
+	float halfDepth = (node->front - node->back) / 2.0f;
+
+	return node->left - halfWidth <= max[0] && node->right + halfWidth >= min[0]
+		&& node->bottom - halfHeight <= max[1] && node->top + halfHeight >= min[1]
+		&& node->back - halfDepth <= max[2] && node->front + halfDepth >= min[2];
+}
+
+///
+//Gets the center and radius of the bounds of an occupant of a loose oct tree
+//
+//Parameters:
+//	centerDest: An array of 3 floats to store the center of the occupant's bounds in
+//	occupant: A pointer to the occupant
+//
+//Returns:
+//	Half of the largest dimension of the occupant's bounds
+static float OctTree_Occupant_GetCenter(float* centerDest, const OctTree_Occupant* occupant)
+{
+	float radius = 0.0f;
+	for(int i = 0; i < 3; i++)
+	{
+		centerDest[i] = (occupant->min[i] + occupant->max[i]) / 2.0f;
+		float halfDimension = (occupant->max[i] - occupant->min[i]) / 2.0f;
+		if(halfDimension > radius)
+		{
+			radius = halfDimension;
+		}
+	}
+	return radius;
+}
+
+///
+//Appends to a loose oct tree's pairs every occupant whose bounds overlap the bounds of the given occupant.
+//Only occupants with a greater index are paired so each pair is found once.
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree containing the occupant
+//	occupantIndex: The index of the occupant to find the pairs of
+static void OctTree_FindLoosePairs(OctTree* tree, unsigned int occupantIndex)
+{
+	OctTree_Occupant* occupants = (OctTree_Occupant*)tree->occupants->data;
+	const OctTree_Occupant* occupant = occupants + occupantIndex;
+	DynamicArray* stack = tree->stack;
+	DynamicArray_Clear(stack);
+	DynamicArray_Append(stack, &tree->root);
+
+	OctTree_Pair pair;
+	pair.obj1 = occupant->obj;
+	while(stack->size > 0)
+	{
+		//A child's loose bounds lie within it's parent's, so nodes whose loose bounds miss the occupant are pruned with their children.
+		//The root also holds the objects outside of it or too large for it, so it is never pruned.
+		struct OctTree_Node* node = ((struct OctTree_Node**)stack->data)[--stack->size];
+		if(node != tree->root && !OctTree_Node_DoesLooseBoundsOverlap(node, occupant->min, occupant->max)) continue;
+
+		unsigned int* indices = (unsigned int*)node->data->data;
+		for(unsigned int i = 0; i < node->data->size; i++)
+		{
+			if(indices[i] <= occupantIndex) continue;
+
+			const OctTree_Occupant* other = occupants + indices[i];
+			if(other->min[0] <= occupant->max[0] && other->max[0] >= occupant->min[0]
+				&& other->min[1] <= occupant->max[1] && other->max[1] >= occupant->min[1]
+				&& other->min[2] <= occupant->max[2] && other->max[2] >= occupant->min[2])
+			{
+				pair.obj2 = other->obj;
+				DynamicArray_Append(tree->pairs, &pair);
+			}
+		}
+
+		//Subtrees without occupants are skipped
+		if(node->children != NULL && node->numLooseOccupants > node->data->size)
+		{
+			for(int i = 0; i < 8; i++)
+			{
+				struct OctTree_Node* child = node->children + i;
+				if(child->numLooseOccupants > 0)
+				{
+					DynamicArray_Append(stack, &child);
+				}
+			}
+		}
+	}
+}
+
 //Functions
 
 ///
@@ -168,6 +592,7 @@ OctTree* OctTree_Allocate()
 	//Assign default values
 	tree->maxDepth = defaultMaxDepth;
 	tree->maxOccupancy = defaultMaxOccupancy;
+	tree->loose = 0;
 
 	return tree;
 }
@@ -185,15 +610,53 @@ OctTree* OctTree_Allocate()
 //	frontBound: The front bound of the octtree
 void OctTree_Initialize(OctTree* tree, float leftBound, float rightBound, float bottomBound, float topBound, float backBound, float frontBound)
 {
+	//Create the node pool, the root is the only node not taken from it
+	tree->nodeSlabs = DynamicArray_Allocate();
+	DynamicArray_Initialize(tree->nodeSlabs, sizeof(struct OctTree_Node*));
+	tree->freeChildren = NULL;
+	tree->numPooledNodes = 0;
+	tree->numLiveNodes = 1;
+	tree->maxLiveNodes = 1;
+
 	//Allocate root
 	tree->root = OctTree_Node_Allocate();
 	//Initialize root
 	OctTree_Node_Initialize(tree->root, tree, NULL, 0, leftBound, rightBound, bottomBound, topBound, backBound, frontBound);
 
-	//Allocate hashmap
+	//Allocate hashmap, a loose tree keeps no log of the nodes holding each object but maps each object to it's occupant instead
 	tree->map = HashMap_Allocate();
-	//Initialize map
+	//Initialize map, which is keyed by pointers to objects
 	HashMap_Initialize(tree->map, 16);
+	tree->map->Hash = Hash_Pointer;
+
+	tree->occupants = DynamicArray_Allocate();
+	DynamicArray_Initialize(tree->occupants, sizeof(OctTree_Occupant));
+	tree->pairs = DynamicArray_Allocate();
+	DynamicArray_Initialize(tree->pairs, sizeof(OctTree_Pair));
+	tree->stack = DynamicArray_Allocate();
+	DynamicArray_Initialize(tree->stack, sizeof(struct OctTree_Node*));
+	tree->numReinserts = 0;
+}
+
+///
+//Initializes a loose oct tree and creates a root node with the given dimensions.
+//Each object in a loose tree lives in exactly one node chosen by it's size and center,
+//So moving an object only ever reinserts it into one node and no log of the nodes holding it is kept.
+//The tree's max depth is raised to defaultLooseMaxDepth.
+//
+//Parameters:
+//	tree: A pointer to the oct tree to initialize
+//	leftBound: The left bound of the octtree
+//	rightBound: The right bound of the octtree
+//	bottomBound: The bottom bound of the octtree
+//	topBound: The top bound of the octtree
+//	backBound: The back bound of the octtree
+//	frontBound: The front bound of the octtree
+void OctTree_InitializeLoose(OctTree* tree, float leftBound, float rightBound, float bottomBound, float topBound, float backBound, float frontBound)
+{
+	tree->loose = 1;
+	tree->maxDepth = defaultLooseMaxDepth;
+	OctTree_Initialize(tree, leftBound, rightBound, bottomBound, topBound, backBound, frontBound);
 }
 
 ///
@@ -205,9 +668,24 @@ void OctTree_Initialize(OctTree* tree, float leftBound, float rightBound, float
 void OctTree_Free(OctTree* tree)
 {
 	//Free the nodes
-	OctTree_Node_Free(tree->root);
+	OctTree_Node_Free(tree, tree->root);
 	//Free the root
 	free(tree->root);
+
+	//Free the node pool
+	struct OctTree_Node** slabs = (struct OctTree_Node**)tree->nodeSlabs->data;
+	for(unsigned int i = 0; i < tree->nodeSlabs->size; i++)
+	{
+		free(slabs[i]);
+	}
+	DynamicArray_Free(tree->nodeSlabs);
+
+	//Free the map, which does not free the logs it holds
+	HashMap_Free(tree->map);
+
+	DynamicArray_Free(tree->occupants);
+	DynamicArray_Free(tree->pairs);
+	DynamicArray_Free(tree->stack);
 	//Free the tree!
 	free(tree);
 }
@@ -217,16 +695,22 @@ void OctTree_Free(OctTree* tree)
 //
 //Parameters:
 //	tree: A pointer to the oct tree to update
-//	gameObjects: A linked list of all game objects currently in the simulation
-void OctTree_Update(OctTree* tree, LinkedList* gameObjects)
+//	colliders: A dynamic array of pointers to every game object with a collider in the simulation
+void OctTree_Update(OctTree* tree, DynamicArray* colliders)
 {
-	struct LinkedList_Node* current = gameObjects->head;
+	if(tree->loose)
+	{
+		OctTree_UpdateLoose(tree);
+		return;
+	}
 
-	while(current != NULL)
+	GObject** gameObjects = (GObject**)colliders->data;
+	for(unsigned int j = 0; j < colliders->size; j++)
 	{
-		GObject* gameObj = (GObject*)current->data;
-		//Find all gameObjects which have entries in the octtree (& treemap)
-		if(gameObj->collider != NULL)
+		GObject* gameObj = gameObjects[j];
+		//Every object with a collider has entries in the octtree (& treemap)
+		//Sleeping objects have not moved, so they are still in the right nodes
+		if(gameObj->body == NULL || gameObj->body->isAwake)
 		{
 			//Get the treemap entry
 			DynamicArray* log = (DynamicArray*)HashMap_LookUp(tree->map, &gameObj, sizeof(GObject*))->data;
@@ -295,8 +779,6 @@ void OctTree_Update(OctTree* tree, LinkedList* gameObjects)
 				}
 			}
 		}
-		//Move to next object in linked list
-		current = current->next;
 	}
 
 }
@@ -309,6 +791,12 @@ void OctTree_Update(OctTree* tree, LinkedList* gameObjects)
 //	obj: A pointer to the game object to add
 void OctTree_Add(OctTree* tree, GObject* obj)
 {
+	if(tree->loose)
+	{
+		OctTree_AddLoose(tree, obj);
+		return;
+	}
+
 	//Add the object to the root node
 	OctTree_Node_Add(tree, tree->root, obj);
 }
@@ -321,6 +809,12 @@ void OctTree_Add(OctTree* tree, GObject* obj)
 //	obj: A pointer to the game object to add
 void OctTree_AddAndLog(OctTree* tree, GObject* obj)
 {
+	if(tree->loose)
+	{
+		OctTree_AddLoose(tree, obj);
+		return;
+	}
+
 	//Add the object to the root node
 	OctTree_Node_AddAndLog(tree, tree->root, obj);
 }
@@ -333,6 +827,12 @@ void OctTree_AddAndLog(OctTree* tree, GObject* obj)
 //  obj: A pointer to the object to be removed
 void OctTree_Remove(OctTree* tree, GObject* obj)
 {
+	if(tree->loose)
+	{
+		OctTree_RemoveLoose(tree, obj);
+		return;
+	}
+
 	OctTree_Node_Remove(tree->root, obj);
 }
 
@@ -344,6 +844,12 @@ void OctTree_Remove(OctTree* tree, GObject* obj)
 //	obj: the object to remove
 void OctTree_RemoveAndUnLog(OctTree* tree, GObject* obj)
 {
+	if(tree->loose)
+	{
+		OctTree_RemoveLoose(tree, obj);
+		return;
+	}
+
 	//Remove from the treemap
 	DynamicArray* objLog = (DynamicArray*)HashMap_Remove(tree->map, &obj, sizeof(GObject*));
 	
@@ -354,6 +860,97 @@ void OctTree_RemoveAndUnLog(OctTree* tree, GObject* obj)
 	OctTree_Remove(tree, obj);
 }
 
+///
+//Finds every game object in an oct tree which may overlap a box.
+//A loose tree tests the bounds each object had at the last update,
+//Any other tree returns each object held by a leaf overlapping the box once.
+//
+//Parameters:
+//	tree: A pointer to the oct tree to query
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the game objects to
+void OctTree_QueryBox(OctTree* tree, const float* min, const float* max, DynamicArray* results)
+{
+	unsigned int firstResult = results->size;
+	DynamicArray* stack = tree->stack;
+	DynamicArray_Clear(stack);
+	DynamicArray_Append(stack, &tree->root);
+
+	while(stack->size > 0)
+	{
+		struct OctTree_Node* node = ((struct OctTree_Node**)stack->data)[--stack->size];
+
+		if(tree->loose)
+		{
+			//A child's loose bounds lie within it's parent's, so nodes whose loose bounds miss the box are pruned with their children.
+			//The root also holds the objects outside of it or too large for it, so it is never pruned.
+			if(node != tree->root && !OctTree_Node_DoesLooseBoundsOverlap(node, min, max)) continue;
+
+			OctTree_Occupant* occupants = (OctTree_Occupant*)tree->occupants->data;
+			unsigned int* indices = (unsigned int*)node->data->data;
+			for(unsigned int i = 0; i < node->data->size; i++)
+			{
+				const OctTree_Occupant* occupant = occupants + indices[i];
+				if(occupant->min[0] <= max[0] && occupant->max[0] >= min[0]
+					&& occupant->min[1] <= max[1] && occupant->max[1] >= min[1]
+					&& occupant->min[2] <= max[2] && occupant->max[2] >= min[2])
+				{
+					DynamicArray_Append(results, (void*)&occupant->obj);
+				}
+			}
+
+			//Subtrees without occupants are skipped
+			if(node->children != NULL && node->numLooseOccupants > node->data->size)
+			{
+				for(int i = 0; i < 8; i++)
+				{
+					struct OctTree_Node* child = node->children + i;
+					if(child->numLooseOccupants > 0)
+					{
+						DynamicArray_Append(stack, &child);
+					}
+				}
+			}
+		}
+		else
+		{
+			if(node->left > max[0] || node->right < min[0]
+				|| node->bottom > max[1] || node->top < min[1]
+				|| node->back > max[2] || node->front < min[2])
+			{
+				continue;
+			}
+
+			if(node->children != NULL)
+			{
+				for(int i = 0; i < 8; i++)
+				{
+					struct OctTree_Node* child = node->children + i;
+					DynamicArray_Append(stack, &child);
+				}
+				continue;
+			}
+
+			//An object spanning several leaves is held by each of them, but is only returned once
+			GObject** objects = (GObject**)node->data->data;
+			for(unsigned int i = 0; i < node->data->size; i++)
+			{
+				GObject** found = (GObject**)results->data + firstResult;
+				GObject** end = (GObject**)results->data + results->size;
+				while(found != end && *found != objects[i])
+				{
+					found++;
+				}
+				if(found == end)
+				{
+					DynamicArray_Append(results, objects + i);
+				}
+			}
+		}
+	}
+}
+
 ///
 //Removes a game object from an oct tree node
 //
@@ -380,14 +977,11 @@ void OctTree_Node_Remove(OctTree_Node* current, GObject* obj)
 	}
 	else
 	{
-		if(current->data->size != 0)
+		//The order of a node's occupants does not matter, so the last takes the place of the one removed
+		unsigned int index = DynamicArray_IndexOf(current->data, &obj, current->data->size);
+		if(index < current->data->size)
 		{
-
-			if(DynamicArray_ContainsWithin(current->data, &obj, current->data->size) == 1)
-			{
-				// this line of code is commented until GetIndexOf is written
-				DynamicArray_RemoveData(current->data, &obj);
-			}
+			DynamicArray_SwapRemove(current->data, index);
 		}
 	}
 }
@@ -433,7 +1027,7 @@ static void OctTree_Node_Add(OctTree* tree, struct OctTree_Node* node, GObject*
 			if(DynamicArray_ContainsWithin(node->data, &obj, node->data->size) == 0)
 			{
 				//Add the object!
-				DynamicArray_Append(node->data, &obj);
+				OctTree_Node_AppendOccupant(node, &obj);
 			}
 		}
 		//Else, we are out of room and can subdivide!
@@ -486,15 +1080,16 @@ void OctTree_Node_AddAndLog(OctTree* tree, struct OctTree_Node* node, GObject* o
 			if(DynamicArray_ContainsWithin(node->data, &obj, node->data->size) == 0)
 			{
 				//Add the object!
-				DynamicArray_Append(node->data, &obj);
+				OctTree_Node_AppendOccupant(node, &obj);
 
 				//Find the entry for this object in the treemap
 				DynamicArray* log = NULL;
 
 				//Is this object already contained in the map?
-				if(HashMap_Contains(tree->map, &obj, sizeof(GObject*)) == 1)
+				struct HashMap_KeyValuePair* logPair = HashMap_LookUp(tree->map, &obj, sizeof(GObject*));
+				if(logPair != NULL)
 				{
-					log = (DynamicArray*)HashMap_LookUp(tree->map, &obj, sizeof(GObject*))->data;
+					log = (DynamicArray*)logPair->data;
 				}
 				else
 				{
@@ -583,18 +1178,16 @@ static void OctTree_Node_Subdivide(OctTree* tree, struct OctTree_Node* node)
 {
 
 	//Allocate this nodes children
-	node->children = OctTree_Node_AllocateChildren();
+	node->children = OctTree_Node_AllocateChildren(tree);
 
 	//Initialize this nodes children
 	OctTree_Node_InitializeChildren(tree, node);
 
+	//Now that the node has children, re-adding an object only adds it to them,
+	//So the occupants can be read from the node's data after it is emptied
 	unsigned int numOccupants = node->data->size;
-	//Create a temporary list of occupants
-	GObject** occupants = (GObject**)malloc(sizeof(GObject**) * numOccupants);
-	//Copy occupants from node into temporary list
-	memcpy(occupants, node->data->data, sizeof(GObject**) * numOccupants);
-	//Clear the node's data
-	DynamicArray_Clear(node->data);
+	GObject** occupants = (GObject**)node->data->data;
+	node->data->size = 0;
 	GObject* current;
 	//re-add all contents to the node
 	for(int i = 0; i < numOccupants; i++)
@@ -604,9 +1197,6 @@ static void OctTree_Node_Subdivide(OctTree* tree, struct OctTree_Node* node)
 		//Add the GObject* back into the node
 		OctTree_Node_Add(tree, node, current);
 	}
-
-	//Free the temporary list of occupants
-	free(occupants);
 }
 
 ///
@@ -620,20 +1210,16 @@ static void OctTree_Node_Subdivide(OctTree* tree, struct OctTree_Node* node)
 static void OctTree_Node_SubdivideAndLog(OctTree*tree, struct OctTree_Node* node)
 {
 	//Allocate this nodes children
-	node->children = OctTree_Node_AllocateChildren();
+	node->children = OctTree_Node_AllocateChildren(tree);
 
 	//Initialize this nodes children
 	OctTree_Node_InitializeChildren(tree, node);
 
+	//Now that the node has children, re-adding an object only adds it to them,
+	//So the occupants can be read from the node's data after it is emptied
 	unsigned int numOccupants = node->data->size;
-	//Create a temporary list of occupants
-	GObject** occupants = (GObject**)malloc(sizeof(GObject**) * numOccupants);
-
-	//Copy occupants from node into temporary list
-	memcpy(occupants, node->data->data, sizeof(GObject**) * numOccupants);
-
-	//Clear the node's data
-	DynamicArray_Clear(node->data);
+	GObject** occupants = (GObject**)node->data->data;
+	node->data->size = 0;
 
 	//re-add all contents to the node
 	GObject* current;
@@ -658,9 +1244,6 @@ static void OctTree_Node_SubdivideAndLog(OctTree*tree, struct OctTree_Node* node
 		//Add the GObject* back into the node
 		OctTree_Node_AddAndLog(tree, node, current);
 	}
-
-	//Free the temporary list of occupants
-	free(occupants);
 }
 
 ///
@@ -687,6 +1270,7 @@ unsigned char OctTree_Node_DoesObjectCollide(OctTree_Node* node, GObject* obj)
 	{
 		primaryFrame = obj->frameOfReference;
 	}
+	FrameOfReference_UpdateRotation(primaryFrame);
 
 	//Determine the type of collider the object has
 	switch(obj->collider->type)
@@ -883,8 +1467,9 @@ static unsigned char OctTree_Node_DoesConvexHullCollide(OctTree_Node* node, Coll
 //	to clean up all unneeded nodes
 //
 //Parameters:
+//	tree: The oct tree the node is part of
 //	node: the base node to check
-void OctTree_Node_CleanAll(OctTree_Node* node)
+void OctTree_Node_CleanAll(OctTree* tree, OctTree_Node* node)
 {
 	// Does the current node have children?
 	if(node->children != NULL)
@@ -908,7 +1493,7 @@ void OctTree_Node_CleanAll(OctTree_Node* node)
 			// Recurse through all the children of this node
 			for(int i = 0; i < 8; i++)
 			{
-				OctTree_Node_CleanAll(node->children+i);
+				OctTree_Node_CleanAll(tree, node->children+i);
 			}
 		}
 
@@ -930,12 +1515,7 @@ void OctTree_Node_CleanAll(OctTree_Node* node)
 			if(hasOccupants == 0)
 			{
 				// Clean out all the children
-				for(int i = 0; i < 8; i++)
-				{
-					OctTree_Node_Free(node->children+i);
-				}
-				free(node->children);
-				node->children = 0;
+				OctTree_Node_FreeChildren(tree, node);
 			}
 		}
 	}
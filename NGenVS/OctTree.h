@@ -13,12 +13,19 @@ struct OctTree_Node
 	struct OctTree_Node* children;
 
 	//The data contained in this node
+	//GObject* of each occupant, or in a loose tree the index of each occupant's OctTree_Occupant
+	//Points to occupants, which keeps it's data in inlineOccupants until the node holds more than fit there
 	DynamicArray* data;
+	DynamicArray occupants;
+	void* inlineOccupants[4];	//Room for 4 GObject* or 8 occupant indices without touching the heap
 
 	//The depth of this node from the root of the tree
 	//The root has a depth of 0.
 	unsigned int depth;
 
+	//Number of occupants held by this node and it's descendants in a loose tree
+	unsigned int numLooseOccupants;
+
 	//Bounds of this oct tree node
 	float left, right;		//Width
 	float bottom, top;		//Height
@@ -31,6 +38,23 @@ struct OctTree_NodeStatus
 	unsigned char collisionStatus;
 };
 
+//An object held by a loose oct tree
+typedef struct OctTree_Occupant
+{
+	GObject* obj;
+	struct OctTree_Node* node;	//The one node holding the object
+	unsigned int nodeSlot;		//Index of the occupant's index in the node's data
+	float min[3];				//Minimum bound of the object's collider on each axis as of the last update
+	float max[3];				//Maximum bound of the object's collider on each axis
+} OctTree_Occupant;
+
+//Two objects in a loose oct tree whose bounds overlap
+typedef struct OctTree_Pair
+{
+	GObject* obj1;
+	GObject* obj2;
+} OctTree_Pair;
+
 typedef struct OctTree
 {
 	//Pointer to the root of the tree
@@ -41,13 +65,32 @@ typedef struct OctTree
 	unsigned int maxOccupancy;	//How many occupants can an octtree have before trying to subdivide
 								//This number will be exceeded if maxDepth is reached.
 
-	//Hashmap used to update tree
+	//Hashmap used to update tree, mapping each object to it's log of nodes, or in a loose tree to the index of it's occupant
 	HashMap* map;
+
+	//A loose tree keeps each object in exactly one node, the deepest node whose loose bounds are sure to contain it.
+	//The loose bounds of a node are it's bounds grown by half of it's size on each side,
+	//So an object fits in any node containing it's center which is at least as large as the object.
+	unsigned char loose;			//1 if the tree is loose, see OctTree_InitializeLoose
+	DynamicArray* occupants;		//OctTree_Occupant of every object in a loose tree
+	DynamicArray* pairs;			//The pairs of objects with overlapping bounds found by the last update of a loose tree
+	DynamicArray* stack;			//Nodes left to visit while finding the pairs of a loose tree
+	unsigned int numReinserts;		//The number of objects which moved to another node during the last update of a loose tree
+
+	//The children of subdivided nodes are taken from a pool of blocks of 8 nodes, so subdividing and collapsing do not touch the heap.
+	//Free blocks are kept in a list linked through the children of the first node of each block.
+	DynamicArray* nodeSlabs;				//Each slab of childBlocksPerSlab blocks allocated by the pool
+	struct OctTree_Node* freeChildren;		//The first block in the pool's free list, NULL if there is none
+	unsigned int numPooledNodes;			//Number of nodes allocated by the pool, which never shrinks, so it is the most the pool has needed
+	unsigned int numLiveNodes;				//Number of nodes in the tree, including the root
+	unsigned int maxLiveNodes;				//The most nodes the tree has held at once
 } OctTree;
 
 //Internal members
 static unsigned int defaultMaxOccupancy = 3;
 static unsigned int defaultMaxDepth = 3;
+static unsigned int defaultLooseMaxDepth = 10;	//Objects in a loose tree only sink as deep as their size allows, so it may be deeper
+static unsigned int childBlocksPerSlab = 64;	//Blocks of 8 children the node pool allocates whenever it runs out
 
 //Internal functions
 
@@ -75,18 +118,41 @@ static struct OctTree_Node* OctTree_Node_Allocate();
 static void OctTree_Node_Initialize(struct OctTree_Node* node, OctTree* tree,  struct OctTree_Node* parent, unsigned int depth, float leftBound, float rightBound, float bottomBound, float topBound, float backBound, float frontBound);
 
 ///
-//Frees data allocated by an oct tree node
+//Frees data allocated by an oct tree node, returning it's descendants to the tree's node pool
 //
 //Parameters:
+//	tree: A pointer to the oct tree this node is part of
 //	node: A pointer to the oct tree node to free
-static void OctTree_Node_Free(struct OctTree_Node* node);
+static void OctTree_Node_Free(OctTree* tree, struct OctTree_Node* node);
 
 ///
-//Allocates the children of an oct tree node
+//Takes the children of an oct tree node from the tree's node pool,
+//Allocating another slab of blocks only when the pool has none free
+//
+//Parameters:
+//	tree: A pointer to the oct tree the children will be a part of
 //
 //Returns:
-//	A pointer to an array of 8 newly allocated, uninitialized node children
-static struct OctTree_Node* OctTree_Node_AllocateChildren();
+//	A pointer to an array of 8 uninitialized node children
+static struct OctTree_Node* OctTree_Node_AllocateChildren(OctTree* tree);
+
+///
+//Frees the children of an oct tree node and returns them to the tree's node pool
+//
+//Parameters:
+//	tree: A pointer to the oct tree the node is part of
+//	node: A pointer to the node to free the children of
+static void OctTree_Node_FreeChildren(OctTree* tree, struct OctTree_Node* node);
+
+///
+//Appends an occupant to the data of an oct tree node.
+//The occupants are moved from the node's inline storage to the heap once they no longer fit,
+//Which only happens to nodes holding more than the tree's max occupancy.
+//
+//Parameters:
+//	node: A pointer to the node to append the occupant to
+//	occupant: A pointer to the GObject* or occupant index to append
+static void OctTree_Node_AppendOccupant(struct OctTree_Node* node, void* occupant);
 
 ///
 //Initializes the children of an oct tree node
@@ -96,6 +162,115 @@ static struct OctTree_Node* OctTree_Node_AllocateChildren();
 //	node: A pointer to the node to initialize the children of
 static void OctTree_Node_InitializeChildren(OctTree* tree, struct OctTree_Node* parent);
 
+///
+//Refits the bounds of every object in a loose oct tree, moves the objects which no longer belong in their node,
+//And finds every pair of objects whose bounds overlap.
+//Sleeping objects have not moved, so they are left where they are.
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree to update
+static void OctTree_UpdateLoose(OctTree* tree);
+
+///
+//Adds a game object to a loose oct tree
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree to add the object to
+//	obj: A pointer to the game object to add
+static void OctTree_AddLoose(OctTree* tree, GObject* obj);
+
+///
+//Removes a game object from a loose oct tree.
+//The object's occupant is found through the tree's map, and the last occupant is moved into it's slot,
+//So removal takes the same time however many objects the tree holds.
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree to remove the object from
+//	obj: A pointer to the game object to remove
+static void OctTree_RemoveLoose(OctTree* tree, GObject* obj);
+
+///
+//Places an occupant of a loose oct tree in the deepest node below a node which fits it,
+//Subdividing full leaves on the way down.
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree holding the occupant
+//	node: A pointer to the node to start searching down from
+//	occupantIndex: The index of the occupant to place
+static void OctTree_Node_AddLooseOccupant(OctTree* tree, struct OctTree_Node* node, unsigned int occupantIndex);
+
+///
+//Removes an occupant's index from the node of a loose oct tree holding it.
+//The occupant knows where it's index lies in the node, so the node's occupants are not searched.
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree holding the occupant
+//	occupantIndex: The index of the occupant to remove
+static void OctTree_Node_RemoveLooseOccupant(OctTree* tree, unsigned int occupantIndex);
+
+///
+//Subdivides a node of a loose oct tree into 8 child nodes, moving each occupant which fits in a child down into it
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree in which this node lives
+//	node: A pointer to the node being subdivided
+static void OctTree_Node_SubdivideLoose(OctTree* tree, struct OctTree_Node* node);
+
+///
+//Gets the child of a node whose octant a point lies in, or would lie in if the point is outside of the node
+//
+//Parameters:
+//	node: A pointer to the node to get the child of, must have children
+//	point: An array of 3 floats holding the point
+//
+//Returns:
+//	A pointer to the child
+static struct OctTree_Node* OctTree_Node_GetChildContaining(struct OctTree_Node* node, const float* point);
+
+///
+//Determines if the loose bounds of an oct tree node are sure to contain an object
+//
+//Parameters:
+//	node: A pointer to the node to test
+//	center: An array of 3 floats holding the center of the object's bounds
+//	radius: Half of the largest dimension of the object's bounds
+//
+//Returns:
+//	1 if the node contains the center and is at least as large as the object, else 0
+static unsigned char OctTree_Node_CanLooselyContain(struct OctTree_Node* node, const float* center, float radius);
+
+///
+//Determines if the loose bounds of an oct tree node overlap a box
+//
+//Parameters:
+//	node: A pointer to the node to test
+//	min: The minimum bound of the box on each axis
+//	max: The maximum bound of the box on each axis
+//
+//Returns:
+//	1 if the bounds overlap, else 0
+static unsigned char OctTree_Node_DoesLooseBoundsOverlap(struct OctTree_Node* node, const float* min, const float* max);
+
+///
+//Gets the center and radius of the bounds of an occupant of a loose oct tree
+//
+//Parameters:
+//	centerDest: An array of 3 floats to store the center of the occupant's bounds in
+//	occupant: A pointer to the occupant
+//
+//Returns:
+//	Half of the largest dimension of the occupant's bounds
+static float OctTree_Occupant_GetCenter(float* centerDest, const OctTree_Occupant* occupant);
+
+///
+//Appends to a loose oct tree's pairs every occupant whose bounds overlap the bounds of the given occupant.
+//Only occupants with a greater index are paired so each pair is found once.
+//
+//Parameters:
+//	tree: A pointer to the loose oct tree containing the occupant
+//	occupantIndex: The index of the occupant to find the pairs of
+static void OctTree_FindLoosePairs(OctTree* tree, unsigned int occupantIndex);
+
 //Functions
 
 ///
@@ -118,6 +293,22 @@ OctTree* OctTree_Allocate();
 //	frontBound: The front bound of the octtree
 void OctTree_Initialize(OctTree* tree, float leftBound, float rightBound, float bottomBound, float topBound, float backBound, float frontBound);
 
+///
+//Initializes a loose oct tree and creates a root node with the given dimensions.
+//Each object in a loose tree lives in exactly one node chosen by it's size and center,
+//So moving an object only ever reinserts it into one node and no log of the nodes holding it is kept.
+//The tree's max depth is raised to defaultLooseMaxDepth.
+//
+//Parameters:
+//	tree: A pointer to the oct tree to initialize
+//	leftBound: The left bound of the octtree
+//	rightBound: The right bound of the octtree
+//	bottomBound: The bottom bound of the octtree
+//	topBound: The top bound of the octtree
+//	backBound: The back bound of the octtree
+//	frontBound: The front bound of the octtree
+void OctTree_InitializeLoose(OctTree* tree, float leftBound, float rightBound, float bottomBound, float topBound, float backBound, float frontBound);
+
 ///
 //Frees the data allocated by an octtree.
 //Does not free any of the data contained within the octtree!
@@ -128,11 +319,12 @@ void OctTree_Free(OctTree* tree);
 
 ///
 //Updates the position of all gameobjects within the oct tree
+//A loose tree updates the objects it holds and finds the pairs of them whose bounds overlap instead
 //
 //Parameters:
 //	tree: A pointer to the oct tree to update
-//	gameObjects: A linked list of all game objects currently in the simulation
-void OctTree_Update(OctTree* tree, LinkedList* gameObjects);
+//	colliders: A dynamic array of pointers to every game object with a collider in the simulation, unused by a loose tree
+void OctTree_Update(OctTree* tree, DynamicArray* colliders);
 
 ///
 //Adds a game object to the oct tree
@@ -144,6 +336,7 @@ void OctTree_Add(OctTree* tree, GObject* obj);
 
 ///
 //Adds a game object to the oct tree logging all nodes in which it is contained
+//A loose tree keeps no log, so the object is only added
 //
 //Parameters:
 //	tree: A pointer to the oct tree to add a game object to
@@ -160,12 +353,25 @@ void OctTree_Remove(OctTree* tree, GObject* obj);
 
 ///
 //Removes a game object from the oct tree and the tree's log
+//A loose tree keeps no log, so the object is only removed
 //
 //Parameters:
 //	tree: The tree to remove the object from
 //	obj: the object to remove
 void OctTree_RemoveAndUnLog(OctTree* tree, GObject* obj);
 
+///
+//Finds every game object in an oct tree which may overlap a box.
+//A loose tree tests the bounds each object had at the last update,
+//Any other tree returns each object held by a leaf overlapping the box once.
+//
+//Parameters:
+//	tree: A pointer to the oct tree to query
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the game objects to
+void OctTree_QueryBox(OctTree* tree, const float* min, const float* max, DynamicArray* results);
+
 
 ///
 //Adds a game object to a node of the oct tree
@@ -272,8 +478,9 @@ static unsigned char OctTree_Node_DoesConvexHullCollide(OctTree_Node* node, Coll
 //	to clean up all unneeded nodes
 //
 //Parameters:
+//	tree: The oct tree the node is part of
 //	node: the base node to check
-void OctTree_Node_CleanAll(OctTree_Node* node);
+void OctTree_Node_CleanAll(OctTree* tree, OctTree_Node* node);
 
 ///
 //Searches up from a leaf node to find the lowest node which fully contains this object
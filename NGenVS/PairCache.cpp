@@ -0,0 +1,473 @@
+#include "PairCache.h"
+
+#include <stdlib.h>
+
+#include "Hash.h"
+
+///
+//Allocates memory for a pair cache
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized pair cache
+PairCache* PairCache_Allocate(void)
+{
+	PairCache* cache = (PairCache*)malloc(sizeof(PairCache));
+	return cache;
+}
+
+///
+//Initializes a pair cache with no pairs
+//
+//Parameters:
+//	cache: A pointer to the pair cache to initialize
+//	capacity: The initial number of slots, rounded up to a power of 2
+void PairCache_Initialize(PairCache* cache, unsigned int capacity)
+{
+	cache->capacity = 1;
+	while(cache->capacity < capacity)
+	{
+		cache->capacity <<= 1;
+	}
+
+	cache->entries = (PairCache_Entry*)calloc(cache->capacity, sizeof(PairCache_Entry));
+	cache->size = 0;
+	cache->frame = 0;
+
+	cache->partners = HashMap_Allocate();
+	HashMap_Initialize(cache->partners, capacity);
+	cache->partners->Hash = Hash_Pointer;
+
+	cache->ended = DynamicArray_Allocate();
+	DynamicArray_Initialize(cache->ended, sizeof(PairCache_Entry));
+
+	cache->kept = DynamicArray_Allocate();
+	DynamicArray_Initialize(cache->kept, sizeof(PairCache_Entry));
+}
+
+///
+//Frees the data allocated by a pair cache.
+//Does not free any of the objects referenced by the pair cache!
+//
+//Parameters:
+//	cache: A pointer to the pair cache to free
+void PairCache_Free(PairCache* cache)
+{
+	free(cache->entries);
+
+	//The map does not free the arrays of partners it holds
+	struct HashMap_KeyValuePair* slots = (struct HashMap_KeyValuePair*)cache->partners->data->data;
+	for(unsigned int i = 0; i < cache->partners->data->capacity; i++)
+	{
+		if(slots[i].probeLength != 0)
+		{
+			DynamicArray_Free((DynamicArray*)slots[i].data);
+		}
+	}
+	HashMap_Free(cache->partners);
+
+	DynamicArray_Free(cache->ended);
+	DynamicArray_Free(cache->kept);
+
+	free(cache);
+}
+
+///
+//Begins a new frame
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+void PairCache_BeginFrame(PairCache* cache)
+{
+	cache->frame++;
+}
+
+///
+//Marks a pair of objects as touched this frame, adding the pair if it is not in the cache
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	obj1: One object of the pair
+//	obj2: The other object of the pair
+//
+//Returns:
+//	A pointer to the pair's entry, valid until the cache is next changed,
+//	Or NULL if the pair was already touched this frame.
+PairCache_Entry* PairCache_Touch(PairCache* cache, GObject* obj1, GObject* obj2)
+{
+	//Order the pair so it has one entry whichever order it is found in
+	if(obj2 < obj1)
+	{
+		GObject* temp = obj1;
+		obj1 = obj2;
+		obj2 = temp;
+	}
+
+	//Keep the table at most half full so probes stay short
+	if((cache->size + 1) * 2 > cache->capacity)
+	{
+		PairCache_Grow(cache);
+	}
+
+	PairCache_Entry* entry = PairCache_FindSlot(cache->entries, cache->capacity, obj1, obj2);
+	if(entry == NULL)
+	{
+		PairCache_Entry newEntry;
+		newEntry.obj1 = obj1;
+		newEntry.obj2 = obj2;
+		newEntry.touchedFrame = 0;
+		newEntry.wasColliding = 0;
+		newEntry.isColliding = 0;
+		newEntry.numContacts = 0;
+		entry = PairCache_Insert(cache->entries, cache->capacity, newEntry);
+		cache->size++;
+
+		PairCache_AddPartner(cache, obj1, obj2);
+		PairCache_AddPartner(cache, obj2, obj1);
+	}
+	else if(entry->touchedFrame == cache->frame)
+	{
+		return NULL;
+	}
+
+	entry->touchedFrame = cache->frame;
+	return entry;
+}
+
+///
+//Finds the entry of a pair of objects without adding the pair
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	obj1: One object of the pair
+//	obj2: The other object of the pair
+//
+//Returns:
+//	A pointer to the pair's entry, valid until the cache is next changed,
+//	Or NULL if the pair is not in the cache.
+PairCache_Entry* PairCache_Find(PairCache* cache, GObject* obj1, GObject* obj2)
+{
+	if(obj2 < obj1)
+	{
+		GObject* temp = obj1;
+		obj1 = obj2;
+		obj2 = temp;
+	}
+
+	return PairCache_FindSlot(cache->entries, cache->capacity, obj1, obj2);
+}
+
+///
+//Determines whether a pair of objects is asleep.
+//A pair is asleep when at least one of it's objects is sleeping and neither is being simulated,
+//Such pairs cannot have moved since they were last tested so they are not tested again.
+//
+//Parameters:
+//	obj1: One object of the pair
+//	obj2: The other object of the pair
+//
+//Returns:
+//	1 if the pair is asleep, else 0
+unsigned char PairCache_IsPairAsleep(const GObject* obj1, const GObject* obj2)
+{
+	unsigned char simulated1 = obj1->body != NULL && obj1->body->physicsOn;
+	unsigned char simulated2 = obj2->body != NULL && obj2->body->physicsOn;
+	unsigned char awake1 = simulated1 && obj1->body->isAwake;
+	unsigned char awake2 = simulated2 && obj2->body->isAwake;
+
+	//Pairs of objects without physics are still tested, as they can be moved by other means
+	return !awake1 && !awake2 && (simulated1 || simulated2);
+}
+
+///
+//Marks a pair as colliding this frame
+//
+//Parameters:
+//	entry: A pointer to the pair's entry as returned by PairCache_Touch
+//
+//Returns:
+//	CONTACT_BEGIN if the pair was not colliding last frame, else CONTACT_STAY
+ContactEvent PairCache_SetColliding(PairCache_Entry* entry)
+{
+	entry->isColliding = 1;
+	return entry->wasColliding ? CONTACT_STAY : CONTACT_BEGIN;
+}
+
+///
+//Ends the current frame.
+//Pairs which were colliding last frame but were not found colliding this frame are moved to the ended array,
+//And every pair which is not colliding is dropped from the cache.
+//Pairs which are asleep are not tested, so they keep colliding until they wake.
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+void PairCache_EndFrame(PairCache* cache)
+{
+	DynamicArray_Clear(cache->ended);
+	DynamicArray_Clear(cache->kept);
+
+	for(unsigned int i = 0; i < cache->capacity; i++)
+	{
+		PairCache_Entry* entry = cache->entries + i;
+		if(entry->obj1 == NULL) continue;
+
+		if(entry->isColliding)
+		{
+			entry->wasColliding = 1;
+			entry->isColliding = 0;
+			DynamicArray_Append(cache->kept, entry);
+		}
+		else if(entry->wasColliding && PairCache_IsPairAsleep(entry->obj1, entry->obj2))
+		{
+			DynamicArray_Append(cache->kept, entry);
+		}
+		else if(entry->wasColliding)
+		{
+			DynamicArray_Append(cache->ended, entry);
+		}
+	}
+
+	PairCache_Rebuild(cache);
+}
+
+///
+//Removes every pair containing an object from a pair cache, including those in the ended array.
+//Must be called before the object is freed so a new object at the same address does not inherit it's pairs.
+//Sleeping objects which were colliding with the object are woken, as they may have been resting on it.
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	obj: A pointer to the object to remove the pairs of
+void PairCache_RemoveObject(PairCache* cache, GObject* obj)
+{
+	DynamicArray* partners = (DynamicArray*)HashMap_Remove(cache->partners, &obj, sizeof(GObject*));
+	if(partners != NULL)
+	{
+		GObject** others = (GObject**)partners->data;
+		for(unsigned int i = 0; i < partners->size; i++)
+		{
+			GObject* other = others[i];
+			PairCache_Entry* entry = obj < other ? PairCache_FindSlot(cache->entries, cache->capacity, obj, other) : PairCache_FindSlot(cache->entries, cache->capacity, other, obj);
+			if(entry->wasColliding && other->body != NULL)
+			{
+				RigidBody_Wake(other->body);
+			}
+
+			PairCache_RemoveSlot(cache, entry);
+			PairCache_RemovePartner(cache, other, obj);
+		}
+		DynamicArray_Free(partners);
+	}
+
+	PairCache_Entry* ended = (PairCache_Entry*)cache->ended->data;
+	unsigned int numKept = 0;
+	for(unsigned int i = 0; i < cache->ended->size; i++)
+	{
+		if(ended[i].obj1 == obj || ended[i].obj2 == obj) continue;
+		ended[numKept++] = ended[i];
+	}
+	cache->ended->size = numKept;
+}
+
+///
+//Hashes an ordered pair of objects
+//
+//Parameters:
+//	obj1: The object of the pair with the lower address
+//	obj2: The object of the pair with the higher address
+//
+//Returns:
+//	The hash of the pair
+static unsigned int PairCache_Hash(const GObject* obj1, const GObject* obj2)
+{
+	//The low bits of an address are mostly alignment, so they are shifted out before mixing
+	unsigned int hash = (unsigned int)((size_t)obj1 >> 3) * 73856093u ^ (unsigned int)((size_t)obj2 >> 3) * 19349663u;
+	hash ^= hash >> 13;
+	hash *= 0x5bd1e995u;
+	hash ^= hash >> 15;
+	return hash;
+}
+
+///
+//Finds the slot holding an ordered pair of objects, or the empty slot where it would be inserted
+//
+//Parameters:
+//	entries: The table of entries to search
+//	capacity: The number of slots in the table
+//	obj1: The object of the pair with the lower address
+//	obj2: The object of the pair with the higher address
+//
+//Returns:
+//	A pointer to the slot, or NULL if the pair is not in the table
+static PairCache_Entry* PairCache_FindSlot(PairCache_Entry* entries, unsigned int capacity, const GObject* obj1, const GObject* obj2)
+{
+	unsigned int mask = capacity - 1;
+	unsigned int index = PairCache_Hash(obj1, obj2) & mask;
+
+	//Once the search is further from the pair's slot than the entry it reaches, the pair would have taken that entry's place
+	for(unsigned int probeLength = 1; probeLength <= entries[index].probeLength; probeLength++)
+	{
+		if(entries[index].obj1 == obj1 && entries[index].obj2 == obj2)
+		{
+			return entries + index;
+		}
+		index = (index + 1) & mask;
+	}
+	return NULL;
+}
+
+///
+//Inserts an entry into a table which does not hold it's pair,
+//Moving each entry which is closer to it's own slot than the new entry one slot along.
+//
+//Parameters:
+//	entries: The table of entries to insert into, with at least one empty slot
+//	capacity: The number of slots in the table
+//	entry: The entry to insert
+//
+//Returns:
+//	A pointer to the slot the entry was inserted into
+static PairCache_Entry* PairCache_Insert(PairCache_Entry* entries, unsigned int capacity, PairCache_Entry entry)
+{
+	unsigned int mask = capacity - 1;
+	unsigned int index = PairCache_Hash(entry.obj1, entry.obj2) & mask;
+	PairCache_Entry* inserted = NULL;
+
+	entry.probeLength = 1;
+	while(entries[index].probeLength != 0)
+	{
+		//The entry further from it's slot takes this one, and the other carries on looking
+		if(entries[index].probeLength < entry.probeLength)
+		{
+			PairCache_Entry displaced = entries[index];
+			entries[index] = entry;
+			entry = displaced;
+			if(inserted == NULL)
+			{
+				inserted = entries + index;
+			}
+		}
+
+		index = (index + 1) & mask;
+		entry.probeLength++;
+	}
+
+	entries[index] = entry;
+	return inserted != NULL ? inserted : entries + index;
+}
+
+///
+//Empties the slot of an entry, shifting back each following entry which is not already in it's own slot so no tombstone is left behind
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	entry: A pointer to the slot of the entry to remove
+static void PairCache_RemoveSlot(PairCache* cache, PairCache_Entry* entry)
+{
+	unsigned int mask = cache->capacity - 1;
+	unsigned int index = (unsigned int)(entry - cache->entries);
+
+	//Stops at an empty slot or an entry in it's own slot
+	unsigned int next = (index + 1) & mask;
+	while(cache->entries[next].probeLength > 1)
+	{
+		cache->entries[index] = cache->entries[next];
+		cache->entries[index].probeLength--;
+		index = next;
+		next = (next + 1) & mask;
+	}
+	cache->entries[index].obj1 = NULL;
+	cache->entries[index].probeLength = 0;
+	cache->size--;
+}
+
+///
+//Records that an object is paired with another
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	obj: The object to add the partner of
+//	partner: The object it is paired with
+static void PairCache_AddPartner(PairCache* cache, GObject* obj, GObject* partner)
+{
+	struct HashMap_KeyValuePair* pair = HashMap_LookUp(cache->partners, &obj, sizeof(GObject*));
+	DynamicArray* partners;
+	if(pair != NULL)
+	{
+		partners = (DynamicArray*)pair->data;
+	}
+	else
+	{
+		partners = DynamicArray_Allocate();
+		DynamicArray_Initialize(partners, sizeof(GObject*));
+		HashMap_Add(cache->partners, &obj, partners, sizeof(GObject*));
+	}
+	DynamicArray_Append(partners, &partner);
+}
+
+///
+//Forgets that an object is paired with another
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	obj: The object to remove the partner of
+//	partner: The object it was paired with
+static void PairCache_RemovePartner(PairCache* cache, GObject* obj, GObject* partner)
+{
+	DynamicArray* partners = (DynamicArray*)HashMap_LookUp(cache->partners, &obj, sizeof(GObject*))->data;
+	DynamicArray_SwapRemove(partners, DynamicArray_IndexOf(partners, &partner, partners->size));
+}
+
+///
+//Doubles the number of slots in a pair cache, reinserting each entry
+//
+//Parameters:
+//	cache: A pointer to the pair cache to grow
+static void PairCache_Grow(PairCache* cache)
+{
+	unsigned int capacity = cache->capacity * 2;
+	PairCache_Entry* entries = (PairCache_Entry*)calloc(capacity, sizeof(PairCache_Entry));
+
+	for(unsigned int i = 0; i < cache->capacity; i++)
+	{
+		PairCache_Entry* entry = cache->entries + i;
+		if(entry->obj1 == NULL) continue;
+		PairCache_Insert(entries, capacity, *entry);
+	}
+
+	free(cache->entries);
+	cache->entries = entries;
+	cache->capacity = capacity;
+}
+
+///
+//Empties the table of a pair cache and reinserts the entries held in it's kept array, along with their objects' partners
+//
+//Parameters:
+//	cache: A pointer to the pair cache to rebuild
+static void PairCache_Rebuild(PairCache* cache)
+{
+	for(unsigned int i = 0; i < cache->capacity; i++)
+	{
+		cache->entries[i].obj1 = NULL;
+		cache->entries[i].probeLength = 0;
+	}
+
+	//The arrays are kept for the objects which are paired again, rather than freed and allocated every frame
+	struct HashMap_KeyValuePair* slots = (struct HashMap_KeyValuePair*)cache->partners->data->data;
+	for(unsigned int i = 0; i < cache->partners->data->capacity; i++)
+	{
+		if(slots[i].probeLength != 0)
+		{
+			DynamicArray_Clear((DynamicArray*)slots[i].data);
+		}
+	}
+
+	PairCache_Entry* kept = (PairCache_Entry*)cache->kept->data;
+	for(unsigned int i = 0; i < cache->kept->size; i++)
+	{
+		PairCache_Insert(cache->entries, cache->capacity, kept[i]);
+		PairCache_AddPartner(cache, kept[i].obj1, kept[i].obj2);
+		PairCache_AddPartner(cache, kept[i].obj2, kept[i].obj1);
+	}
+	cache->size = cache->kept->size;
+}
@@ -0,0 +1,240 @@
+#ifndef PAIRCACHE_H
+#define PAIRCACHE_H
+
+#include "GObject.h"
+#include "DynamicArray.h"
+#include "HashMap.h"
+
+//Describes how the contact between a pair of objects changed since the last frame
+enum ContactEvent
+{
+	CONTACT_BEGIN,		//The pair is colliding this frame but was not last frame
+	CONTACT_STAY,		//The pair was colliding last frame and still is
+	CONTACT_END			//The pair was colliding last frame but is not anymore
+};
+
+//Number of contact points kept for each pair
+static const unsigned int PairCache_maxContacts = 4;
+
+//The impulses a solver accumulated at a contact point, kept so it can start from them next frame
+typedef struct PairCache_Contact
+{
+	float localPoint[3];			//The contact point in the space of the pair's obj1
+	float normalImpulse;			//The impulse along the contact normal
+	float tangentImpulse[3];		//The friction impulse applied to the pair's obj1
+} PairCache_Contact;
+
+//The state of a pair of objects kept by a pair cache
+typedef struct PairCache_Entry
+{
+	GObject* obj1;					//The object of the pair with the lower address, NULL if the slot is empty
+	GObject* obj2;					//The object of the pair with the higher address
+	unsigned int touchedFrame;		//The frame in which the pair was last touched
+	unsigned char wasColliding;		//1 if the pair was colliding last frame
+	unsigned char isColliding;		//1 if the pair has been found colliding this frame
+	unsigned short probeLength;		//1 more than the distance from the slot the pair hashes to, 0 if the slot is empty
+
+	unsigned char numContacts;								//Number of contacts stored by the solver, 0 for a new pair
+	PairCache_Contact contacts[PairCache_maxContacts];		//The contacts stored by the solver the last time the pair was solved
+} PairCache_Entry;
+
+//A hash table of pairs of objects which persists across frames.
+//It holds every pair touched during the current frame and every pair which was colliding at the end of the last frame.
+typedef struct PairCache
+{
+	PairCache_Entry* entries;		//Open addressed table of entries using Robin Hood hashing, so removing a pair shifts the entries after it back
+	unsigned int capacity;			//Number of slots in the table, always a power of 2
+	unsigned int size;				//Number of slots in use
+	HashMap* partners;				//Maps each object in the table to a DynamicArray of the objects it is paired with
+
+	unsigned int frame;				//Incremented at the start of each frame, 0 before the first frame
+
+	DynamicArray* ended;			//Entries of the pairs whose contact ended in the last frame
+	DynamicArray* kept;				//Scratch storage for the entries which survive the end of a frame
+} PairCache;
+
+//Internal members
+static const unsigned int PairCache_defaultCapacity = 256;	//Number of slots a pair cache is initialized with
+
+//Internal functions
+
+///
+//Hashes an ordered pair of objects
+//
+//Parameters:
+//	obj1: The object of the pair with the lower address
+//	obj2: The object of the pair with the higher address
+//
+//Returns:
+//	The hash of the pair
+static unsigned int PairCache_Hash(const GObject* obj1, const GObject* obj2);
+
+///
+//Finds the slot holding an ordered pair of objects
+//
+//Parameters:
+//	entries: The table of entries to search
+//	capacity: The number of slots in the table
+//	obj1: The object of the pair with the lower address
+//	obj2: The object of the pair with the higher address
+//
+//Returns:
+//	A pointer to the slot, or NULL if the pair is not in the table
+static PairCache_Entry* PairCache_FindSlot(PairCache_Entry* entries, unsigned int capacity, const GObject* obj1, const GObject* obj2);
+
+///
+//Inserts an entry into a table which does not hold it's pair,
+//Moving each entry which is closer to it's own slot than the new entry one slot along.
+//
+//Parameters:
+//	entries: The table of entries to insert into, with at least one empty slot
+//	capacity: The number of slots in the table
+//	entry: The entry to insert
+//
+//Returns:
+//	A pointer to the slot the entry was inserted into
+static PairCache_Entry* PairCache_Insert(PairCache_Entry* entries, unsigned int capacity, PairCache_Entry entry);
+
+///
+//Empties the slot of an entry, shifting back each following entry which is not already in it's own slot so no tombstone is left behind
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	entry: A pointer to the slot of the entry to remove
+static void PairCache_RemoveSlot(PairCache* cache, PairCache_Entry* entry);
+
+///
+//Records that an object is paired with another
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	obj: The object to add the partner of
+//	partner: The object it is paired with
+static void PairCache_AddPartner(PairCache* cache, GObject* obj, GObject* partner);
+
+///
+//Forgets that an object is paired with another
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	obj: The object to remove the partner of
+//	partner: The object it was paired with
+static void PairCache_RemovePartner(PairCache* cache, GObject* obj, GObject* partner);
+
+///
+//Doubles the number of slots in a pair cache, reinserting each entry
+//
+//Parameters:
+//	cache: A pointer to the pair cache to grow
+static void PairCache_Grow(PairCache* cache);
+
+///
+//Empties the table of a pair cache and reinserts the entries held in it's kept array, along with their objects' partners
+//
+//Parameters:
+//	cache: A pointer to the pair cache to rebuild
+static void PairCache_Rebuild(PairCache* cache);
+
+//Functions
+
+///
+//Allocates memory for a pair cache
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized pair cache
+PairCache* PairCache_Allocate(void);
+
+///
+//Initializes a pair cache with no pairs
+//
+//Parameters:
+//	cache: A pointer to the pair cache to initialize
+//	capacity: The initial number of slots, rounded up to a power of 2
+void PairCache_Initialize(PairCache* cache, unsigned int capacity);
+
+///
+//Frees the data allocated by a pair cache.
+//Does not free any of the objects referenced by the pair cache!
+//
+//Parameters:
+//	cache: A pointer to the pair cache to free
+void PairCache_Free(PairCache* cache);
+
+///
+//Begins a new frame
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+void PairCache_BeginFrame(PairCache* cache);
+
+///
+//Marks a pair of objects as touched this frame, adding the pair if it is not in the cache
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	obj1: One object of the pair
+//	obj2: The other object of the pair
+//
+//Returns:
+//	A pointer to the pair's entry, valid until the cache is next changed,
+//	Or NULL if the pair was already touched this frame.
+PairCache_Entry* PairCache_Touch(PairCache* cache, GObject* obj1, GObject* obj2);
+
+///
+//Finds the entry of a pair of objects without adding the pair
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	obj1: One object of the pair
+//	obj2: The other object of the pair
+//
+//Returns:
+//	A pointer to the pair's entry, valid until the cache is next changed,
+//	Or NULL if the pair is not in the cache.
+PairCache_Entry* PairCache_Find(PairCache* cache, GObject* obj1, GObject* obj2);
+
+///
+//Determines whether a pair of objects is asleep.
+//A pair is asleep when at least one of it's objects is sleeping and neither is being simulated,
+//Such pairs cannot have moved since they were last tested so they are not tested again.
+//
+//Parameters:
+//	obj1: One object of the pair
+//	obj2: The other object of the pair
+//
+//Returns:
+//	1 if the pair is asleep, else 0
+unsigned char PairCache_IsPairAsleep(const GObject* obj1, const GObject* obj2);
+
+///
+//Marks a pair as colliding this frame
+//
+//Parameters:
+//	entry: A pointer to the pair's entry as returned by PairCache_Touch
+//
+//Returns:
+//	CONTACT_BEGIN if the pair was not colliding last frame, else CONTACT_STAY
+ContactEvent PairCache_SetColliding(PairCache_Entry* entry);
+
+///
+//Ends the current frame.
+//Pairs which were colliding last frame but were not found colliding this frame are moved to the ended array,
+//And every pair which is not colliding is dropped from the cache.
+//Pairs which are asleep are not tested, so they keep colliding until they wake.
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+void PairCache_EndFrame(PairCache* cache);
+
+///
+//Removes every pair containing an object from a pair cache, including those in the ended array.
+//Only the object's own pairs are visited, each removed from the table in place.
+//Must be called before the object is freed so a new object at the same address does not inherit it's pairs.
+//Sleeping objects which were colliding with the object are woken, as they may have been resting on it.
+//
+//Parameters:
+//	cache: A pointer to the pair cache
+//	obj: A pointer to the object to remove the pairs of
+void PairCache_RemoveObject(PairCache* cache, GObject* obj);
+
+#endif
@@ -2,8 +2,12 @@
 
 #include <stdio.h>
 #include <math.h>
+#include <float.h>
+#include <string.h>
 
 #include "TimeManager.h"
+#include "ObjectManager.h"
+#include "SIMDMath.h"
 
 ///
 //Allocates memory for a new Physics Buffer
@@ -28,337 +32,1737 @@ static void PhysicsManager_InitializeBuffer(PhysicsBuffer* buffer)
 
 	buffer->globalAccelerations = LinkedList_Allocate();
 	LinkedList_Initialize(buffer->globalAccelerations);
+
+	buffer->solver = SOLVER_SEQUENTIALIMPULSE;
+	buffer->solverIterations = PhysicsManager_defaultSolverIterations;
+	buffer->previousDeltaTime = 0.0f;
+
+	buffer->contactConstraints = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->contactConstraints, sizeof(ContactConstraint));
+
+	buffer->contactCandidates = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->contactCandidates, sizeof(ContactPoint));
+
+	for(int i = 0; i < 2; i++)
+	{
+		buffer->features[i] = DynamicArray_Allocate();
+		DynamicArray_Initialize(buffer->features[i], sizeof(Vec3));
+
+		buffer->clipBuffers[i] = DynamicArray_Allocate();
+		DynamicArray_Initialize(buffer->clipBuffers[i], sizeof(Vec3));
+	}
+
+	buffer->featureAngles = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->featureAngles, sizeof(float));
+
+	buffer->timeToSleep = PhysicsManager_defaultTimeToSleep;
+	buffer->islandBodies = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->islandBodies, sizeof(RigidBody*));
+
+	buffer->sweptObjects = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->sweptObjects, sizeof(GObject*));
+
+	buffer->sweepTargets = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->sweepTargets, sizeof(GObject*));
+
+	buffer->syncedObjects = DynamicArray_Allocate();
+	DynamicArray_Initialize(buffer->syncedObjects, sizeof(GObject*));
+}
+
+///
+//Frees memory taken by a physics buffer
+//
+//Parameters:
+//	buffer: The buffer to free the memory of
+static void PhysicsManager_FreeBuffer(PhysicsBuffer* buffer)
+{
+	//Delete all vectors in the list of global forces
+	LinkedList_Node* current = buffer->globalForces->head;
+	while(current != NULL)
+	{
+		Vector_Free((Vector*)current->data);
+		current = current->next;
+	}
+	//Delete list of global forces
+	LinkedList_Free(buffer->globalForces);
+
+	//Delete all vectors in the list of global accelerations
+	current = buffer->globalAccelerations->head;
+	while(current != NULL)
+	{
+		Vector_Free((Vector*)current->data);
+		current = current->next;
+	}
+	//Delete linked list of global accelerations
+	LinkedList_Free(buffer->globalAccelerations);
+
+	//Delete the solver's scratch storage
+	DynamicArray_Free(buffer->contactConstraints);
+	DynamicArray_Free(buffer->contactCandidates);
+	for(int i = 0; i < 2; i++)
+	{
+		DynamicArray_Free(buffer->features[i]);
+		DynamicArray_Free(buffer->clipBuffers[i]);
+	}
+	DynamicArray_Free(buffer->featureAngles);
+
+	DynamicArray_Free(buffer->islandBodies);
+	DynamicArray_Free(buffer->sweptObjects);
+	DynamicArray_Free(buffer->sweepTargets);
+	DynamicArray_Free(buffer->syncedObjects);
+
+	//Free the buffer itself
+	free(buffer);
+}
+
+///
+//Initializes the physics manager
+void PhysicsManager_Initialize()
+{
+	//Allocate and initialize the buffer
+	physicsBuffer = PhysicsManager_AllocateBuffer();
+	PhysicsManager_InitializeBuffer(physicsBuffer);
+}
+
+///
+//Frees internal data of the physics manager
+void PhysicsManager_Free()
+{
+	PhysicsManager_FreeBuffer(physicsBuffer);
+}
+
+///
+//Gets a reference to the internal physics buffer of the physics manager
+//
+//Returns:
+//	A pointer to the physics buffer
+PhysicsBuffer* PhysicsManager_GetPhysicsBuffer()
+{
+	return physicsBuffer;
+}
+
+///
+//Adds a global force to the list of global forces
+//
+//Parameters:
+//	force: A pointer to a vector of dimension 3 representing the force to add
+void PhysicsManager_AddGlobalForce(Vector* force)
+{
+	LinkedList_Append(physicsBuffer->globalForces, force);
+}
+
+///
+//Adds a global acceleration to the list of global accelerations
+//
+//Parameters:
+//	acceleration: A pointer to a vector of dimension 3 representing the acceleration to add
+void PhysicsManager_AddGlobalAcceleration(Vector* acceleration)
+{
+	LinkedList_Append(physicsBuffer->globalAccelerations, acceleration);
+}
+
+///
+//Updates the Rigidbody components of all gameObjects
+//
+//Parameters:
+//	bodies: A dynamic array of pointers to exactly the game objects with rigid bodies
+void PhysicsManager_Update(DynamicArray* bodies)
+{
+	PhysicsManager_UpdateBodies(bodies);
+	PhysicsManager_UpdateObjects(bodies);
+}
+
+///
+//Updates the Rigidbody components of all gameObjects
+//
+//Parameters:
+//	bodies: A dynamic array of pointers to exactly the game objects with rigid bodies
+void PhysicsManager_UpdateBodies(DynamicArray* bodies)
+{
+	GObject** gameObjects = (GObject**)bodies->data;
+	GObject* gameObject = NULL;
+
+	float dt = TimeManager_GetFixedDeltaSec();
+	DynamicArray_Clear(physicsBuffer->islandBodies);
+	DynamicArray_Clear(physicsBuffer->sweptObjects);
+
+	RigidBodyStore* store = RigidBody_GetStore();
+	if(store == NULL)
+	{
+		return;
+	}
+
+	//Only the bodies found below are integrated
+	memset(store->active, 0, store->size);
+	for(unsigned int i = 0; i < bodies->size; i++)
+	{
+		gameObject = gameObjects[i];
+		if(gameObject->body->physicsOn)
+		{
+			//Every body starts the frame on an island of it's own
+			gameObject->body->island = gameObject->body;
+			gameObject->body->islandAwake = 0;
+			DynamicArray_Append(physicsBuffer->islandBodies, &gameObject->body);
+
+			//Keep the state before this step so rendering can interpolate from it
+			Vector_Copy(gameObject->body->previousPosition, gameObject->body->frame->position);
+			gameObject->body->previousOrientation = *gameObject->body->frame->orientation;
+
+			//Sleeping bodies are not moved until they are woken
+			if(gameObject->body->isAwake)
+			{
+				//Forces applied since the last step are held for the rest of the frame, so every fixed step of the frame applies them
+				unsigned int index = gameObject->body->storeIndex;
+				Vec3_Increment(store->heldForces + index, store->netForces + index);
+				store->netForces[index] = store->heldForces[index];
+				Vec3_Increment(store->heldTorques + index, store->netTorques + index);
+				store->netTorques[index] = store->heldTorques[index];
+
+				PhysicsManager_ApplyGlobalForces(gameObject->body, dt);
+
+				store->active[index] = 1;
+				store->inverseMasses[index] = gameObject->body->inverseMass;
+
+				if(gameObject->body->continuousCollision && gameObject->collider != NULL)
+				{
+					DynamicArray_Append(physicsBuffer->sweptObjects, &gameObject);
+				}
+			}
+		}
+	}
+
+	//Every body is integrated independently, so the store is split into chunks of slots spread across the job threads
+	JobManager_RunChunks(PhysicsManager_IntegrateBodies, &dt, store->size, PhysicsManager_bodiesPerJob);
+
+	GObject** sweptObjects = (GObject**)physicsBuffer->sweptObjects->data;
+	for(unsigned int i = 0; i < physicsBuffer->sweptObjects->size; i++)
+	{
+		PhysicsManager_SweepBody(sweptObjects[i]);
+	}
+}
+
+///
+//Applies all global forces to the given rigidbody
+//
+//Parameters:
+//	body: The rigidbody to apply global forces to
+//	dt: The change in type since last update
+void PhysicsManager_ApplyGlobalForces(RigidBody* body, float dt)
+{
+	LinkedList_Node* currentNode = physicsBuffer->globalForces->head;
+	Vector* currentForce;
+
+	//Apply each global force
+	while(currentNode != NULL)
+	{
+		currentForce = (Vector*)currentNode->data;
+
+		RigidBody_ApplyForce(body, (const Vector*)currentForce, &Vector_ZERO);
+
+		currentNode = currentNode->next;
+	}
+
+	//If the object does not have an infinite mass
+	if(body->inverseMass != 0.0f)
+	{
+		Vector scaledForce;
+		Vector_INIT_ON_STACK(scaledForce, 3);
+
+		//Apply each global acceleration
+		currentNode = physicsBuffer->globalAccelerations->head;
+		while(currentNode != NULL)
+		{
+			currentForce = (Vector*)currentNode->data;
+			Vector_GetScalarProduct(&scaledForce, currentForce, 1.0f / body->inverseMass);
+			
+			RigidBody_ApplyForce(body, &scaledForce, &Vector_ZERO);
+			
+			currentNode = currentNode->next;
+		}
+	}
+}
+
+///
+//Updates the linear physics of every active body in a range of slots of a rigid body store
+//This determines calculations of acceleration, velocity, and position from netForce, netImpulse, and 1/mass
+//
+//Parameters:
+//	store: The store holding the bodies to update
+//	first: The index of the first slot to update
+//	end: One past the index of the last slot to update
+//	dt: The change in time since last update
+void PhysicsManager_UpdateLinearPhysicsOfBodies(RigidBodyStore* store, unsigned int first, unsigned int end, float dt)
+{
+	//The kernel integrates 4 slots at a time, inactive slots are masked out rather than branched over
+	SIMDMath_IntegrateLinear(
+		store->positions[first].components,
+		store->velocities[first].components,
+		store->accelerations[first].components,
+		store->netImpulses[first].components,
+		store->netForces[first].components,
+		store->inverseMasses + first,
+		store->active + first,
+		end - first, dt);
+}
+
+///
+//Updates the rotational physics of every active body in a range of slots of a rigid body store
+//This determines calculations of angular acceleration, angular velocity, and orientation / rotation
+//from net torque and inverse Inertia
+//
+//Parameters:
+//	store: The store holding the bodies to update
+//	first: The index of the first slot to update
+//	end: One past the index of the last slot to update
+//	dt: The change in time since last update
+void PhysicsManager_UpdateRotationalPhysicsOfBodies(RigidBodyStore* store, unsigned int first, unsigned int end, float dt)
+{
+	//The orientations are integrated in place of the rotation matrices, which are only built once something reads them
+	SIMDMath_IntegrateAngular(
+		store->orientations[first].components,
+		store->rotationsOutOfDate + first,
+		store->angularVelocities[first].components,
+		store->angularAccelerations[first].components,
+		store->netInstantaneousTorques[first].components,
+		store->netTorques[first].components,
+		store->inverseInertias[first].components,
+		store->active + first,
+		end - first, dt);
+}
+
+///
+//Updates the Frame of reference component of all gameObjects to match their rigidbodies
+//
+//Parameters:
+//	bodies: A dynamic array of pointers to exactly the game objects with rigid bodies
+void PhysicsManager_UpdateObjects(DynamicArray* bodies)
+{
+	float dt = TimeManager_GetFixedDeltaSec();
+	GObject** gameObjects = (GObject**)bodies->data;
+
+	//Only the walk over the array is serial, the objects are synced in chunks spread across the job threads
+	DynamicArray_Clear(physicsBuffer->syncedObjects);
+	for(unsigned int i = 0; i < bodies->size; i++)
+	{
+		if(gameObjects[i]->body->physicsOn)
+		{
+			DynamicArray_Append(physicsBuffer->syncedObjects, gameObjects + i);
+		}
+	}
+
+	JobManager_RunChunks(PhysicsManager_SyncObjects, &dt, physicsBuffer->syncedObjects->size, PhysicsManager_bodiesPerJob);
+}
+
+
+///
+//Moves the Frame of reference component of all gameObjects between the last two states of their rigidbodies,
+//So objects are drawn smoothly when physics steps at a different rate than frames are drawn
+//
+//Parameters:
+//	bodies: A dynamic array of pointers to exactly the game objects with rigid bodies
+//	alpha: How far to move from the state before the last physics step to the state after it, from 0 to 1
+void PhysicsManager_InterpolateObjects(DynamicArray* bodies, float alpha)
+{
+	GObject** gameObjects = (GObject**)bodies->data;
+	for(unsigned int i = 0; i < bodies->size; i++)
+	{
+		GObject* gameObject = gameObjects[i];
+		if(gameObject->body->physicsOn)
+		{
+			RigidBody* body = gameObject->body;
+
+			Vec3* position = Vec3_FROM_VECTOR(gameObject->frameOfReference->position);
+			Vec3_Subtract(position, Vec3_FROM_VECTOR(body->frame->position), Vec3_FROM_VECTOR(body->previousPosition));
+			Vec3_Scale(position, alpha);
+			Vec3_Increment(position, Vec3_FROM_VECTOR(body->previousPosition));
+
+			//The rotation over one step is small enough for a normalized blend to be smooth
+			Quat orientation;
+			Quat_GetNlerp(&orientation, &body->previousOrientation, body->frame->orientation, alpha);
+			FrameOfReference_SetOrientation(gameObject->frameOfReference, &orientation);
+		}
+	}
+}
+
+///
+//Clears the forces and torques applied to every rigid body this frame.
+//A force is applied over time, so the forces applied during a frame are applied by each of the frame's fixed steps
+//And dropped once the frame's steps are taken. Must be called once per frame after it's fixed steps, even when it took none.
+void PhysicsManager_ClearForces(void)
+{
+	RigidBodyStore* store = RigidBody_GetStore();
+	if(store == NULL)
+	{
+		return;
+	}
+
+	//Impulses are not held, they are applied once by the next step whichever frame it is taken in
+	memset(store->heldForces, 0, sizeof(Vec3) * store->size);
+	memset(store->heldTorques, 0, sizeof(Vec3) * store->size);
+	memset(store->netForces, 0, sizeof(Vec3) * store->size);
+	memset(store->netTorques, 0, sizeof(Vec3) * store->size);
+}
+
+///
+//Sets the method used to resolve collisions
+//
+//Parameters:
+//	solver: The method to resolve collisions with
+void PhysicsManager_SetSolver(CollisionSolver solver)
+{
+	physicsBuffer->solver = solver;
+}
+
+///
+//Gets the method used to resolve collisions
+//
+//Returns:
+//	The method collisions are resolved with
+CollisionSolver PhysicsManager_GetSolver(void)
+{
+	return physicsBuffer->solver;
+}
+
+///
+//Sets the number of passes the sequential impulse solver makes over the contacts each frame.
+//More iterations let impulses travel further through stacks at a higher cost.
+//
+//Parameters:
+//	numIterations: The number of iterations, at least 1
+void PhysicsManager_SetSolverIterations(unsigned int numIterations)
+{
+	if(numIterations == 0)
+	{
+		printf("PhysicsManager_SetSolverIterations failed! Must make at least one iteration. Iterations not changed.\n");
+		return;
+	}
+	physicsBuffer->solverIterations = numIterations;
+}
+
+///
+//Sets how long a body must move slowly before it can be put to sleep.
+//Touching bodies form an island which only sleeps once all of it's bodies can, and wakes when any of them is disturbed.
+//
+//Parameters:
+//	seconds: The time in seconds, or 0 to keep every body awake
+void PhysicsManager_SetTimeToSleep(float seconds)
+{
+	if(seconds < 0.0f)
+	{
+		printf("PhysicsManager_SetTimeToSleep failed! Time cannot be negative. Time to sleep not changed.\n");
+		return;
+	}
+	physicsBuffer->timeToSleep = seconds;
+}
+
+///
+//Resolves all collisions in an array,
+//Then puts to sleep the islands of bodies which have been resting long enough and wakes those which were disturbed
+//
+//Parameters:
+//	collisions: A dynamic array of pointers to all collisions detected which need resolving
+void PhysicsManager_ResolveCollisions(DynamicArray* collisions)
+{
+	//Touching bodies sleep and wake together
+	PhysicsManager_FindIslands(collisions);
+	PhysicsManager_WakeIslands();
+
+	if(physicsBuffer->solver == SOLVER_SEQUENTIALIMPULSE)
+	{
+		PhysicsManager_SolveContacts(collisions);
+	}
+	else
+	{
+		//Loop through the array of collisions
+		Collision** collisionArray = (Collision**)collisions->data;
+		for(unsigned int i = 0; i < collisions->size; i++)
+		{
+			PhysicsManager_ResolveCollision(collisionArray[i]);
+		}
+	}
+
+	PhysicsManager_UpdateSleeping();
+}
+
+///
+//Integrates the active bodies in a chunk of slots of the rigid body store.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the float change in time since last update
+//	first: The index of the first slot to integrate
+//	end: One past the index of the last slot to integrate
+//	threadIndex: Unused
+static void PhysicsManager_IntegrateBodies(void* data, unsigned int first, unsigned int end, unsigned int /*threadIndex*/)
+{
+	float dt = *(float*)data;
+	RigidBodyStore* store = RigidBody_GetStore();
+
+	PhysicsManager_UpdateLinearPhysicsOfBodies(store, first, end, dt);
+	PhysicsManager_UpdateRotationalPhysicsOfBodies(store, first, end, dt);
+}
+
+///
+//Updates the Frame of reference component of a chunk of the physics buffer's synced objects to match their rigidbodies,
+//And clears the forces applied to the rigidbodies this step.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the float change in time since last update
+//	first: The index of the first object to update
+//	end: One past the index of the last object to update
+//	threadIndex: Unused
+static void PhysicsManager_SyncObjects(void* data, unsigned int first, unsigned int end, unsigned int /*threadIndex*/)
+{
+	float dt = *(float*)data;
+	GObject** gameObjects = (GObject**)physicsBuffer->syncedObjects->data;
+
+	for(unsigned int i = first; i < end; i++)
+	{
+		GObject* gameObject = gameObjects[i];
+
+		Vector_Copy(gameObject->frameOfReference->position, gameObject->body->frame->position);
+		FrameOfReference_SetOrientation(gameObject->frameOfReference, gameObject->body->frame->orientation);
+
+		//Update previous net force
+		Vector_GetScalarProduct(gameObject->body->previousNetForce, gameObject->body->netForce, dt);
+		Vector_Increment(gameObject->body->previousNetForce, gameObject->body->netImpulse);
+
+		//Update previous net torque
+		Vector_GetScalarProduct(gameObject->body->previousNetTorque, gameObject->body->netTorque, dt);
+		Vector_Increment(gameObject->body->previousNetTorque, gameObject->body->netInstantaneousTorque);
+
+		//Set netforce back to 0
+		Vector_Copy(gameObject->body->netForce, &Vector_ZERO);
+		Vector_Copy(gameObject->body->acceleration, &Vector_ZERO);
+		Vector_Copy(gameObject->body->netImpulse, &Vector_ZERO);
+		Vector_Copy(gameObject->body->netTorque, &Vector_ZERO);
+		Vector_Copy(gameObject->body->netInstantaneousTorque, &Vector_ZERO);
+	}
+}
+
+///
+//Moves a body with continuous collision back along it's last step to where it first touched another object,
+//Letting it sink in slightly so the contact is found and resolved instead of passed through.
+//Colliders other than spheres are swept as their world space bounding box.
+//The objects it may hit are found by querying the broad phase in use with the bounds of the whole sweep.
+//
+//Parameters:
+//	obj: The object of the body to sweep (Must have a collider attached)
+static void PhysicsManager_SweepBody(GObject* obj)
+{
+	RigidBody* body = obj->body;
+
+	//The body moved in a straight line from where it started the step
+	Vec3 motion;
+	Vec3_Subtract(&motion, Vec3_FROM_VECTOR(body->frame->position), Vec3_FROM_VECTOR(body->previousPosition));
+	float distance = Vec3_GetMag(&motion);
+	if(distance == 0.0f)
+	{
+		return;
+	}
+
+	//Find the shape at the start of the step
+	float min[3];
+	float max[3];
+	Collider_GetWorldBounds(min, max, obj->collider, body->frame);
+	for(int i = 0; i < 3; i++)
+	{
+		min[i] -= motion.components[i];
+		max[i] -= motion.components[i];
+	}
+
+	unsigned char isSphere = obj->collider->type == COLLIDER_SPHERE;
+	float radius = isSphere ? SphereCollider_GetScaledRadius(obj->collider->data->sphereData, body->frame) : 0.0f;
+	Vec3* center = Vec3_FROM_VECTOR(body->previousPosition);
+
+	//The bounds of the whole sweep, to find the objects near it
+	float sweepMin[3];
+	float sweepMax[3];
+	for(int i = 0; i < 3; i++)
+	{
+		sweepMin[i] = motion.components[i] < 0.0f ? min[i] + motion.components[i] : min[i];
+		sweepMax[i] = motion.components[i] > 0.0f ? max[i] + motion.components[i] : max[i];
+	}
+
+	DynamicArray_Clear(physicsBuffer->sweepTargets);
+	ObjectManager_QueryBox(sweepMin, sweepMax, physicsBuffer->sweepTargets);
+
+	float firstTime = -1.0f;
+	float targetMin[3];
+	float targetMax[3];
+	GObject** targets = (GObject**)physicsBuffer->sweepTargets->data;
+	for(unsigned int i = 0; i < physicsBuffer->sweepTargets->size; i++)
+	{
+		GObject* target = targets[i];
+		if(target == obj)
+		{
+			continue;
+		}
+
+		FrameOfReference* targetFrame = target->body != NULL ? target->body->frame : target->frameOfReference;
+		Collider_GetWorldBounds(targetMin, targetMax, target->collider, targetFrame);
+		if(targetMax[0] < sweepMin[0] || targetMin[0] > sweepMax[0] ||
+			targetMax[1] < sweepMin[1] || targetMin[1] > sweepMax[1] ||
+			targetMax[2] < sweepMin[2] || targetMin[2] > sweepMax[2])
+		{
+			continue;
+		}
+
+		float time;
+		if(isSphere && target->collider->type == COLLIDER_SPHERE)
+		{
+			float targetRadius = SphereCollider_GetScaledRadius(target->collider->data->sphereData, targetFrame);
+			time = CollisionManager_GetSweptSphereSphereTimeOfImpact(center, radius, &motion, Vec3_FROM_VECTOR(targetFrame->position), targetRadius);
+		}
+		else if(isSphere)
+		{
+			time = CollisionManager_GetSweptSphereTimeOfImpact(center, radius, &motion, targetMin, targetMax);
+		}
+		else
+		{
+			time = CollisionManager_GetSweptAABBTimeOfImpact(min, max, &motion, targetMin, targetMax);
+		}
+
+		if(time >= 0.0f && (firstTime < 0.0f || time < firstTime))
+		{
+			firstTime = time;
+		}
+	}
+
+	if(firstTime < 0.0f)
+	{
+		return;
+	}
+
+	//Stop a little past the first impact, the velocity is left for the solver to resolve against the contact
+	float time = firstTime + PhysicsManager_sweepPenetration / distance;
+	if(time < 1.0f)
+	{
+		Vec3_GetScalarProduct(Vec3_FROM_VECTOR(body->frame->position), &motion, time);
+		Vec3_Increment(Vec3_FROM_VECTOR(body->frame->position), Vec3_FROM_VECTOR(body->previousPosition));
+	}
+}
+
+///
+//Finds the islands of the bodies simulated this frame from the pairs which are touching,
+//Including the pairs of sleeping bodies kept by the collision manager's pair cache
+//
+//Parameters:
+//	collisions: A dynamic array of pointers to the collisions found this frame
+static void PhysicsManager_FindIslands(DynamicArray* collisions)
+{
+	Collision** collisionArray = (Collision**)collisions->data;
+	for(unsigned int i = 0; i < collisions->size; i++)
+	{
+		PhysicsManager_LinkIslands(collisionArray[i]->obj1, collisionArray[i]->obj2);
+	}
+
+	//Sleeping pairs are not tested, but their contacts are kept so an island is woken all at once
+	PairCache* pairCache = CollisionManager_GetPairCache();
+	for(unsigned int i = 0; i < pairCache->capacity; i++)
+	{
+		const PairCache_Entry* entry = pairCache->entries + i;
+		if(entry->obj1 != NULL && entry->wasColliding)
+		{
+			PhysicsManager_LinkIslands(entry->obj1, entry->obj2);
+		}
+	}
+}
+
+///
+//Joins the islands of two objects' bodies
+//
+//Parameters:
+//	obj1: The first object
+//	obj2: The second object
+static void PhysicsManager_LinkIslands(const GObject* obj1, const GObject* obj2)
+{
+	//Objects without physics do not join islands, or everything resting on the ground would be one island
+	RigidBody* body1 = obj1->body;
+	RigidBody* body2 = obj2->body;
+	if(body1 == NULL || !body1->physicsOn || body2 == NULL || !body2->physicsOn)
+	{
+		return;
+	}
+
+	RigidBody* island1 = PhysicsManager_FindIsland(body1);
+	RigidBody* island2 = PhysicsManager_FindIsland(body2);
+	if(island1 != island2)
+	{
+		island2->island = island1;
+	}
+}
+
+///
+//Finds the root of the island a body belongs to, shortening the path to it along the way
+//
+//Parameters:
+//	body: The body to find the island of
+//
+//Returns:
+//	The body at the root of the island
+static RigidBody* PhysicsManager_FindIsland(RigidBody* body)
+{
+	while(body->island != body)
+	{
+		body->island = body->island->island;
+		body = body->island;
+	}
+	return body;
+}
+
+///
+//Flags the root of every island with an awake body which has not moved slowly for long enough to sleep
+static void PhysicsManager_MarkAwakeIslands(void)
+{
+	RigidBody** bodies = (RigidBody**)physicsBuffer->islandBodies->data;
+	unsigned int numBodies = physicsBuffer->islandBodies->size;
+
+	for(unsigned int i = 0; i < numBodies; i++)
+	{
+		PhysicsManager_FindIsland(bodies[i])->islandAwake = 0;
+	}
+
+	for(unsigned int i = 0; i < numBodies; i++)
+	{
+		RigidBody* body = bodies[i];
+		if(physicsBuffer->timeToSleep == 0.0f || (body->isAwake && body->sleepTime < physicsBuffer->timeToSleep))
+		{
+			PhysicsManager_FindIsland(body)->islandAwake = 1;
+		}
+	}
+}
+
+///
+//Wakes every body on an island which is disturbed, so a body touching a sleeping island is solved against all of it
+static void PhysicsManager_WakeIslands(void)
+{
+	RigidBody** bodies = (RigidBody**)physicsBuffer->islandBodies->data;
+	unsigned int numBodies = physicsBuffer->islandBodies->size;
+
+	PhysicsManager_MarkAwakeIslands();
+	for(unsigned int i = 0; i < numBodies; i++)
+	{
+		if(PhysicsManager_FindIsland(bodies[i])->islandAwake)
+		{
+			RigidBody_Wake(bodies[i]);
+		}
+	}
+}
+
+///
+//Updates how long each body simulated this frame has been moving slowly,
+//Then puts to sleep every island whose bodies have all moved slowly long enough
+static void PhysicsManager_UpdateSleeping(void)
+{
+	RigidBody** bodies = (RigidBody**)physicsBuffer->islandBodies->data;
+	unsigned int numBodies = physicsBuffer->islandBodies->size;
+	float dt = TimeManager_GetFixedDeltaSec();
+
+	for(unsigned int i = 0; i < numBodies; i++)
+	{
+		RigidBody* body = bodies[i];
+		if(!body->isAwake) continue;
+
+		if(Vector_GetMagSq(body->velocity) < PhysicsManager_sleepLinearVelocity * PhysicsManager_sleepLinearVelocity &&
+			Vector_GetMagSq(body->angularVelocity) < PhysicsManager_sleepAngularVelocity * PhysicsManager_sleepAngularVelocity)
+		{
+			body->sleepTime += dt;
+		}
+		else
+		{
+			body->sleepTime = 0.0f;
+		}
+	}
+
+	PhysicsManager_MarkAwakeIslands();
+	for(unsigned int i = 0; i < numBodies; i++)
+	{
+		if(bodies[i]->isAwake && !PhysicsManager_FindIsland(bodies[i])->islandAwake)
+		{
+			RigidBody_Sleep(bodies[i]);
+		}
+	}
+
+	//The bodies of this frame may be freed before the next
+	DynamicArray_Clear(physicsBuffer->islandBodies);
+}
+
+///
+//Resolves every collision in an array at once with sequential impulses.
+//A manifold of up to four contact points is built for each collision and warm started with the impulses stored in the pair cache,
+//Then impulses are applied directly to the velocities of the bodies at each contact for a number of iterations.
+//Finally the bodies are moved apart to remove the penetration the impulses leave behind.
+//
+//Parameters:
+//	collisions: A dynamic array of pointers to all collisions detected which need resolving
+static void PhysicsManager_SolveContacts(DynamicArray* collisions)
+{
+	float dt = TimeManager_GetFixedDeltaSec();
+	if(dt <= 0.0f)
+	{
+		return;
+	}
+
+	//Resting impulses are proportional to the time step, so stored impulses are scaled when it changes
+	float timeStepRatio = physicsBuffer->previousDeltaTime > 0.0f ? dt / physicsBuffer->previousDeltaTime : 1.0f;
+	physicsBuffer->previousDeltaTime = dt;
+
+	//Build every constraint before any impulse is applied so restitution sees the velocities of the collision
+	DynamicArray* constraintArray = physicsBuffer->contactConstraints;
+	DynamicArray_Clear(constraintArray);
+
+	ContactConstraint constraint;
+	Collision** collisionArray = (Collision**)collisions->data;
+	for(unsigned int i = 0; i < collisions->size; i++)
+	{
+		if(PhysicsManager_InitializeContactConstraint(&constraint, collisionArray[i]))
+		{
+			DynamicArray_Append(constraintArray, &constraint);
+		}
+	}
+
+	ContactConstraint* constraints = (ContactConstraint*)constraintArray->data;
+	unsigned int numConstraints = constraintArray->size;
+	PairCache* pairCache = CollisionManager_GetPairCache();
+
+	for(unsigned int i = 0; i < numConstraints; i++)
+	{
+		const PairCache_Entry* entry = PairCache_Find(pairCache, constraints[i].collision->obj1, constraints[i].collision->obj2);
+		if(entry != NULL)
+		{
+			PhysicsManager_WarmStartContacts(constraints + i, entry, timeStepRatio);
+		}
+	}
+
+	for(unsigned int iteration = 0; iteration < physicsBuffer->solverIterations; iteration++)
+	{
+		for(unsigned int i = 0; i < numConstraints; i++)
+		{
+			PhysicsManager_SolveContactConstraint(constraints + i);
+		}
+	}
+
+	for(unsigned int i = 0; i < numConstraints; i++)
+	{
+		PairCache_Entry* entry = PairCache_Find(pairCache, constraints[i].collision->obj1, constraints[i].collision->obj2);
+		if(entry != NULL)
+		{
+			PhysicsManager_StoreContactImpulses(constraints + i, entry);
+		}
+	}
+
+	for(unsigned int iteration = 0; iteration < PhysicsManager_positionIterations; iteration++)
+	{
+		for(unsigned int i = 0; i < numConstraints; i++)
+		{
+			PhysicsManager_SolveContactPosition(constraints + i);
+		}
+	}
+}
+
+///
+//Initializes the contact constraint of a collision, building it's contact manifold
+//
+//Parameters:
+//	constraint: The constraint to initialize
+//	collision: The collision to build the constraint from
+//
+//Returns:
+//	1 if the constraint has a contact and an object the solver can move, else 0
+static unsigned char PhysicsManager_InitializeContactConstraint(ContactConstraint* constraint, Collision* collision)
+{
+	GObject* objects[2] = { collision->obj1, collision->obj2 };
+	RigidBody* bodies[2];
+	float inverseMasses[2];
+	Mat3* inverseInertias[2] = { &constraint->inverseInertia1, &constraint->inverseInertia2 };
+
+	for(int i = 0; i < 2; i++)
+	{
+		//Bodies with physics off, such as bodies with infinite mass, are never moved by collisions
+		RigidBody* body = objects[i]->body;
+		bodies[i] = body != NULL && body->physicsOn ? body : NULL;
+
+		inverseMasses[i] = bodies[i] != NULL && !body->freezeTranslation ? body->inverseMass : 0.0f;
+
+		//AABBs cannot rotate
+		Mat3* inverseInertia = inverseInertias[i];
+		if(bodies[i] != NULL && !body->freezeRotation && body->inverseMass != 0.0f && objects[i]->collider->type != COLLIDER_AABB)
+		{
+			//I^-1 = R I^-1 R^T
+			Mat3 rotation;
+			Mat3 transpose;
+			FrameOfReference_UpdateRotation(body->frame);
+			Mat3_Copy(&rotation, Mat3_FROM_MATRIX(body->frame->rotation));
+			Mat3_GetTranspose(&transpose, &rotation);
+			Mat3_GetProduct(inverseInertia, Mat3_FROM_MATRIX(body->inverseInertia), &transpose);
+			Mat3_Transform(&rotation, inverseInertia);
+		}
+		else
+		{
+			for(int j = 0; j < 9; j++)
+			{
+				inverseInertia->components[j] = 0.0f;
+			}
+		}
+	}
+
+	if(bodies[0] == NULL && bodies[1] == NULL)
+	{
+		return 0;
+	}
+
+	constraint->collision = collision;
+	constraint->body1 = bodies[0];
+	constraint->body2 = bodies[1];
+	constraint->inverseMass1 = inverseMasses[0];
+	constraint->inverseMass2 = inverseMasses[1];
+
+	Vec3_Copy(&constraint->normal, Vec3_FROM_VECTOR(collision->minimumTranslationVector));
+	if(Vec3_GetMagSq(&constraint->normal) == 0.0f)
+	{
+		return 0;
+	}
+	Vec3_Normalize(&constraint->normal);
+	PhysicsManager_GetContactTangents(constraint->tangents, &constraint->normal);
+
+	//Objects without a body use the same coefficients the decoupling solver gives them
+	constraint->friction = ((collision->obj1->body != NULL ? collision->obj1->body->dynamicFriction : 1.0f) + (collision->obj2->body != NULL ? collision->obj2->body->dynamicFriction : 1.0f)) / 2.0f;
+	float restitution = (collision->obj1->body != NULL ? collision->obj1->body->coefficientOfRestitution : 1.0f) * (collision->obj2->body != NULL ? collision->obj2->body->coefficientOfRestitution : 1.0f);
+
+	PhysicsManager_BuildContactManifold(constraint);
+	if(constraint->numPoints == 0)
+	{
+		return 0;
+	}
+
+	for(unsigned int i = 0; i < constraint->numPoints; i++)
+	{
+		ContactPoint* point = constraint->points + i;
+
+		Vec3_Subtract(&point->radius1, &point->position, Vec3_FROM_VECTOR(collision->obj1Frame->position));
+		Vec3_Subtract(&point->radius2, &point->position, Vec3_FROM_VECTOR(collision->obj2Frame->position));
+		PhysicsManager_GetLocalContactPoint(&point->localRadius1, constraint, &point->position, 1);
+		PhysicsManager_GetLocalContactPoint(&point->localRadius2, constraint, &point->position, 0);
+
+		point->normalMass = PhysicsManager_GetContactMass(constraint, point, &constraint->normal);
+		point->tangentMass[0] = PhysicsManager_GetContactMass(constraint, point, constraint->tangents);
+		point->tangentMass[1] = PhysicsManager_GetContactMass(constraint, point, constraint->tangents + 1);
+
+		point->normalImpulse = 0.0f;
+		point->tangentImpulse[0] = 0.0f;
+		point->tangentImpulse[1] = 0.0f;
+
+		//Contacts approaching quickly bounce, slower contacts are brought to rest so stacks do not jitter
+		Vec3 velocity;
+		PhysicsManager_GetContactVelocity(&velocity, constraint, point);
+		float normalVelocity = Vec3_DotProduct(&velocity, &constraint->normal);
+		point->targetVelocity = normalVelocity < -PhysicsManager_restitutionThreshold ? -restitution * normalVelocity : 0.0f;
+	}
+
+	return 1;
+}
+
+///
+//Builds the contact manifold of a constraint from the surfaces of it's objects which face each other.
+//When both surfaces are edges or vertices a single contact is made,
+//Otherwise the feature with fewer points is clipped against the other.
+//
+//Parameters:
+//	constraint: The constraint to build the manifold of, with it's collision and normal set
+static void PhysicsManager_BuildContactManifold(ContactConstraint* constraint)
+{
+	Collision* collision = constraint->collision;
+	const Vec3* normal = &constraint->normal;
+
+	//The normal points from obj2 to obj1, so obj1's surface facing obj2 is furthest against the normal
+	Vec3 reverseNormal;
+	Vec3_GetScalarProduct(&reverseNormal, normal, -1.0f);
+
+	DynamicArray* feature1 = physicsBuffer->features[0];
+	DynamicArray* feature2 = physicsBuffer->features[1];
+	PhysicsManager_GetContactFeature(feature1, collision->obj1, collision->obj1Frame, &reverseNormal);
+	PhysicsManager_GetContactFeature(feature2, collision->obj2, collision->obj2Frame, normal);
+	PhysicsManager_WindContactFeature(feature1, normal);
+	PhysicsManager_WindContactFeature(feature2, normal);
+
+	DynamicArray_Clear(physicsBuffer->contactCandidates);
+
+	if(feature1->size >= 3 || feature2->size >= 3)
+	{
+		if(feature1->size >= feature2->size)
+		{
+			PhysicsManager_ClipContactFeature(feature2, feature1, normal, 1);
+		}
+		else
+		{
+			PhysicsManager_ClipContactFeature(feature1, feature2, normal, 0);
+		}
+	}
+
+	//Vertex and edge contacts, or faces which clipping found no overlap of, touch at a single point
+	if(physicsBuffer->contactCandidates->size == 0)
+	{
+		const Vec3* points1 = (const Vec3*)feature1->data;
+		const Vec3* points2 = (const Vec3*)feature2->data;
+		float halfOverlap = collision->overlap / 2.0f;
+
+		Vec3 position;
+		if(feature1->size == 2 && feature2->size == 2)
+		{
+			PhysicsManager_GetClosestPointOfSegments(&position, points1, points2);
+		}
+		else if(feature1->size == 1 || feature2->size != 1)
+		{
+			//obj1's deepest point lies inside obj2 by the overlap
+			Vec3_GetScalarProduct(&position, normal, halfOverlap);
+			Vec3_Increment(&position, points1);
+		}
+		else
+		{
+			Vec3_GetScalarProduct(&position, normal, -halfOverlap);
+			Vec3_Increment(&position, points2);
+		}
+		PhysicsManager_AddContactCandidate(&position, collision->overlap);
+	}
+
+	PhysicsManager_ReduceContactCandidates(constraint);
+}
+
+///
+//Gets two directions perpendicular to a normal and to each other, always the same two for the same normal
+//
+//Parameters:
+//	dest: Array of two Vec3s to store the tangents in
+//	normal: The normalized normal
+static void PhysicsManager_GetContactTangents(Vec3* dest, const Vec3* normal)
+{
+	//Cross with whichever axis is furthest from the normal
+	const float* n = normal->components;
+	if(fabsf(n[0]) >= 0.57735f)
+	{
+		Vec3_Set(dest, n[1], -n[0], 0.0f);
+	}
+	else
+	{
+		Vec3_Set(dest, 0.0f, n[2], -n[1]);
+	}
+	Vec3_Normalize(dest);
+	Vec3_CrossProduct(dest + 1, normal, dest);
+}
+
+///
+//Gets the point halfway between the closest points of two line segments
+//
+//Parameters:
+//	dest: The destination of the point
+//	segment1: Array of the two ends of the first segment
+//	segment2: Array of the two ends of the second segment
+static void PhysicsManager_GetClosestPointOfSegments(Vec3* dest, const Vec3* segment1, const Vec3* segment2)
+{
+	Vec3 direction1;
+	Vec3 direction2;
+	Vec3 between;
+	Vec3_Subtract(&direction1, segment1 + 1, segment1);
+	Vec3_Subtract(&direction2, segment2 + 1, segment2);
+	Vec3_Subtract(&between, segment1, segment2);
+
+	float lengthSq1 = Vec3_DotProduct(&direction1, &direction1);
+	float lengthSq2 = Vec3_DotProduct(&direction2, &direction2);
+	float dot12 = Vec3_DotProduct(&direction1, &direction2);
+	float dot1 = Vec3_DotProduct(&direction1, &between);
+	float dot2 = Vec3_DotProduct(&direction2, &between);
+
+	//Parameters along each segment of the closest points, clamped to the segments
+	float s = 0.0f;
+	float t = 0.0f;
+	float denominator = lengthSq1 * lengthSq2 - dot12 * dot12;
+	if(denominator > FLT_EPSILON)
+	{
+		s = (dot12 * dot2 - dot1 * lengthSq2) / denominator;
+		s = s < 0.0f ? 0.0f : (s > 1.0f ? 1.0f : s);
+	}
+	if(lengthSq2 > FLT_EPSILON)
+	{
+		t = (dot12 * s + dot2) / lengthSq2;
+		if(t < 0.0f || t > 1.0f)
+		{
+			t = t < 0.0f ? 0.0f : 1.0f;
+			if(lengthSq1 > FLT_EPSILON)
+			{
+				s = (dot12 * t - dot1) / lengthSq1;
+				s = s < 0.0f ? 0.0f : (s > 1.0f ? 1.0f : s);
+			}
+		}
+	}
+
+	Vec3 closest2;
+	Vec3_GetScalarProduct(dest, &direction1, s);
+	Vec3_Increment(dest, segment1);
+	Vec3_GetScalarProduct(&closest2, &direction2, t);
+	Vec3_Increment(&closest2, segment2);
+
+	Vec3_Increment(dest, &closest2);
+	Vec3_Scale(dest, 0.5f);
+}
+
+///
+//Gets the points of an object's collider furthest in a direction, within the feature tolerance
+//
+//Parameters:
+//	dest: Dynamic array of Vec3 to store the points in
+//	obj: The object with the collider
+//	frame: The frame of reference orienting the collider
+//	direction: The direction to search in
+static void PhysicsManager_GetContactFeature(DynamicArray* dest, GObject* obj, FrameOfReference* frame, const Vec3* direction)
+{
+	DynamicArray_Clear(dest);
+
+	Vec3 corners[8];
+	const Vec3* points = corners;
+	unsigned int numPoints = 0;
+
+	switch(obj->collider->type)
+	{
+	case COLLIDER_SPHERE:
+		{
+			Vec3 point;
+			Vec3_GetScalarProduct(&point, direction, SphereCollider_GetScaledRadius(obj->collider->data->sphereData, frame));
+			Vec3_Increment(&point, Vec3_FROM_VECTOR(frame->position));
+			DynamicArray_Append(dest, &point);
+		}
+		return;
+	case COLLIDER_AABB:
+		{
+			float bounds[2][3];
+			Collider_GetWorldBounds(bounds[0], bounds[1], obj->collider, frame);
+			for(int i = 0; i < 8; i++)
+			{
+				Vec3_Set(corners + i, bounds[i & 1][0], bounds[(i >> 1) & 1][1], bounds[(i >> 2) & 1][2]);
+			}
+			numPoints = 8;
+		}
+		break;
+	case COLLIDER_CONVEXHULL:
+		{
+			ColliderData_ConvexHull* convexHull = obj->collider->data->convexHullData;
+			points = ConvexHullCollider_GetWorldCache(convexHull, frame)->worldPoints;
+			numPoints = convexHull->points->size;
+		}
+		break;
+	}
+
+	float maxDistance = -FLT_MAX;
+	for(unsigned int i = 0; i < numPoints; i++)
+	{
+		float distance = Vec3_DotProduct(points + i, direction);
+		if(distance > maxDistance) maxDistance = distance;
+	}
+
+	for(unsigned int i = 0; i < numPoints; i++)
+	{
+		if(Vec3_DotProduct(points + i, direction) >= maxDistance - PhysicsManager_featureTolerance)
+		{
+			DynamicArray_Append(dest, (void*)(points + i));
+		}
+	}
+}
+
+///
+//Orders the points of a feature counter clockwise around the contact normal.
+//A feature whose points all lie along a line is reduced to the two ends of the line.
+//
+//Parameters:
+//	feature: Dynamic array of Vec3 holding the feature to order
+//	normal: The contact normal
+static void PhysicsManager_WindContactFeature(DynamicArray* feature, const Vec3* normal)
+{
+	if(feature->size < 3)
+	{
+		return;
+	}
+
+	Vec3* points = (Vec3*)feature->data;
+	unsigned int numPoints = feature->size;
+
+	Vec3 center;
+	Vec3_Zero(&center);
+	for(unsigned int i = 0; i < numPoints; i++)
+	{
+		Vec3_Increment(&center, points + i);
+	}
+	Vec3_Scale(&center, 1.0f / numPoints);
+
+	Vec3 tangents[2];
+	PhysicsManager_GetContactTangents(tangents, normal);
+
+	DynamicArray* angleArray = physicsBuffer->featureAngles;
+	DynamicArray_Clear(angleArray);
+	for(unsigned int i = 0; i < numPoints; i++)
+	{
+		Vec3 offset;
+		Vec3_Subtract(&offset, points + i, &center);
+		float angle = atan2f(Vec3_DotProduct(&offset, tangents + 1), Vec3_DotProduct(&offset, tangents));
+		DynamicArray_Append(angleArray, &angle);
+	}
+	float* angles = (float*)angleArray->data;
+
+	//Features are small, so an insertion sort by angle is enough
+	for(unsigned int i = 1; i < numPoints; i++)
+	{
+		float angle = angles[i];
+		Vec3 point = points[i];
+		unsigned int j = i;
+		while(j > 0 && angles[j - 1] > angle)
+		{
+			angles[j] = angles[j - 1];
+			points[j] = points[j - 1];
+			j--;
+		}
+		angles[j] = angle;
+		points[j] = point;
+	}
+
+	//Twice the area of the feature projected onto the contact plane
+	float area = 0.0f;
+	for(unsigned int i = 0; i < numPoints; i++)
+	{
+		Vec3 edge1;
+		Vec3 edge2;
+		Vec3 cross;
+		Vec3_Subtract(&edge1, points + i, &center);
+		Vec3_Subtract(&edge2, points + (i + 1) % numPoints, &center);
+		Vec3_CrossProduct(&cross, &edge1, &edge2);
+		area += Vec3_DotProduct(&cross, normal);
+	}
+
+	if(area < PhysicsManager_featureTolerance * PhysicsManager_featureTolerance)
+	{
+		//Keep the two points furthest apart
+		unsigned int end1 = 0;
+		unsigned int end2 = 0;
+		float maxDistanceSq = -1.0f;
+		for(unsigned int pass = 0; pass < 2; pass++)
+		{
+			unsigned int from = pass == 0 ? 0 : end1;
+			maxDistanceSq = -1.0f;
+			for(unsigned int i = 0; i < numPoints; i++)
+			{
+				Vec3 offset;
+				Vec3_Subtract(&offset, points + i, points + from);
+				float distanceSq = Vec3_GetMagSq(&offset);
+				if(distanceSq > maxDistanceSq)
+				{
+					maxDistanceSq = distanceSq;
+					if(pass == 0) end1 = i;
+					else end2 = i;
+				}
+			}
+		}
+
+		Vec3 ends[2] = { points[end1], points[end2] };
+		points[0] = ends[0];
+		points[1] = ends[1];
+		feature->size = 2;
+	}
 }
 
 ///
-//Frees memory taken by a physics buffer
+//Clips an incident feature against the sides of a reference feature and adds each remaining point as a candidate contact
 //
 //Parameters:
-//	buffer: The buffer to free the memory of
-static void PhysicsManager_FreeBuffer(PhysicsBuffer* buffer)
+//	incident: Dynamic array of Vec3 holding the feature to clip
+//	reference: Dynamic array of Vec3 holding the wound feature, with at least three points, to clip against
+//	normal: The contact normal, pointing from obj2 to obj1
+//	referenceIsObj1: 1 if the reference feature belongs to obj1, 0 if it belongs to obj2
+static void PhysicsManager_ClipContactFeature(DynamicArray* incident, DynamicArray* reference, const Vec3* normal, unsigned char referenceIsObj1)
 {
-	//Delete all vectors in the list of global forces
-	LinkedList_Node* current = buffer->globalForces->head;
-	while(current != NULL)
+	const Vec3* referencePoints = (const Vec3*)reference->data;
+	unsigned int numReferencePoints = reference->size;
+
+	Vec3 center;
+	Vec3_Zero(&center);
+	for(unsigned int i = 0; i < numReferencePoints; i++)
 	{
-		Vector_Free((Vector*)current->data);
-		current = current->next;
+		Vec3_Increment(&center, referencePoints + i);
 	}
-	//Delete list of global forces
-	LinkedList_Free(buffer->globalForces);
+	Vec3_Scale(&center, 1.0f / numReferencePoints);
 
-	//Delete all vectors in the list of global accelerations
-	current = buffer->globalAccelerations->head;
-	while(current != NULL)
+	DynamicArray* input = physicsBuffer->clipBuffers[0];
+	DynamicArray* output = physicsBuffer->clipBuffers[1];
+	DynamicArray_Clear(input);
+	for(unsigned int i = 0; i < incident->size; i++)
 	{
-		Vector_Free((Vector*)current->data);
-		current = current->next;
+		DynamicArray_Append(input, DynamicArray_Index(incident, i));
 	}
-	//Delete linked list of global accelerations
-	LinkedList_Free(buffer->globalAccelerations);
 
-	//Free the buffer itself
-	free(buffer);
-}
+	//Sutherland-Hodgman clipping against the plane through each side of the reference feature, along the normal
+	for(unsigned int i = 0; i < numReferencePoints && input->size > 0; i++)
+	{
+		const Vec3* start = referencePoints + i;
+		Vec3 side;
+		Vec3_Subtract(&side, referencePoints + (i + 1) % numReferencePoints, start);
 
-///
-//Initializes the physics manager
-void PhysicsManager_Initialize()
-{
-	//Allocate and initialize the buffer
-	physicsBuffer = PhysicsManager_AllocateBuffer();
-	PhysicsManager_InitializeBuffer(physicsBuffer);
-}
+		//The inward facing normal of the side within the contact plane
+		Vec3 sideNormal;
+		Vec3 toCenter;
+		Vec3_CrossProduct(&sideNormal, normal, &side);
+		Vec3_Subtract(&toCenter, &center, start);
+		if(Vec3_DotProduct(&sideNormal, &toCenter) < 0.0f)
+		{
+			Vec3_Scale(&sideNormal, -1.0f);
+		}
 
-///
-//Frees internal data of the physics manager
-void PhysicsManager_Free()
-{
-	PhysicsManager_FreeBuffer(physicsBuffer);
-}
+		DynamicArray_Clear(output);
+		const Vec3* inputPoints = (const Vec3*)input->data;
+		for(unsigned int j = 0; j < input->size; j++)
+		{
+			const Vec3* point = inputPoints + j;
+			const Vec3* previous = inputPoints + (j + input->size - 1) % input->size;
 
-///
-//Gets a reference to the internal physics buffer of the physics manager
-//
-//Returns:
-//	A pointer to the physics buffer
-PhysicsBuffer* PhysicsManager_GetPhysicsBuffer()
-{
-	return physicsBuffer;
+			Vec3 offset;
+			Vec3_Subtract(&offset, point, start);
+			float distance = Vec3_DotProduct(&offset, &sideNormal);
+			Vec3_Subtract(&offset, previous, start);
+			float previousDistance = Vec3_DotProduct(&offset, &sideNormal);
+
+			//Add the point where the edge from the previous point crosses the plane
+			if((distance >= 0.0f) != (previousDistance >= 0.0f))
+			{
+				Vec3 crossing;
+				Vec3_Subtract(&crossing, point, previous);
+				Vec3_Scale(&crossing, previousDistance / (previousDistance - distance));
+				Vec3_Increment(&crossing, previous);
+				DynamicArray_Append(output, &crossing);
+			}
+			if(distance >= 0.0f)
+			{
+				DynamicArray_Append(output, (void*)point);
+			}
+		}
+
+		DynamicArray* temp = input;
+		input = output;
+		output = temp;
+	}
+
+	//Keep the clipped points which are behind the reference surface, moved halfway to it
+	float referenceDistance = Vec3_DotProduct(&center, normal);
+	const Vec3* clippedPoints = (const Vec3*)input->data;
+	for(unsigned int i = 0; i < input->size; i++)
+	{
+		float distance = Vec3_DotProduct(clippedPoints + i, normal);
+		float penetration = referenceIsObj1 ? distance - referenceDistance : referenceDistance - distance;
+		if(penetration < -PhysicsManager_featureTolerance)
+		{
+			continue;
+		}
+
+		Vec3 position;
+		Vec3_GetScalarProduct(&position, normal, referenceIsObj1 ? -penetration / 2.0f : penetration / 2.0f);
+		Vec3_Increment(&position, clippedPoints + i);
+		PhysicsManager_AddContactCandidate(&position, penetration);
+	}
 }
 
 ///
-//Adds a global force to the list of global forces
+//Adds a candidate contact to the physics buffer's candidates unless one already lies on top of it
 //
 //Parameters:
-//	force: A pointer to a vector of dimension 3 representing the force to add
-void PhysicsManager_AddGlobalForce(Vector* force)
+//	position: The position of the contact
+//	penetration: The distance the surfaces overlap at the contact
+static void PhysicsManager_AddContactCandidate(const Vec3* position, float penetration)
 {
-	LinkedList_Append(physicsBuffer->globalForces, force);
+	ContactPoint* candidates = (ContactPoint*)physicsBuffer->contactCandidates->data;
+	for(unsigned int i = 0; i < physicsBuffer->contactCandidates->size; i++)
+	{
+		Vec3 offset;
+		Vec3_Subtract(&offset, &candidates[i].position, position);
+		if(Vec3_GetMagSq(&offset) < PhysicsManager_contactSlop * PhysicsManager_contactSlop)
+		{
+			return;
+		}
+	}
+
+	ContactPoint candidate;
+	Vec3_Copy(&candidate.position, position);
+	candidate.penetration = penetration;
+	DynamicArray_Append(physicsBuffer->contactCandidates, &candidate);
 }
 
 ///
-//Adds a global acceleration to the list of global accelerations
+//Copies the candidate contacts into a constraint, keeping the four which cover the largest area if there are more
 //
 //Parameters:
-//	acceleration: A pointer to a vector of dimension 3 representing the acceleration to add
-void PhysicsManager_AddGlobalAcceleration(Vector* acceleration)
+//	constraint: The constraint to store the contacts in
+static void PhysicsManager_ReduceContactCandidates(ContactConstraint* constraint)
 {
-	LinkedList_Append(physicsBuffer->globalAccelerations, acceleration);
+	const ContactPoint* candidates = (const ContactPoint*)physicsBuffer->contactCandidates->data;
+	unsigned int numCandidates = physicsBuffer->contactCandidates->size;
+
+	if(numCandidates <= PairCache_maxContacts)
+	{
+		for(unsigned int i = 0; i < numCandidates; i++)
+		{
+			constraint->points[i] = candidates[i];
+		}
+		constraint->numPoints = numCandidates;
+		return;
+	}
+
+	//Start from the deepest contact and the contact furthest from it
+	unsigned int kept[4] = { 0, 0, 0, 0 };
+	for(unsigned int i = 1; i < numCandidates; i++)
+	{
+		if(candidates[i].penetration > candidates[kept[0]].penetration) kept[0] = i;
+	}
+
+	float maxDistanceSq = -1.0f;
+	for(unsigned int i = 0; i < numCandidates; i++)
+	{
+		Vec3 offset;
+		Vec3_Subtract(&offset, &candidates[i].position, &candidates[kept[0]].position);
+		float distanceSq = Vec3_GetMagSq(&offset);
+		if(distanceSq > maxDistanceSq)
+		{
+			maxDistanceSq = distanceSq;
+			kept[1] = i;
+		}
+	}
+
+	//Then the contacts furthest to either side of the line between them
+	Vec3 line;
+	Vec3_Subtract(&line, &candidates[kept[1]].position, &candidates[kept[0]].position);
+
+	float sideDistances[2] = { 0.0f, 0.0f };
+	for(unsigned int i = 0; i < numCandidates; i++)
+	{
+		Vec3 offset;
+		Vec3 cross;
+		Vec3_Subtract(&offset, &candidates[i].position, &candidates[kept[0]].position);
+		Vec3_CrossProduct(&cross, &offset, &line);
+		float sideDistance = Vec3_DotProduct(&cross, &constraint->normal);
+
+		if(sideDistance > sideDistances[0])
+		{
+			sideDistances[0] = sideDistance;
+			kept[2] = i;
+		}
+		else if(-sideDistance > sideDistances[1])
+		{
+			sideDistances[1] = -sideDistance;
+			kept[3] = i;
+		}
+	}
+
+	constraint->numPoints = 0;
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		//Sides with no contacts off the line are skipped
+		if(i >= 2 && sideDistances[i - 2] == 0.0f) continue;
+		constraint->points[constraint->numPoints++] = candidates[kept[i]];
+	}
 }
 
 ///
-//Updates the Rigidbody components of all gameObjects
+//Gets the mass of a contact along a direction, the inverse of the change in relative velocity a unit impulse causes
 //
 //Parameters:
-//	gameObjects: THe linked list of gameobjects to update their rigidBodies
-void PhysicsManager_Update(LinkedList* gameObjects)
+//	constraint: The constraint holding the contact
+//	point: The contact
+//	direction: The direction of the impulse
+//
+//Returns:
+//	The mass along the direction
+static float PhysicsManager_GetContactMass(const ContactConstraint* constraint, const ContactPoint* point, const Vec3* direction)
 {
-	PhysicsManager_UpdateBodies(gameObjects);
-	PhysicsManager_UpdateObjects(gameObjects);
+	float inverseMass = constraint->inverseMass1 + constraint->inverseMass2;
+
+	//Add the velocity along the direction each body's spin picks up from the impulse
+	Vec3 angular;
+	Vec3 velocity;
+	Vec3_CrossProduct(&angular, &point->radius1, direction);
+	Mat3_TransformVec3(&constraint->inverseInertia1, &angular);
+	Vec3_CrossProduct(&velocity, &angular, &point->radius1);
+	inverseMass += Vec3_DotProduct(&velocity, direction);
+
+	Vec3_CrossProduct(&angular, &point->radius2, direction);
+	Mat3_TransformVec3(&constraint->inverseInertia2, &angular);
+	Vec3_CrossProduct(&velocity, &angular, &point->radius2);
+	inverseMass += Vec3_DotProduct(&velocity, direction);
+
+	return inverseMass > 0.0f ? 1.0f / inverseMass : 0.0f;
 }
 
 ///
-//Updates the Rigidbody components of all gameObjects
+//Gets the velocity of the contact point on obj1 relative to the contact point on obj2
 //
 //Parameters:
-//	gameObjects: THe linked list of gameobjects to update their rigidBodies
-void PhysicsManager_UpdateBodies(LinkedList* gameObjects)
+//	dest: The destination of the relative velocity
+//	constraint: The constraint holding the contact
+//	point: The contact
+static void PhysicsManager_GetContactVelocity(Vec3* dest, const ContactConstraint* constraint, const ContactPoint* point)
 {
-	struct LinkedList_Node* current = gameObjects->head;
-	struct LinkedList_Node* next = NULL;
-	GObject* gameObject = NULL;
+	Vec3_Zero(dest);
 
-	float dt = TimeManager_GetDeltaSec();
-	while(current != NULL)
+	Vec3 velocity;
+	if(constraint->body1 != NULL)
 	{
-		next = current->next;
-		gameObject = (GObject*)current->data;
-		if(gameObject->body != NULL)
-		{
-			if( gameObject->body->physicsOn)
-			{
-				PhysicsManager_ApplyGlobalForces(gameObject->body, dt);
-				PhysicsManager_UpdateLinearPhysicsOfBody(gameObject->body, dt);
-				PhysicsManager_UpdateRotationalPhysicsOfBody(gameObject->body, dt);
-			}
-		}
-
-
-		current = next;
-
+		Vec3_CrossProduct(&velocity, Vec3_FROM_VECTOR(constraint->body1->angularVelocity), &point->radius1);
+		Vec3_Increment(&velocity, Vec3_FROM_VECTOR(constraint->body1->velocity));
+		Vec3_Increment(dest, &velocity);
+	}
+	if(constraint->body2 != NULL)
+	{
+		Vec3_CrossProduct(&velocity, Vec3_FROM_VECTOR(constraint->body2->angularVelocity), &point->radius2);
+		Vec3_Increment(&velocity, Vec3_FROM_VECTOR(constraint->body2->velocity));
+		Vec3_Decrement(dest, &velocity);
 	}
 }
 
 ///
-//Applies all global forces to the given rigidbody
+//Applies an impulse at a contact to obj1, and the opposite impulse to obj2, changing their velocities immediately
 //
 //Parameters:
-//	body: The rigidbody to apply global forces to
-//	dt: The change in type since last update
-void PhysicsManager_ApplyGlobalForces(RigidBody* body, float dt)
+//	constraint: The constraint holding the contact
+//	point: The contact
+//	impulse: The impulse to apply to obj1
+static void PhysicsManager_ApplyContactImpulse(const ContactConstraint* constraint, const ContactPoint* point, const Vec3* impulse)
 {
-	LinkedList_Node* currentNode = physicsBuffer->globalForces->head;
-	Vector* currentForce;
-
-	//Apply each global force
-	while(currentNode != NULL)
+	Vec3 change;
+	if(constraint->body1 != NULL)
 	{
-		currentForce = (Vector*)currentNode->data;
-
-		RigidBody_ApplyForce(body, (const Vector*)currentForce, &Vector_ZERO);
+		Vec3_GetScalarProduct(&change, impulse, constraint->inverseMass1);
+		Vec3_Increment(Vec3_FROM_VECTOR(constraint->body1->velocity), &change);
 
-		currentNode = currentNode->next;
+		Vec3_CrossProduct(&change, &point->radius1, impulse);
+		Mat3_TransformVec3(&constraint->inverseInertia1, &change);
+		Vec3_Increment(Vec3_FROM_VECTOR(constraint->body1->angularVelocity), &change);
 	}
-
-	//If the object does not have an infinite mass
-	if(body->inverseMass != 0.0f)
+	if(constraint->body2 != NULL)
 	{
-		Vector scaledForce;
-		Vector_INIT_ON_STACK(scaledForce, 3);
+		Vec3_GetScalarProduct(&change, impulse, constraint->inverseMass2);
+		Vec3_Decrement(Vec3_FROM_VECTOR(constraint->body2->velocity), &change);
 
-		//Apply each global acceleration
-		currentNode = physicsBuffer->globalAccelerations->head;
-		while(currentNode != NULL)
-		{
-			currentForce = (Vector*)currentNode->data;
-			Vector_GetScalarProduct(&scaledForce, currentForce, 1.0f / body->inverseMass);
-			
-			RigidBody_ApplyForce(body, &scaledForce, &Vector_ZERO);
-			
-			currentNode = currentNode->next;
-		}
+		Vec3_CrossProduct(&change, &point->radius2, impulse);
+		Mat3_TransformVec3(&constraint->inverseInertia2, &change);
+		Vec3_Decrement(Vec3_FROM_VECTOR(constraint->body2->angularVelocity), &change);
 	}
 }
 
 ///
-//Updates the linear physics of a rigidbody
-//This determines calculations of acceleration, velocity, and position from netForce and netImpulse
+//Gets the position of a world space point in the space of one of the objects of a pair
 //
 //Parameters:
-//	body: The body to update
-//	dt: The change in time since last update
-void PhysicsManager_UpdateLinearPhysicsOfBody(RigidBody* body, float dt)
+//	dest: The destination of the local point
+//	constraint: The constraint of the pair
+//	point: The world space point
+//	ofObj1: 1 to get the point in the space of obj1, 0 for obj2
+static void PhysicsManager_GetLocalContactPoint(Vec3* dest, const ContactConstraint* constraint, const Vec3* point, unsigned char ofObj1)
 {
-	//F = MA
-	//A = 1/M * F
-	Vector_GetScalarProduct(body->acceleration, body->netForce, body->inverseMass);
-	//J = MV so V = 1/M * J
-	//J = J * 1/M
-	//Will apply J to V later
-	Vector_Scale(body->netImpulse, body->inverseMass);	
-
-
-	Vector VT;
-	Vector_INIT_ON_STACK( VT , 3 );
-	Vector AT;
-	Vector_INIT_ON_STACK( AT , 3);
-	Vector VAT2;
-	Vector_INIT_ON_STACK( VAT2 , 3);
-
-	//Get V0T
-	Vector_GetScalarProduct(&VT, body->velocity, dt);			//VT = V0 * dt		
-
-	//Get AT
-	Vector_GetScalarProduct(&AT, body->acceleration, dt);		//AT = A1 * dt
-
-	//Get AT^2
-	Vector_GetScalarProduct(&VAT2, &AT, dt);	//VAT2 = A1 * dt ^ 2
-	//Get 1/2AT^2
-	Vector_Scale(&VAT2, 0.5f);	//VAT2 = 1/2 * A1 * dt ^ 2
-
-	//Get VT + 1/2AT^2
-	Vector_Increment(&VAT2, &VT);	//VAT2 = VT + 1/2 * A1 * dt^2
-
-	//X = X0 + V0T + 1/2AT^2
-	Vector_Increment(body->frame->position, &VAT2);
-	//V = V0 + AT
-	Vector_Increment(body->velocity, &AT);	
-	//V += 1/M * J
-	Vector_Increment(body->velocity, body->netImpulse);
+	const FrameOfReference* frame = ofObj1 ? constraint->collision->obj1Frame : constraint->collision->obj2Frame;
+
+	Vec3 offset;
+	Vec3_Subtract(&offset, point, Vec3_FROM_VECTOR(frame->position));
+
+	//Rotate by the transpose, the inverse of a rotation
+	const float* rotation = frame->rotation->components;
+	for(int i = 0; i < 3; i++)
+	{
+		dest->components[i] = rotation[i] * offset.components[0] + rotation[3 + i] * offset.components[1] + rotation[6 + i] * offset.components[2];
+	}
 }
 
 ///
-//Updates the rotational physics of a rigidbody
-//This determines calculations of angular acceleration, angular velocity, and orientation / rotation
-//from net torque and inverse Inertia
+//Starts the accumulated impulses of a constraint from the impulses stored in the pair's entry,
+//Matching each contact to the nearest stored contact, and applies them
 //
 //Parameters:
-//	body: The body to update
-//	dt: The change in time since last update
-void PhysicsManager_UpdateRotationalPhysicsOfBody(RigidBody* body, float dt)
+//	constraint: The constraint to warm start
+//	entry: The pair's entry in the pair cache
+//	timeStepRatio: This frame's time step over the time step the impulses were stored with
+static void PhysicsManager_WarmStartContacts(ContactConstraint* constraint, const PairCache_Entry* entry, float timeStepRatio)
 {
-	Vector AT;
-	Vector_INIT_ON_STACK(AT, 3);
-
-	Vector VT;
-	Vector_INIT_ON_STACK(VT, 3);
+	//Stored contacts are kept in the space of, and with friction applied to, the entry's obj1
+	unsigned char entryObj1IsObj1 = entry->obj1 == constraint->collision->obj1;
+	float frictionSign = entryObj1IsObj1 ? timeStepRatio : -timeStepRatio;
 
+	for(unsigned int i = 0; i < constraint->numPoints; i++)
+	{
+		ContactPoint* point = constraint->points + i;
 
-	//T = IA
-	//1/I * T = A
-	Matrix_GetProductVector(body->angularAcceleration, body->inverseInertia, body->netTorque);
-	//Same for instantaneous torque, accept it is applied directly to angular velocity at the end of this function
-	Matrix_TransformVector(body->inverseInertia, body->netInstantaneousTorque);
-
-	//A = dV / dT
-	//A * dT = dV
-	Vector_GetScalarProduct(&AT, body->angularAcceleration, dt);
+		Vec3 localPoint;
+		PhysicsManager_GetLocalContactPoint(&localPoint, constraint, &point->position, entryObj1IsObj1);
 
-	//A * dT = (V1 - V0)
-	//A * dT + V0 = V1
-	Vector_Increment(body->angularVelocity, &AT);
-	//Apply instantaneousTorque to angularVelocity
-	Vector_Increment(body->angularVelocity, body->netInstantaneousTorque);
+		const PairCache_Contact* match = NULL;
+		float matchDistanceSq = PhysicsManager_contactMatchDistance * PhysicsManager_contactMatchDistance;
+		for(unsigned int j = 0; j < entry->numContacts; j++)
+		{
+			Vec3 offset;
+			Vec3_Subtract(&offset, &localPoint, (const Vec3*)entry->contacts[j].localPoint);
+			float distanceSq = Vec3_GetMagSq(&offset);
+			if(distanceSq < matchDistanceSq)
+			{
+				matchDistanceSq = distanceSq;
+				match = entry->contacts + j;
+			}
+		}
+		if(match == NULL) continue;
 
-	//V = dTheta / dt
-	//V * dT = dTheta
-	//V * dT = (Theta1 - Theta0)
-	//V * dT + Theta0 = Theta1
-	Vector_GetScalarProduct(&VT, body->angularVelocity, dt);
+		Vec3 frictionImpulse;
+		Vec3_GetScalarProduct(&frictionImpulse, (const Vec3*)match->tangentImpulse, frictionSign);
 
-	//Rotate by |VT| around axis VT
-	float theta = Vector_GetMag(&VT);
-	Vector_Normalize(&VT);
+		point->normalImpulse = match->normalImpulse * timeStepRatio;
+		point->tangentImpulse[0] = Vec3_DotProduct(&frictionImpulse, constraint->tangents);
+		point->tangentImpulse[1] = Vec3_DotProduct(&frictionImpulse, constraint->tangents + 1);
 
-	if(theta != 0)
-	{
-		FrameOfReference_Rotate(body->frame, &VT, theta);
+		Vec3 impulse;
+		Vec3 tangentImpulse;
+		Vec3_GetScalarProduct(&impulse, &constraint->normal, point->normalImpulse);
+		Vec3_GetScalarProduct(&tangentImpulse, constraint->tangents, point->tangentImpulse[0]);
+		Vec3_Increment(&impulse, &tangentImpulse);
+		Vec3_GetScalarProduct(&tangentImpulse, constraint->tangents + 1, point->tangentImpulse[1]);
+		Vec3_Increment(&impulse, &tangentImpulse);
+		PhysicsManager_ApplyContactImpulse(constraint, point, &impulse);
 	}
-
 }
 
 ///
-//Updates the Frame of reference component of all gameObjects to match their rigidbodies
+//Performs one iteration of the sequential impulse solver on a constraint,
+//Applying the friction and normal impulses which bring each contact closer to it's target velocity
 //
 //Parameters:
-//	gameObjects: the linked list of gameObjects to update their rigidbodies
-void PhysicsManager_UpdateObjects(LinkedList* gameObjects)
+//	constraint: The constraint to solve
+static void PhysicsManager_SolveContactConstraint(ContactConstraint* constraint)
 {
-	float dt = TimeManager_GetDeltaSec();
-	struct LinkedList_Node* current = gameObjects->head;
-	struct LinkedList_Node* next = NULL;
-	GObject* gameObject = NULL;
+	Vec3 velocity;
+	Vec3 impulse;
 
-
-	while(current != NULL)
+	for(unsigned int i = 0; i < constraint->numPoints; i++)
 	{
-		next = current->next;
-		gameObject = (GObject*)current->data;
-		if(gameObject->body != NULL)
+		ContactPoint* point = constraint->points + i;
+
+		//Friction can push back at most as hard as the contact pushes the objects apart
+		float maxFriction = constraint->friction * point->normalImpulse;
+		for(int j = 0; j < 2; j++)
 		{
-			if( gameObject->body->physicsOn)
-			{
-				Vector_Copy(gameObject->frameOfReference->position, gameObject->body->frame->position);
-				Matrix_Copy(gameObject->frameOfReference->rotation, gameObject->body->frame->rotation);
-
-				//Update previous net force
-				Vector_GetScalarProduct(gameObject->body->previousNetForce, gameObject->body->netForce, dt);
-				Vector_Increment(gameObject->body->previousNetForce, gameObject->body->netImpulse);
-
-				//Update previous net torque
-				Vector_GetScalarProduct(gameObject->body->previousNetTorque, gameObject->body->netTorque, dt);
-				Vector_Increment(gameObject->body->previousNetTorque, gameObject->body->netInstantaneousTorque);
-
-				//Set netforce back to 0
-				Vector_Copy(gameObject->body->netForce, &Vector_ZERO);
-				Vector_Copy(gameObject->body->acceleration, &Vector_ZERO);
-				Vector_Copy(gameObject->body->netImpulse, &Vector_ZERO);
-				Vector_Copy(gameObject->body->netTorque, &Vector_ZERO);
-				Vector_Copy(gameObject->body->netInstantaneousTorque, &Vector_ZERO);
-			}
+			PhysicsManager_GetContactVelocity(&velocity, constraint, point);
+			float change = -Vec3_DotProduct(&velocity, constraint->tangents + j) * point->tangentMass[j];
+
+			float accumulated = point->tangentImpulse[j] + change;
+			accumulated = accumulated < -maxFriction ? -maxFriction : (accumulated > maxFriction ? maxFriction : accumulated);
+			change = accumulated - point->tangentImpulse[j];
+			point->tangentImpulse[j] = accumulated;
+
+			Vec3_GetScalarProduct(&impulse, constraint->tangents + j, change);
+			PhysicsManager_ApplyContactImpulse(constraint, point, &impulse);
 		}
 
+		//The accumulated normal impulse may shrink, but the contact can never pull the objects together
+		PhysicsManager_GetContactVelocity(&velocity, constraint, point);
+		float change = (point->targetVelocity - Vec3_DotProduct(&velocity, &constraint->normal)) * point->normalMass;
 
-		current = next;
+		float accumulated = point->normalImpulse + change;
+		accumulated = accumulated > 0.0f ? accumulated : 0.0f;
+		change = accumulated - point->normalImpulse;
+		point->normalImpulse = accumulated;
 
+		Vec3_GetScalarProduct(&impulse, &constraint->normal, change);
+		PhysicsManager_ApplyContactImpulse(constraint, point, &impulse);
 	}
 }
 
+///
+//Stores the accumulated impulses of a constraint in the pair's entry for the next frame
+//
+//Parameters:
+//	constraint: The solved constraint
+//	entry: The pair's entry in the pair cache
+static void PhysicsManager_StoreContactImpulses(const ContactConstraint* constraint, PairCache_Entry* entry)
+{
+	unsigned char entryObj1IsObj1 = entry->obj1 == constraint->collision->obj1;
+
+	entry->numContacts = (unsigned char)constraint->numPoints;
+	for(unsigned int i = 0; i < constraint->numPoints; i++)
+	{
+		const ContactPoint* point = constraint->points + i;
+		PairCache_Contact* contact = entry->contacts + i;
+
+		PhysicsManager_GetLocalContactPoint((Vec3*)contact->localPoint, constraint, &point->position, entryObj1IsObj1);
+		contact->normalImpulse = point->normalImpulse;
+
+		Vec3 frictionImpulse;
+		Vec3 tangentImpulse;
+		Vec3_GetScalarProduct(&frictionImpulse, constraint->tangents, point->tangentImpulse[0]);
+		Vec3_GetScalarProduct(&tangentImpulse, constraint->tangents + 1, point->tangentImpulse[1]);
+		Vec3_Increment(&frictionImpulse, &tangentImpulse);
+		Vec3_GetScalarProduct((Vec3*)contact->tangentImpulse, &frictionImpulse, entryObj1IsObj1 ? 1.0f : -1.0f);
+	}
+}
 
 ///
-//Resolves all collisions in a linked list
+//Performs one iteration of position correction on a constraint.
+//Moves the bodies directly to remove part of the penetration left at each contact,
+//So correcting penetration does not add velocity which would make resting contacts jitter.
 //
 //Parameters:
-//	collisions: A linked list of all collisions detected which need resolving
-void PhysicsManager_ResolveCollisions(LinkedList* collisions)
+//	constraint: The constraint to correct
+static void PhysicsManager_SolveContactPosition(const ContactConstraint* constraint)
 {
-	//Loop through the linked list of collisions
-	LinkedList_Node* current = collisions->head;
-	LinkedList_Node* next = NULL;
+	const Vec3* normal = &constraint->normal;
+	RigidBody* bodies[2] = { constraint->body1, constraint->body2 };
+	float inverseMasses[2] = { constraint->inverseMass1, constraint->inverseMass2 };
+	const Mat3* inverseInertias[2] = { &constraint->inverseInertia1, &constraint->inverseInertia2 };
 
-	Collision* collision;
-	while(current != NULL)
+	for(unsigned int i = 0; i < constraint->numPoints; i++)
 	{
-		next = current->next;
-		collision = (Collision*)current->data;
-		PhysicsManager_ResolveCollision(collision);
+		const ContactPoint* point = constraint->points + i;
+		const Vec3* localRadii[2] = { &point->localRadius1, &point->localRadius2 };
+
+		//Follow the contact on each body from where it was found, moving obj1 along the normal separates the pair
+		Vec3 radii[2];
+		float penetration = point->penetration;
+		for(int j = 0; j < 2; j++)
+		{
+			if(bodies[j] == NULL) continue;
 
+			Vec3 offset;
+			Mat3_GetProductVec3(radii + j, Mat3_FROM_MATRIX(bodies[j]->frame->rotation), localRadii[j]);
+			Vec3_Add(&offset, radii + j, Vec3_FROM_VECTOR(bodies[j]->frame->position));
+			Vec3_Decrement(&offset, &point->position);
+			penetration += j == 0 ? -Vec3_DotProduct(&offset, normal) : Vec3_DotProduct(&offset, normal);
+		}
+
+		float correction = PhysicsManager_baumgarteFactor * (penetration - PhysicsManager_contactSlop);
+		if(correction <= 0.0f) continue;
+		if(correction > PhysicsManager_maxCorrection) correction = PhysicsManager_maxCorrection;
 
+		//The mass found when the constraint was built is close enough while the bodies barely move
+		float magnitude = correction * point->normalMass;
+		for(int j = 0; j < 2; j++)
+		{
+			if(bodies[j] == NULL) continue;
 
-		current = next;
+			Vec3 impulse;
+			Vec3_GetScalarProduct(&impulse, normal, j == 0 ? magnitude : -magnitude);
 
+			Vec3 translation;
+			Vec3_GetScalarProduct(&translation, &impulse, inverseMasses[j]);
+			Vec3_Increment(Vec3_FROM_VECTOR(bodies[j]->frame->position), &translation);
 
+			Vec3 rotation;
+			Vec3_CrossProduct(&rotation, radii + j, &impulse);
+			Mat3_TransformVec3(inverseInertias[j], &rotation);
+			float angle = sqrtf(Vec3_GetMagSq(&rotation));
+			if(angle > 0.0f)
+			{
+				Vector axis;
+				Vector_INIT_ON_STACK(axis, 3);
+				Vec3_Copy(Vec3_FROM_VECTOR(&axis), &rotation);
+				FrameOfReference_Rotate(bodies[j]->frame, &axis, angle);
+			}
+		}
 	}
 }
 
@@ -413,7 +1817,7 @@ static void PhysicsManager_ResolveCollision(Collision* collision)
 
 		//Step 5:
 		/*
-		float dt = TimeManager_GetDeltaSec();
+		float dt = TimeManager_GetFixedDeltaSec();
 
 		//And update the objects in this collision
 		if(collision->obj1->body != NULL)
@@ -480,24 +1884,15 @@ static unsigned char PhysicsManager_IsResolutionNeeded(Collision* collision)
 			//Grab convexHull data set
 			ColliderData_ConvexHull* convex = collision->obj1->collider->data->convexHullData;
 
-			//Create an array of pointers to vectors to hold the model oriented collider points
-			Vector** modelOrientedPoints = (Vector**)malloc(sizeof(Vector*) * convex->points->size);
-			//Allocate & initialize individual vectors in array
-			for(unsigned int i = 0; i < convex->points->size; i++)
-			{
-				modelOrientedPoints[i] = Vector_Allocate();
-				Vector_Initialize(modelOrientedPoints[i], 3);
-			}
-
-			//Get the model oriented points
-			ConvexHullCollider_GetOrientedModelPoints(modelOrientedPoints, convex, collision->obj1Frame);
+			//Get the model oriented points from the collider's world cache
+			const Vec3* modelOrientedPoints = ConvexHullCollider_GetWorldCache(convex, collision->obj1Frame)->modelOrientedPoints;
 
 			//Allocate & initialize a dynamic array to hold the points furthest in the direction of the MTV
 			DynamicArray* furthestPoints = DynamicArray_Allocate();
 			DynamicArray_Initialize(furthestPoints, sizeof(Vector));
 
 			//Get the furthest points in the direction of relative MTV
-			ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, (const Vector**) modelOrientedPoints, &relativeMTV);
+			ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, modelOrientedPoints, &relativeMTV);
 
 			//Calculate the maximum linear velocity due to the bodies angular velocity in the direction of the relative MTV
 			Vector maxLinearVelocityAtPoint;
@@ -512,12 +1907,6 @@ static unsigned char PhysicsManager_IsResolutionNeeded(Collision* collision)
 
 			//Now free the data used for this algorithm
 			DynamicArray_Free(furthestPoints);
-
-			for(unsigned int i = 0; i < convex->points->size; i++)
-			{
-				Vector_Free(modelOrientedPoints[i]);
-			}
-			free(modelOrientedPoints);
 		}
 
 		//Increment the total velocity by the linear velocity of the object
@@ -532,24 +1921,15 @@ static unsigned char PhysicsManager_IsResolutionNeeded(Collision* collision)
 			//Grab convexHull data set
 			ColliderData_ConvexHull* convex = collision->obj2->collider->data->convexHullData;
 
-			//Create an array of pointers to vectors to hold the model oriented collider points
-			Vector** modelOrientedPoints = (Vector**)malloc(sizeof(Vector*) * convex->points->size);
-			//Allocate & initialize individual vectors in array
-			for(unsigned int i = 0; i < convex->points->size; i++)
-			{
-				modelOrientedPoints[i] = Vector_Allocate();
-				Vector_Initialize(modelOrientedPoints[i], 3);
-			}
-
-			//Get the model oriented points
-			ConvexHullCollider_GetOrientedModelPoints(modelOrientedPoints, convex, collision->obj2Frame);
+			//Get the model oriented points from the collider's world cache
+			const Vec3* modelOrientedPoints = ConvexHullCollider_GetWorldCache(convex, collision->obj2Frame)->modelOrientedPoints;
 
 			//Allocate & initialize a dynamic array to hold the points furthest in the direction of the MTV
 			DynamicArray* furthestPoints = DynamicArray_Allocate();
 			DynamicArray_Initialize(furthestPoints, sizeof(Vector));
 
 			//Get the furthest points in the direction of relative MTV
-			ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, (const Vector**) modelOrientedPoints, collision->minimumTranslationVector);
+			ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, modelOrientedPoints, collision->minimumTranslationVector);
 
 			Vector maxLinearVelocityAtPoint;
 			Vector_INIT_ON_STACK(maxLinearVelocityAtPoint, 3);
@@ -563,12 +1943,6 @@ static unsigned char PhysicsManager_IsResolutionNeeded(Collision* collision)
 
 			//Now free the data used for this algorithm
 			DynamicArray_Free(furthestPoints);
-
-			for(unsigned int i = 0; i < convex->points->size; i++)
-			{
-				Vector_Free(modelOrientedPoints[i]);
-			}
-			free(modelOrientedPoints);
 		}
 
 
@@ -616,24 +1990,15 @@ static unsigned char PhysicsManager_IsResolutionNeeded(Collision* collision)
 			//Grab convexHull data set
 			ColliderData_ConvexHull* convex = collision->obj1->collider->data->convexHullData;
 
-			//Create an array of pointers to vectors to hold the model oriented collider points
-			Vector** modelOrientedPoints = (Vector**)malloc(sizeof(Vector*) * convex->points->size);
-			//Allocate & initialize individual vectors in array
-			for(unsigned int i = 0; i < convex->points->size; i++)
-			{
-				modelOrientedPoints[i] = Vector_Allocate();
-				Vector_Initialize(modelOrientedPoints[i], 3);
-			}
-
-			//Get the model oriented points
-			ConvexHullCollider_GetOrientedModelPoints(modelOrientedPoints, convex, collision->obj1Frame);
+			//Get the model oriented points from the collider's world cache
+			const Vec3* modelOrientedPoints = ConvexHullCollider_GetWorldCache(convex, collision->obj1Frame)->modelOrientedPoints;
 
 			//Allocate & initialize a dynamic array to hold the points furthest in the direction of the MTV
 			DynamicArray* furthestPoints = DynamicArray_Allocate();
 			DynamicArray_Initialize(furthestPoints, sizeof(Vector));
 
 			//Get the furthest points in the direction of relative MTV
-			ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, (const Vector**) modelOrientedPoints, &relativeMTV);
+			ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, modelOrientedPoints, &relativeMTV);
 
 			Vector maxLinearVelocityAtPoint;
 			Vector_INIT_ON_STACK(maxLinearVelocityAtPoint, 3);
@@ -646,12 +2011,6 @@ static unsigned char PhysicsManager_IsResolutionNeeded(Collision* collision)
 
 			//Now free the data used for this algorithm
 			DynamicArray_Free(furthestPoints);
-
-			for(unsigned int i = 0; i < convex->points->size; i++)
-			{
-				Vector_Free(modelOrientedPoints[i]);
-			}
-			free(modelOrientedPoints);
 		}
 
 		//Increment the total velocity by the linear velocity of object1
@@ -677,24 +2036,15 @@ static unsigned char PhysicsManager_IsResolutionNeeded(Collision* collision)
 			//Grab convexHull data set
 			ColliderData_ConvexHull* convex = collision->obj2->collider->data->convexHullData;
 
-			//Create an array of pointers to vectors to hold the model oriented collider points
-			Vector** modelOrientedPoints = (Vector**)malloc(sizeof(Vector*) * convex->points->size);
-			//Allocate & initialize individual vectors in array
-			for(unsigned int i = 0; i < convex->points->size; i++)
-			{
-				modelOrientedPoints[i] = Vector_Allocate();
-				Vector_Initialize(modelOrientedPoints[i], 3);
-			}
-
-			//Get the model oriented points
-			ConvexHullCollider_GetOrientedModelPoints(modelOrientedPoints, convex, collision->obj2Frame);
+			//Get the model oriented points from the collider's world cache
+			const Vec3* modelOrientedPoints = ConvexHullCollider_GetWorldCache(convex, collision->obj2Frame)->modelOrientedPoints;
 
 			//Allocate & initialize a dynamic array to hold the points furthest in the direction of the MTV
 			DynamicArray* furthestPoints = DynamicArray_Allocate();
 			DynamicArray_Initialize(furthestPoints, sizeof(Vector));
 
 			//Get the furthest points in the direction of relative MTV
-			ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, (const Vector**) modelOrientedPoints, collision->minimumTranslationVector);
+			ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, modelOrientedPoints, collision->minimumTranslationVector);
 
 			Vector maxLinearVelocityAtPoint;
 			Vector_INIT_ON_STACK(maxLinearVelocityAtPoint, 3);
@@ -707,12 +2057,6 @@ static unsigned char PhysicsManager_IsResolutionNeeded(Collision* collision)
 
 			//Now free the data used for this algorithm
 			DynamicArray_Free(furthestPoints);
-
-			for(unsigned int i = 0; i < convex->points->size; i++)
-			{
-				Vector_Free(modelOrientedPoints[i]);
-			}
-			free(modelOrientedPoints);
 		}
 
 
@@ -767,24 +2111,15 @@ static void PhysicsManager_DecoupleCollision(Collision* collision)
 				//Grab convexHull data set
 				ColliderData_ConvexHull* convex = collision->obj1->collider->data->convexHullData;
 
-				//Create an array of pointers to vectors to hold the model oriented collider points
-				Vector** modelOrientedPoints = (Vector**)malloc(sizeof(Vector*) * convex->points->size);
-				//Allocate & initialize individual vectors in array
-				for(unsigned int i = 0; i < convex->points->size; i++)
-				{
-					modelOrientedPoints[i] = Vector_Allocate();
-					Vector_Initialize(modelOrientedPoints[i], 3);
-				}
-
-				//Get the model oriented points
-				ConvexHullCollider_GetOrientedModelPoints(modelOrientedPoints, convex, collision->obj1Frame);
+				//Get the model oriented points from the collider's world cache
+				const Vec3* modelOrientedPoints = ConvexHullCollider_GetWorldCache(convex, collision->obj1Frame)->modelOrientedPoints;
 
 				//Allocate & initialize a dynamic array to hold the points furthest in the direction of the MTV
 				DynamicArray* furthestPoints = DynamicArray_Allocate();
 				DynamicArray_Initialize(furthestPoints, sizeof(Vector));
 
 				//Get the furthest points in the direction of relative MTV
-				ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, (const Vector**) modelOrientedPoints, &relativeMTV);
+				ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, modelOrientedPoints, &relativeMTV);
 
 				Vector maxLinearVelocityAtPoint;
 				Vector_INIT_ON_STACK(maxLinearVelocityAtPoint, 3);
@@ -797,12 +2132,6 @@ static void PhysicsManager_DecoupleCollision(Collision* collision)
 
 				//Now free the data used for this algorithm
 				DynamicArray_Free(furthestPoints);
-
-				for(unsigned int i = 0; i < convex->points->size; i++)
-				{
-					Vector_Free(modelOrientedPoints[i]);
-				}
-				free(modelOrientedPoints);
 			}
 
 		}
@@ -826,24 +2155,15 @@ static void PhysicsManager_DecoupleCollision(Collision* collision)
 			//Grab convexHull data set
 			ColliderData_ConvexHull* convex = collision->obj2->collider->data->convexHullData;
 
-			//Create an array of pointers to vectors to hold the model oriented collider points
-			Vector** modelOrientedPoints = (Vector**)malloc(sizeof(Vector*) * convex->points->size);
-			//Allocate & initialize individual vectors in array
-			for(unsigned int i = 0; i < convex->points->size; i++)
-			{
-				modelOrientedPoints[i] = Vector_Allocate();
-				Vector_Initialize(modelOrientedPoints[i], 3);
-			}
-
-			//Get the model oriented points
-			ConvexHullCollider_GetOrientedModelPoints(modelOrientedPoints, convex, collision->obj2Frame);
+			//Get the model oriented points from the collider's world cache
+			const Vec3* modelOrientedPoints = ConvexHullCollider_GetWorldCache(convex, collision->obj2Frame)->modelOrientedPoints;
 
 			//Allocate & initialize a dynamic array to hold the points furthest in the direction of the MTV
 			DynamicArray* furthestPoints = DynamicArray_Allocate();
 			DynamicArray_Initialize(furthestPoints, sizeof(Vector));
 
 			//Get the furthest points in the direction of relative MTV
-			ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, (const Vector**) modelOrientedPoints, collision->minimumTranslationVector);
+			ConvexHullCollider_GetFurthestPoints(furthestPoints, convex, modelOrientedPoints, collision->minimumTranslationVector);
 
 			Vector maxLinearVelocityAtPoint;
 			Vector_INIT_ON_STACK(maxLinearVelocityAtPoint, 3);
@@ -857,12 +2177,6 @@ static void PhysicsManager_DecoupleCollision(Collision* collision)
 			//Now free the data used for this algorithm
 			DynamicArray_Free(furthestPoints);
 
-			for(unsigned int i = 0; i < convex->points->size; i++)
-			{
-				Vector_Free(modelOrientedPoints[i]);
-			}
-			free(modelOrientedPoints);
-
 		}
 	}
 	else
@@ -1147,35 +2461,16 @@ static void PhysicsManager_DetermineCollisionPointAABB(Vector* dest, const Frame
 //	convexFrame2: A pointer to the frame of reference of the other convex hull involved in the collision, whether the object itself has a convex hull or not
 //	relativeMTV: A pointer to a vector representing the MTV !Pointing towards the OTHER object (convexHull2)!
 static void PhysicsManager_DetermineCollisionPointConvexHull(Vector* dest,
-															 const ColliderData_ConvexHull* convexHull1, const FrameOfReference* convexFrame1, 
-															 const ColliderData_ConvexHull* convexHull2, const FrameOfReference* convexFrame2,
+															 ColliderData_ConvexHull* convexHull1, const FrameOfReference* convexFrame1, 
+															 ColliderData_ConvexHull* convexHull2, const FrameOfReference* convexFrame2,
 															 const Vector* relativeMTV)
 {
 	//Create an unsigned character to serve as a boolean for whether the collision point was found yet
 	unsigned char found = 0;
 
-	//allocate arrays of vectors to hold the model space oriented points of colliders
-	Vector** modelOrientedPoints1 = (Vector**)malloc(sizeof(Vector*) * convexHull1->points->size);
-	Vector** modelOrientedPoints2 = (Vector**)malloc(sizeof(Vector*) * convexHull2->points->size);
-
-	//Allocate & initialize individual vectors in array
-	for(unsigned int i = 0; i < convexHull1->points->size; i++)
-	{
-		modelOrientedPoints1[i] = Vector_Allocate();
-		Vector_Initialize(modelOrientedPoints1[i], 3);
-	}
-
-	//Allocate & initialize individual vectors in array
-	for(unsigned int i = 0; i < convexHull2->points->size; i++)
-	{
-		modelOrientedPoints2[i] = Vector_Allocate();
-		Vector_Initialize(modelOrientedPoints2[i], 3);
-	}
-
-
-	//Get the points of the collider oriented in modelSpace
-	ConvexHullCollider_GetOrientedModelPoints(modelOrientedPoints1, convexHull1, convexFrame1);
-	ConvexHullCollider_GetOrientedModelPoints(modelOrientedPoints2, convexHull2, convexFrame2);
+	//Get the world caches holding the points of the colliders oriented in model and world space
+	const ConvexHullCollider_WorldCache* cache1 = ConvexHullCollider_GetWorldCache(convexHull1, convexFrame1);
+	const ConvexHullCollider_WorldCache* cache2 = ConvexHullCollider_GetWorldCache(convexHull2, convexFrame2);
 
 
 	//We must now determine the type of collision:
@@ -1192,7 +2487,7 @@ static void PhysicsManager_DetermineCollisionPointConvexHull(Vector* dest,
 	DynamicArray_Initialize(furthestPoints1, sizeof(Vector));
 	DynamicArray_Initialize(furthestPoints2, sizeof(Vector));
 
-	ConvexHullCollider_GetFurthestPoints(furthestPoints1, convexHull1, (const Vector**)modelOrientedPoints1, relativeMTV);
+	ConvexHullCollider_GetFurthestPoints(furthestPoints1, convexHull1, cache1->modelOrientedPoints, relativeMTV);
 
 	//If only a single closest point was found, We have a special case of:
 	//	Vertex - Vertex / Edge / Face
@@ -1212,7 +2507,7 @@ static void PhysicsManager_DetermineCollisionPointConvexHull(Vector* dest,
 		Vector relativeMTVForObj2;
 		Vector_INIT_ON_STACK(relativeMTVForObj2, 3);
 		Vector_GetScalarProduct(&relativeMTVForObj2, relativeMTV, -1.0f);
-		ConvexHullCollider_GetFurthestPoints(furthestPoints2, convexHull2, (const Vector**)modelOrientedPoints2, &relativeMTVForObj2);
+		ConvexHullCollider_GetFurthestPoints(furthestPoints2, convexHull2, cache2->modelOrientedPoints, &relativeMTVForObj2);
 
 
 		//If only a single furthest point was found, We have a special case of:
@@ -1249,17 +2544,18 @@ static void PhysicsManager_DetermineCollisionPointConvexHull(Vector* dest,
 	{
 		//It must be an Edge / Face - Face case
 
-		//In this case we must translate all points into worldspace before calling the collision point determination function!
+		//In this case we must use the world space points before calling the collision point determination function!
+		//The cached world points are the model oriented points translated by the frame's position, so just point the views at them
 		for(int i = 0; i < furthestPoints1->size; i++)
 		{
 			Vector* current = (Vector*)DynamicArray_Index(furthestPoints1, i);
-			Vector_Increment(current, convexFrame1->position);
+			current->components = (float*)cache1->worldPoints[(Vec3*)current->components - cache1->modelOrientedPoints].components;
 		}
 
 		for(int i = 0; i < furthestPoints2->size; i++)
 		{
 			Vector*current = (Vector*)DynamicArray_Index(furthestPoints2, i);
-			Vector_Increment(current, convexFrame2->position);
+			current->components = (float*)cache2->worldPoints[(Vec3*)current->components - cache2->modelOrientedPoints].components;
 		}
 
 		//Calculate approximate collision point of general case
@@ -1268,19 +2564,6 @@ static void PhysicsManager_DetermineCollisionPointConvexHull(Vector* dest,
 		found = 1;
 	}
 
-	//Delete arrays of modelSpace oriented collider points
-	for(unsigned int i = 0; i < convexHull1->points->size; i++)
-	{
-		Vector_Free(modelOrientedPoints1[i]);
-	}
-	free(modelOrientedPoints1);
-	for(unsigned int i = 0; i < convexHull2->points->size; i++)
-	{
-		Vector_Free(modelOrientedPoints2[i]);
-	}
-	free(modelOrientedPoints2);
-
-
 	//Delete dynamic arrays of furthest points
 	DynamicArray_Free(furthestPoints1);
 	DynamicArray_Free(furthestPoints2);
@@ -1,15 +1,89 @@
 #include "CollisionManager.h"
 
 #include "GObject.h"
+#include "JobManager.h"
 #include "DynamicArray.h"
 #include "LinkedList.h"
 
+//Dictates how the collisions found each frame are resolved
+enum CollisionSolver
+{
+	SOLVER_SEQUENTIALIMPULSE,	//Iterates impulses over every contact manifold at once, starting from the impulses of the last frame
+	SOLVER_DECOUPLE				//Resolves each collision once in list order, pulling the objects apart and applying a single impulse
+};
+
 typedef struct PhysicsBuffer
 {
 	LinkedList* globalForces;			//Contains the list of global forces to apply to all bodies upon each update
 	LinkedList* globalAccelerations;	//Contains the listof global accelerations to apply to all bodies upon each update
+
+	CollisionSolver solver;				//The method used to resolve collisions
+	unsigned int solverIterations;		//Number of passes the sequential impulse solver makes over the contacts each frame
+	float previousDeltaTime;			//The time step of the last frame the sequential impulse solver ran
+
+	DynamicArray* contactConstraints;	//ContactConstraint of each collision being solved, reused every frame
+	DynamicArray* contactCandidates;	//ContactPoint of each candidate contact of a manifold before it is reduced
+	DynamicArray* features[2];			//Vec3 points of each object's surface furthest along the contact normal
+	DynamicArray* clipBuffers[2];		//Vec3 points of a feature being clipped against another
+	DynamicArray* featureAngles;		//Angle of each point of a feature around it's center, used to wind it
+
+	float timeToSleep;					//Seconds a body must move slowly before it's island can sleep, 0 if bodies never sleep
+	DynamicArray* islandBodies;			//RigidBody* of every body simulated this frame, which islands are found among
+
+	DynamicArray* sweptObjects;			//GObject* of every body with continuous collision moved this frame
+	DynamicArray* sweepTargets;			//GObject* of every object the broad phase places near the body being swept
+	DynamicArray* syncedObjects;		//GObject* of every object whose frame of reference is updated from it's body this frame
 } PhysicsBuffer;
 
+//Internals
+
+//A point of contact between two objects
+struct ContactPoint
+{
+	Vec3 position;				//World space position of the contact, halfway between the surfaces
+	Vec3 radius1;				//From the center of mass of obj1 to the contact
+	Vec3 radius2;				//From the center of mass of obj2 to the contact
+	Vec3 localRadius1;			//radius1 in the space of obj1, so the contact can be followed as obj1 moves
+	Vec3 localRadius2;			//radius2 in the space of obj2
+	float penetration;			//Distance the surfaces overlap at the contact
+	float normalMass;			//Mass the contact has along the normal
+	float tangentMass[2];		//Mass the contact has along each tangent
+	float targetVelocity;		//Separating velocity along the normal the solver drives the contact towards
+	float normalImpulse;		//Impulse accumulated along the normal
+	float tangentImpulse[2];	//Friction impulse accumulated along each tangent
+};
+
+//The contact manifold of a collision with everything the sequential impulse solver needs
+struct ContactConstraint
+{
+	Collision* collision;
+	RigidBody* body1;			//The body of obj1, or NULL if the solver cannot move obj1
+	RigidBody* body2;			//The body of obj2, or NULL if the solver cannot move obj2
+	float inverseMass1;			//0 if obj1 cannot translate
+	float inverseMass2;			//0 if obj2 cannot translate
+	Mat3 inverseInertia1;		//World space inverse inertia of obj1, 0 if obj1 cannot rotate
+	Mat3 inverseInertia2;		//World space inverse inertia of obj2, 0 if obj2 cannot rotate
+	Vec3 normal;				//Contact normal, pointing from obj2 to obj1
+	Vec3 tangents[2];			//Two directions perpendicular to the normal and each other
+	float friction;				//Coefficient of friction between the surfaces
+	ContactPoint points[PairCache_maxContacts];
+	unsigned int numPoints;
+};
+
+static const unsigned int PhysicsManager_defaultSolverIterations = 10;	//Iterations the sequential impulse solver starts with
+static const float PhysicsManager_contactSlop = 0.01f;					//Penetration left uncorrected so resting contacts stay touching
+static const unsigned int PhysicsManager_positionIterations = 3;		//Passes made over the contacts to push apart penetrating objects
+static const float PhysicsManager_baumgarteFactor = 0.2f;				//Fraction of the penetration past the slop corrected by each position iteration
+static const float PhysicsManager_maxCorrection = 0.2f;					//Furthest a contact is pushed apart by one position iteration
+static const float PhysicsManager_restitutionThreshold = 1.0f;			//Slowest approach which bounces, slower contacts come to rest
+static const float PhysicsManager_featureTolerance = 0.02f;				//Points this close to the furthest point along the normal belong to the same feature
+static const float PhysicsManager_contactMatchDistance = 0.1f;			//Furthest a contact can move within obj1 between frames and keep it's impulses
+static const float PhysicsManager_defaultTimeToSleep = 0.5f;			//Seconds a body must move slowly before it can sleep when the physics manager starts
+static const float PhysicsManager_sleepLinearVelocity = 0.1f;			//Fastest speed of a body which counts as moving slowly
+static const float PhysicsManager_sleepAngularVelocity = 0.1f;			//Fastest angular speed of a body which counts as moving slowly
+static const float PhysicsManager_sweepPenetration = 0.02f;				//Depth a swept body sinks into the first object it hits so the contact is resolved
+static const unsigned int PhysicsManager_bodiesPerJob = 256;			//Bodies integrated or synced by each job, enough to outweigh the cost of taking a job
+
 static PhysicsBuffer* physicsBuffer;
 
 ///
@@ -66,15 +140,15 @@ void PhysicsManager_AddGlobalAcceleration(Vector* acceleration);
 //Updates the Physics Manager
 //
 //Parameters:
-//	gameObjects: the physics components of the list of gameObjects
-void PhysicsManager_Update(LinkedList* gameObjects);
+//	bodies: A dynamic array of pointers to exactly the game objects with rigid bodies
+void PhysicsManager_Update(DynamicArray* bodies);
 
 ///
 //Updates the Rigidbody components of all gameObjects
 //
 //Parameters:
-//	gameObjects: THe linked list of gameobjects to update their rigidBodies
-void PhysicsManager_UpdateBodies(LinkedList* gameObjects);
+//	bodies: A dynamic array of pointers to exactly the game objects with rigid bodies
+void PhysicsManager_UpdateBodies(DynamicArray* bodies);
 
 ///
 //Applies all global forces to the given rigidbody
@@ -85,37 +159,325 @@ void PhysicsManager_UpdateBodies(LinkedList* gameObjects);
 void PhysicsManager_ApplyGlobalForces(RigidBody* body, float dt);
 
 ///
-//Updates the linear physics of a rigidbody
+//Updates the linear physics of every active body in a range of slots of a rigid body store
 //This determines calculations of acceleration, velocity, and position from netForce, netImpulse, and 1/mass
 //
 //Parameters:
-//	body: The body to update
+//	store: The store holding the bodies to update
+//	first: The index of the first slot to update
+//	end: One past the index of the last slot to update
 //	dt: The change in time since last update
-void PhysicsManager_UpdateLinearPhysicsOfBody(RigidBody* body, float dt);
+void PhysicsManager_UpdateLinearPhysicsOfBodies(RigidBodyStore* store, unsigned int first, unsigned int end, float dt);
 
 ///
-//Updates the rotational physics of a rigidbody
+//Updates the rotational physics of every active body in a range of slots of a rigid body store
 //This determines calculations of angular acceleration, angular velocity, and orientation / rotation
 //from net torque and inverse Inertia
 //
 //Parameters:
-//	body: The body to update
+//	store: The store holding the bodies to update
+//	first: The index of the first slot to update
+//	end: One past the index of the last slot to update
 //	dt: The change in time since last update
-void PhysicsManager_UpdateRotationalPhysicsOfBody(RigidBody* body, float dt);
+void PhysicsManager_UpdateRotationalPhysicsOfBodies(RigidBodyStore* store, unsigned int first, unsigned int end, float dt);
 
 ///
 //Updates the Frame of reference component of all gameObjects to match their rigidbodies
 //
 //Parameters:
-//	gameObjects: the linked list of gameObjects to update their rigidbodies
-void PhysicsManager_UpdateObjects(LinkedList* gameObjects);
+//	bodies: A dynamic array of pointers to exactly the game objects with rigid bodies
+void PhysicsManager_UpdateObjects(DynamicArray* bodies);
+
+///
+//Moves the Frame of reference component of all gameObjects between the last two states of their rigidbodies,
+//So objects are drawn smoothly when physics steps at a different rate than frames are drawn
+//
+//Parameters:
+//	bodies: A dynamic array of pointers to exactly the game objects with rigid bodies
+//	alpha: How far to move from the state before the last physics step to the state after it, from 0 to 1
+void PhysicsManager_InterpolateObjects(DynamicArray* bodies, float alpha);
+
+///
+//Clears the forces and torques applied to every rigid body this frame.
+//A force is applied over time, so the forces applied during a frame are applied by each of the frame's fixed steps
+//And dropped once the frame's steps are taken. Must be called once per frame after it's fixed steps, even when it took none.
+void PhysicsManager_ClearForces(void);
+
+///
+//Sets the method used to resolve collisions
+//
+//Parameters:
+//	solver: The method to resolve collisions with
+void PhysicsManager_SetSolver(CollisionSolver solver);
+
+///
+//Gets the method used to resolve collisions
+//
+//Returns:
+//	The method collisions are resolved with
+CollisionSolver PhysicsManager_GetSolver(void);
+
+///
+//Sets the number of passes the sequential impulse solver makes over the contacts each frame.
+//More iterations let impulses travel further through stacks at a higher cost.
+//
+//Parameters:
+//	numIterations: The number of iterations, at least 1
+void PhysicsManager_SetSolverIterations(unsigned int numIterations);
+
+///
+//Sets how long a body must move slowly before it can be put to sleep.
+//Touching bodies form an island which only sleeps once all of it's bodies can, and wakes when any of them is disturbed.
+//
+//Parameters:
+//	seconds: The time in seconds, or 0 to keep every body awake
+void PhysicsManager_SetTimeToSleep(float seconds);
+
+///
+//Resolves all collisions in an array,
+//Then puts to sleep the islands of bodies which have been resting long enough and wakes those which were disturbed
+//
+//Parameters:
+//	collisions: A dynamic array of pointers to all collisions detected which need resolving
+void PhysicsManager_ResolveCollisions(DynamicArray* collisions);
+
+///
+//Integrates the active bodies in a chunk of slots of the rigid body store.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the float change in time since last update
+//	first: The index of the first slot to integrate
+//	end: One past the index of the last slot to integrate
+//	threadIndex: Unused
+static void PhysicsManager_IntegrateBodies(void* data, unsigned int first, unsigned int end, unsigned int threadIndex);
+
+///
+//Updates the Frame of reference component of a chunk of the physics buffer's synced objects to match their rigidbodies,
+//And clears the forces applied to the rigidbodies this step.
+//Performed by the threads of the job manager.
+//
+//Parameters:
+//	data: A pointer to the float change in time since last update
+//	first: The index of the first object to update
+//	end: One past the index of the last object to update
+//	threadIndex: Unused
+static void PhysicsManager_SyncObjects(void* data, unsigned int first, unsigned int end, unsigned int threadIndex);
+
+///
+//Moves a body with continuous collision back along it's last step to where it first touched another object,
+//Letting it sink in slightly so the contact is found and resolved instead of passed through.
+//Colliders other than spheres are swept as their world space bounding box.
+//The objects it may hit are found by querying the broad phase in use with the bounds of the whole sweep.
+//
+//Parameters:
+//	obj: The object of the body to sweep (Must have a collider attached)
+static void PhysicsManager_SweepBody(GObject* obj);
+
+///
+//Finds the islands of the bodies simulated this frame from the pairs which are touching,
+//Including the pairs of sleeping bodies kept by the collision manager's pair cache
+//
+//Parameters:
+//	collisions: A dynamic array of pointers to the collisions found this frame
+static void PhysicsManager_FindIslands(DynamicArray* collisions);
+
+///
+//Joins the islands of two objects' bodies
+//
+//Parameters:
+//	obj1: The first object
+//	obj2: The second object
+static void PhysicsManager_LinkIslands(const GObject* obj1, const GObject* obj2);
+
+///
+//Finds the root of the island a body belongs to, shortening the path to it along the way
+//
+//Parameters:
+//	body: The body to find the island of
+//
+//Returns:
+//	The body at the root of the island
+static RigidBody* PhysicsManager_FindIsland(RigidBody* body);
+
+///
+//Flags the root of every island with an awake body which has not moved slowly for long enough to sleep
+static void PhysicsManager_MarkAwakeIslands(void);
+
+///
+//Wakes every body on an island which is disturbed, so a body touching a sleeping island is solved against all of it
+static void PhysicsManager_WakeIslands(void);
+
+///
+//Updates how long each body simulated this frame has been moving slowly,
+//Then puts to sleep every island whose bodies have all moved slowly long enough
+static void PhysicsManager_UpdateSleeping(void);
+
+///
+//Resolves every collision in an array at once with sequential impulses.
+//A manifold of up to four contact points is built for each collision and warm started with the impulses stored in the pair cache,
+//Then impulses are applied directly to the velocities of the bodies at each contact for a number of iterations.
+//Finally the bodies are moved apart to remove the penetration the impulses leave behind.
+//
+//Parameters:
+//	collisions: A dynamic array of pointers to all collisions detected which need resolving
+static void PhysicsManager_SolveContacts(DynamicArray* collisions);
+
+///
+//Initializes the contact constraint of a collision, building it's contact manifold
+//
+//Parameters:
+//	constraint: The constraint to initialize
+//	collision: The collision to build the constraint from
+//
+//Returns:
+//	1 if the constraint has a contact and an object the solver can move, else 0
+static unsigned char PhysicsManager_InitializeContactConstraint(ContactConstraint* constraint, Collision* collision);
+
+///
+//Builds the contact manifold of a constraint from the surfaces of it's objects which face each other.
+//When both surfaces are edges or vertices a single contact is made,
+//Otherwise the feature with fewer points is clipped against the other.
+//
+//Parameters:
+//	constraint: The constraint to build the manifold of, with it's collision and normal set
+static void PhysicsManager_BuildContactManifold(ContactConstraint* constraint);
+
+///
+//Gets two directions perpendicular to a normal and to each other, always the same two for the same normal
+//
+//Parameters:
+//	dest: Array of two Vec3s to store the tangents in
+//	normal: The normalized normal
+static void PhysicsManager_GetContactTangents(Vec3* dest, const Vec3* normal);
+
+///
+//Gets the point halfway between the closest points of two line segments
+//
+//Parameters:
+//	dest: The destination of the point
+//	segment1: Array of the two ends of the first segment
+//	segment2: Array of the two ends of the second segment
+static void PhysicsManager_GetClosestPointOfSegments(Vec3* dest, const Vec3* segment1, const Vec3* segment2);
+
+///
+//Gets the points of an object's collider furthest in a direction, within the feature tolerance
+//
+//Parameters:
+//	dest: Dynamic array of Vec3 to store the points in
+//	obj: The object with the collider
+//	frame: The frame of reference orienting the collider
+//	direction: The direction to search in
+static void PhysicsManager_GetContactFeature(DynamicArray* dest, GObject* obj, FrameOfReference* frame, const Vec3* direction);
+
+///
+//Orders the points of a feature counter clockwise around the contact normal.
+//A feature whose points all lie along a line is reduced to the two ends of the line.
+//
+//Parameters:
+//	feature: Dynamic array of Vec3 holding the feature to order
+//	normal: The contact normal
+static void PhysicsManager_WindContactFeature(DynamicArray* feature, const Vec3* normal);
+
+///
+//Clips an incident feature against the sides of a reference feature and adds each remaining point as a candidate contact
+//
+//Parameters:
+//	incident: Dynamic array of Vec3 holding the feature to clip
+//	reference: Dynamic array of Vec3 holding the wound feature, with at least three points, to clip against
+//	normal: The contact normal, pointing from obj2 to obj1
+//	referenceIsObj1: 1 if the reference feature belongs to obj1, 0 if it belongs to obj2
+static void PhysicsManager_ClipContactFeature(DynamicArray* incident, DynamicArray* reference, const Vec3* normal, unsigned char referenceIsObj1);
+
+///
+//Adds a candidate contact to the physics buffer's candidates unless one already lies on top of it
+//
+//Parameters:
+//	position: The position of the contact
+//	penetration: The distance the surfaces overlap at the contact
+static void PhysicsManager_AddContactCandidate(const Vec3* position, float penetration);
+
+///
+//Copies the candidate contacts into a constraint, keeping the four which cover the largest area if there are more
+//
+//Parameters:
+//	constraint: The constraint to store the contacts in
+static void PhysicsManager_ReduceContactCandidates(ContactConstraint* constraint);
+
+///
+//Gets the mass of a contact along a direction, the inverse of the change in relative velocity a unit impulse causes
+//
+//Parameters:
+//	constraint: The constraint holding the contact
+//	point: The contact
+//	direction: The direction of the impulse
+//
+//Returns:
+//	The mass along the direction
+static float PhysicsManager_GetContactMass(const ContactConstraint* constraint, const ContactPoint* point, const Vec3* direction);
+
+///
+//Gets the velocity of the contact point on obj1 relative to the contact point on obj2
+//
+//Parameters:
+//	dest: The destination of the relative velocity
+//	constraint: The constraint holding the contact
+//	point: The contact
+static void PhysicsManager_GetContactVelocity(Vec3* dest, const ContactConstraint* constraint, const ContactPoint* point);
+
+///
+//Applies an impulse at a contact to obj1, and the opposite impulse to obj2, changing their velocities immediately
+//
+//Parameters:
+//	constraint: The constraint holding the contact
+//	point: The contact
+//	impulse: The impulse to apply to obj1
+static void PhysicsManager_ApplyContactImpulse(const ContactConstraint* constraint, const ContactPoint* point, const Vec3* impulse);
+
+///
+//Gets the position of a world space point in the space of one of the objects of a pair
+//
+//Parameters:
+//	dest: The destination of the local point
+//	constraint: The constraint of the pair
+//	point: The world space point
+//	ofObj1: 1 to get the point in the space of obj1, 0 for obj2
+static void PhysicsManager_GetLocalContactPoint(Vec3* dest, const ContactConstraint* constraint, const Vec3* point, unsigned char ofObj1);
+
+///
+//Starts the accumulated impulses of a constraint from the impulses stored in the pair's entry,
+//Matching each contact to the nearest stored contact, and applies them
+//
+//Parameters:
+//	constraint: The constraint to warm start
+//	entry: The pair's entry in the pair cache
+//	timeStepRatio: This frame's time step over the time step the impulses were stored with
+static void PhysicsManager_WarmStartContacts(ContactConstraint* constraint, const PairCache_Entry* entry, float timeStepRatio);
+
+///
+//Performs one iteration of the sequential impulse solver on a constraint,
+//Applying the friction and normal impulses which bring each contact closer to it's target velocity
+//
+//Parameters:
+//	constraint: The constraint to solve
+static void PhysicsManager_SolveContactConstraint(ContactConstraint* constraint);
+
+///
+//Stores the accumulated impulses of a constraint in the pair's entry for the next frame
+//
+//Parameters:
+//	constraint: The solved constraint
+//	entry: The pair's entry in the pair cache
+static void PhysicsManager_StoreContactImpulses(const ContactConstraint* constraint, PairCache_Entry* entry);
 
 ///
-//Resolves all collisions in a linked list
+//Performs one iteration of position correction on a constraint.
+//Moves the bodies directly to remove part of the penetration left at each contact,
+//So correcting penetration does not add velocity which would make resting contacts jitter.
 //
 //Parameters:
-//	collisions: A linked list of all collisions detected which need resolving
-void PhysicsManager_ResolveCollisions(LinkedList* collisions);
+//	constraint: The constraint to correct
+static void PhysicsManager_SolveContactPosition(const ContactConstraint* constraint);
 
 ///
 //Resolves a collision
@@ -183,8 +545,8 @@ static void PhysicsManager_DetermineCollisionPointAABB(Vector* dest, const Frame
 //	convexFrame2: A pointer to the frame of reference of the other convex hull involved in the collision, whether the object itself has a convex hull or not
 //	relativeMTV: A pointer to a vector representing the MTV !Pointing towards the OTHER object (convexHull2)!
 static void PhysicsManager_DetermineCollisionPointConvexHull(Vector* dest,
-															const ColliderData_ConvexHull* convexHull1, const FrameOfReference* convexFrame1,
-															const ColliderData_ConvexHull* convexHull2, const FrameOfReference* convexFrame2,
+															ColliderData_ConvexHull* convexHull1, const FrameOfReference* convexFrame1,
+															ColliderData_ConvexHull* convexHull2, const FrameOfReference* convexFrame2,
 															const Vector* relativeMTV);
 
 ///
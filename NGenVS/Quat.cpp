@@ -0,0 +1,214 @@
+#include "Quat.h"
+
+#include <math.h>
+
+///
+//Sets a Quat to the identity rotation
+//
+//Parameters:
+//	quat: The Quat to set
+void Quat_ToIdentity(Quat* quat)
+{
+	quat->components[0] = 0.0f;
+	quat->components[1] = 0.0f;
+	quat->components[2] = 0.0f;
+	quat->components[3] = 1.0f;
+}
+
+///
+//Sets a Quat to a rotation around an axis
+//
+//Parameters:
+//	dest: The Quat to set
+//	axis: The normalized axis to rotate around
+//	radians: The amount of radians to rotate by
+void Quat_SetAxisAngle(Quat* dest, const Vec3* axis, const float radians)
+{
+	float halfSin = sinf(radians * 0.5f);
+	dest->components[0] = axis->components[0] * halfSin;
+	dest->components[1] = axis->components[1] * halfSin;
+	dest->components[2] = axis->components[2] * halfSin;
+	dest->components[3] = cosf(radians * 0.5f);
+}
+
+///
+//Normalizes a Quat so it is a pure rotation
+//A Quat with a magnitude of 0 is set to the identity
+//
+//Parameters:
+//	quat: The Quat to normalize
+void Quat_Normalize(Quat* quat)
+{
+	float magSq = 0.0f;
+	for(int i = 0; i < 4; i++)
+	{
+		magSq += quat->components[i] * quat->components[i];
+	}
+
+	if(magSq == 0.0f)
+	{
+		Quat_ToIdentity(quat);
+		return;
+	}
+
+	float inverseMag = 1.0f / sqrtf(magSq);
+	for(int i = 0; i < 4; i++)
+	{
+		quat->components[i] *= inverseMag;
+	}
+}
+
+///
+//Gets the product of two Quats, the rotation by RHS followed by the rotation by LHS
+//
+//Parameters:
+//	dest: The destination of the product, may alias either operand
+//	LHS: The left hand side of the product
+//	RHS: The right hand side of the product
+void Quat_GetProduct(Quat* dest, const Quat* LHS, const Quat* RHS)
+{
+	const float* l = LHS->components;
+	const float* r = RHS->components;
+
+	//Compute into temporaries so dest may alias either operand
+	float x = l[3] * r[0] + l[0] * r[3] + l[1] * r[2] - l[2] * r[1];
+	float y = l[3] * r[1] - l[0] * r[2] + l[1] * r[3] + l[2] * r[0];
+	float z = l[3] * r[2] + l[0] * r[1] - l[1] * r[0] + l[2] * r[3];
+	float w = l[3] * r[3] - l[0] * r[0] - l[1] * r[1] - l[2] * r[2];
+
+	dest->components[0] = x;
+	dest->components[1] = y;
+	dest->components[2] = z;
+	dest->components[3] = w;
+}
+
+///
+//Advances a Quat by a world space angular velocity over a time step and normalizes the result.
+//The time derivative of the rotation is 1/2 * (angularVelocity, 0) * quat, which is integrated directly,
+//So no axis, angle or trigonometry is needed.
+//
+//Parameters:
+//	quat: The Quat to advance
+//	angularVelocity: The angular velocity in radians per second
+//	dt: The time step
+void Quat_Integrate(Quat* quat, const Vec3* angularVelocity, const float dt)
+{
+	Quat spin;
+	spin.components[0] = angularVelocity->components[0];
+	spin.components[1] = angularVelocity->components[1];
+	spin.components[2] = angularVelocity->components[2];
+	spin.components[3] = 0.0f;
+
+	Quat derivative;
+	Quat_GetProduct(&derivative, &spin, quat);
+
+	float halfDT = 0.5f * dt;
+	for(int i = 0; i < 4; i++)
+	{
+		quat->components[i] += derivative.components[i] * halfDT;
+	}
+
+	Quat_Normalize(quat);
+}
+
+///
+//Blends between two rotations and normalizes the result.
+//The shorter way between the rotations is taken, as a Quat and it's negation describe the same rotation.
+//
+//Parameters:
+//	dest: The destination of the blend, may alias either operand
+//	from: The rotation when alpha is 0
+//	to: The rotation when alpha is 1
+//	alpha: How far to move from one rotation to the other, from 0 to 1
+void Quat_GetNlerp(Quat* dest, const Quat* from, const Quat* to, const float alpha)
+{
+	float dot = 0.0f;
+	for(int i = 0; i < 4; i++)
+	{
+		dot += from->components[i] * to->components[i];
+	}
+	float toScale = dot < 0.0f ? -alpha : alpha;
+
+	for(int i = 0; i < 4; i++)
+	{
+		dest->components[i] = from->components[i] * (1.0f - alpha) + to->components[i] * toScale;
+	}
+
+	Quat_Normalize(dest);
+}
+
+///
+//Gets the rotation matrix of a unit Quat
+//
+//Parameters:
+//	dest: The destination of the rotation matrix
+//	quat: The Quat to get the rotation matrix of
+void Quat_ToMat3(Mat3* dest, const Quat* quat)
+{
+	float x = quat->components[0];
+	float y = quat->components[1];
+	float z = quat->components[2];
+	float w = quat->components[3];
+
+	float* m = dest->components;
+	m[0] = 1.0f - 2.0f * (y * y + z * z);
+	m[1] = 2.0f * (x * y - z * w);
+	m[2] = 2.0f * (x * z + y * w);
+
+	m[3] = 2.0f * (x * y + z * w);
+	m[4] = 1.0f - 2.0f * (x * x + z * z);
+	m[5] = 2.0f * (y * z - x * w);
+
+	m[6] = 2.0f * (x * z - y * w);
+	m[7] = 2.0f * (y * z + x * w);
+	m[8] = 1.0f - 2.0f * (x * x + y * y);
+}
+
+///
+//Gets the Quat of a rotation matrix.
+//The matrix is assumed to be orthonormal, the result is normalized so small drift is tolerated.
+//
+//Parameters:
+//	dest: The destination of the Quat
+//	mat: The rotation matrix
+void Quat_FromMat3(Quat* dest, const Mat3* mat)
+{
+	const float* m = mat->components;
+	float trace = m[0] + m[4] + m[8];
+
+	//Divide by the largest of the four terms so the result stays accurate for every rotation
+	if(trace > 0.0f)
+	{
+		float s = 2.0f * sqrtf(trace + 1.0f);
+		dest->components[0] = (m[7] - m[5]) / s;
+		dest->components[1] = (m[2] - m[6]) / s;
+		dest->components[2] = (m[3] - m[1]) / s;
+		dest->components[3] = 0.25f * s;
+	}
+	else if(m[0] > m[4] && m[0] > m[8])
+	{
+		float s = 2.0f * sqrtf(1.0f + m[0] - m[4] - m[8]);
+		dest->components[0] = 0.25f * s;
+		dest->components[1] = (m[1] + m[3]) / s;
+		dest->components[2] = (m[2] + m[6]) / s;
+		dest->components[3] = (m[7] - m[5]) / s;
+	}
+	else if(m[4] > m[8])
+	{
+		float s = 2.0f * sqrtf(1.0f + m[4] - m[0] - m[8]);
+		dest->components[0] = (m[1] + m[3]) / s;
+		dest->components[1] = 0.25f * s;
+		dest->components[2] = (m[5] + m[7]) / s;
+		dest->components[3] = (m[2] - m[6]) / s;
+	}
+	else
+	{
+		float s = 2.0f * sqrtf(1.0f + m[8] - m[0] - m[4]);
+		dest->components[0] = (m[2] + m[6]) / s;
+		dest->components[1] = (m[5] + m[7]) / s;
+		dest->components[2] = 0.25f * s;
+		dest->components[3] = (m[3] - m[1]) / s;
+	}
+
+	Quat_Normalize(dest);
+}
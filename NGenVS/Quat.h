@@ -0,0 +1,88 @@
+#ifndef QUAT_H
+#define QUAT_H
+
+#include "Vec3.h"
+#include "Mat3.h"
+
+///
+//A Quat is a quaternion stored by value as x, y, z then w,
+//Where a unit quaternion rotating by an angle around an axis is (axis * sin(angle / 2), cos(angle / 2)).
+//Unlike a rotation matrix it has only one constraint, a magnitude of 1, which is cheap to restore after integrating it.
+typedef struct Quat
+{
+	float components[4];
+} Quat;
+
+///
+//Sets a Quat to the identity rotation
+//
+//Parameters:
+//	quat: The Quat to set
+void Quat_ToIdentity(Quat* quat);
+
+///
+//Sets a Quat to a rotation around an axis
+//
+//Parameters:
+//	dest: The Quat to set
+//	axis: The normalized axis to rotate around
+//	radians: The amount of radians to rotate by
+void Quat_SetAxisAngle(Quat* dest, const Vec3* axis, const float radians);
+
+///
+//Normalizes a Quat so it is a pure rotation
+//A Quat with a magnitude of 0 is set to the identity
+//
+//Parameters:
+//	quat: The Quat to normalize
+void Quat_Normalize(Quat* quat);
+
+///
+//Gets the product of two Quats, the rotation by RHS followed by the rotation by LHS
+//
+//Parameters:
+//	dest: The destination of the product, may alias either operand
+//	LHS: The left hand side of the product
+//	RHS: The right hand side of the product
+void Quat_GetProduct(Quat* dest, const Quat* LHS, const Quat* RHS);
+
+///
+//Advances a Quat by a world space angular velocity over a time step and normalizes the result.
+//The time derivative of the rotation is 1/2 * (angularVelocity, 0) * quat, which is integrated directly,
+//So no axis, angle or trigonometry is needed.
+//
+//Parameters:
+//	quat: The Quat to advance
+//	angularVelocity: The angular velocity in radians per second
+//	dt: The time step
+void Quat_Integrate(Quat* quat, const Vec3* angularVelocity, const float dt);
+
+///
+//Blends between two rotations and normalizes the result.
+//The shorter way between the rotations is taken, as a Quat and it's negation describe the same rotation.
+//
+//Parameters:
+//	dest: The destination of the blend, may alias either operand
+//	from: The rotation when alpha is 0
+//	to: The rotation when alpha is 1
+//	alpha: How far to move from one rotation to the other, from 0 to 1
+void Quat_GetNlerp(Quat* dest, const Quat* from, const Quat* to, const float alpha);
+
+///
+//Gets the rotation matrix of a unit Quat
+//
+//Parameters:
+//	dest: The destination of the rotation matrix
+//	quat: The Quat to get the rotation matrix of
+void Quat_ToMat3(Mat3* dest, const Quat* quat);
+
+///
+//Gets the Quat of a rotation matrix.
+//The matrix is assumed to be orthonormal, the result is normalized so small drift is tolerated.
+//
+//Parameters:
+//	dest: The destination of the Quat
+//	mat: The rotation matrix
+void Quat_FromMat3(Quat* dest, const Mat3* mat);
+
+#endif
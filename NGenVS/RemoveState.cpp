@@ -18,14 +18,25 @@ struct State_Remove_Members
 void State_Remove_Initialize(State* state, float seconds)
 {
 	state->members = (State_Members)malloc(sizeof(struct State_Remove_Members));
+	State_Remove_Reset(state, seconds);
+
+	state->State_Members_Free = State_Remove_Free;
+	state->State_Update = State_Remove_Update;
+}
+
+///
+//Restarts the timer of a remove state, so the state of a recycled object can be used again
+//
+//Parameters:
+//	state: The remove state to restart
+//	seconds: The number of seconds until removal of this object from the simulation
+void State_Remove_Reset(State* state, float seconds)
+{
 	//Get members
 	struct State_Remove_Members* members = (struct State_Remove_Members*)state->members;
 
 	members->currentTime = 0.0f;
 	members->removeTime = seconds;
-
-	state->State_Members_Free = State_Remove_Free;
-	state->State_Update = State_Remove_Update;
 }
 
 ///
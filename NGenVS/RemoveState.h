@@ -12,6 +12,14 @@
 //	seconds: The number of seconds until removal of this object from the simulation
 void State_Remove_Initialize(State* state, float seconds);
 
+///
+//Restarts the timer of a remove state, so the state of a recycled object can be used again
+//
+//Parameters:
+//	state: The remove state to restart
+//	seconds: The number of seconds until removal of this object from the simulation
+void State_Remove_Reset(State* state, float seconds);
+
 ///
 //Frees memory allocated by a remove state
 //
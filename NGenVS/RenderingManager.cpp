@@ -1,8 +1,10 @@
 #include "RenderingManager.h"
 
 #include <stdio.h>
+#include <string.h>
 
 #include "AssetManager.h"
+#include "Mat4.h"
 
 ///
 //Initialize the Rendering Manager
@@ -53,11 +55,12 @@ RenderingBuffer* RenderingManager_GetRenderingBuffer()
 
 
 ///
-//Renders a gameobject as it's mesh.
+//Renders every gameobject with a mesh as it's mesh, then the colliders in debug mode as lines.
 //
 //Parameters:
-//	GO: Game object to render
-void RenderingManager_Render(LinkedList* gameObjects)
+//	meshes: A dynamic array of pointers to exactly the game objects with meshes
+//	colliders: A dynamic array of pointers to exactly the game objects with colliders
+void RenderingManager_Render(DynamicArray* meshes, DynamicArray* colliders)
 {
 
 	//Clear buffers
@@ -83,53 +86,60 @@ void RenderingManager_Render(LinkedList* gameObjects)
 	//Set projectionMatrix Uniform
 	glProgramUniformMatrix4fv(renderingBuffer->shaderPrograms[0]->shaderProgramID, renderingBuffer->shaderPrograms[0]->projectionMatrixLocation, 1, GL_TRUE, renderingBuffer->camera->projectionMatrix->components);
 
+	//The view projection matrix is shared by every object this frame,
+	//Objects keep the model view projection matrix they built with it until it or they change
+	Mat4 viewProjectionMatrix;
+	Mat4_GetProduct(&viewProjectionMatrix, Mat4_FROM_MATRIX(renderingBuffer->camera->projectionMatrix), Mat4_FROM_MATRIX(&viewMatrix));
+	if(memcmp(viewProjectionMatrix.components, renderingBuffer->viewProjectionMatrix.components, sizeof(Mat4)) != 0)
+	{
+		Mat4_Copy(&renderingBuffer->viewProjectionMatrix, &viewProjectionMatrix);
+		renderingBuffer->viewProjectionRevision++;
+	}
 
-	struct LinkedList_Node* current = gameObjects->head;
 
-	while (current != NULL)
+	GObject** gameObjects = (GObject**)meshes->data;
+	for(unsigned int i = 0; i < meshes->size; i++)
 	{
-		GObject* gameObj = (GObject*)(current->data);
-		//Render gameobject's mesh if it exists
-		if (gameObj->mesh != NULL)
-		{
-			//Set color matrix
-			glProgramUniformMatrix4fv(renderingBuffer->shaderPrograms[0]->shaderProgramID, renderingBuffer->shaderPrograms[0]->colorMatrixLocation, 1, GL_TRUE, gameObj->colorMatrix->components);
+		GObject* gameObj = gameObjects[i];
+		//Set color matrix
+		glProgramUniformMatrix4fv(renderingBuffer->shaderPrograms[0]->shaderProgramID, renderingBuffer->shaderPrograms[0]->colorMatrixLocation, 1, GL_TRUE, gameObj->colorMatrix->components);
 
-			//Set modelMatrix uniform
-			FrameOfReference_ToMatrix4(gameObj->frameOfReference, &modelMatrix);
-			glProgramUniformMatrix4fv(renderingBuffer->shaderPrograms[0]->shaderProgramID, renderingBuffer->shaderPrograms[0]->modelMatrixLocation, 1, GL_TRUE, modelMatrix.components);
+		//Set modelMatrix uniform, objects which have not moved reuse the matrix they compiled last
+		const Mat4* worldMatrix = FrameOfReference_GetWorldMatrix(gameObj->frameOfReference);
+		glProgramUniformMatrix4fv(renderingBuffer->shaderPrograms[0]->shaderProgramID, renderingBuffer->shaderPrograms[0]->modelMatrixLocation, 1, GL_TRUE, worldMatrix->components);
 
-			//Construct modelViewProjectionMatrix
-			Matrix_Copy(&modelViewProjectionMatrix, &modelMatrix);
-			Matrix_TransformMatrix(&viewMatrix, &modelViewProjectionMatrix);
-			Matrix_TransformMatrix(renderingBuffer->camera->projectionMatrix, &modelViewProjectionMatrix);
-			//Set modelViewProjectionMatrix uniform
-			glProgramUniformMatrix4fv(renderingBuffer->shaderPrograms[0]->shaderProgramID, renderingBuffer->shaderPrograms[0]->modelViewProjectionMatrixLocation, 1, GL_TRUE, modelViewProjectionMatrix.components);
+		//Set modelViewProjectionMatrix uniform
+		const Mat4* objectModelViewProjection = FrameOfReference_GetModelViewProjectionMatrix(gameObj->frameOfReference, &renderingBuffer->viewProjectionMatrix, renderingBuffer->viewProjectionRevision);
+		glProgramUniformMatrix4fv(renderingBuffer->shaderPrograms[0]->shaderProgramID, renderingBuffer->shaderPrograms[0]->modelViewProjectionMatrixLocation, 1, GL_TRUE, objectModelViewProjection->components);
 
-			if (gameObj->texture != NULL)
-			{
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_2D, gameObj->texture->textureID);
+		if (gameObj->texture != NULL)
+		{
+			glActiveTexture(GL_TEXTURE0);
+			glBindTexture(GL_TEXTURE_2D, gameObj->texture->textureID);
 
-				//Send texture to uniform
-				glUniform1i(renderingBuffer->shaderPrograms[0]->textureLocation, 0);
-			}
-			else
-			{
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_2D, AssetManager_LookupTexture("Test")->textureID);
+			//Send texture to uniform
+			glUniform1i(renderingBuffer->shaderPrograms[0]->textureLocation, 0);
+		}
+		else
+		{
+			glActiveTexture(GL_TEXTURE0);
+			glBindTexture(GL_TEXTURE_2D, AssetManager_LookupTexture("Test")->textureID);
 
-				//Send texture to uniform
-				glUniform1i(renderingBuffer->shaderPrograms[0]->textureLocation, 0);
-			}
+			//Send texture to uniform
+			glUniform1i(renderingBuffer->shaderPrograms[0]->textureLocation, 0);
+		}
 
 
-			//Setup GPU program to draw this mesh
-			Mesh_Render(gameObj->mesh, gameObj->mesh->primitive);
-		}
+		//Setup GPU program to draw this mesh
+		Mesh_Render(gameObj->mesh, gameObj->mesh->primitive);
+	}
 
-		//Render gameObject's collider if it exists & in debug mode
-		if(gameObj->collider != NULL && gameObj->collider->debug)
+	//Render gameObject's collider if it is in debug mode
+	gameObjects = (GObject**)colliders->data;
+	for(unsigned int i = 0; i < colliders->size; i++)
+	{
+		GObject* gameObj = gameObjects[i];
+		if(gameObj->collider->debug)
 		{
 			//Set color matrix
 			glProgramUniformMatrix4fv(renderingBuffer->shaderPrograms[0]->shaderProgramID, renderingBuffer->shaderPrograms[0]->colorMatrixLocation, 1, GL_TRUE, gameObj->collider->colorMatrix->components);
@@ -158,9 +168,7 @@ void RenderingManager_Render(LinkedList* gameObjects)
 
 
 			//Construct modelViewProjectionMatrix
-			Matrix_Copy(&modelViewProjectionMatrix, &modelMatrix);
-			Matrix_TransformMatrix(&viewMatrix, &modelViewProjectionMatrix);
-			Matrix_TransformMatrix(renderingBuffer->camera->projectionMatrix, &modelViewProjectionMatrix);
+			Mat4_GetProduct(Mat4_FROM_MATRIX(&modelViewProjectionMatrix), &viewProjectionMatrix, Mat4_FROM_MATRIX(&modelMatrix));
 			//Set modelViewProjectionMatrix uniform
 			glProgramUniformMatrix4fv(renderingBuffer->shaderPrograms[0]->shaderProgramID, renderingBuffer->shaderPrograms[0]->modelViewProjectionMatrixLocation, 1, GL_TRUE, modelViewProjectionMatrix.components);
 
@@ -181,8 +189,6 @@ void RenderingManager_Render(LinkedList* gameObjects)
 			*Matrix_Index(gameObj->collider->colorMatrix, 1, 1) = 1.0f;
 			*Matrix_Index(gameObj->collider->colorMatrix, 2, 2) = 0.0f;
 		}
-
-		current = current->next;
 	}
 
 	//Render the oct tree
@@ -249,8 +255,8 @@ void RenderingManager_RenderOctTree(OctTree_Node* nodeToRender, Matrix* modelVie
 		glProgramUniformMatrix4fv(renderingBuffer->shaderPrograms[0]->shaderProgramID, renderingBuffer->shaderPrograms[0]->modelMatrixLocation, 1, GL_TRUE, modelViewProjectionMatrix->components);
 
 		//Construct modelViewProjection
-		Matrix_TransformMatrix(viewMatrix, modelViewProjectionMatrix);
-		Matrix_TransformMatrix(projectionMatrix, modelViewProjectionMatrix);
+		Mat4_Transform(Mat4_FROM_MATRIX(viewMatrix), Mat4_FROM_MATRIX(modelViewProjectionMatrix));
+		Mat4_Transform(Mat4_FROM_MATRIX(projectionMatrix), Mat4_FROM_MATRIX(modelViewProjectionMatrix));
 		//Set modelViewProjectionMatrix uniform
 		glProgramUniformMatrix4fv(renderingBuffer->shaderPrograms[0]->shaderProgramID, renderingBuffer->shaderPrograms[0]->modelViewProjectionMatrixLocation, 1, GL_TRUE, modelViewProjectionMatrix->components);
 
@@ -308,6 +314,10 @@ static void RenderingManager_InitializeBuffer(RenderingBuffer* buffer)
 
 	//Debug
 	buffer->debugOctTree = 0;
+
+	//No object has cached a model view projection matrix yet
+	Mat4_ToIdentity(&buffer->viewProjectionMatrix);
+	buffer->viewProjectionRevision = 0;
 }
 
 ///
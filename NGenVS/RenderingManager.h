@@ -16,6 +16,9 @@ typedef struct RenderingBuffer
 	Camera* camera;
 	Vector* directionalLightVector;
 	unsigned char debugOctTree;
+
+	Mat4 viewProjectionMatrix;				//The view projection matrix of the camera as of the last frame rendered
+	unsigned int viewProjectionRevision;	//Incremented whenever the view projection matrix changes, so objects know when their cached matrices are stale
 } RenderingBuffer;
 
 //Internals
@@ -54,11 +57,12 @@ void RenderingManager_Initialize(void);
 void RenderingManager_Free(void);
 
 ///
-//Renders a gameobject as it's mesh.
+//Renders every gameobject with a mesh as it's mesh, then the colliders in debug mode as lines.
 //
 //Parameters:
-//	GO: Game object to render
-void RenderingManager_Render(LinkedList* GameObjects);
+//	meshes: A dynamic array of pointers to exactly the game objects with meshes
+//	colliders: A dynamic array of pointers to exactly the game objects with colliders
+void RenderingManager_Render(DynamicArray* meshes, DynamicArray* colliders);
 
 ///
 //Renders the OctTree
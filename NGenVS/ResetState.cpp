@@ -83,21 +83,19 @@ void State_Reset_Update(GObject* GO, State* state)
 	{
 
 		//Loop through the collisions which occurred previous frame
-		LinkedList_Node* current = GO->collider->currentCollisions->head;
+		Collision** currentCollisions = (Collision**)GO->collider->currentCollisions->data;
 		Collision* currentCollision;
-		while(current != NULL)
+		for(unsigned int i = 0; i < GO->collider->currentCollisions->size; i++)
 		{
 			//Check if any of the objects involved in the collision are a bullet
 			//TODO: MAke a tagging system so this doesn't need to happen
-			currentCollision = (Collision*)current->data;
+			currentCollision = currentCollisions[i];
 			//Bullets are the only thing with a scale of 0.3
 			if(currentCollision->obj1->frameOfReference->scale->components[0] == 0.9f || currentCollision->obj2->frameOfReference->scale->components[0] == 0.9f)
 			{
 				members->currentTime = 0.0f;
 				break;
 			}
-			current = current->next;
-
 		}
 	}
 	else if(members->currentTime < members->resetTime)
@@ -28,14 +28,10 @@ void State_Revolution_Initialize(State* s, const Vector* startPoint, Vector* poi
 	struct State_Revolution_Members* members = (struct State_Revolution_Members*)s->members;
 
 	members->frameOfRevolution = FrameOfReference_Allocate();
+	FrameOfReference_Initialize(members->frameOfRevolution);
+	//The frame revolves around the given point rather than a copy of it
 	members->frameOfRevolution->position = pointOfRevolution;
 
-	members->frameOfRevolution->rotation = Matrix_Allocate();
-	Matrix_Initialize(members->frameOfRevolution->rotation, 3, 3);
-
-	members->frameOfRevolution->scale = Matrix_Allocate();
-	Matrix_Initialize(members->frameOfRevolution->scale, 3, 3);
-
 	members->startPoint = Vector_Allocate();
 	Vector_Initialize(members->startPoint, 3);
 	Vector_Copy(members->startPoint, startPoint);
@@ -63,10 +59,7 @@ void State_Revolution_Free(State* s)
 
 	Vector_Free(members->startPoint);
 	
-	Matrix_Free(members->frameOfRevolution->rotation);
-	Matrix_Free(members->frameOfRevolution->scale);
-
-	free(members->frameOfRevolution);
+	FrameOfReference_Free(members->frameOfRevolution);
 
 	free(members);
 }
@@ -88,4 +81,5 @@ void State_Revolution_Update(GObject* GO, State* state)
 
 	Matrix_GetProductVector(GO->frameOfReference->position, members->frameOfRevolution->rotation, members->startPoint);
 	Vector_Increment(GO->frameOfReference->position, members->frameOfRevolution->position);
+	FrameOfReference_InvalidateWorldMatrix(GO->frameOfReference);
 }
\ No newline at end of file
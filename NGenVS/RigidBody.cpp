@@ -2,6 +2,16 @@
 
 #include <math.h>
 
+///
+//Gets the rigid body store holding the integrated state of every initialized body
+//
+//Returns:
+//	A pointer to the store, or NULL if no bodies are initialized
+RigidBodyStore* RigidBody_GetStore(void)
+{
+	return RigidBody_store;
+}
+
 ///
 //Allocates memory for a rigidBody
 //
@@ -21,6 +31,57 @@ RigidBody* RigidBody_Allocate(void)
 //	startingFrame: The frame the rigidbody should use to initialize itself in world space
 //	mass: The mass of the rigidbody
 void RigidBody_Initialize(RigidBody* body, const FrameOfReference* startingFrame, const float mass)
+{
+	body->inertia = Mat3_Storage_Initialize(&body->inertiaStorage);
+	body->previousNetForce = Vec3_Storage_Initialize(&body->previousNetForceStorage);
+	body->previousNetTorque = Vec3_Storage_Initialize(&body->previousNetTorqueStorage);
+
+	body->frame = &body->frameStorage;
+	FrameOfReference_Initialize(body->frame);
+
+	//The state read and written while integrating lives in the store, the handles are bound to it's slot when it is added
+	body->inverseInertia = &body->inverseInertiaView;
+	body->inverseInertia->numRows = 3;
+	body->inverseInertia->numColumns = 3;
+	body->netForce = &body->netForceView;
+	body->netImpulse = &body->netImpulseView;
+	body->netTorque = &body->netTorqueView;
+	body->netInstantaneousTorque = &body->netInstantaneousTorqueView;
+	body->acceleration = &body->accelerationView;
+	body->angularAcceleration = &body->angularAccelerationView;
+	body->velocity = &body->velocityView;
+	body->angularVelocity = &body->angularVelocityView;
+	body->netForce->dimension = 3;
+	body->netImpulse->dimension = 3;
+	body->netTorque->dimension = 3;
+	body->netInstantaneousTorque->dimension = 3;
+	body->acceleration->dimension = 3;
+	body->angularAcceleration->dimension = 3;
+	body->velocity->dimension = 3;
+	body->angularVelocity->dimension = 3;
+
+	if(RigidBody_store == NULL)
+	{
+		RigidBody_store = RigidBodyStore_Allocate();
+		RigidBodyStore_Initialize(RigidBody_store, RigidBodyStore_defaultCapacity);
+	}
+	RigidBodyStore_Add(RigidBody_store, body);
+
+	body->previousPosition = Vec3_Storage_Initialize(&body->previousPositionStorage);
+
+	RigidBody_Reset(body, startingFrame, mass);
+}
+
+///
+//Resets an initialized RigidBody to the state it was initialized in,
+//So a body can be reused without being freed and initialized again.
+//The body keeps it's slot in the rigid body store.
+//
+//Parameters:
+//	body: The rigid body to reset
+//	startingFrame: The frame the rigidbody should use to reset itself in world space
+//	mass: The mass of the rigidbody
+void RigidBody_Reset(RigidBody* body, const FrameOfReference* startingFrame, const float mass)
 {
 	body->coefficientOfRestitution = 1.0f;
 	body->staticFriction = 1.0f;
@@ -38,48 +99,19 @@ void RigidBody_Initialize(RigidBody* body, const FrameOfReference* startingFrame
 		body->inverseMass = 0.0f;
 	}
 
-	body->inverseInertia = Matrix_Allocate();
-	Matrix_Initialize(body->inverseInertia, 3, 3);
-
-	body->inertia = Matrix_Allocate();
-	Matrix_Initialize(body->inertia, 3, 3);
-
-	body->netForce = Vector_Allocate();
-	Vector_Initialize(body->netForce, 3);
-
-	body->previousNetForce = Vector_Allocate();
-	Vector_Initialize(body->previousNetForce, 3);
-
-	body->netImpulse = Vector_Allocate();
-	Vector_Initialize(body->netImpulse, 3);
-
-	body->netTorque = Vector_Allocate();
-	Vector_Initialize(body->netTorque, 3);
-
-	body->previousNetTorque = Vector_Allocate();
-	Vector_Initialize(body->previousNetTorque, 3);
-
-	body->netInstantaneousTorque = Vector_Allocate();
-	Vector_Initialize(body->netInstantaneousTorque, 3);
-
-	body->acceleration = Vector_Allocate();
-	Vector_Initialize(body->acceleration, 3);
-
-	body->angularAcceleration = Vector_Allocate();
-	Vector_Initialize(body->angularAcceleration, 3);
-
-	body->velocity = Vector_Allocate();
-	Vector_Initialize(body->velocity, 3);
-
-	body->angularVelocity = Vector_Allocate();
-	Vector_Initialize(body->angularVelocity, 3);
-
-	body->frame = FrameOfReference_Allocate();
-	FrameOfReference_Initialize(body->frame);
+	RigidBodyStore_ClearSlot(RigidBody_store, body->storeIndex);
+	Vector_ZeroArray(body->previousNetForce->components, 3);
+	Vector_ZeroArray(body->previousNetTorque->components, 3);
 
 	Vector_Copy(body->frame->position, startingFrame->position);
 	Matrix_Copy(body->frame->rotation, startingFrame->rotation);
 	Matrix_Copy(body->frame->scale, startingFrame->scale);
+	*body->frame->orientation = *startingFrame->orientation;
+	*body->frame->rotationOutOfDate = *startingFrame->rotationOutOfDate;
+	FrameOfReference_InvalidateWorldMatrix(body->frame);
+
+	Vector_Copy(body->previousPosition, body->frame->position);
+	body->previousOrientation = *body->frame->orientation;
 
 	//Set the moment of inertia
 	RigidBody_SetInertiaOfCuboid(body);
@@ -88,6 +120,14 @@ void RigidBody_Initialize(RigidBody* body, const FrameOfReference* startingFrame
 	body->freezeTranslation = 0;
 	body->freezeRotation = 0;
 
+	//Only bodies which move fast enough to pass through objects need to pay for sweeping
+	body->continuousCollision = 0;
+
+	body->isAwake = 1;
+	body->sleepTime = 0.0f;
+	body->island = body;
+	body->islandAwake = 0;
+
 	
 }
 
@@ -98,17 +138,14 @@ void RigidBody_Initialize(RigidBody* body, const FrameOfReference* startingFrame
 //	body: The rigidbody to free
 void RigidBody_Free(RigidBody* body)
 {
-	Matrix_Free(body->inverseInertia);
-	Matrix_Free(body->inertia);
-	Vector_Free(body->netForce);
-	Vector_Free(body->previousNetForce);
-	Vector_Free(body->netImpulse);
-	Vector_Free(body->netTorque);
-	Vector_Free(body->previousNetTorque);
-	Vector_Free(body->netInstantaneousTorque);
-	Vector_Free(body->acceleration);
-	Vector_Free(body->velocity);
-	FrameOfReference_Free(body->frame);
+	RigidBodyStore_Remove(RigidBody_store, body);
+	if(RigidBody_store->size == 0)
+	{
+		RigidBodyStore_Free(RigidBody_store);
+		RigidBody_store = NULL;
+	}
+
+	//All other vectors, matrices and the frame live inside the body
 	free(body);
 }
 
@@ -155,6 +192,8 @@ void RigidBody_SetInertiaOfCuboid(RigidBody* body)
 //		For purposes of preventing rotation make the radius 0.
 void RigidBody_ApplyForce(RigidBody* body, const Vector* forceApplied, const Vector* radius)
 {
+	RigidBody_Wake(body);
+
 	//If the body is not linearly frozen
 	if(!body->freezeTranslation)
 	{
@@ -182,6 +221,8 @@ void RigidBody_ApplyForce(RigidBody* body, const Vector* forceApplied, const Vec
 //		For purposes of preventing rotation make the radius 0.
 void RigidBody_ApplyImpulse(RigidBody* body, const Vector* impulseApplied, const Vector* radius)
 {
+	RigidBody_Wake(body);
+
 	//If the body is not linearly frozen
 	if(!body->freezeTranslation)
 	{
@@ -207,6 +248,8 @@ void RigidBody_ApplyImpulse(RigidBody* body, const Vector* impulseApplied, const
 //	torqueApplied: The torque to apply
 void RigidBody_ApplyTorque(RigidBody* body, const Vector* torqueApplied)
 {
+	RigidBody_Wake(body);
+
 	//If the body's rotation is not frozen
 	if(!body->freezeRotation)
 	{
@@ -222,6 +265,8 @@ void RigidBody_ApplyTorque(RigidBody* body, const Vector* torqueApplied)
 //	torqueApplied: The instantaneous torque to apply
 void RigidBody_ApplyInstantaneousTorque(RigidBody* body, const Vector* instantaneousTorqueApplied)
 {
+	RigidBody_Wake(body);
+
 	//If the body's rotation is not frozen
 	if(!body->freezeRotation)
 	{
@@ -229,6 +274,33 @@ void RigidBody_ApplyInstantaneousTorque(RigidBody* body, const Vector* instantan
 	}
 }
 
+///
+//Wakes a sleeping rigidbody so it is simulated again.
+//Does nothing to a body which is awake.
+//
+//Parameters:
+//	body: The body to wake
+void RigidBody_Wake(RigidBody* body)
+{
+	if(!body->isAwake)
+	{
+		body->isAwake = 1;
+		body->sleepTime = 0.0f;
+	}
+}
+
+///
+//Puts a rigidbody to sleep, stopping it so it is not simulated until it is woken
+//
+//Parameters:
+//	body: The body to put to sleep
+void RigidBody_Sleep(RigidBody* body)
+{
+	body->isAwake = 0;
+	Vector_Copy(body->velocity, &Vector_ZERO);
+	Vector_Copy(body->angularVelocity, &Vector_ZERO);
+}
+
 ///
 //Calculates the linear velocity due to the angular velocity of a point on/in a rigidbody.
 //This is the instantaneous linear velocity of the point around the position of an object.
@@ -298,6 +370,7 @@ void RigidBody_CalculateMomentOfInertiaInWorldSpace(Matrix* dest, const RigidBod
 	Matrix iRotation;		//Inverse of rotation matrix
 	Matrix_INIT_ON_STACK(iRotation, 3, 3);
 
+	FrameOfReference_UpdateRotation(body->frame);
 	Matrix_GetTranspose(&iRotation, body->frame->rotation);
 	Matrix_GetProductMatrix(dest, body->inertia, &iRotation);
 	Matrix_TransformMatrix(body->frame->rotation, dest);
@@ -311,6 +384,7 @@ void RigidBody_CalculateMomentOfInertiaInWorldSpace(Matrix* dest, const RigidBod
 //	translation: The Vector to translate by
 void RigidBody_Translate(RigidBody* body, Vector* translation)
 {
+	RigidBody_Wake(body);
 	FrameOfReference_Translate(body->frame, translation);
 }
 
@@ -323,6 +397,7 @@ void RigidBody_Translate(RigidBody* body, Vector* translation)
 //	radians: The number of radians to rotate by
 void RigidBody_Rotate(RigidBody* body, const Vector* axis, float radians)
 {
+	RigidBody_Wake(body);
 	FrameOfReference_Rotate(body->frame, axis, radians);
 }
 
@@ -335,28 +410,35 @@ void RigidBody_Rotate(RigidBody* body, const Vector* axis, float radians)
 //	scaleVector: A 3 DIM Vector comtaining the X, Y, and Z scale factors
 void RigidBody_Scale(RigidBody* body, Vector* scaleVector)
 {
+	RigidBody_Wake(body);
 	FrameOfReference_Scale(body->frame, scaleVector);
 	RigidBody_SetInertiaOfCuboid(body);
 }
 
 ///
-//Sets the position of a rigidBody
+//Sets the position of a rigidBody.
+//The body is not interpolated from it's old position, it is drawn at the new one straight away.
 //
 //Parameters:
 //  body: The rigidBody to set the position of
 //  position: The position to move the body to
 void RigidBody_SetPosition(RigidBody* body, Vector* position)
 {
+	RigidBody_Wake(body);
 	FrameOfReference_SetPosition(body->frame, position);
+	Vector_Copy(body->previousPosition, body->frame->position);
 }
 
 ///
-//Sets the rotation of a rigidBody
+//Sets the rotation of a rigidBody.
+//The body is not interpolated from it's old rotation, it is drawn at the new one straight away.
 //
 //Parameters:
 //  body: The rigidbody to set the rotation of
 //  position: The rotation to set the body to
 void RigidBody_SetRotation(RigidBody* body, Matrix* rotation)
 {
+	RigidBody_Wake(body);
 	FrameOfReference_SetRotation(body->frame, rotation);
+	body->previousOrientation = *body->frame->orientation;
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "DynamicArray.h"
 #include "FrameOfReference.h"
+#include "RigidBodyStore.h"
 
 typedef struct RigidBody
 {
@@ -23,11 +24,51 @@ typedef struct RigidBody
 	Vector* velocity;					//current velocity of point mass
 	Vector* angularVelocity;			//Current angular velocity
 	FrameOfReference* frame;			//Position and orientation of point mass in global space
+	Vector* previousPosition;			//Position of the frame before the last physics step, used to interpolate rendering
+	Quat previousOrientation;			//Orientation of the frame before the last physics step, used to interpolate rendering
 	unsigned char freezeTranslation;	//Freezes the rigidbody so it can not have any linear forces applied
 	unsigned char freezeRotation;		//Freezes the rigidbody so it cannot have any torques applied
 	unsigned char physicsOn;			//Boolean to turn physics off. 1 = on | 0 = off.
+	unsigned char isAwake;				//Boolean for whether the body is being simulated. 1 = awake | 0 = asleep.
+	unsigned char continuousCollision;	//Boolean to sweep the body's motion each step so it cannot pass through thin objects. 1 = on | 0 = off.
+	float sleepTime;					//Seconds the body has been moving slowly enough to sleep
+
+	//Used by the physics manager while it finds islands of touching bodies
+	struct RigidBody* island;			//The body this body's island is merged into, itself if it is the island's root
+	unsigned char islandAwake;			//On the root of an island, 1 if a body of the island must stay awake
+
+	unsigned int storeIndex;			//The body's slot in the rigid body store
+
+	//Inline storage the handles above point into, a RigidBody is a single allocation
+	Mat3_Storage inertiaStorage;
+	Vec3_Storage previousNetForceStorage;
+	Vec3_Storage previousNetTorqueStorage;
+	Vec3_Storage previousPositionStorage;
+	FrameOfReference frameStorage;
+
+	//Headers of the handles above which view the body's slot in the rigid body store,
+	//The frame's position, rotation and orientation view the store as well
+	Matrix inverseInertiaView;
+	Vector netForceView;
+	Vector netImpulseView;
+	Vector netTorqueView;
+	Vector netInstantaneousTorqueView;
+	Vector accelerationView;
+	Vector angularAccelerationView;
+	Vector velocityView;
+	Vector angularVelocityView;
 } RigidBody;
 
+//Internals
+static RigidBodyStore* RigidBody_store;	//Holds the integrated state of every initialized body, NULL while there are none
+
+///
+//Gets the rigid body store holding the integrated state of every initialized body
+//
+//Returns:
+//	A pointer to the store, or NULL if no bodies are initialized
+RigidBodyStore* RigidBody_GetStore(void);
+
 ///
 //Allocates memory for a rigidBody
 //
@@ -44,6 +85,17 @@ RigidBody* RigidBody_Allocate(void);
 //	mass: The mass of the rigidbody
 void RigidBody_Initialize(RigidBody* body, const FrameOfReference* startingFrame, const float mass);
 
+///
+//Resets an initialized RigidBody to the state it was initialized in,
+//So a body can be reused without being freed and initialized again.
+//The body keeps it's slot in the rigid body store.
+//
+//Parameters:
+//	body: The rigid body to reset
+//	startingFrame: The frame the rigidbody should use to reset itself in world space
+//	mass: The mass of the rigidbody
+void RigidBody_Reset(RigidBody* body, const FrameOfReference* startingFrame, const float mass);
+
 ///
 //Frees resources allocated by a rigidbody
 //
@@ -96,6 +148,21 @@ void RigidBody_ApplyTorque(RigidBody* body, const Vector* torqueApplied);
 //	torqueApplied: The instantaneous torque to apply
 void RigidBody_ApplyInstantaneousTorque(RigidBody* body, const Vector* torqueApplied);
 
+///
+//Wakes a sleeping rigidbody so it is simulated again.
+//Does nothing to a body which is awake.
+//
+//Parameters:
+//	body: The body to wake
+void RigidBody_Wake(RigidBody* body);
+
+///
+//Puts a rigidbody to sleep, stopping it so it is not simulated until it is woken
+//
+//Parameters:
+//	body: The body to put to sleep
+void RigidBody_Sleep(RigidBody* body);
+
 ///
 //Calculates the linear velocity due to the angular velocity of a point on/in a rigidbody.
 //This is the instantaneous linear velocity of the point around the position of an object.
@@ -153,7 +220,8 @@ void RigidBody_Rotate(RigidBody* body, const Vector* axis, float radians);
 void RigidBody_Scale(RigidBody* body, Vector* scaleVector);
 
 ///
-//Sets the position of a rigidBody
+//Sets the position of a rigidBody.
+//The body is not interpolated from it's old position, it is drawn at the new one straight away.
 //
 //Parameters:
 //  body: The rigidBody to set the position of
@@ -161,7 +229,8 @@ void RigidBody_Scale(RigidBody* body, Vector* scaleVector);
 void RigidBody_SetPosition(RigidBody* body, Vector* position);
 
 ///
-//Sets the rotation of a rigidBody
+//Sets the rotation of a rigidBody.
+//The body is not interpolated from it's old rotation, it is drawn at the new one straight away.
 //
 //Parameters:
 //  body: The rigidbody to set the rotation of
@@ -0,0 +1,238 @@
+#include "RigidBodyStore.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "RigidBody.h"
+
+///
+//Allocates memory for a rigid body store
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized rigid body store
+RigidBodyStore* RigidBodyStore_Allocate(void)
+{
+	RigidBodyStore* store = (RigidBodyStore*)malloc(sizeof(RigidBodyStore));
+	return store;
+}
+
+///
+//Initializes a rigid body store with no bodies
+//
+//Parameters:
+//	store: A pointer to the store to initialize
+//	capacity: The initial number of slots, at least 1
+void RigidBodyStore_Initialize(RigidBodyStore* store, unsigned int capacity)
+{
+	store->size = 0;
+	store->capacity = capacity > 0 ? capacity : 1;
+
+	store->bodies = (RigidBody**)malloc(sizeof(RigidBody*) * store->capacity);
+	store->active = (unsigned char*)malloc(sizeof(unsigned char) * store->capacity);
+	store->inverseMasses = (float*)malloc(sizeof(float) * store->capacity);
+
+	store->positions = (Vec3*)malloc(sizeof(Vec3) * store->capacity);
+	store->rotations = (Mat3*)malloc(sizeof(Mat3) * store->capacity);
+	store->orientations = (Quat*)malloc(sizeof(Quat) * store->capacity);
+	store->rotationsOutOfDate = (unsigned char*)malloc(sizeof(unsigned char) * store->capacity);
+	store->velocities = (Vec3*)malloc(sizeof(Vec3) * store->capacity);
+	store->angularVelocities = (Vec3*)malloc(sizeof(Vec3) * store->capacity);
+	store->accelerations = (Vec3*)malloc(sizeof(Vec3) * store->capacity);
+	store->angularAccelerations = (Vec3*)malloc(sizeof(Vec3) * store->capacity);
+	store->netForces = (Vec3*)malloc(sizeof(Vec3) * store->capacity);
+	store->netImpulses = (Vec3*)malloc(sizeof(Vec3) * store->capacity);
+	store->netTorques = (Vec3*)malloc(sizeof(Vec3) * store->capacity);
+	store->netInstantaneousTorques = (Vec3*)malloc(sizeof(Vec3) * store->capacity);
+	store->inverseInertias = (Mat3*)malloc(sizeof(Mat3) * store->capacity);
+	store->heldForces = (Vec3*)malloc(sizeof(Vec3) * store->capacity);
+	store->heldTorques = (Vec3*)malloc(sizeof(Vec3) * store->capacity);
+}
+
+///
+//Frees the data allocated by a rigid body store.
+//Does not free any of the bodies in the store!
+//
+//Parameters:
+//	store: A pointer to the store to free
+void RigidBodyStore_Free(RigidBodyStore* store)
+{
+	free(store->bodies);
+	free(store->active);
+	free(store->inverseMasses);
+
+	free(store->positions);
+	free(store->rotations);
+	free(store->orientations);
+	free(store->rotationsOutOfDate);
+	free(store->velocities);
+	free(store->angularVelocities);
+	free(store->accelerations);
+	free(store->angularAccelerations);
+	free(store->netForces);
+	free(store->netImpulses);
+	free(store->netTorques);
+	free(store->netInstantaneousTorques);
+	free(store->inverseInertias);
+	free(store->heldForces);
+	free(store->heldTorques);
+
+	free(store);
+}
+
+///
+//Adds a body to a rigid body store, binding it's handles to a new slot.
+//The slot's vectors start at 0 and it's matrices start as identity.
+//
+//Parameters:
+//	store: A pointer to the store to add the body to
+//	body: A pointer to the body to add
+void RigidBodyStore_Add(RigidBodyStore* store, RigidBody* body)
+{
+	if(store->size == store->capacity)
+	{
+		RigidBodyStore_Grow(store);
+	}
+
+	unsigned int index = store->size++;
+	store->bodies[index] = body;
+	RigidBodyStore_ClearSlot(store, index);
+
+	RigidBodyStore_BindSlot(store, index);
+}
+
+///
+//Puts the slot of a body in a rigid body store back in the state it was added in,
+//Zeroing it's vectors and setting it's matrices to identity.
+//
+//Parameters:
+//	store: A pointer to the store containing the slot
+//	index: The index of the slot to clear
+void RigidBodyStore_ClearSlot(RigidBodyStore* store, unsigned int index)
+{
+	store->active[index] = 0;
+	store->inverseMasses[index] = 0.0f;
+
+	Vec3_Zero(store->positions + index);
+	Mat3_ToIdentity(store->rotations + index);
+	Quat_ToIdentity(store->orientations + index);
+	store->rotationsOutOfDate[index] = 0;
+	Vec3_Zero(store->velocities + index);
+	Vec3_Zero(store->angularVelocities + index);
+	Vec3_Zero(store->accelerations + index);
+	Vec3_Zero(store->angularAccelerations + index);
+	Vec3_Zero(store->netForces + index);
+	Vec3_Zero(store->netImpulses + index);
+	Vec3_Zero(store->netTorques + index);
+	Vec3_Zero(store->netInstantaneousTorques + index);
+	Mat3_ToIdentity(store->inverseInertias + index);
+	Vec3_Zero(store->heldForces + index);
+	Vec3_Zero(store->heldTorques + index);
+}
+
+///
+//Removes a body from a rigid body store.
+//The last slot is moved into the body's slot, so the handles of the body owning it are rebound.
+//
+//Parameters:
+//	store: A pointer to the store to remove the body from
+//	body: A pointer to the body to remove
+void RigidBodyStore_Remove(RigidBodyStore* store, RigidBody* body)
+{
+	unsigned int index = body->storeIndex;
+	if(index >= store->size || store->bodies[index] != body)
+	{
+		printf("RigidBodyStore_Remove failed! Body is not in the store. Store not changed.\n");
+		return;
+	}
+
+	unsigned int last = --store->size;
+	if(index == last)
+	{
+		return;
+	}
+
+	//Keep the slots in use contiguous so integrating them never skips over holes
+	store->bodies[index] = store->bodies[last];
+	store->active[index] = store->active[last];
+	store->inverseMasses[index] = store->inverseMasses[last];
+
+	store->positions[index] = store->positions[last];
+	store->rotations[index] = store->rotations[last];
+	store->orientations[index] = store->orientations[last];
+	store->rotationsOutOfDate[index] = store->rotationsOutOfDate[last];
+	store->velocities[index] = store->velocities[last];
+	store->angularVelocities[index] = store->angularVelocities[last];
+	store->accelerations[index] = store->accelerations[last];
+	store->angularAccelerations[index] = store->angularAccelerations[last];
+	store->netForces[index] = store->netForces[last];
+	store->netImpulses[index] = store->netImpulses[last];
+	store->netTorques[index] = store->netTorques[last];
+	store->netInstantaneousTorques[index] = store->netInstantaneousTorques[last];
+	store->inverseInertias[index] = store->inverseInertias[last];
+	store->heldForces[index] = store->heldForces[last];
+	store->heldTorques[index] = store->heldTorques[last];
+
+	RigidBodyStore_BindSlot(store, index);
+}
+
+///
+//Doubles the number of slots in a rigid body store, rebinding the handles of every body
+//
+//Parameters:
+//	store: A pointer to the store to grow
+static void RigidBodyStore_Grow(RigidBodyStore* store)
+{
+	store->capacity *= 2;
+
+	store->bodies = (RigidBody**)realloc(store->bodies, sizeof(RigidBody*) * store->capacity);
+	store->active = (unsigned char*)realloc(store->active, sizeof(unsigned char) * store->capacity);
+	store->inverseMasses = (float*)realloc(store->inverseMasses, sizeof(float) * store->capacity);
+
+	store->positions = (Vec3*)realloc(store->positions, sizeof(Vec3) * store->capacity);
+	store->rotations = (Mat3*)realloc(store->rotations, sizeof(Mat3) * store->capacity);
+	store->orientations = (Quat*)realloc(store->orientations, sizeof(Quat) * store->capacity);
+	store->rotationsOutOfDate = (unsigned char*)realloc(store->rotationsOutOfDate, sizeof(unsigned char) * store->capacity);
+	store->velocities = (Vec3*)realloc(store->velocities, sizeof(Vec3) * store->capacity);
+	store->angularVelocities = (Vec3*)realloc(store->angularVelocities, sizeof(Vec3) * store->capacity);
+	store->accelerations = (Vec3*)realloc(store->accelerations, sizeof(Vec3) * store->capacity);
+	store->angularAccelerations = (Vec3*)realloc(store->angularAccelerations, sizeof(Vec3) * store->capacity);
+	store->netForces = (Vec3*)realloc(store->netForces, sizeof(Vec3) * store->capacity);
+	store->netImpulses = (Vec3*)realloc(store->netImpulses, sizeof(Vec3) * store->capacity);
+	store->netTorques = (Vec3*)realloc(store->netTorques, sizeof(Vec3) * store->capacity);
+	store->netInstantaneousTorques = (Vec3*)realloc(store->netInstantaneousTorques, sizeof(Vec3) * store->capacity);
+	store->inverseInertias = (Mat3*)realloc(store->inverseInertias, sizeof(Mat3) * store->capacity);
+	store->heldForces = (Vec3*)realloc(store->heldForces, sizeof(Vec3) * store->capacity);
+	store->heldTorques = (Vec3*)realloc(store->heldTorques, sizeof(Vec3) * store->capacity);
+
+	//Every array may have moved
+	for(unsigned int i = 0; i < store->size; i++)
+	{
+		RigidBodyStore_BindSlot(store, i);
+	}
+}
+
+///
+//Binds the Vector, Matrix and orientation handles of the body owning a slot to the slot
+//
+//Parameters:
+//	store: A pointer to the store containing the slot
+//	index: The index of the slot to bind
+static void RigidBodyStore_BindSlot(RigidBodyStore* store, unsigned int index)
+{
+	RigidBody* body = store->bodies[index];
+	body->storeIndex = index;
+
+	body->frame->position->components = store->positions[index].components;
+	body->frame->rotation->components = store->rotations[index].components;
+	body->frame->orientation = store->orientations + index;
+	body->frame->rotationOutOfDate = store->rotationsOutOfDate + index;
+	body->velocity->components = store->velocities[index].components;
+	body->angularVelocity->components = store->angularVelocities[index].components;
+	body->acceleration->components = store->accelerations[index].components;
+	body->angularAcceleration->components = store->angularAccelerations[index].components;
+	body->netForce->components = store->netForces[index].components;
+	body->netImpulse->components = store->netImpulses[index].components;
+	body->netTorque->components = store->netTorques[index].components;
+	body->netInstantaneousTorque->components = store->netInstantaneousTorques[index].components;
+	body->inverseInertia->components = store->inverseInertias[index].components;
+}
@@ -0,0 +1,112 @@
+#ifndef RIGIDBODYSTORE_H
+#define RIGIDBODYSTORE_H
+
+#include "Vec3.h"
+#include "Mat3.h"
+#include "Quat.h"
+
+//Forward declaration of RigidBody to avoid circular dependency
+struct RigidBody;
+
+//Contiguous storage for the state of rigid bodies which is read and written while integrating them.
+//Each member is an array with one element per body, so integrating every body streams through a few arrays instead of chasing pointers.
+//A body's Vector, Matrix and orientation handles view it's slot in these arrays, and are rebound whenever the store grows or a slot moves.
+typedef struct RigidBodyStore
+{
+	unsigned int size;					//Number of slots in use, slots 0 to size - 1 are always in use
+	unsigned int capacity;				//Number of slots allocated
+
+	struct RigidBody** bodies;			//The body owning each slot
+	unsigned char* active;				//1 if the slot's body is integrated this step, set by the physics manager
+	float* inverseMasses;				//Inverse mass of each body, copied from the body by the physics manager each step
+
+	Vec3* positions;					//Position of each body's frame
+	Mat3* rotations;					//Rotation matrix of each body's frame, built from it's orientation when it is read
+	Quat* orientations;					//Orientation of each body's frame, integrated in place of the rotation matrix
+	unsigned char* rotationsOutOfDate;	//1 if the slot's orientation changed since it's rotation matrix was built
+	Vec3* velocities;
+	Vec3* angularVelocities;
+	Vec3* accelerations;
+	Vec3* angularAccelerations;
+	Vec3* netForces;
+	Vec3* netImpulses;
+	Vec3* netTorques;
+	Vec3* netInstantaneousTorques;
+	Mat3* inverseInertias;
+	Vec3* heldForces;					//Forces applied to each body since the frame began, applied again by every fixed step of the frame
+	Vec3* heldTorques;					//Torques applied to each body since the frame began, applied again by every fixed step of the frame
+} RigidBodyStore;
+
+//Internal members
+static const unsigned int RigidBodyStore_defaultCapacity = 64;	//Number of slots a store starts with
+
+//Internal functions
+
+///
+//Doubles the number of slots in a rigid body store, rebinding the handles of every body
+//
+//Parameters:
+//	store: A pointer to the store to grow
+static void RigidBodyStore_Grow(RigidBodyStore* store);
+
+///
+//Binds the Vector, Matrix and orientation handles of the body owning a slot to the slot
+//
+//Parameters:
+//	store: A pointer to the store containing the slot
+//	index: The index of the slot to bind
+static void RigidBodyStore_BindSlot(RigidBodyStore* store, unsigned int index);
+
+//Functions
+
+///
+//Allocates memory for a rigid body store
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized rigid body store
+RigidBodyStore* RigidBodyStore_Allocate(void);
+
+///
+//Initializes a rigid body store with no bodies
+//
+//Parameters:
+//	store: A pointer to the store to initialize
+//	capacity: The initial number of slots, at least 1
+void RigidBodyStore_Initialize(RigidBodyStore* store, unsigned int capacity);
+
+///
+//Frees the data allocated by a rigid body store.
+//Does not free any of the bodies in the store!
+//
+//Parameters:
+//	store: A pointer to the store to free
+void RigidBodyStore_Free(RigidBodyStore* store);
+
+///
+//Adds a body to a rigid body store, binding it's handles to a new slot.
+//The slot's vectors start at 0 and it's matrices start as identity.
+//
+//Parameters:
+//	store: A pointer to the store to add the body to
+//	body: A pointer to the body to add
+void RigidBodyStore_Add(RigidBodyStore* store, struct RigidBody* body);
+
+///
+//Removes a body from a rigid body store.
+//The last slot is moved into the body's slot, so the handles of the body owning it are rebound.
+//
+//Parameters:
+//	store: A pointer to the store to remove the body from
+//	body: A pointer to the body to remove
+void RigidBodyStore_Remove(RigidBodyStore* store, struct RigidBody* body);
+
+///
+//Puts the slot of a body in a rigid body store back in the state it was added in,
+//Zeroing it's vectors and setting it's matrices to identity.
+//
+//Parameters:
+//	store: A pointer to the store containing the slot
+//	index: The index of the slot to clear
+void RigidBodyStore_ClearSlot(RigidBodyStore* store, unsigned int index);
+
+#endif
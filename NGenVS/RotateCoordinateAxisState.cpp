@@ -65,8 +65,14 @@ void State_RotateCoordinateAxis_Update(GObject* GO, State* state)
 	Vector axis;
 	Vector_INIT_ON_STACK(axis, 3);
 
+	//Copy the coordinate system so the frame's orientation can be set from it once it is changed
+	Matrix coordinateSystem;
+	Matrix_INIT_ON_STACK(coordinateSystem, 3, 3);
+	FrameOfReference_UpdateRotation(GO->frameOfReference);
+	Matrix_Copy(&coordinateSystem, GO->frameOfReference->rotation);
+
 	//Slice coordinate system taking the axis being rotated
-	Matrix_SliceRow(&axis, GO->frameOfReference->rotation, members->axis, 0, 3);
+	Matrix_SliceRow(&axis, &coordinateSystem, members->axis, 0, 3);
 
 	if(axis.components[members->axis] <= 0) members->angularVelocity *= -1.0f;
 
@@ -80,8 +86,9 @@ void State_RotateCoordinateAxis_Update(GObject* GO, State* state)
 	Matrix_TransformVector(&rotation, &axis);
 
 	//Replace the entries in the gameobject's coordinate system with the new axis
-	*Matrix_Index(GO->frameOfReference->rotation, members->axis, 0) = axis.components[0];
-	*Matrix_Index(GO->frameOfReference->rotation, members->axis, 1) = axis.components[1];
-	*Matrix_Index(GO->frameOfReference->rotation, members->axis, 2) = axis.components[2];
+	*Matrix_Index(&coordinateSystem, members->axis, 0) = axis.components[0];
+	*Matrix_Index(&coordinateSystem, members->axis, 1) = axis.components[1];
+	*Matrix_Index(&coordinateSystem, members->axis, 2) = axis.components[2];
+	FrameOfReference_SetRotation(GO->frameOfReference, &coordinateSystem);
 
 }
\ No newline at end of file
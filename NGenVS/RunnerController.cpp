@@ -78,11 +78,11 @@ static unsigned char State_RunnerController_IsOnGround(GObject* obj, State* stat
 	unsigned char onGround = 0;
 
 	//Loop through all current collisions
-	LinkedList_Node* current = obj->collider->currentCollisions->head;
+	Collision** currentCollisions = (Collision**)obj->collider->currentCollisions->data;
 	Collision* currentCollision = NULL;
-	while(current != NULL)
+	for(unsigned int i = 0; i < obj->collider->currentCollisions->size; i++)
 	{
-		currentCollision = (Collision*)current->data;
+		currentCollision = currentCollisions[i];
 		//Determine if this obj is obj1 or obj2
 		if(obj == currentCollision->obj1)
 		{
@@ -102,8 +102,6 @@ static unsigned char State_RunnerController_IsOnGround(GObject* obj, State* stat
 				break;
 			}
 		}
-
-		current = current->next;
 	}
 
 	return onGround;
@@ -333,7 +331,7 @@ void State_RunnerController_Wallrun(GObject* obj, State* state)
 
 
 	//Get the first collision this object is involved in
-	Collision* first = (Collision*)obj->collider->currentCollisions->head->data;
+	Collision* first = *(Collision**)DynamicArray_Index(obj->collider->currentCollisions, 0);
 
 	//If we are not wallrunning yet
 	if(members->horizontalRunning == 0 && members->verticalRunning == 0)
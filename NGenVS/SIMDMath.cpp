@@ -0,0 +1,649 @@
+#include "SIMDMath.h"
+
+#include <math.h>
+
+#ifdef SIMDMATH_SSE
+///
+//Loads 3 floats into the low lanes of an SSE register without reading past the third float
+//
+//Parameters:
+//	src: The floats to load
+//
+//Returns:
+//	An SSE register containing {src[0], src[1], src[2], 0}
+static __m128 SIMDMath_Load3(const float* src)
+{
+	__m128 xy = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)src);
+	__m128 z = _mm_load_ss(src + 2);
+	return _mm_movelh_ps(xy, z);
+}
+
+///
+//Stores the low 3 lanes of an SSE register without writing past the third float
+//
+//Parameters:
+//	dest: The destination of the 3 floats
+//	value: The register to store
+static void SIMDMath_Store3(float* dest, const __m128 value)
+{
+	_mm_storel_pi((__m64*)dest, value);
+	_mm_store_ss(dest + 2, _mm_movehl_ps(value, value));
+}
+
+///
+//Builds a lane mask from 4 flags
+//
+//Parameters:
+//	flags: The 4 flags, each 0 or not
+//
+//Returns:
+//	An SSE register with every bit of a lane set where the flag is not 0, and clear where it is 0
+static __m128 SIMDMath_LoadMask4(const unsigned char* flags)
+{
+	return _mm_cmpneq_ps(_mm_set_ps(flags[3], flags[2], flags[1], flags[0]), _mm_setzero_ps());
+}
+
+///
+//Picks each lane of one of two registers by a mask, without branching
+//
+//Parameters:
+//	mask: The lane mask, see SIMDMath_LoadMask4
+//	ifSet: The lanes to pick where the mask is set
+//	ifClear: The lanes to pick where the mask is clear
+//
+//Returns:
+//	An SSE register holding the picked lanes
+static __m128 SIMDMath_Select(const __m128 mask, const __m128 ifSet, const __m128 ifClear)
+{
+	return _mm_or_ps(_mm_and_ps(mask, ifSet), _mm_andnot_ps(mask, ifClear));
+}
+
+///
+//Loads 4 consecutive 3 dimensional vectors with the x, y and z components of each in their own register
+//
+//Parameters:
+//	dest: Array of 3 registers to store the x, y and z components in, lane n holds the nth vector
+//	src: The 12 floats of the vectors
+static void SIMDMath_LoadVec3x4(__m128* dest, const float* src)
+{
+	//{x0, y0, z0, x1}, {y1, z1, x2, y2}, {z2, x3, y3, z3}
+	__m128 a = _mm_loadu_ps(src);
+	__m128 b = _mm_loadu_ps(src + 4);
+	__m128 c = _mm_loadu_ps(src + 8);
+
+	dest[0] = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+	dest[1] = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	dest[2] = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+///
+//Stores 4 consecutive 3 dimensional vectors from registers of their x, y and z components
+//
+//Parameters:
+//	dest: The destination of the 12 floats of the vectors
+//	src: Array of 3 registers holding the x, y and z components, lane n holds the nth vector
+static void SIMDMath_StoreVec3x4(float* dest, const __m128* src)
+{
+	__m128 x = src[0];
+	__m128 y = src[1];
+	__m128 z = src[2];
+
+	_mm_storeu_ps(dest, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(dest + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(dest + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+#endif
+
+///
+//Determines if the kernels in this file were compiled with SSE
+//
+//Returns:
+//	1 if the SSE kernels are in use, 0 if the scalar fallbacks are in use
+unsigned char SIMDMath_IsAccelerated(void)
+{
+#ifdef SIMDMATH_SSE
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+///
+//Gets the dot product of two 3 dimensional vectors
+//
+//Parameters:
+//	vec1: The first 3 components being dotted
+//	vec2: The other 3 components being dotted
+//
+//Returns:
+//	Float representing value of the dot product
+float SIMDMath_DotProduct3(const float* vec1, const float* vec2)
+{
+#ifdef SIMDMATH_SSE
+	__m128 products = _mm_mul_ps(SIMDMath_Load3(vec1), SIMDMath_Load3(vec2));
+	//Sum the lanes in order so the result matches the scalar loop
+	__m128 dotProd = _mm_add_ss(_mm_setzero_ps(), products);
+	dotProd = _mm_add_ss(dotProd, _mm_shuffle_ps(products, products, _MM_SHUFFLE(1, 1, 1, 1)));
+	dotProd = _mm_add_ss(dotProd, _mm_shuffle_ps(products, products, _MM_SHUFFLE(2, 2, 2, 2)));
+	return _mm_cvtss_f32(dotProd);
+#else
+	float dotProd = 0.0f;
+	for(int i = 0; i < 3; i++)
+	{
+		float product = vec1[i] * vec2[i];
+		dotProd += product;
+	}
+	return dotProd;
+#endif
+}
+
+///
+//Gets the dot product of two 4 dimensional vectors
+//
+//Parameters:
+//	vec1: The first 4 components being dotted
+//	vec2: The other 4 components being dotted
+//
+//Returns:
+//	Float representing value of the dot product
+float SIMDMath_DotProduct4(const float* vec1, const float* vec2)
+{
+#ifdef SIMDMATH_SSE
+	__m128 products = _mm_mul_ps(_mm_loadu_ps(vec1), _mm_loadu_ps(vec2));
+	//Sum the lanes in order so the result matches the scalar loop
+	__m128 dotProd = _mm_add_ss(_mm_setzero_ps(), products);
+	dotProd = _mm_add_ss(dotProd, _mm_shuffle_ps(products, products, _MM_SHUFFLE(1, 1, 1, 1)));
+	dotProd = _mm_add_ss(dotProd, _mm_shuffle_ps(products, products, _MM_SHUFFLE(2, 2, 2, 2)));
+	dotProd = _mm_add_ss(dotProd, _mm_shuffle_ps(products, products, _MM_SHUFFLE(3, 3, 3, 3)));
+	return _mm_cvtss_f32(dotProd);
+#else
+	float dotProd = 0.0f;
+	for(int i = 0; i < 4; i++)
+	{
+		float product = vec1[i] * vec2[i];
+		dotProd += product;
+	}
+	return dotProd;
+#endif
+}
+
+///
+//Adds together two 3 dimensional vectors retrieving the sum
+//
+//Parameters:
+//	dest: The destination of the sum (may alias either addend)
+//	vec1: The first addend
+//	vec2: The second addend
+void SIMDMath_Add3(float* dest, const float* vec1, const float* vec2)
+{
+#ifdef SIMDMATH_SSE
+	SIMDMath_Store3(dest, _mm_add_ps(SIMDMath_Load3(vec1), SIMDMath_Load3(vec2)));
+#else
+	for(int i = 0; i < 3; i++)
+	{
+		dest[i] = vec1[i] + vec2[i];
+	}
+#endif
+}
+
+///
+//Adds together two 4 dimensional vectors retrieving the sum
+//
+//Parameters:
+//	dest: The destination of the sum (may alias either addend)
+//	vec1: The first addend
+//	vec2: The second addend
+void SIMDMath_Add4(float* dest, const float* vec1, const float* vec2)
+{
+#ifdef SIMDMATH_SSE
+	_mm_storeu_ps(dest, _mm_add_ps(_mm_loadu_ps(vec1), _mm_loadu_ps(vec2)));
+#else
+	for(int i = 0; i < 4; i++)
+	{
+		dest[i] = vec1[i] + vec2[i];
+	}
+#endif
+}
+
+///
+//Gets the product of two 3x3 matrices
+//
+//Parameters:
+//	dest: The destination of the product (may alias RHSMatrix but not LHSMatrix)
+//	LHSMatrix: The left hand side matrix
+//	RHSMatrix: The right hand side matrix
+void SIMDMath_GetProductMatrix3(float* dest, const float* LHSMatrix, const float* RHSMatrix)
+{
+#ifdef SIMDMATH_SSE
+	__m128 RHSRow0 = SIMDMath_Load3(RHSMatrix);
+	__m128 RHSRow1 = SIMDMath_Load3(RHSMatrix + 3);
+	__m128 RHSRow2 = SIMDMath_Load3(RHSMatrix + 6);
+
+	//Each lane of a destination row accumulates one column's dot product
+	for(int row = 0; row < 3; row++)
+	{
+		const float* LHSRow = LHSMatrix + row * 3;
+		__m128 destRow = _mm_setzero_ps();
+		destRow = _mm_add_ps(destRow, _mm_mul_ps(_mm_set1_ps(LHSRow[0]), RHSRow0));
+		destRow = _mm_add_ps(destRow, _mm_mul_ps(_mm_set1_ps(LHSRow[1]), RHSRow1));
+		destRow = _mm_add_ps(destRow, _mm_mul_ps(_mm_set1_ps(LHSRow[2]), RHSRow2));
+		SIMDMath_Store3(dest + row * 3, destRow);
+	}
+#else
+	float product[9];
+	for(int row = 0; row < 3; row++)
+	{
+		for(int col = 0; col < 3; col++)
+		{
+			float sum = 0.0f;
+			for(int dot = 0; dot < 3; dot++)
+			{
+				float increment = LHSMatrix[row * 3 + dot] * RHSMatrix[dot * 3 + col];
+				sum += increment;
+			}
+			product[row * 3 + col] = sum;
+		}
+	}
+	for(int i = 0; i < 9; i++)
+	{
+		dest[i] = product[i];
+	}
+#endif
+}
+
+///
+//Gets the product of two 4x4 matrices
+//
+//Parameters:
+//	dest: The destination of the product (may alias RHSMatrix but not LHSMatrix)
+//	LHSMatrix: The left hand side matrix
+//	RHSMatrix: The right hand side matrix
+void SIMDMath_GetProductMatrix4(float* dest, const float* LHSMatrix, const float* RHSMatrix)
+{
+#ifdef SIMDMATH_SSE
+	__m128 RHSRow0 = _mm_loadu_ps(RHSMatrix);
+	__m128 RHSRow1 = _mm_loadu_ps(RHSMatrix + 4);
+	__m128 RHSRow2 = _mm_loadu_ps(RHSMatrix + 8);
+	__m128 RHSRow3 = _mm_loadu_ps(RHSMatrix + 12);
+
+	//Each lane of a destination row accumulates one column's dot product
+	for(int row = 0; row < 4; row++)
+	{
+		const float* LHSRow = LHSMatrix + row * 4;
+		__m128 destRow = _mm_setzero_ps();
+		destRow = _mm_add_ps(destRow, _mm_mul_ps(_mm_set1_ps(LHSRow[0]), RHSRow0));
+		destRow = _mm_add_ps(destRow, _mm_mul_ps(_mm_set1_ps(LHSRow[1]), RHSRow1));
+		destRow = _mm_add_ps(destRow, _mm_mul_ps(_mm_set1_ps(LHSRow[2]), RHSRow2));
+		destRow = _mm_add_ps(destRow, _mm_mul_ps(_mm_set1_ps(LHSRow[3]), RHSRow3));
+		_mm_storeu_ps(dest + row * 4, destRow);
+	}
+#else
+	float product[16];
+	for(int row = 0; row < 4; row++)
+	{
+		for(int col = 0; col < 4; col++)
+		{
+			float sum = 0.0f;
+			for(int dot = 0; dot < 4; dot++)
+			{
+				float increment = LHSMatrix[row * 4 + dot] * RHSMatrix[dot * 4 + col];
+				sum += increment;
+			}
+			product[row * 4 + col] = sum;
+		}
+	}
+	for(int i = 0; i < 16; i++)
+	{
+		dest[i] = product[i];
+	}
+#endif
+}
+
+///
+//Multiplies a 3x3 matrix onto a 3 dimensional vector, transforming the vector
+//
+//Parameters:
+//	LHSMatrix: The matrix
+//	RHSVector: The vector being transformed
+void SIMDMath_TransformVector3(const float* LHSMatrix, float* RHSVector)
+{
+#ifdef SIMDMATH_SSE
+	//Transpose the matrix so each lane of the result accumulates one row's dot product
+	__m128 col0 = SIMDMath_Load3(LHSMatrix);
+	__m128 col1 = SIMDMath_Load3(LHSMatrix + 3);
+	__m128 col2 = SIMDMath_Load3(LHSMatrix + 6);
+	__m128 col3 = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+
+	__m128 result = _mm_setzero_ps();
+	result = _mm_add_ps(result, _mm_mul_ps(col0, _mm_set1_ps(RHSVector[0])));
+	result = _mm_add_ps(result, _mm_mul_ps(col1, _mm_set1_ps(RHSVector[1])));
+	result = _mm_add_ps(result, _mm_mul_ps(col2, _mm_set1_ps(RHSVector[2])));
+	SIMDMath_Store3(RHSVector, result);
+#else
+	float RHSCopy[3] = { RHSVector[0], RHSVector[1], RHSVector[2] };
+	for(int row = 0; row < 3; row++)
+	{
+		float sum = 0.0f;
+		for(int col = 0; col < 3; col++)
+		{
+			float increment = LHSMatrix[row * 3 + col] * RHSCopy[col];
+			sum += increment;
+		}
+		RHSVector[row] = sum;
+	}
+#endif
+}
+
+///
+//Multiplies a 4x4 matrix onto a 4 dimensional vector, transforming the vector
+//
+//Parameters:
+//	LHSMatrix: The matrix
+//	RHSVector: The vector being transformed
+void SIMDMath_TransformVector4(const float* LHSMatrix, float* RHSVector)
+{
+#ifdef SIMDMATH_SSE
+	//Transpose the matrix so each lane of the result accumulates one row's dot product
+	__m128 col0 = _mm_loadu_ps(LHSMatrix);
+	__m128 col1 = _mm_loadu_ps(LHSMatrix + 4);
+	__m128 col2 = _mm_loadu_ps(LHSMatrix + 8);
+	__m128 col3 = _mm_loadu_ps(LHSMatrix + 12);
+	_MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+
+	__m128 result = _mm_setzero_ps();
+	result = _mm_add_ps(result, _mm_mul_ps(col0, _mm_set1_ps(RHSVector[0])));
+	result = _mm_add_ps(result, _mm_mul_ps(col1, _mm_set1_ps(RHSVector[1])));
+	result = _mm_add_ps(result, _mm_mul_ps(col2, _mm_set1_ps(RHSVector[2])));
+	result = _mm_add_ps(result, _mm_mul_ps(col3, _mm_set1_ps(RHSVector[3])));
+	_mm_storeu_ps(RHSVector, result);
+#else
+	float RHSCopy[4] = { RHSVector[0], RHSVector[1], RHSVector[2], RHSVector[3] };
+	for(int row = 0; row < 4; row++)
+	{
+		float sum = 0.0f;
+		for(int col = 0; col < 4; col++)
+		{
+			float increment = LHSMatrix[row * 4 + col] * RHSCopy[col];
+			sum += increment;
+		}
+		RHSVector[row] = sum;
+	}
+#endif
+}
+
+///
+//Integrates the linear motion of a run of rigid bodies, whose state is kept in arrays of 3 floats per body.
+//Each body's acceleration is it's net force times it's inverse mass, and it's net impulse is scaled by it's inverse mass.
+//Then it's position is advanced by it's velocity and half of it's acceleration over the time step,
+//And it's velocity by it's acceleration over the time step and it's scaled impulse.
+//Bodies whose active flag is 0 are left as they are.
+//The SSE kernel integrates 4 bodies at a time, the active flags are applied by masking rather than branching.
+//
+//Parameters:
+//	positions: The position of each body
+//	velocities: The velocity of each body
+//	accelerations: The destination of the acceleration of each body
+//	netImpulses: The net impulse of each body, scaled by the body's inverse mass
+//	netForces: The net force of each body
+//	inverseMasses: The inverse mass of each body, 1 float per body
+//	active: 1 if the body is integrated, 0 if it is left as it is, 1 flag per body
+//	numBodies: The number of bodies to integrate
+//	dt: The time step
+void SIMDMath_IntegrateLinear(float* positions, float* velocities, float* accelerations, float* netImpulses, const float* netForces, const float* inverseMasses, const unsigned char* active, unsigned int numBodies, float dt)
+{
+	unsigned int i = 0;
+#ifdef SIMDMATH_SSE
+	__m128 dts = _mm_set1_ps(dt);
+	__m128 halves = _mm_set1_ps(0.5f);
+	for(; i + 4 <= numBodies; i += 4)
+	{
+		//The 12 components of the 4 bodies fill 3 registers, {0, 0, 0, 1}, {1, 1, 2, 2} and {2, 3, 3, 3} by body,
+		//So each body's inverse mass and mask are spread across the lanes of it's components
+		__m128 masses = _mm_loadu_ps(inverseMasses + i);
+		__m128 mask = SIMDMath_LoadMask4(active + i);
+		__m128 laneMasses[3] =
+		{
+			_mm_shuffle_ps(masses, masses, _MM_SHUFFLE(1, 0, 0, 0)),
+			_mm_shuffle_ps(masses, masses, _MM_SHUFFLE(2, 2, 1, 1)),
+			_mm_shuffle_ps(masses, masses, _MM_SHUFFLE(3, 3, 3, 2))
+		};
+		__m128 laneMasks[3] =
+		{
+			_mm_shuffle_ps(mask, mask, _MM_SHUFFLE(1, 0, 0, 0)),
+			_mm_shuffle_ps(mask, mask, _MM_SHUFFLE(2, 2, 1, 1)),
+			_mm_shuffle_ps(mask, mask, _MM_SHUFFLE(3, 3, 3, 2))
+		};
+
+		for(int k = 0; k < 3; k++)
+		{
+			unsigned int j = i * 3 + k * 4;
+
+			__m128 oldAcceleration = _mm_loadu_ps(accelerations + j);
+			__m128 oldImpulse = _mm_loadu_ps(netImpulses + j);
+			__m128 oldVelocity = _mm_loadu_ps(velocities + j);
+			__m128 oldPosition = _mm_loadu_ps(positions + j);
+
+			//Same operations in the same order as the scalar loop below
+			__m128 acceleration = _mm_mul_ps(_mm_loadu_ps(netForces + j), laneMasses[k]);
+			__m128 impulse = _mm_mul_ps(oldImpulse, laneMasses[k]);
+			__m128 VT = _mm_mul_ps(oldVelocity, dts);
+			__m128 AT = _mm_mul_ps(acceleration, dts);
+			__m128 position = _mm_add_ps(oldPosition, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(AT, dts), halves), VT));
+			__m128 velocity = _mm_add_ps(_mm_add_ps(oldVelocity, AT), impulse);
+
+			_mm_storeu_ps(accelerations + j, SIMDMath_Select(laneMasks[k], acceleration, oldAcceleration));
+			_mm_storeu_ps(netImpulses + j, SIMDMath_Select(laneMasks[k], impulse, oldImpulse));
+			_mm_storeu_ps(positions + j, SIMDMath_Select(laneMasks[k], position, oldPosition));
+			_mm_storeu_ps(velocities + j, SIMDMath_Select(laneMasks[k], velocity, oldVelocity));
+		}
+	}
+#endif
+
+	//The bodies left over, or every body without SSE
+	for(; i < numBodies; i++)
+	{
+		if(!active[i])
+		{
+			continue;
+		}
+
+		float inverseMass = inverseMasses[i];
+		for(unsigned int j = i * 3; j < i * 3 + 3; j++)
+		{
+			accelerations[j] = netForces[j] * inverseMass;
+			netImpulses[j] *= inverseMass;
+
+			float VT = velocities[j] * dt;
+			float AT = accelerations[j] * dt;
+
+			positions[j] += AT * dt * 0.5f + VT;
+			velocities[j] += AT;
+			velocities[j] += netImpulses[j];
+		}
+	}
+}
+
+///
+//Integrates the rotational motion of a run of rigid bodies, whose state is kept in arrays of 3 floats, 4 floats and 3x3 matrices per body.
+//Each body's angular acceleration is it's inverse inertia times it's net torque, and it's instantaneous torque is transformed by it's inverse inertia.
+//Then it's angular velocity is advanced by it's angular acceleration over the time step and it's transformed instantaneous torque,
+//And it's orientation is advanced by it's angular velocity over the time step and normalized, see Quat_Integrate.
+//Bodies whose active flag is 0 are left as they are, the rotations of the other bodies are marked out of date.
+//The SSE kernel integrates 4 bodies at a time, the active flags are applied by masking rather than branching.
+//
+//Parameters:
+//	orientations: The orientation of each body, a Quat
+//	rotationsOutOfDate: Set to 1 for each body which is integrated
+//	angularVelocities: The angular velocity of each body
+//	angularAccelerations: The destination of the angular acceleration of each body
+//	netInstantaneousTorques: The net instantaneous torque of each body, transformed by the body's inverse inertia
+//	netTorques: The net torque of each body
+//	inverseInertias: The inverse inertia of each body, a 3x3 matrix
+//	active: 1 if the body is integrated, 0 if it is left as it is, 1 flag per body
+//	numBodies: The number of bodies to integrate
+//	dt: The time step
+void SIMDMath_IntegrateAngular(float* orientations, unsigned char* rotationsOutOfDate, float* angularVelocities, float* angularAccelerations, float* netInstantaneousTorques, const float* netTorques, const float* inverseInertias, const unsigned char* active, unsigned int numBodies, float dt)
+{
+	float halfDT = 0.5f * dt;
+
+	unsigned int i = 0;
+#ifdef SIMDMATH_SSE
+	__m128 zeros = _mm_setzero_ps();
+	__m128 ones = _mm_set1_ps(1.0f);
+	__m128 dts = _mm_set1_ps(dt);
+	__m128 halfDTs = _mm_set1_ps(halfDT);
+	for(; i + 4 <= numBodies; i += 4)
+	{
+		//Each lane holds one of the 4 bodies, so the mask needs no spreading
+		__m128 mask = SIMDMath_LoadMask4(active + i);
+
+		//Gather each entry of the 4 inverse inertias into it's own register
+		const float* inertias = inverseInertias + i * 9;
+		__m128 inertia[9];
+		for(int k = 0; k < 9; k++)
+		{
+			inertia[k] = _mm_set_ps(inertias[27 + k], inertias[18 + k], inertias[9 + k], inertias[k]);
+		}
+
+		__m128 torque[3], oldAcceleration[3], oldInstantaneous[3], oldVelocity[3];
+		SIMDMath_LoadVec3x4(torque, netTorques + i * 3);
+		SIMDMath_LoadVec3x4(oldAcceleration, angularAccelerations + i * 3);
+		SIMDMath_LoadVec3x4(oldInstantaneous, netInstantaneousTorques + i * 3);
+		SIMDMath_LoadVec3x4(oldVelocity, angularVelocities + i * 3);
+
+		//Same operations in the same order as the scalar loop below
+		__m128 acceleration[3], instantaneous[3], velocity[3];
+		for(int row = 0; row < 3; row++)
+		{
+			acceleration[row] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(inertia[row * 3], torque[0]), _mm_mul_ps(inertia[row * 3 + 1], torque[1])), _mm_mul_ps(inertia[row * 3 + 2], torque[2]));
+
+			instantaneous[row] = _mm_add_ps(zeros, _mm_mul_ps(inertia[row * 3], oldInstantaneous[0]));
+			instantaneous[row] = _mm_add_ps(instantaneous[row], _mm_mul_ps(inertia[row * 3 + 1], oldInstantaneous[1]));
+			instantaneous[row] = _mm_add_ps(instantaneous[row], _mm_mul_ps(inertia[row * 3 + 2], oldInstantaneous[2]));
+		}
+		for(int k = 0; k < 3; k++)
+		{
+			velocity[k] = _mm_add_ps(_mm_add_ps(oldVelocity[k], _mm_mul_ps(acceleration[k], dts)), instantaneous[k]);
+		}
+
+		//Transpose the 4 orientations so each component has it's own register
+		float* quats = orientations + i * 4;
+		__m128 oldX = _mm_loadu_ps(quats);
+		__m128 oldY = _mm_loadu_ps(quats + 4);
+		__m128 oldZ = _mm_loadu_ps(quats + 8);
+		__m128 oldW = _mm_loadu_ps(quats + 12);
+		_MM_TRANSPOSE4_PS(oldX, oldY, oldZ, oldW);
+
+		//The derivative is (angularVelocity, 0) * orientation
+		__m128 wx = velocity[0], wy = velocity[1], wz = velocity[2];
+		__m128 dx = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(zeros, oldX), _mm_mul_ps(wx, oldW)), _mm_mul_ps(wy, oldZ)), _mm_mul_ps(wz, oldY));
+		__m128 dy = _mm_add_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(zeros, oldY), _mm_mul_ps(wx, oldZ)), _mm_mul_ps(wy, oldW)), _mm_mul_ps(wz, oldX));
+		__m128 dz = _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(zeros, oldZ), _mm_mul_ps(wx, oldY)), _mm_mul_ps(wy, oldX)), _mm_mul_ps(wz, oldW));
+		__m128 dw = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(zeros, oldW), _mm_mul_ps(wx, oldX)), _mm_mul_ps(wy, oldY)), _mm_mul_ps(wz, oldZ));
+
+		__m128 x = _mm_add_ps(oldX, _mm_mul_ps(dx, halfDTs));
+		__m128 y = _mm_add_ps(oldY, _mm_mul_ps(dy, halfDTs));
+		__m128 z = _mm_add_ps(oldZ, _mm_mul_ps(dz, halfDTs));
+		__m128 w = _mm_add_ps(oldW, _mm_mul_ps(dw, halfDTs));
+
+		//Normalize, an orientation of length 0 becomes the identity
+		__m128 magSq = _mm_add_ps(zeros, _mm_mul_ps(x, x));
+		magSq = _mm_add_ps(magSq, _mm_mul_ps(y, y));
+		magSq = _mm_add_ps(magSq, _mm_mul_ps(z, z));
+		magSq = _mm_add_ps(magSq, _mm_mul_ps(w, w));
+		__m128 degenerate = _mm_cmpeq_ps(magSq, zeros);
+		__m128 inverseMag = _mm_div_ps(ones, _mm_sqrt_ps(magSq));
+		x = SIMDMath_Select(degenerate, zeros, _mm_mul_ps(x, inverseMag));
+		y = SIMDMath_Select(degenerate, zeros, _mm_mul_ps(y, inverseMag));
+		z = SIMDMath_Select(degenerate, zeros, _mm_mul_ps(z, inverseMag));
+		w = SIMDMath_Select(degenerate, ones, _mm_mul_ps(w, inverseMag));
+
+		//Inactive bodies keep their state
+		for(int k = 0; k < 3; k++)
+		{
+			acceleration[k] = SIMDMath_Select(mask, acceleration[k], oldAcceleration[k]);
+			instantaneous[k] = SIMDMath_Select(mask, instantaneous[k], oldInstantaneous[k]);
+			velocity[k] = SIMDMath_Select(mask, velocity[k], oldVelocity[k]);
+		}
+		x = SIMDMath_Select(mask, x, oldX);
+		y = SIMDMath_Select(mask, y, oldY);
+		z = SIMDMath_Select(mask, z, oldZ);
+		w = SIMDMath_Select(mask, w, oldW);
+
+		SIMDMath_StoreVec3x4(angularAccelerations + i * 3, acceleration);
+		SIMDMath_StoreVec3x4(netInstantaneousTorques + i * 3, instantaneous);
+		SIMDMath_StoreVec3x4(angularVelocities + i * 3, velocity);
+
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		_mm_storeu_ps(quats, x);
+		_mm_storeu_ps(quats + 4, y);
+		_mm_storeu_ps(quats + 8, z);
+		_mm_storeu_ps(quats + 12, w);
+
+		for(int k = 0; k < 4; k++)
+		{
+			rotationsOutOfDate[i + k] |= active[i + k];
+		}
+	}
+#endif
+
+	//The bodies left over, or every body without SSE
+	for(; i < numBodies; i++)
+	{
+		if(!active[i])
+		{
+			continue;
+		}
+
+		const float* m = inverseInertias + i * 9;
+		const float* t = netTorques + i * 3;
+		float* acceleration = angularAccelerations + i * 3;
+		float* velocity = angularVelocities + i * 3;
+		float* instantaneous = netInstantaneousTorques + i * 3;
+
+		acceleration[0] = m[0] * t[0] + m[1] * t[1] + m[2] * t[2];
+		acceleration[1] = m[3] * t[0] + m[4] * t[1] + m[5] * t[2];
+		acceleration[2] = m[6] * t[0] + m[7] * t[1] + m[8] * t[2];
+		SIMDMath_TransformVector3(m, instantaneous);
+
+		for(int k = 0; k < 3; k++)
+		{
+			velocity[k] += acceleration[k] * dt;
+			velocity[k] += instantaneous[k];
+		}
+
+		//The derivative is (angularVelocity, 0) * orientation
+		float* q = orientations + i * 4;
+		float spinW = 0.0f;
+		float dx = spinW * q[0] + velocity[0] * q[3] + velocity[1] * q[2] - velocity[2] * q[1];
+		float dy = spinW * q[1] - velocity[0] * q[2] + velocity[1] * q[3] + velocity[2] * q[0];
+		float dz = spinW * q[2] + velocity[0] * q[1] - velocity[1] * q[0] + velocity[2] * q[3];
+		float dw = spinW * q[3] - velocity[0] * q[0] - velocity[1] * q[1] - velocity[2] * q[2];
+		q[0] += dx * halfDT;
+		q[1] += dy * halfDT;
+		q[2] += dz * halfDT;
+		q[3] += dw * halfDT;
+
+		float magSq = 0.0f;
+		for(int k = 0; k < 4; k++)
+		{
+			magSq += q[k] * q[k];
+		}
+		if(magSq == 0.0f)
+		{
+			q[0] = q[1] = q[2] = 0.0f;
+			q[3] = 1.0f;
+		}
+		else
+		{
+			float inverseMag = 1.0f / sqrtf(magSq);
+			for(int k = 0; k < 4; k++)
+			{
+				q[k] *= inverseMag;
+			}
+		}
+
+		rotationsOutOfDate[i] = 1;
+	}
+}
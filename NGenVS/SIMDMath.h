@@ -0,0 +1,199 @@
+#ifndef SIMDMATH_H
+#define SIMDMATH_H
+
+//SSE is used whenever the compiler is allowed to emit it.
+//Only SSE1 instructions are used so the /arch:SSE configurations qualify.
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1) || defined(__SSE__)
+#define SIMDMATH_SSE
+#include <xmmintrin.h>
+#endif
+
+//Every kernel in this file produces the same bits whether or not SSE is available.
+//Both paths round each product to a float before adding it to a running sum which starts at 0,
+//And the sums are accumulated in the same order as the general loops in Vector.cpp and Matrix.cpp.
+
+#ifdef SIMDMATH_SSE
+//Internals
+
+///
+//Loads 3 floats into the low lanes of an SSE register without reading past the third float
+//
+//Parameters:
+//	src: The floats to load
+//
+//Returns:
+//	An SSE register containing {src[0], src[1], src[2], 0}
+static __m128 SIMDMath_Load3(const float* src);
+
+///
+//Stores the low 3 lanes of an SSE register without writing past the third float
+//
+//Parameters:
+//	dest: The destination of the 3 floats
+//	value: The register to store
+static void SIMDMath_Store3(float* dest, const __m128 value);
+
+///
+//Builds a lane mask from 4 flags
+//
+//Parameters:
+//	flags: The 4 flags, each 0 or not
+//
+//Returns:
+//	An SSE register with every bit of a lane set where the flag is not 0, and clear where it is 0
+static __m128 SIMDMath_LoadMask4(const unsigned char* flags);
+
+///
+//Picks each lane of one of two registers by a mask, without branching
+//
+//Parameters:
+//	mask: The lane mask, see SIMDMath_LoadMask4
+//	ifSet: The lanes to pick where the mask is set
+//	ifClear: The lanes to pick where the mask is clear
+//
+//Returns:
+//	An SSE register holding the picked lanes
+static __m128 SIMDMath_Select(const __m128 mask, const __m128 ifSet, const __m128 ifClear);
+
+///
+//Loads 4 consecutive 3 dimensional vectors with the x, y and z components of each in their own register
+//
+//Parameters:
+//	dest: Array of 3 registers to store the x, y and z components in, lane n holds the nth vector
+//	src: The 12 floats of the vectors
+static void SIMDMath_LoadVec3x4(__m128* dest, const float* src);
+
+///
+//Stores 4 consecutive 3 dimensional vectors from registers of their x, y and z components
+//
+//Parameters:
+//	dest: The destination of the 12 floats of the vectors
+//	src: Array of 3 registers holding the x, y and z components, lane n holds the nth vector
+static void SIMDMath_StoreVec3x4(float* dest, const __m128* src);
+#endif
+
+//Functions
+
+///
+//Determines if the kernels in this file were compiled with SSE
+//
+//Returns:
+//	1 if the SSE kernels are in use, 0 if the scalar fallbacks are in use
+unsigned char SIMDMath_IsAccelerated(void);
+
+///
+//Gets the dot product of two 3 dimensional vectors
+//
+//Parameters:
+//	vec1: The first 3 components being dotted
+//	vec2: The other 3 components being dotted
+//
+//Returns:
+//	Float representing value of the dot product
+float SIMDMath_DotProduct3(const float* vec1, const float* vec2);
+
+///
+//Gets the dot product of two 4 dimensional vectors
+//
+//Parameters:
+//	vec1: The first 4 components being dotted
+//	vec2: The other 4 components being dotted
+//
+//Returns:
+//	Float representing value of the dot product
+float SIMDMath_DotProduct4(const float* vec1, const float* vec2);
+
+///
+//Adds together two 3 dimensional vectors retrieving the sum
+//
+//Parameters:
+//	dest: The destination of the sum (may alias either addend)
+//	vec1: The first addend
+//	vec2: The second addend
+void SIMDMath_Add3(float* dest, const float* vec1, const float* vec2);
+
+///
+//Adds together two 4 dimensional vectors retrieving the sum
+//
+//Parameters:
+//	dest: The destination of the sum (may alias either addend)
+//	vec1: The first addend
+//	vec2: The second addend
+void SIMDMath_Add4(float* dest, const float* vec1, const float* vec2);
+
+///
+//Gets the product of two 3x3 matrices
+//
+//Parameters:
+//	dest: The destination of the product (may alias RHSMatrix but not LHSMatrix)
+//	LHSMatrix: The left hand side matrix
+//	RHSMatrix: The right hand side matrix
+void SIMDMath_GetProductMatrix3(float* dest, const float* LHSMatrix, const float* RHSMatrix);
+
+///
+//Gets the product of two 4x4 matrices
+//
+//Parameters:
+//	dest: The destination of the product (may alias RHSMatrix but not LHSMatrix)
+//	LHSMatrix: The left hand side matrix
+//	RHSMatrix: The right hand side matrix
+void SIMDMath_GetProductMatrix4(float* dest, const float* LHSMatrix, const float* RHSMatrix);
+
+///
+//Multiplies a 3x3 matrix onto a 3 dimensional vector, transforming the vector
+//
+//Parameters:
+//	LHSMatrix: The matrix
+//	RHSVector: The vector being transformed
+void SIMDMath_TransformVector3(const float* LHSMatrix, float* RHSVector);
+
+///
+//Multiplies a 4x4 matrix onto a 4 dimensional vector, transforming the vector
+//
+//Parameters:
+//	LHSMatrix: The matrix
+//	RHSVector: The vector being transformed
+void SIMDMath_TransformVector4(const float* LHSMatrix, float* RHSVector);
+
+///
+//Integrates the linear motion of a run of rigid bodies, whose state is kept in arrays of 3 floats per body.
+//Each body's acceleration is it's net force times it's inverse mass, and it's net impulse is scaled by it's inverse mass.
+//Then it's position is advanced by it's velocity and half of it's acceleration over the time step,
+//And it's velocity by it's acceleration over the time step and it's scaled impulse.
+//Bodies whose active flag is 0 are left as they are.
+//The SSE kernel integrates 4 bodies at a time, the active flags are applied by masking rather than branching.
+//
+//Parameters:
+//	positions: The position of each body
+//	velocities: The velocity of each body
+//	accelerations: The destination of the acceleration of each body
+//	netImpulses: The net impulse of each body, scaled by the body's inverse mass
+//	netForces: The net force of each body
+//	inverseMasses: The inverse mass of each body, 1 float per body
+//	active: 1 if the body is integrated, 0 if it is left as it is, 1 flag per body
+//	numBodies: The number of bodies to integrate
+//	dt: The time step
+void SIMDMath_IntegrateLinear(float* positions, float* velocities, float* accelerations, float* netImpulses, const float* netForces, const float* inverseMasses, const unsigned char* active, unsigned int numBodies, float dt);
+
+///
+//Integrates the rotational motion of a run of rigid bodies, whose state is kept in arrays of 3 floats, 4 floats and 3x3 matrices per body.
+//Each body's angular acceleration is it's inverse inertia times it's net torque, and it's instantaneous torque is transformed by it's inverse inertia.
+//Then it's angular velocity is advanced by it's angular acceleration over the time step and it's transformed instantaneous torque,
+//And it's orientation is advanced by it's angular velocity over the time step and normalized, see Quat_Integrate.
+//Bodies whose active flag is 0 are left as they are, the rotations of the other bodies are marked out of date.
+//The SSE kernel integrates 4 bodies at a time, the active flags are applied by masking rather than branching.
+//
+//Parameters:
+//	orientations: The orientation of each body, a Quat
+//	rotationsOutOfDate: Set to 1 for each body which is integrated
+//	angularVelocities: The angular velocity of each body
+//	angularAccelerations: The destination of the angular acceleration of each body
+//	netInstantaneousTorques: The net instantaneous torque of each body, transformed by the body's inverse inertia
+//	netTorques: The net torque of each body
+//	inverseInertias: The inverse inertia of each body, a 3x3 matrix
+//	active: 1 if the body is integrated, 0 if it is left as it is, 1 flag per body
+//	numBodies: The number of bodies to integrate
+//	dt: The time step
+void SIMDMath_IntegrateAngular(float* orientations, unsigned char* rotationsOutOfDate, float* angularVelocities, float* angularAccelerations, float* netInstantaneousTorques, const float* netTorques, const float* inverseInertias, const unsigned char* active, unsigned int numBodies, float dt);
+
+#endif
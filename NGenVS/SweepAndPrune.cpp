@@ -0,0 +1,454 @@
+#include "SweepAndPrune.h"
+
+#include <stdlib.h>
+
+#include "Hash.h"
+
+///
+//Allocates memory for a sweep and prune
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized sweep and prune
+SweepAndPrune* SweepAndPrune_Allocate(void)
+{
+	SweepAndPrune* sap = (SweepAndPrune*)malloc(sizeof(SweepAndPrune));
+	return sap;
+}
+
+///
+//Initializes a sweep and prune with no objects
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to initialize
+void SweepAndPrune_Initialize(SweepAndPrune* sap)
+{
+	sap->proxies = DynamicArray_Allocate();
+	DynamicArray_Initialize(sap->proxies, sizeof(SweepAndPrune_Proxy));
+
+	sap->map = HashMap_Allocate();
+	HashMap_Initialize(sap->map, 16);
+	sap->map->Hash = Hash_Pointer;
+
+	sap->remap = DynamicArray_Allocate();
+	DynamicArray_Initialize(sap->remap, sizeof(unsigned int));
+	sap->numRemoved = 0;
+
+	for(int i = 0; i < 3; i++)
+	{
+		sap->endpoints[i] = DynamicArray_Allocate();
+		DynamicArray_Initialize(sap->endpoints[i], sizeof(SweepAndPrune_Endpoint));
+	}
+
+	sap->active = DynamicArray_Allocate();
+	DynamicArray_Initialize(sap->active, sizeof(unsigned int));
+
+	sap->pairs = DynamicArray_Allocate();
+	DynamicArray_Initialize(sap->pairs, sizeof(SweepAndPrune_Pair));
+
+	sap->sweepAxis = 0;
+	sap->numSwaps = 0;
+
+	sap->numSortedEndpoints = 0;
+	for(int i = 0; i < 3; i++)
+	{
+		sap->maxExtent[i] = 0.0f;
+	}
+}
+
+///
+//Frees the data allocated by a sweep and prune.
+//Does not free any of the objects contained within the sweep and prune!
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to free
+void SweepAndPrune_Free(SweepAndPrune* sap)
+{
+	DynamicArray_Free(sap->proxies);
+	HashMap_Free(sap->map);
+	DynamicArray_Free(sap->remap);
+	for(int i = 0; i < 3; i++)
+	{
+		DynamicArray_Free(sap->endpoints[i]);
+	}
+	DynamicArray_Free(sap->active);
+	DynamicArray_Free(sap->pairs);
+
+	free(sap);
+}
+
+///
+//Adds a game object to the sweep and prune
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to add a game object to
+//	obj: A pointer to the game object to add (Must have collider attached)
+void SweepAndPrune_Add(SweepAndPrune* sap, GObject* obj)
+{
+	SweepAndPrune_Proxy proxy;
+	proxy.obj = obj;
+	SweepAndPrune_UpdateProxy(&proxy);
+
+	unsigned int proxyIndex = sap->proxies->size;
+	DynamicArray_Append(sap->proxies, &proxy);
+	HashMap_Add(sap->map, &obj, (void*)(size_t)proxyIndex, sizeof(GObject*));
+
+	//The new endpoints go on the end of each axis, the next update sorts them into place
+	SweepAndPrune_Endpoint endpoint;
+	endpoint.proxyIndex = proxyIndex;
+	for(int i = 0; i < 3; i++)
+	{
+		if(proxy.max[i] - proxy.min[i] > sap->maxExtent[i])
+		{
+			sap->maxExtent[i] = proxy.max[i] - proxy.min[i];
+		}
+
+		endpoint.value = proxy.min[i];
+		endpoint.isMax = 0;
+		DynamicArray_Append(sap->endpoints[i], &endpoint);
+
+		endpoint.value = proxy.max[i];
+		endpoint.isMax = 1;
+		DynamicArray_Append(sap->endpoints[i], &endpoint);
+	}
+}
+
+///
+//Removes a game object from the sweep and prune
+//The object's proxy is found through the map and marked removed, so the endpoints stay in order,
+//And the next update compacts it and it's endpoints out.
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to remove the game object from
+//	obj: A pointer to the game object to remove
+void SweepAndPrune_Remove(SweepAndPrune* sap, GObject* obj)
+{
+	struct HashMap_KeyValuePair* pair = HashMap_LookUp(sap->map, &obj, sizeof(GObject*));
+	if(pair == NULL)
+	{
+		return;
+	}
+	unsigned int proxyIndex = (unsigned int)(size_t)pair->data;
+	HashMap_Remove(sap->map, &obj, sizeof(GObject*));
+
+	((SweepAndPrune_Proxy*)sap->proxies->data)[proxyIndex].obj = NULL;
+	sap->numRemoved++;
+}
+
+///
+//Updates the bounds of all game objects within the sweep and prune, re-sorts their endpoints on the sweep axis
+//And finds every pair of game objects whose bounds overlap.
+//The sweep is done along the axis which the objects are most spread out on.
+//The other axes are left as they are until the sweep moves to them, when they are sorted from the order they were last swept in.
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to update
+void SweepAndPrune_Update(SweepAndPrune* sap)
+{
+	if(sap->numRemoved > 0)
+	{
+		SweepAndPrune_Compact(sap);
+	}
+
+	SweepAndPrune_Proxy* proxies = (SweepAndPrune_Proxy*)sap->proxies->data;
+
+	//Update the bounds of every object, tracking how spread out their centers are on each axis
+	float sum[3] = { 0.0f, 0.0f, 0.0f };
+	float sumSq[3] = { 0.0f, 0.0f, 0.0f };
+	for(int i = 0; i < 3; i++)
+	{
+		sap->maxExtent[i] = 0.0f;
+	}
+	for(unsigned int i = 0; i < sap->proxies->size; i++)
+	{
+		//Sleeping objects have not moved, so their bounds are still correct
+		if(proxies[i].obj->body == NULL || proxies[i].obj->body->isAwake)
+		{
+			SweepAndPrune_UpdateProxy(proxies + i);
+		}
+
+		for(int j = 0; j < 3; j++)
+		{
+			float center = (proxies[i].min[j] + proxies[i].max[j]) / 2.0f;
+			sum[j] += center;
+			sumSq[j] += center * center;
+
+			if(proxies[i].max[j] - proxies[i].min[j] > sap->maxExtent[j])
+			{
+				sap->maxExtent[j] = proxies[i].max[j] - proxies[i].min[j];
+			}
+		}
+	}
+
+	//Sweep along the axis with the greatest variance, where the fewest bounds overlap
+	sap->sweepAxis = 0;
+	if(sap->proxies->size > 0)
+	{
+		float greatestVariance = -1.0f;
+		for(int i = 0; i < 3; i++)
+		{
+			float mean = sum[i] / sap->proxies->size;
+			float variance = sumSq[i] / sap->proxies->size - mean * mean;
+			if(variance > greatestVariance)
+			{
+				greatestVariance = variance;
+				sap->sweepAxis = i;
+			}
+		}
+	}
+
+	//Copy the new bounds into the endpoints of the sweep axis and restore their order, the sweep tests the other axes against the proxies
+	DynamicArray* endpointArray = sap->endpoints[sap->sweepAxis];
+	SweepAndPrune_Endpoint* endpoints = (SweepAndPrune_Endpoint*)endpointArray->data;
+	for(unsigned int i = 0; i < endpointArray->size; i++)
+	{
+		SweepAndPrune_Proxy* proxy = proxies + endpoints[i].proxyIndex;
+		endpoints[i].value = endpoints[i].isMax ? proxy->max[sap->sweepAxis] : proxy->min[sap->sweepAxis];
+	}
+	sap->numSwaps = SweepAndPrune_SortEndpoints(endpointArray);
+	sap->numSortedEndpoints = endpointArray->size;
+
+	SweepAndPrune_Sweep(sap, sap->sweepAxis);
+}
+
+///
+//Finds every game object in a sweep and prune whose bounds as of the last update overlap a box.
+//The endpoints on the last sweep axis are searched from the box's minimum less the largest bounds,
+//Before which no overlapping bounds can begin, so only the bounds near the box are tested.
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to query
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the overlapping game objects to
+void SweepAndPrune_QueryBox(SweepAndPrune* sap, const float* min, const float* max, DynamicArray* results)
+{
+	unsigned int axis = sap->sweepAxis;
+	SweepAndPrune_Endpoint* endpoints = (SweepAndPrune_Endpoint*)sap->endpoints[axis]->data;
+	unsigned int numEndpoints = sap->endpoints[axis]->size;
+
+	//Bounds overlapping the box end after it's minimum, so they begin no further before it than the largest bounds
+	float start = min[axis] - sap->maxExtent[axis];
+	unsigned int first = 0;
+	unsigned int high = sap->numSortedEndpoints;
+	while(first < high)
+	{
+		unsigned int middle = (first + high) / 2;
+		if(endpoints[middle].value < start) first = middle + 1;
+		else high = middle;
+	}
+
+	//And they begin before the box's maximum
+	unsigned int end = first;
+	high = sap->numSortedEndpoints;
+	while(end < high)
+	{
+		unsigned int middle = (end + high) / 2;
+		if(endpoints[middle].value <= max[axis]) end = middle + 1;
+		else high = middle;
+	}
+
+	SweepAndPrune_QueryEndpoints(sap, first, end, min, max, results);
+	//The endpoints of objects added since the last update are not sorted yet
+	SweepAndPrune_QueryEndpoints(sap, sap->numSortedEndpoints, numEndpoints, min, max, results);
+}
+
+///
+//Appends to a query's results the object of each minimum endpoint in a range of the endpoints on the last sweep axis
+//Whose bounds overlap the box being queried
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune being queried
+//	first: The index of the first endpoint of the range
+//	end: One past the index of the last endpoint of the range
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the overlapping game objects to
+static void SweepAndPrune_QueryEndpoints(SweepAndPrune* sap, unsigned int first, unsigned int end, const float* min, const float* max, DynamicArray* results)
+{
+	SweepAndPrune_Proxy* proxies = (SweepAndPrune_Proxy*)sap->proxies->data;
+	SweepAndPrune_Endpoint* endpoints = (SweepAndPrune_Endpoint*)sap->endpoints[sap->sweepAxis]->data;
+
+	for(unsigned int i = first; i < end; i++)
+	{
+		if(endpoints[i].isMax) continue;
+
+		//Objects removed since the last update are still in the endpoints
+		SweepAndPrune_Proxy* proxy = proxies + endpoints[i].proxyIndex;
+		if(proxy->obj == NULL) continue;
+
+		if(proxy->min[0] <= max[0] && proxy->max[0] >= min[0] &&
+			proxy->min[1] <= max[1] && proxy->max[1] >= min[1] &&
+			proxy->min[2] <= max[2] && proxy->max[2] >= min[2])
+		{
+			DynamicArray_Append(results, &proxy->obj);
+		}
+	}
+}
+
+///
+//Gets the world space bounds of an object's collider
+//
+//Parameters:
+//	proxy: The proxy to store the bounds of it's object in
+static void SweepAndPrune_UpdateProxy(SweepAndPrune_Proxy* proxy)
+{
+	GObject* obj = proxy->obj;
+
+	//If there is a rigidbody use that frame of reference, else use the objects
+	FrameOfReference* frame = obj->body != NULL ? obj->body->frame : obj->frameOfReference;
+
+	Collider_GetWorldBounds(proxy->min, proxy->max, obj->collider, frame);
+}
+
+///
+//Compacts the proxies removed since the last update out of the proxies and the endpoints on each axis,
+//Keeping the order of those which remain and updating the map with their new indices
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to compact
+static void SweepAndPrune_Compact(SweepAndPrune* sap)
+{
+	SweepAndPrune_Proxy* proxies = (SweepAndPrune_Proxy*)sap->proxies->data;
+	unsigned int numProxies = sap->proxies->size;
+
+	//A removed proxy maps to the number of proxies, which no proxy will have as an index
+	DynamicArray_Reserve(sap->remap, numProxies);
+	sap->remap->size = numProxies;
+	unsigned int* remap = (unsigned int*)sap->remap->data;
+
+	unsigned int numKept = 0;
+	for(unsigned int i = 0; i < numProxies; i++)
+	{
+		if(proxies[i].obj == NULL)
+		{
+			remap[i] = numProxies;
+			continue;
+		}
+
+		remap[i] = numKept;
+		if(numKept != i)
+		{
+			proxies[numKept] = proxies[i];
+			HashMap_LookUp(sap->map, &proxies[numKept].obj, sizeof(GObject*))->data = (void*)(size_t)numKept;
+		}
+		numKept++;
+	}
+	sap->proxies->size = numKept;
+
+	//A proxy's endpoints are either all sorted or all added since the last update, the same on every axis
+	unsigned int numSortedRemoved = 0;
+	for(int i = 0; i < 3; i++)
+	{
+		DynamicArray* endpointArray = sap->endpoints[i];
+		SweepAndPrune_Endpoint* endpoints = (SweepAndPrune_Endpoint*)endpointArray->data;
+
+		unsigned int kept = 0;
+		numSortedRemoved = 0;
+		for(unsigned int j = 0; j < endpointArray->size; j++)
+		{
+			unsigned int proxyIndex = remap[endpoints[j].proxyIndex];
+			if(proxyIndex == numProxies)
+			{
+				if(j < sap->numSortedEndpoints) numSortedRemoved++;
+				continue;
+			}
+			endpoints[kept] = endpoints[j];
+			endpoints[kept].proxyIndex = proxyIndex;
+			kept++;
+		}
+		endpointArray->size = kept;
+	}
+	sap->numSortedEndpoints -= numSortedRemoved;
+	sap->numRemoved = 0;
+}
+
+///
+//Sorts endpoints by value using insertion sort, which is close to linear when they were sorted last frame
+//When values are equal, minimum endpoints are sorted before maximum endpoints so touching bounds overlap.
+//
+//Parameters:
+//	endpointArray: The dynamic array of endpoints to sort
+//
+//Returns:
+//	The number of swaps made
+static unsigned long SweepAndPrune_SortEndpoints(DynamicArray* endpointArray)
+{
+	SweepAndPrune_Endpoint* endpoints = (SweepAndPrune_Endpoint*)endpointArray->data;
+	unsigned long numSwaps = 0;
+
+	for(unsigned int i = 1; i < endpointArray->size; i++)
+	{
+		SweepAndPrune_Endpoint key = endpoints[i];
+		unsigned int j = i;
+		while(j > 0 &&
+			(endpoints[j - 1].value > key.value ||
+			(endpoints[j - 1].value == key.value && endpoints[j - 1].isMax > key.isMax)))
+		{
+			endpoints[j] = endpoints[j - 1];
+			j--;
+			numSwaps++;
+		}
+		endpoints[j] = key;
+	}
+
+	return numSwaps;
+}
+
+///
+//Sweeps along the sorted endpoints of an axis, filling the pairs of a sweep and prune
+//With every pair of objects whose bounds overlap on all three axes
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to sweep
+//	axis: The axis to sweep along
+static void SweepAndPrune_Sweep(SweepAndPrune* sap, unsigned int axis)
+{
+	SweepAndPrune_Proxy* proxies = (SweepAndPrune_Proxy*)sap->proxies->data;
+	DynamicArray* endpointArray = sap->endpoints[axis];
+	SweepAndPrune_Endpoint* endpoints = (SweepAndPrune_Endpoint*)endpointArray->data;
+
+	//The other two axes must be checked for each pair the sweep finds
+	unsigned int otherAxis1 = (axis + 1) % 3;
+	unsigned int otherAxis2 = (axis + 2) % 3;
+
+	DynamicArray_Clear(sap->pairs);
+	sap->active->size = 0;
+
+	SweepAndPrune_Pair pair;
+	for(unsigned int i = 0; i < endpointArray->size; i++)
+	{
+		unsigned int proxyIndex = endpoints[i].proxyIndex;
+		unsigned int* active = (unsigned int*)sap->active->data;
+
+		if(endpoints[i].isMax)
+		{
+			//The proxy's bounds close, so it can't overlap any proxy which opens after this
+			for(unsigned int j = 0; j < sap->active->size; j++)
+			{
+				if(active[j] == proxyIndex)
+				{
+					active[j] = active[--sap->active->size];
+					break;
+				}
+			}
+		}
+		else
+		{
+			//The proxy's bounds open while every active proxy's bounds are open, so they overlap on this axis
+			SweepAndPrune_Proxy* proxy = proxies + proxyIndex;
+			for(unsigned int j = 0; j < sap->active->size; j++)
+			{
+				SweepAndPrune_Proxy* other = proxies + active[j];
+				if(proxy->min[otherAxis1] <= other->max[otherAxis1] && proxy->max[otherAxis1] >= other->min[otherAxis1] &&
+					proxy->min[otherAxis2] <= other->max[otherAxis2] && proxy->max[otherAxis2] >= other->min[otherAxis2])
+				{
+					pair.obj1 = other->obj;
+					pair.obj2 = proxy->obj;
+					DynamicArray_Append(sap->pairs, &pair);
+				}
+			}
+
+			DynamicArray_Append(sap->active, &proxyIndex);
+		}
+	}
+}
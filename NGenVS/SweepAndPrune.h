@@ -0,0 +1,162 @@
+#ifndef SWEEPANDPRUNE_H
+#define SWEEPANDPRUNE_H
+
+#include "GObject.h"		//The data the sweep and prune will contain
+#include "DynamicArray.h"
+#include "HashMap.h"
+
+//The world space bounds of an object's collider
+typedef struct SweepAndPrune_Proxy
+{
+	GObject* obj;		//The object being bounded, NULL once it is removed until the next update compacts the proxy out
+	float min[3];		//Minimum bound on each axis
+	float max[3];		//Maximum bound on each axis
+} SweepAndPrune_Proxy;
+
+//The start or end of a proxy's bounds along one axis
+typedef struct SweepAndPrune_Endpoint
+{
+	float value;				//Position of the endpoint along the axis
+	unsigned int proxyIndex;	//Index of the proxy this endpoint bounds
+	unsigned int isMax;			//1 if this is the proxy's maximum bound, 0 if it is the minimum bound
+} SweepAndPrune_Endpoint;
+
+//Two objects whose bounds overlap on every axis
+typedef struct SweepAndPrune_Pair
+{
+	GObject* obj1;
+	GObject* obj2;
+} SweepAndPrune_Pair;
+
+typedef struct SweepAndPrune
+{
+	DynamicArray* proxies;			//The bounds of every object, in the order they were added
+	HashMap* map;					//Maps each object to the index of it's proxy
+	DynamicArray* remap;			//Scratch storage for the index each proxy moves to when removed proxies are compacted out
+	unsigned int numRemoved;		//Number of proxies removed since the last update, left in place until it compacts them out
+	DynamicArray* endpoints[3];		//Both endpoints of every proxy on each axis, only the sweep axis is kept sorted between updates
+	DynamicArray* active;			//Indices of the proxies whose bounds are open at the current point of a sweep
+	DynamicArray* pairs;			//The pairs of objects with overlapping bounds found by the last update
+
+	unsigned int sweepAxis;			//The axis the last update swept along
+	unsigned long numSwaps;			//The number of swaps made by insertion sort during the last update
+
+	unsigned int numSortedEndpoints;	//Number of endpoints on the sweep axis sorted by the last update, the endpoints of objects added since follow them
+	float maxExtent[3];					//Size of the largest bounds on each axis, as of the last update or the objects added since
+} SweepAndPrune;
+
+//Internal functions
+
+///
+//Gets the world space bounds of an object's collider
+//
+//Parameters:
+//	proxy: The proxy to store the bounds of it's object in
+static void SweepAndPrune_UpdateProxy(SweepAndPrune_Proxy* proxy);
+
+///
+//Compacts the proxies removed since the last update out of the proxies and the endpoints on each axis,
+//Keeping the order of those which remain and updating the map with their new indices
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to compact
+static void SweepAndPrune_Compact(SweepAndPrune* sap);
+
+///
+//Sorts endpoints by value using insertion sort, which is close to linear when they were sorted last frame
+//When values are equal, minimum endpoints are sorted before maximum endpoints so touching bounds overlap.
+//
+//Parameters:
+//	endpointArray: The dynamic array of endpoints to sort
+//
+//Returns:
+//	The number of swaps made
+static unsigned long SweepAndPrune_SortEndpoints(DynamicArray* endpointArray);
+
+///
+//Sweeps along the sorted endpoints of an axis, filling the pairs of a sweep and prune
+//With every pair of objects whose bounds overlap on all three axes
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to sweep
+//	axis: The axis to sweep along
+static void SweepAndPrune_Sweep(SweepAndPrune* sap, unsigned int axis);
+
+///
+//Appends to a query's results the object of each minimum endpoint in a range of the endpoints on the last sweep axis
+//Whose bounds overlap the box being queried
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune being queried
+//	first: The index of the first endpoint of the range
+//	end: One past the index of the last endpoint of the range
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the overlapping game objects to
+static void SweepAndPrune_QueryEndpoints(SweepAndPrune* sap, unsigned int first, unsigned int end, const float* min, const float* max, DynamicArray* results);
+
+//Functions
+
+///
+//Allocates memory for a sweep and prune
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized sweep and prune
+SweepAndPrune* SweepAndPrune_Allocate(void);
+
+///
+//Initializes a sweep and prune with no objects
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to initialize
+void SweepAndPrune_Initialize(SweepAndPrune* sap);
+
+///
+//Frees the data allocated by a sweep and prune.
+//Does not free any of the objects contained within the sweep and prune!
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to free
+void SweepAndPrune_Free(SweepAndPrune* sap);
+
+///
+//Adds a game object to the sweep and prune
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to add a game object to
+//	obj: A pointer to the game object to add (Must have collider attached)
+void SweepAndPrune_Add(SweepAndPrune* sap, GObject* obj);
+
+///
+//Removes a game object from the sweep and prune
+//The object's proxy is found through the map and marked removed, so the endpoints stay in order,
+//And the next update compacts it and it's endpoints out.
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to remove the game object from
+//	obj: A pointer to the game object to remove
+void SweepAndPrune_Remove(SweepAndPrune* sap, GObject* obj);
+
+///
+//Updates the bounds of all game objects within the sweep and prune, re-sorts their endpoints on the sweep axis
+//And finds every pair of game objects whose bounds overlap.
+//The sweep is done along the axis which the objects are most spread out on.
+//The other axes are left as they are until the sweep moves to them, when they are sorted from the order they were last swept in.
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to update
+void SweepAndPrune_Update(SweepAndPrune* sap);
+
+///
+//Finds every game object in a sweep and prune whose bounds as of the last update overlap a box.
+//The endpoints on the last sweep axis are searched from the box's minimum less the largest bounds,
+//Before which no overlapping bounds can begin, so only the bounds near the box are tested.
+//
+//Parameters:
+//	sap: A pointer to the sweep and prune to query
+//	min: Array of 3 floats, the minimum bound of the box on each axis
+//	max: Array of 3 floats, the maximum bound of the box on each axis
+//	results: Dynamic array of GObject* to append the overlapping game objects to
+void SweepAndPrune_QueryBox(SweepAndPrune* sap, const float* min, const float* max, DynamicArray* results);
+
+#endif
@@ -0,0 +1,258 @@
+#include "ThreadPool.h"
+
+///
+//Allocates memory for a thread pool
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized thread pool
+ThreadPool* ThreadPool_Allocate(void)
+{
+	//The pool's mutex and condition variables must be constructed, so it cannot come from malloc
+	ThreadPool* pool = new ThreadPool;
+	return pool;
+}
+
+///
+//Initializes a thread pool, starting it's worker threads
+//
+//Parameters:
+//	pool: A pointer to the thread pool to initialize
+//	numThreads: The number of threads to perform each batch with, including the thread which runs it
+void ThreadPool_Initialize(ThreadPool* pool, unsigned int numThreads)
+{
+	pool->numThreads = numThreads > 0 ? numThreads : 1;
+
+	pool->function = NULL;
+	pool->data = NULL;
+	pool->numTasks = 0;
+	pool->ranges = new ThreadPool_TaskRange[pool->numThreads];
+	for(unsigned int i = 0; i < pool->numThreads; i++)
+	{
+		pool->ranges[i].tasks.store(0);
+	}
+
+	pool->numWorking = 0;
+	pool->batch = 0;
+	pool->shutdown = 0;
+
+	pool->workers = new std::thread[pool->numThreads - 1];
+	for(unsigned int i = 1; i < pool->numThreads; i++)
+	{
+		pool->workers[i - 1] = std::thread(ThreadPool_WorkerMain, pool, i);
+	}
+}
+
+///
+//Stops the worker threads of a thread pool and frees the pool.
+//Must not be called while a batch is running.
+//
+//Parameters:
+//	pool: A pointer to the thread pool to free
+void ThreadPool_Free(ThreadPool* pool)
+{
+	pool->mutex.lock();
+	pool->shutdown = 1;
+	pool->mutex.unlock();
+	pool->wake.notify_all();
+
+	for(unsigned int i = 1; i < pool->numThreads; i++)
+	{
+		pool->workers[i - 1].join();
+	}
+
+	delete[] pool->workers;
+	delete[] pool->ranges;
+	delete pool;
+}
+
+///
+//Performs a batch of tasks spread across the threads of a thread pool, returning once every task is done.
+//Each thread performs the tasks it owns or steals in increasing order of index,
+//But a thread may steal tasks with a lower index than ones it has performed, and tasks may finish in any order.
+//Must not be called from within a task.
+//
+//Parameters:
+//	pool: A pointer to the thread pool to run the batch on
+//	function: The function performing each task
+//	data: Data to pass to each call of function
+//	numTasks: The number of tasks in the batch
+void ThreadPool_Run(ThreadPool* pool, ThreadPool_TaskFunction function, void* data, unsigned int numTasks)
+{
+	//Waking the workers costs more than a single task, so small batches are performed on this thread
+	if(pool->numThreads == 1 || numTasks < 2)
+	{
+		for(unsigned int i = 0; i < numTasks; i++)
+		{
+			function(data, i, 0);
+		}
+		return;
+	}
+
+	pool->mutex.lock();
+	pool->function = function;
+	pool->data = data;
+	pool->numTasks = numTasks;
+
+	//Neighbouring tasks usually touch neighbouring data, so each thread starts with a contiguous share
+	for(unsigned int i = 0; i < pool->numThreads; i++)
+	{
+		unsigned long long first = (unsigned long long)numTasks * i / pool->numThreads;
+		unsigned long long end = (unsigned long long)numTasks * (i + 1) / pool->numThreads;
+		pool->ranges[i].tasks.store(first | (end << 32));
+	}
+	pool->numWorking = pool->numThreads - 1;
+	pool->batch++;
+	pool->mutex.unlock();
+	pool->wake.notify_all();
+
+	ThreadPool_PerformTasks(pool, 0);
+
+	//Wait for the tasks still being performed by workers
+	std::unique_lock<std::mutex> lock(pool->mutex);
+	while(pool->numWorking != 0)
+	{
+		pool->finished.wait(lock);
+	}
+}
+
+///
+//Gets the number of threads the hardware can run at once
+//
+//Returns:
+//	The number of hardware threads, at least 1
+unsigned int ThreadPool_GetNumHardwareThreads(void)
+{
+	//The standard allows 0 to be returned when the number cannot be determined
+	unsigned int numThreads = std::thread::hardware_concurrency();
+	return numThreads > 0 ? numThreads : 1;
+}
+
+///
+//The entry point of each worker thread.
+//Waits for a batch, performs tasks of the batch until none are left, then waits for the next.
+//
+//Parameters:
+//	pool: A pointer to the thread pool the worker belongs to
+//	threadIndex: The index of the worker, from 1 to the number of threads in the pool
+static void ThreadPool_WorkerMain(ThreadPool* pool, unsigned int threadIndex)
+{
+	//Workers start with no batch performed, even if a batch was run before this thread got the lock
+	unsigned int lastBatch = 0;
+	std::unique_lock<std::mutex> lock(pool->mutex);
+	while(true)
+	{
+		while(!pool->shutdown && pool->batch == lastBatch)
+		{
+			pool->wake.wait(lock);
+		}
+		if(pool->shutdown)
+		{
+			return;
+		}
+		lastBatch = pool->batch;
+
+		lock.unlock();
+		ThreadPool_PerformTasks(pool, threadIndex);
+		lock.lock();
+
+		pool->numWorking--;
+		if(pool->numWorking == 0)
+		{
+			pool->finished.notify_one();
+		}
+	}
+}
+
+///
+//Performs tasks of the current batch of a thread pool until none are left,
+//First from the thread's own range and then from ranges stolen from the other threads
+//
+//Parameters:
+//	pool: A pointer to the thread pool running the batch
+//	threadIndex: The index of the thread performing the tasks
+static void ThreadPool_PerformTasks(ThreadPool* pool, unsigned int threadIndex)
+{
+	//The batch's members are only written while every worker is waiting, so they can be read without the lock
+	ThreadPool_TaskFunction function = pool->function;
+	void* data = pool->data;
+	ThreadPool_TaskRange* range = pool->ranges + threadIndex;
+
+	unsigned int task;
+	do
+	{
+		while(ThreadPool_PopTask(range, &task))
+		{
+			function(data, task, threadIndex);
+		}
+	} while(ThreadPool_StealTasks(pool, threadIndex));
+}
+
+///
+//Takes the first task from a range of tasks
+//
+//Parameters:
+//	range: A pointer to the range to take the task from
+//	task: A pointer to store the index of the task in
+//
+//Returns:
+//	1 if a task was taken, 0 if the range is empty
+static unsigned char ThreadPool_PopTask(ThreadPool_TaskRange* range, unsigned int* task)
+{
+	unsigned long long tasks = range->tasks.load();
+	while(true)
+	{
+		unsigned int first = (unsigned int)tasks;
+		unsigned int end = (unsigned int)(tasks >> 32);
+		if(first >= end)
+		{
+			return 0;
+		}
+
+		//A failed exchange reloads tasks, as a thief may have shortened the range
+		if(range->tasks.compare_exchange_weak(tasks, (first + 1) | ((unsigned long long)end << 32)))
+		{
+			*task = first;
+			return 1;
+		}
+	}
+}
+
+///
+//Steals the back half of the tasks left to another thread of a pool, making them the range of the stealing thread.
+//Must only be called once the stealing thread's own range is empty.
+//
+//Parameters:
+//	pool: A pointer to the thread pool running the batch
+//	threadIndex: The index of the stealing thread
+//
+//Returns:
+//	1 if tasks were stolen, 0 if every other thread has run out of tasks
+static unsigned char ThreadPool_StealTasks(ThreadPool* pool, unsigned int threadIndex)
+{
+	//Start with the next thread so thieves spread out over the victims
+	for(unsigned int i = 1; i < pool->numThreads; i++)
+	{
+		ThreadPool_TaskRange* victim = pool->ranges + (threadIndex + i) % pool->numThreads;
+
+		unsigned long long tasks = victim->tasks.load();
+		while(true)
+		{
+			unsigned int first = (unsigned int)tasks;
+			unsigned int end = (unsigned int)(tasks >> 32);
+			if(first >= end)
+			{
+				break;
+			}
+
+			//Taking the back half leaves the victim the tasks it would reach next
+			unsigned int split = end - (end - first + 1) / 2;
+			if(victim->tasks.compare_exchange_weak(tasks, first | ((unsigned long long)split << 32)))
+			{
+				//Tasks are only ever handed out once, so thieves holding the old empty range can never exchange it
+				pool->ranges[threadIndex].tasks.store(split | ((unsigned long long)end << 32));
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
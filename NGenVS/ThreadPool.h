@@ -0,0 +1,136 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+//A function run once for each task of a batch
+//
+//Parameters:
+//	data: The data the batch was run with
+//	taskIndex: The index of the task to perform, from 0 to the number of tasks in the batch
+//	threadIndex: The index of the thread performing the task, 0 for the thread which ran the batch
+typedef void (*ThreadPool_TaskFunction)(void* data, unsigned int taskIndex, unsigned int threadIndex);
+
+//The tasks of the current batch waiting to be performed by one thread of a pool.
+//The first task and the end of the range are packed into one atomic so the owner can take a task from the front
+//While other threads steal half of the range from the back, each with a single compare and swap.
+struct ThreadPool_TaskRange
+{
+	std::atomic<unsigned long long> tasks;		//The first task in the low 32 bits, one past the last task in the high 32 bits
+	char padding[64 - sizeof(std::atomic<unsigned long long>)];	//Keeps each range on a cache line of it's own
+};
+
+//A fixed number of worker threads which perform batches of tasks.
+//The thread running a batch performs tasks alongside the workers, so a pool of n threads starts n - 1 workers.
+//Each thread starts a batch with an even, contiguous share of the tasks and steals from the other threads once it's share runs out.
+typedef struct ThreadPool
+{
+	unsigned int numThreads;				//Number of threads performing each batch, including the thread which runs it
+	std::thread* workers;					//Array of numThreads - 1 worker threads
+
+	std::mutex mutex;						//Guards every member below except ranges
+	std::condition_variable wake;			//Signalled when a batch starts or the pool shuts down
+	std::condition_variable finished;		//Signalled when the last worker finishes it's part of a batch
+
+	ThreadPool_TaskFunction function;		//The function performing each task of the current batch
+	void* data;								//The data the current batch was run with
+	unsigned int numTasks;					//The number of tasks in the current batch
+	struct ThreadPool_TaskRange* ranges;	//The tasks of the current batch left to each thread, indexed by thread
+
+	unsigned int numWorking;				//The number of workers still performing tasks of the current batch
+	unsigned int batch;						//Incremented each time a batch is run so workers can tell a new batch from a spurious wake
+	unsigned char shutdown;					//1 when the workers should exit
+} ThreadPool;
+
+//Internal functions
+
+///
+//The entry point of each worker thread.
+//Waits for a batch, performs tasks of the batch until none are left, then waits for the next.
+//
+//Parameters:
+//	pool: A pointer to the thread pool the worker belongs to
+//	threadIndex: The index of the worker, from 1 to the number of threads in the pool
+static void ThreadPool_WorkerMain(ThreadPool* pool, unsigned int threadIndex);
+
+///
+//Performs tasks of the current batch of a thread pool until none are left,
+//First from the thread's own range and then from ranges stolen from the other threads
+//
+//Parameters:
+//	pool: A pointer to the thread pool running the batch
+//	threadIndex: The index of the thread performing the tasks
+static void ThreadPool_PerformTasks(ThreadPool* pool, unsigned int threadIndex);
+
+///
+//Takes the first task from a range of tasks
+//
+//Parameters:
+//	range: A pointer to the range to take the task from
+//	task: A pointer to store the index of the task in
+//
+//Returns:
+//	1 if a task was taken, 0 if the range is empty
+static unsigned char ThreadPool_PopTask(struct ThreadPool_TaskRange* range, unsigned int* task);
+
+///
+//Steals the back half of the tasks left to another thread of a pool, making them the range of the stealing thread.
+//Must only be called once the stealing thread's own range is empty.
+//
+//Parameters:
+//	pool: A pointer to the thread pool running the batch
+//	threadIndex: The index of the stealing thread
+//
+//Returns:
+//	1 if tasks were stolen, 0 if every other thread has run out of tasks
+static unsigned char ThreadPool_StealTasks(ThreadPool* pool, unsigned int threadIndex);
+
+//Functions
+
+///
+//Allocates memory for a thread pool
+//
+//Returns:
+//	Pointer to a newly allocated uninitialized thread pool
+ThreadPool* ThreadPool_Allocate(void);
+
+///
+//Initializes a thread pool, starting it's worker threads
+//
+//Parameters:
+//	pool: A pointer to the thread pool to initialize
+//	numThreads: The number of threads to perform each batch with, including the thread which runs it
+void ThreadPool_Initialize(ThreadPool* pool, unsigned int numThreads);
+
+///
+//Stops the worker threads of a thread pool and frees the pool.
+//Must not be called while a batch is running.
+//
+//Parameters:
+//	pool: A pointer to the thread pool to free
+void ThreadPool_Free(ThreadPool* pool);
+
+///
+//Performs a batch of tasks spread across the threads of a thread pool, returning once every task is done.
+//Each thread performs the tasks it owns or steals in increasing order of index,
+//But a thread may steal tasks with a lower index than ones it has performed, and tasks may finish in any order.
+//Must not be called from within a task.
+//
+//Parameters:
+//	pool: A pointer to the thread pool to run the batch on
+//	function: The function performing each task
+//	data: Data to pass to each call of function
+//	numTasks: The number of tasks in the batch
+void ThreadPool_Run(ThreadPool* pool, ThreadPool_TaskFunction function, void* data, unsigned int numTasks);
+
+///
+//Gets the number of threads the hardware can run at once
+//
+//Returns:
+//	The number of hardware threads, at least 1
+unsigned int ThreadPool_GetNumHardwareThreads(void);
+
+#endif
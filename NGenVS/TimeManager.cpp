@@ -76,6 +76,11 @@ void TimeManager_TimeBuffer_Initialize(TimeBuffer* buffer)
 	buffer->deltaTime->QuadPart = 0L;
 
 	buffer->timeScale = 1.0f;
+
+	buffer->fixedTimeStep = TimeManager_defaultFixedTimeStep;
+	buffer->maxFixedSteps = TimeManager_defaultMaxFixedSteps;
+	buffer->accumulator = 0.0f;
+	buffer->numFixedSteps = 0;
 }
 
 ///
@@ -114,6 +119,17 @@ void TimeManager_UpdateBuffer(TimeBuffer* buffer)
 	buffer->elapsedTime->QuadPart = (buffer->elapsedTicks->QuadPart * 1000000.0) / buffer->ticksPerSecond->QuadPart;
 
 	buffer->previousTick->QuadPart = currentTick.QuadPart;
+
+	//Accumulate the scaled time and take as many whole fixed steps as it holds
+	buffer->accumulator += buffer->deltaTime->QuadPart / 1000000.0f;
+	buffer->numFixedSteps = (unsigned int)(buffer->accumulator / buffer->fixedTimeStep);
+	if(buffer->numFixedSteps > buffer->maxFixedSteps)
+	{
+		//Drop the time which cannot be simulated rather than falling further behind
+		buffer->numFixedSteps = buffer->maxFixedSteps;
+		buffer->accumulator = buffer->fixedTimeStep * buffer->maxFixedSteps;
+	}
+	buffer->accumulator -= buffer->numFixedSteps * buffer->fixedTimeStep;
 }
 
 
@@ -147,4 +163,66 @@ void TimeManager_ScaleTimeScale(float scale)
 float TimeManager_GetDeltaSec(void)
 {
 	return timeBuffer->deltaTime->QuadPart / 1000000.0f;
+}
+
+///
+//Sets the time manager's fixed time step
+//
+//Parameters:
+//	seconds: The number of seconds each fixed step simulates, must be greater than 0
+void TimeManager_SetFixedTimeStep(float seconds)
+{
+	if(seconds <= 0.0f)
+	{
+		printf("TimeManager_SetFixedTimeStep failed! Step must be greater than 0. Fixed time step not changed.\n");
+		return;
+	}
+	timeBuffer->fixedTimeStep = seconds;
+}
+
+///
+//Sets the most fixed steps the time manager will take in one update.
+//When an update takes longer than this many steps the extra time is dropped,
+//So a slow frame cannot cause more steps which make the next frame slower still.
+//
+//Parameters:
+//	maxSteps: The most fixed steps to take in one update, must be at least 1
+void TimeManager_SetMaxFixedSteps(unsigned int maxSteps)
+{
+	if(maxSteps == 0)
+	{
+		printf("TimeManager_SetMaxFixedSteps failed! At least 1 step must be allowed. Max fixed steps not changed.\n");
+		return;
+	}
+	timeBuffer->maxFixedSteps = maxSteps;
+}
+
+///
+//Gets the fixed time step in seconds as a single floating point
+//
+//Returns:
+//	Number of seconds each fixed step simulates
+float TimeManager_GetFixedDeltaSec(void)
+{
+	return timeBuffer->fixedTimeStep;
+}
+
+///
+//Gets the number of fixed steps which fit in the time accumulated up to the last update
+//
+//Returns:
+//	Number of fixed steps to take this update, possibly 0
+unsigned int TimeManager_GetNumFixedSteps(void)
+{
+	return timeBuffer->numFixedSteps;
+}
+
+///
+//Gets how far the time of the last update is between the last fixed step and the next
+//
+//Returns:
+//	The time left over after the fixed steps as a fraction of the fixed time step, from 0 to 1
+float TimeManager_GetFixedStepInterpolation(void)
+{
+	return timeBuffer->accumulator / timeBuffer->fixedTimeStep;
 }
\ No newline at end of file
@@ -22,11 +22,19 @@ typedef struct TimeBuffer
 
 	float timeScale;
 
+	float fixedTimeStep;			//Seconds of simulated time advanced by each fixed step
+	unsigned int maxFixedSteps;		//Most fixed steps taken in one update, time beyond them is dropped
+	float accumulator;				//Seconds of scaled time which have passed but not been taken as fixed steps
+	unsigned int numFixedSteps;		//Number of fixed steps to take for the last update
+
 } TimeBuffer;
 
 //Internals
 static TimeBuffer* timeBuffer;
 
+static const float TimeManager_defaultFixedTimeStep = 1.0f / 120.0f;	//Seconds per fixed step, physics runs at 120Hz
+static const unsigned int TimeManager_defaultMaxFixedSteps = 8;			//Fixed steps an update may take before time is dropped
+
 //Functions
 
 ///
@@ -100,6 +108,43 @@ void TimeManager_ScaleTimeScale(float scale);
 //	Number of seconds since last update
 float TimeManager_GetDeltaSec(void);
 
+///
+//Sets the time manager's fixed time step
+//
+//Parameters:
+//	seconds: The number of seconds each fixed step simulates, must be greater than 0
+void TimeManager_SetFixedTimeStep(float seconds);
+
+///
+//Sets the most fixed steps the time manager will take in one update.
+//When an update takes longer than this many steps the extra time is dropped,
+//So a slow frame cannot cause more steps which make the next frame slower still.
+//
+//Parameters:
+//	maxSteps: The most fixed steps to take in one update, must be at least 1
+void TimeManager_SetMaxFixedSteps(unsigned int maxSteps);
+
+///
+//Gets the fixed time step in seconds as a single floating point
+//
+//Returns:
+//	Number of seconds each fixed step simulates
+float TimeManager_GetFixedDeltaSec(void);
+
+///
+//Gets the number of fixed steps which fit in the time accumulated up to the last update
+//
+//Returns:
+//	Number of fixed steps to take this update, possibly 0
+unsigned int TimeManager_GetNumFixedSteps(void);
+
+///
+//Gets how far the time of the last update is between the last fixed step and the next
+//
+//Returns:
+//	The time left over after the fixed steps as a fraction of the fixed time step, from 0 to 1
+float TimeManager_GetFixedStepInterpolation(void);
+
 
 
 #endif	//If not defined
@@ -0,0 +1,242 @@
+#include <math.h>
+#include <stdio.h>
+
+#include "Vec3.h"
+
+///
+//Initializes a Vec3_Storage binding it's Vector header to it's value and zeroing the value
+//
+//Parameters:
+//	storage: The storage to initialize
+//
+//Returns:
+//	A pointer to the bound Vector header
+Vector* Vec3_Storage_Initialize(Vec3_Storage* storage)
+{
+	Vec3_INIT_VECTOR_VIEW(storage->vector, storage->value);
+	Vec3_Zero(&storage->value);
+	return &storage->vector;
+}
+
+///
+//Sets the components of a Vec3
+//
+//Parameters:
+//	dest: The Vec3 to set
+//	x: The first component
+//	y: The second component
+//	z: The third component
+void Vec3_Set(Vec3* dest, const float x, const float y, const float z)
+{
+	dest->components[0] = x;
+	dest->components[1] = y;
+	dest->components[2] = z;
+}
+
+///
+//Sets all components of a Vec3 to 0
+//
+//Parameters:
+//	vec: The Vec3 being zeroed
+void Vec3_Zero(Vec3* vec)
+{
+	vec->components[0] = 0.0f;
+	vec->components[1] = 0.0f;
+	vec->components[2] = 0.0f;
+}
+
+///
+//Copies a Vec3
+//
+//Parameters:
+//	dest: The destination of the copy
+//	src: The Vec3 to copy
+void Vec3_Copy(Vec3* dest, const Vec3* src)
+{
+	dest->components[0] = src->components[0];
+	dest->components[1] = src->components[1];
+	dest->components[2] = src->components[2];
+}
+
+///
+//Determines the magnitude^2 of a Vec3
+//
+//Parameters:
+//	vec: The Vec3 to find the mag squared of
+float Vec3_GetMagSq(const Vec3* vec)
+{
+	return vec->components[0] * vec->components[0] + vec->components[1] * vec->components[1] + vec->components[2] * vec->components[2];
+}
+
+///
+//Determines the magnitude of a Vec3
+//
+//Parameters:
+//	vec: The Vec3 to find the magnitude of
+float Vec3_GetMag(const Vec3* vec)
+{
+	return sqrtf(Vec3_GetMagSq(vec));
+}
+
+///
+//Normalizes a Vec3
+//A Vec3 with a magnitude of 0 is left unchanged
+//
+//Parameters:
+//	vec: The Vec3 to normalize
+void Vec3_Normalize(Vec3* vec)
+{
+	float mag = Vec3_GetMag(vec);
+	if(mag != 0.0f)
+	{
+		vec->components[0] /= mag;
+		vec->components[1] /= mag;
+		vec->components[2] /= mag;
+	}
+}
+
+///
+//Gets the dot product of two Vec3s
+//
+//Parameters:
+//	vec1: Vec3 being dotted
+//	vec2: Other Vec3 being dotted
+//
+//Returns:
+//	Float representing value of the dot product
+float Vec3_DotProduct(const Vec3* vec1, const Vec3* vec2)
+{
+	return vec1->components[0] * vec2->components[0] + vec1->components[1] * vec2->components[1] + vec1->components[2] * vec2->components[2];
+}
+
+///
+//Gets the cross product of two Vec3s
+//
+//Parameters:
+//	dest: The destination of the cross product result
+//	vec1: The left hand side of the cross product
+//	vec2: The right hand side of the cross product
+void Vec3_CrossProduct(Vec3* dest, const Vec3* vec1, const Vec3* vec2)
+{
+	//Compute into temporaries so dest may alias either operand
+	float x = vec1->components[1] * vec2->components[2] - vec1->components[2] * vec2->components[1];
+	float y = vec1->components[2] * vec2->components[0] - vec1->components[0] * vec2->components[2];
+	float z = vec1->components[0] * vec2->components[1] - vec1->components[1] * vec2->components[0];
+
+	dest->components[0] = x;
+	dest->components[1] = y;
+	dest->components[2] = z;
+}
+
+///
+//Increments a Vec3 by another Vec3
+//
+//Parameters:
+//	dest: The Vec3 getting incremented
+//	src: The Vec3 being added to the destination
+void Vec3_Increment(Vec3* dest, const Vec3* src)
+{
+	dest->components[0] += src->components[0];
+	dest->components[1] += src->components[1];
+	dest->components[2] += src->components[2];
+}
+
+///
+//Decrements a Vec3 by another Vec3
+//
+//Parameters:
+//	dest: The Vec3 getting decremented
+//	src: The Vec3 being subtracted from the destination
+void Vec3_Decrement(Vec3* dest, const Vec3* src)
+{
+	dest->components[0] -= src->components[0];
+	dest->components[1] -= src->components[1];
+	dest->components[2] -= src->components[2];
+}
+
+///
+//Scales a Vec3 by a scalar
+//
+//Parameters:
+//	vec: The Vec3 to be scaled
+//	scaleValue: The scale factor
+void Vec3_Scale(Vec3* vec, const float scaleValue)
+{
+	vec->components[0] *= scaleValue;
+	vec->components[1] *= scaleValue;
+	vec->components[2] *= scaleValue;
+}
+
+///
+//Gets the scalar product of a Vec3 and a scalar
+//
+//Parameters:
+//	dest: The destination of the scaled Vec3
+//	src: The Vec3 to be scaled
+//	scaleValue: The scale factor
+void Vec3_GetScalarProduct(Vec3* dest, const Vec3* src, const float scaleValue)
+{
+	dest->components[0] = src->components[0] * scaleValue;
+	dest->components[1] = src->components[1] * scaleValue;
+	dest->components[2] = src->components[2] * scaleValue;
+}
+
+///
+//Adds together two Vec3s retrieving the sum
+//
+//Parameters:
+//	dest: The destination of the sum
+//	vec1: The first addend
+//	vec2: The second addend
+void Vec3_Add(Vec3* dest, const Vec3* vec1, const Vec3* vec2)
+{
+	dest->components[0] = vec1->components[0] + vec2->components[0];
+	dest->components[1] = vec1->components[1] + vec2->components[1];
+	dest->components[2] = vec1->components[2] + vec2->components[2];
+}
+
+///
+//Subtracts vec2 from vec1 retrieving the difference
+//
+//Parameters:
+//	dest: The destination of the difference
+//	vec1: The minuend
+//	vec2: The subtrahend
+void Vec3_Subtract(Vec3* dest, const Vec3* vec1, const Vec3* vec2)
+{
+	dest->components[0] = vec1->components[0] - vec2->components[0];
+	dest->components[1] = vec1->components[1] - vec2->components[1];
+	dest->components[2] = vec1->components[2] - vec2->components[2];
+}
+
+///
+//Projects vec1 onto vec2 and stores the result in the destination
+//
+//Parameters:
+//	dest: The destination of the projected Vec3
+//	vec1: The Vec3 being projected
+//	vec2: The Vec3 representing the projection axis
+void Vec3_GetProjection(Vec3* dest, const Vec3* vec1, const Vec3* vec2)
+{
+	float numerator = Vec3_DotProduct(vec1, vec2);
+	float denominator = Vec3_GetMagSq(vec2);
+	if(numerator == 0.0f || denominator == 0.0f)
+	{
+		//Return 0 vector
+		Vec3_Zero(dest);
+	}
+	else
+	{
+		Vec3_GetScalarProduct(dest, vec2, numerator / denominator);
+	}
+}
+
+///
+//Prints out the contents of a Vec3
+//
+//Parameters:
+//	vec: The Vec3 to print
+void Vec3_Print(const Vec3* vec)
+{
+	printf("%f\n%f\n%f\n", vec->components[0], vec->components[1], vec->components[2]);
+}
@@ -0,0 +1,176 @@
+#ifndef VEC3_H
+#define VEC3_H
+
+#include "Vector.h"
+
+///
+//A Vec3 is a fixed size, 3 component vector stored by value.
+//Unlike a Vector it owns it's components inline and never touches the heap,
+//Making it suitable for members of hot structures and for temporaries in tight loops.
+typedef struct Vec3
+{
+	float components[3];
+} Vec3;
+
+///
+//A Vector header bundled with the Vec3 it views.
+//Embedding one of these lets a structure hand out a Vector* without a separate heap allocation.
+typedef struct Vec3_Storage
+{
+	Vector vector;
+	Vec3 value;
+} Vec3_Storage;
+
+//Views the components of a 3 dimensional Vector as a Vec3
+#define Vec3_FROM_VECTOR( vecPtr ) ((Vec3*)(vecPtr)->components)
+
+//Binds a Vector header to the components of a Vec3 so the Vector_* functions can operate on it in place
+#define Vec3_INIT_VECTOR_VIEW( vec , vec3 ) \
+	vec.dimension = 3; \
+	vec.components = (vec3).components;
+
+///
+//Initializes a Vec3_Storage binding it's Vector header to it's value and zeroing the value
+//
+//Parameters:
+//	storage: The storage to initialize
+//
+//Returns:
+//	A pointer to the bound Vector header
+Vector* Vec3_Storage_Initialize(Vec3_Storage* storage);
+
+///
+//Sets the components of a Vec3
+//
+//Parameters:
+//	dest: The Vec3 to set
+//	x: The first component
+//	y: The second component
+//	z: The third component
+void Vec3_Set(Vec3* dest, const float x, const float y, const float z);
+
+///
+//Sets all components of a Vec3 to 0
+//
+//Parameters:
+//	vec: The Vec3 being zeroed
+void Vec3_Zero(Vec3* vec);
+
+///
+//Copies a Vec3
+//
+//Parameters:
+//	dest: The destination of the copy
+//	src: The Vec3 to copy
+void Vec3_Copy(Vec3* dest, const Vec3* src);
+
+///
+//Determines the magnitude^2 of a Vec3
+//
+//Parameters:
+//	vec: The Vec3 to find the mag squared of
+float Vec3_GetMagSq(const Vec3* vec);
+
+///
+//Determines the magnitude of a Vec3
+//
+//Parameters:
+//	vec: The Vec3 to find the magnitude of
+float Vec3_GetMag(const Vec3* vec);
+
+///
+//Normalizes a Vec3
+//A Vec3 with a magnitude of 0 is left unchanged
+//
+//Parameters:
+//	vec: The Vec3 to normalize
+void Vec3_Normalize(Vec3* vec);
+
+///
+//Gets the dot product of two Vec3s
+//
+//Parameters:
+//	vec1: Vec3 being dotted
+//	vec2: Other Vec3 being dotted
+//
+//Returns:
+//	Float representing value of the dot product
+float Vec3_DotProduct(const Vec3* vec1, const Vec3* vec2);
+
+///
+//Gets the cross product of two Vec3s
+//
+//Parameters:
+//	dest: The destination of the cross product result
+//	vec1: The left hand side of the cross product
+//	vec2: The right hand side of the cross product
+void Vec3_CrossProduct(Vec3* dest, const Vec3* vec1, const Vec3* vec2);
+
+///
+//Increments a Vec3 by another Vec3
+//
+//Parameters:
+//	dest: The Vec3 getting incremented
+//	src: The Vec3 being added to the destination
+void Vec3_Increment(Vec3* dest, const Vec3* src);
+
+///
+//Decrements a Vec3 by another Vec3
+//
+//Parameters:
+//	dest: The Vec3 getting decremented
+//	src: The Vec3 being subtracted from the destination
+void Vec3_Decrement(Vec3* dest, const Vec3* src);
+
+///
+//Scales a Vec3 by a scalar
+//
+//Parameters:
+//	vec: The Vec3 to be scaled
+//	scaleValue: The scale factor
+void Vec3_Scale(Vec3* vec, const float scaleValue);
+
+///
+//Gets the scalar product of a Vec3 and a scalar
+//
+//Parameters:
+//	dest: The destination of the scaled Vec3
+//	src: The Vec3 to be scaled
+//	scaleValue: The scale factor
+void Vec3_GetScalarProduct(Vec3* dest, const Vec3* src, const float scaleValue);
+
+///
+//Adds together two Vec3s retrieving the sum
+//
+//Parameters:
+//	dest: The destination of the sum
+//	vec1: The first addend
+//	vec2: The second addend
+void Vec3_Add(Vec3* dest, const Vec3* vec1, const Vec3* vec2);
+
+///
+//Subtracts vec2 from vec1 retrieving the difference
+//
+//Parameters:
+//	dest: The destination of the difference
+//	vec1: The minuend
+//	vec2: The subtrahend
+void Vec3_Subtract(Vec3* dest, const Vec3* vec1, const Vec3* vec2);
+
+///
+//Projects vec1 onto vec2 and stores the result in the destination
+//
+//Parameters:
+//	dest: The destination of the projected Vec3
+//	vec1: The Vec3 being projected
+//	vec2: The Vec3 representing the projection axis
+void Vec3_GetProjection(Vec3* dest, const Vec3* vec1, const Vec3* vec2);
+
+///
+//Prints out the contents of a Vec3
+//
+//Parameters:
+//	vec: The Vec3 to print
+void Vec3_Print(const Vec3* vec);
+
+#endif
@@ -5,6 +5,7 @@
 
 //#include "Vector.h"
 #include "Matrix.h"
+#include "SIMDMath.h"
 
 
 ///
@@ -173,6 +174,10 @@ void Vector_NormalizeArray(float* vec, const int dim)
 //	Float representing value of the dot product
 float Vector_DotProductArray(const float* vec1, const float* vec2, const int dim)
 {
+	//Use the specialized kernels for the common dimensions
+	if (dim == 3) return SIMDMath_DotProduct3(vec1, vec2);
+	if (dim == 4) return SIMDMath_DotProduct4(vec1, vec2);
+
 	float dotProd = 0.0f;
 
 	for (int i = 0; i < dim; i++)
@@ -389,6 +394,18 @@ void Vector_GetScalarProduct(Vector* dest, const Vector* src, const float scaleV
 //	dim: the dimension of the Vectors being added
 void Vector_AddArray(float* dest, const float* vec1, const float* vec2, const int dim)
 {
+	//Use the specialized kernels for the common dimensions
+	if (dim == 3)
+	{
+		SIMDMath_Add3(dest, vec1, vec2);
+		return;
+	}
+	if (dim == 4)
+	{
+		SIMDMath_Add4(dest, vec1, vec2);
+		return;
+	}
+
 	for (int row = 0; row < dim; row++)
 	{
 		dest[row] = vec1[row] + vec2[row];
@@ -27,6 +27,8 @@
 #include "TimeManager.h"
 #include "PhysicsManager.h"
 #include "CollisionManager.h"
+#include "JobManager.h"
+#include "Benchmark.h"
 
 #include "ScoreState.h"
 #include "ResetState.h"
@@ -125,6 +127,8 @@ void InitializeScene(void)
 	RigidBody_Initialize(cam->body, cam->frameOfReference, 1.0f);
 	cam->body->coefficientOfRestitution = 0.0f;
 	cam->body->dynamicFriction = 0.5f;
+	//The runner is fast enough to pass through thin pillars between steps
+	cam->body->continuousCollision = 1;
 
 	//Attach character controller state
 	State* state = State_Allocate();
@@ -185,6 +189,7 @@ void Init(void)
 {
 
 	//Initialize managers
+	JobManager_Initialize();
 	InputManager_Initialize();
 	RenderingManager_Initialize();
 	AssetManager_Initialize();
@@ -335,7 +340,7 @@ void CalculateOctTreeCollisions(OctTree_Node* node)
 	{
 		if(node->data->size != 0)
 		{
-			LinkedList* collisions = CollisionManager_UpdateArray((GObject**)node->data->data, node->data->size);
+			DynamicArray* collisions = CollisionManager_UpdateArray((GObject**)node->data->data, node->data->size);
 			PhysicsManager_ResolveCollisions(collisions);
 		}
 	}
@@ -374,7 +379,7 @@ void Update(void)
 	{
 		TimeManager_SetTimeScale(1.0f);
 	}
-	if (InputManager_IsKeyDown('r') || InputManager_IsKeyDown('y') || InputManager_IsKeyDown('o') || InputManager_IsKeyDown('p'))
+	if (InputManager_IsKeyDown('r') || InputManager_IsKeyDown('y') || InputManager_IsKeyDown('o') || InputManager_IsKeyDown('p') || InputManager_IsKeyDown('b') || InputManager_IsKeyDown('n') || InputManager_IsKeyDown('h') || InputManager_IsKeyDown('k') || InputManager_IsKeyDown('l') || InputManager_IsKeyDown('u') || InputManager_IsKeyDown('e') || InputManager_IsKeyDown('8') || InputManager_IsKeyDown('9') || InputManager_IsKeyDown('j') || InputManager_IsKeyDown('v') || InputManager_IsKeyDown('x') || InputManager_IsKeyDown('z') || InputManager_IsKeyDown('f') || InputManager_IsKeyDown('0') || InputManager_IsKeyDown('[') || InputManager_IsKeyDown(']') || InputManager_IsKeyDown('7') || InputManager_IsKeyDown(';'))
 	{
 		if (keyTrigger == 0)
 		{
@@ -394,6 +399,103 @@ void Update(void)
 			{
 				RenderingManager_GetRenderingBuffer()->debugOctTree = 1;
 			}
+			else if (InputManager_IsKeyDown('b'))
+			{
+				//Report allocations and time per physics step
+				Benchmark_PhysicsStep(100);
+			}
+			else if (InputManager_IsKeyDown(']'))
+			{
+				//Compare the math kernels against the general loops
+				Benchmark_MathKernels(10000);
+			}
+			else if (InputManager_IsKeyDown('n'))
+			{
+				//Report allocations and time of the narrow phase alone
+				Benchmark_NarrowPhase(100);
+			}
+			else if (InputManager_IsKeyDown('h'))
+			{
+				//Compare SAT against GJK on convex hulls with more and more points
+				Benchmark_ConvexHullTests(100);
+			}
+			else if (InputManager_IsKeyDown('k'))
+			{
+				ObjectManager_SetBroadPhase(BROADPHASE_OCTTREE);
+				printf("Broad phase: oct tree\n");
+			}
+			else if (InputManager_IsKeyDown('l'))
+			{
+				ObjectManager_SetBroadPhase(BROADPHASE_SWEEPANDPRUNE);
+				printf("Broad phase: sweep and prune\n");
+			}
+			else if (InputManager_IsKeyDown('u'))
+			{
+				ObjectManager_SetBroadPhase(BROADPHASE_AABBTREE);
+				printf("Broad phase: AABB tree\n");
+			}
+			else if (InputManager_IsKeyDown('e'))
+			{
+				ObjectManager_SetBroadPhase(BROADPHASE_LOOSEOCTTREE);
+				printf("Broad phase: loose oct tree\n");
+			}
+			else if (InputManager_IsKeyDown('8'))
+			{
+				ObjectManager_SetBroadPhase(BROADPHASE_LINEAROCTTREE);
+				printf("Broad phase: linear oct tree\n");
+			}
+			else if (InputManager_IsKeyDown('j'))
+			{
+				//Compare the broad phases on the current scene
+				Benchmark_BroadPhase(100);
+			}
+			else if (InputManager_IsKeyDown('v'))
+			{
+				//Toggle spreading the narrow phase and body integration across every hardware thread
+				JobManager_SetNumThreads(JobManager_GetNumThreads() > 1 ? 1 : ThreadPool_GetNumHardwareThreads());
+				printf("Job threads: %u\n", JobManager_GetNumThreads());
+			}
+			else if (InputManager_IsKeyDown('x'))
+			{
+				//Time the narrow phase on a stress scene with more and more threads
+				Benchmark_NarrowPhaseThreads(1000, 10);
+			}
+			else if (InputManager_IsKeyDown('9'))
+			{
+				//Compare relocating objects in the oct trees against rebuilding the linear oct tree when every object moves
+				Benchmark_MovingBroadPhase(10000, 10);
+			}
+			else if (InputManager_IsKeyDown('f'))
+			{
+				//Time integrating a stress scene of bodies with more and more threads
+				Benchmark_IntegrationThreads(10000, 100);
+			}
+			else if (InputManager_IsKeyDown('0'))
+			{
+				//Time the hash map under the oct tree's pattern of adding, looking up and removing objects
+				Benchmark_HashMap(10000, 100);
+			}
+			else if (InputManager_IsKeyDown('['))
+			{
+				//Time the dynamic array under the loader's appends and the oct tree's removals
+				Benchmark_DynamicArray(100000, 100);
+			}
+			else if (InputManager_IsKeyDown('7'))
+			{
+				//Check that swept bodies slide across the seams of a floor built from boxes but still stop at walls
+				Benchmark_SweptTileSeams(100000);
+			}
+			else if (InputManager_IsKeyDown(';'))
+			{
+				//Time the SSE integration kernels against the per body loops they replaced
+				Benchmark_IntegrationKernels(10000, 100);
+			}
+			else if (InputManager_IsKeyDown('z'))
+			{
+				//Toggle between the sequential impulse solver and resolving each collision once
+				PhysicsManager_SetSolver(PhysicsManager_GetSolver() == SOLVER_SEQUENTIALIMPULSE ? SOLVER_DECOUPLE : SOLVER_SEQUENTIALIMPULSE);
+				printf("Collision solver: %s\n", PhysicsManager_GetSolver() == SOLVER_SEQUENTIALIMPULSE ? "sequential impulse" : "decouple");
+			}
 		}
 		keyTrigger = 1;
 	}
@@ -405,21 +507,53 @@ void Update(void)
 
 
 
-	PhysicsManager_Update(ObjectManager_GetObjectBuffer().gameObjects);
+	//Step physics at a fixed rate, as many times as the time since the last update holds
+	unsigned int numSteps = TimeManager_GetNumFixedSteps();
+	for(unsigned int i = 0; i < numSteps; i++)
+	{
+		PhysicsManager_Update(ObjectManager_GetObjectBuffer().objects[GOBJECT_ARRAY_BODIES]);
+
+		//Update the broad phase
+		ObjectManager_UpdateBroadPhase();
 
-	//Update the oct tree
-	ObjectManager_UpdateOctTree();
+		//The colliders let go of the last step's collisions before they are freed
+		ObjectManager_ClearCollisions();
 
-	//LinkedList* collisions = CollisionManager_UpdateList(ObjectManager_GetObjectBuffer().gameObjects);
+		//DynamicArray* collisions = CollisionManager_UpdateArray((GObject**)ObjectManager_GetObjectBuffer().objects[GOBJECT_ARRAY_COLLIDERS]->data, ObjectManager_GetObjectBuffer().objects[GOBJECT_ARRAY_COLLIDERS]->size);
 
-	//OctTree_Node* octTreeRoot = ObjectManager_GetObjectBuffer().octTree->root;
-	//CalculateOctTreeCollisions(octTreeRoot);
+		//OctTree_Node* octTreeRoot = ObjectManager_GetObjectBuffer().octTree->root;
+		//CalculateOctTreeCollisions(octTreeRoot);
 
-	LinkedList* collisions = CollisionManager_UpdateOctTree(ObjectManager_GetObjectBuffer().octTree);
+		DynamicArray* collisions;
+		switch(ObjectManager_GetObjectBuffer().broadPhase)
+		{
+		case BROADPHASE_SWEEPANDPRUNE:
+			collisions = CollisionManager_UpdateSweepAndPrune(ObjectManager_GetObjectBuffer().sweepAndPrune);
+			break;
+		case BROADPHASE_AABBTREE:
+			collisions = CollisionManager_UpdateAABBTree(ObjectManager_GetObjectBuffer().aabbTree);
+			break;
+		case BROADPHASE_LOOSEOCTTREE:
+			collisions = CollisionManager_UpdateOctTree(ObjectManager_GetObjectBuffer().looseOctTree);
+			break;
+		case BROADPHASE_LINEAROCTTREE:
+			collisions = CollisionManager_UpdateLinearOctTree(ObjectManager_GetObjectBuffer().linearOctTree);
+			break;
+		default:
+			collisions = CollisionManager_UpdateOctTree(ObjectManager_GetObjectBuffer().octTree);
+			break;
+		}
+
+
+		//Pass collisions to physics manager to be resolved
+		PhysicsManager_ResolveCollisions(collisions);
+	}
 
+	//The forces states applied this frame have been applied by each of it's steps
+	PhysicsManager_ClearForces();
 
-	//Pass collisions to physics manager to be resolved
-	PhysicsManager_ResolveCollisions(collisions);
+	//Draw objects part way between their last two physics states by the time left over
+	PhysicsManager_InterpolateObjects(ObjectManager_GetObjectBuffer().objects[GOBJECT_ARRAY_BODIES], TimeManager_GetFixedStepInterpolation());
 
 	//Update input
 	InputManager_Update();
@@ -440,7 +574,7 @@ void DrawLoop(int val)
 //Draws the current state of the engine
 void Draw(void)
 {
-	RenderingManager_Render(ObjectManager_GetObjectBuffer().gameObjects);
+	RenderingManager_Render(ObjectManager_GetObjectBuffer().objects[GOBJECT_ARRAY_MESHES], ObjectManager_GetObjectBuffer().objects[GOBJECT_ARRAY_COLLIDERS]);
 }
 
 
@@ -501,6 +635,7 @@ int main(int argc, char* argv[])
 	CollisionManager_Free();
 	PhysicsManager_Free();
 	TimeManager_Free();
+	JobManager_Free();
 
 	return 0;
 }
\ No newline at end of file